@@ -21,6 +21,7 @@
 #include "drake/geometry/geometry_properties.h"
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/meshcat.h"
+#include "drake/geometry/meshcat_animation.h"
 #include "drake/geometry/meshcat_visualizer.h"
 #include "drake/geometry/optimization/cartesian_product.h"
 #include "drake/geometry/optimization/hpolyhedron.h"
@@ -770,6 +771,10 @@ void DoScalarDependentDefinitions(py::module m, T) {
             &QueryObject<T>::ComputeSignedDistanceToPoint, py::arg("p_WQ"),
             py::arg("threshold") = std::numeric_limits<double>::infinity(),
             cls_doc.ComputeSignedDistanceToPoint.doc)
+        .def("ComputeSignedDistanceToPoints",
+            &QueryObject<T>::ComputeSignedDistanceToPoints, py::arg("p_WQs"),
+            py::arg("threshold") = std::numeric_limits<double>::infinity(),
+            cls_doc.ComputeSignedDistanceToPoints.doc)
         .def("FindCollisionCandidates",
             &QueryObject<T>::FindCollisionCandidates,
             cls_doc.FindCollisionCandidates.doc)
@@ -858,6 +863,27 @@ void DoScalarDependentDefinitions(py::module m, T) {
             doc.SignedDistanceToPoint.grad_W.doc);
   }
 
+  // SignedDistanceToPointBatch
+  {
+    using Class = SignedDistanceToPointBatch<T>;
+    constexpr auto& cls_doc = doc.SignedDistanceToPointBatch;
+    auto cls = DefineTemplateClassWithDefault<Class>(
+        m, "SignedDistanceToPointBatch", param, cls_doc.doc);
+    cls  // BR
+        .def(py::init<>(), cls_doc.ctor.doc)
+        .def("num_points", &Class::num_points, cls_doc.num_points.doc)
+        .def("num_results", &Class::num_results, cls_doc.num_results.doc)
+        .def("result", &Class::result, py::arg("k"), cls_doc.result.doc)
+        .def_readwrite("offsets", &Class::offsets, cls_doc.offsets.doc)
+        .def_readwrite("id_G", &Class::id_G, cls_doc.id_G.doc)
+        .def_readwrite("p_GN", &Class::p_GN,
+            return_value_policy_for_scalar_type<T>(), cls_doc.p_GN.doc)
+        .def_readwrite("distance", &Class::distance,
+            return_value_policy_for_scalar_type<T>(), cls_doc.distance.doc)
+        .def_readwrite("grad_W", &Class::grad_W,
+            return_value_policy_for_scalar_type<T>(), cls_doc.grad_W.doc);
+  }
+
   // PenetrationAsPointPair
   {
     using Class = PenetrationAsPointPair<T>;
@@ -976,6 +1002,17 @@ void DoScalarDependentDefinitions(py::module m, T) {
             // `meshcat` is a shared_ptr, so does not need a keep_alive.
             cls_doc.ctor.doc)
         .def("Delete", &Class::Delete, cls_doc.Delete.doc)
+        .def("StartRecording", &Class::StartRecording,
+            py::arg("set_transforms_while_recording") = true,
+            py_rvp::reference_internal, cls_doc.StartRecording.doc)
+        .def("StopRecording", &Class::StopRecording,
+            cls_doc.StopRecording.doc)
+        .def("PublishRecording", &Class::PublishRecording,
+            cls_doc.PublishRecording.doc)
+        .def("DeleteRecording", &Class::DeleteRecording,
+            cls_doc.DeleteRecording.doc)
+        .def("get_recording", &Class::get_recording,
+            py_rvp::reference_internal, cls_doc.get_recording.doc)
         .def("query_object_input_port", &Class::query_object_input_port,
             py_rvp::reference_internal, cls_doc.query_object_input_port.doc)
         .def_static("AddToBuilder",
@@ -1147,13 +1184,27 @@ void DoScalarIndependentDefinitions(py::module m) {
         .def_readwrite("role", &DrakeVisualizerParams::role, cls_doc.role.doc)
         .def_readwrite("default_color", &DrakeVisualizerParams::default_color,
             cls_doc.default_color.doc)
+        .def_readwrite("publish_changed_poses_only",
+            &DrakeVisualizerParams::publish_changed_poses_only,
+            cls_doc.publish_changed_poses_only.doc)
+        .def_readwrite("pose_change_tolerance",
+            &DrakeVisualizerParams::pose_change_tolerance,
+            cls_doc.pose_change_tolerance.doc)
+        .def_readwrite("full_draw_period",
+            &DrakeVisualizerParams::full_draw_period,
+            cls_doc.full_draw_period.doc)
         .def("__repr__", [](const Class& self) {
           return py::str(
               "DrakeVisualizerParams("
               "publish_period={}, "
               "role={}, "
-              "default_color={})")
-              .format(self.publish_period, self.role, self.default_color);
+              "default_color={}, "
+              "publish_changed_poses_only={}, "
+              "pose_change_tolerance={}, "
+              "full_draw_period={})")
+              .format(self.publish_period, self.role, self.default_color,
+                  self.publish_changed_poses_only, self.pose_change_tolerance,
+                  self.full_draw_period);
         });
   }
 
@@ -1555,6 +1606,12 @@ void DoScalarIndependentDefinitions(py::module m) {
       &AddSoftHydroelasticPropertiesForHalfSpace, py::arg("slab_thickness"),
       py::arg("properties"), doc.AddSoftHydroelasticPropertiesForHalfSpace.doc);
 
+  m.def("AddSignedDistanceFieldProperties", &AddSignedDistanceFieldProperties,
+      py::arg("resolution"), py::arg("band_width"),
+      py::arg("cache_path") = std::nullopt,
+      py::arg("max_memory_bytes") = std::nullopt, py::arg("properties"),
+      doc.AddSignedDistanceFieldProperties.doc);
+
   m.def("AddContactMaterial",
       py::overload_cast<const std::optional<double>&,
           const std::optional<double>&, const std::optional<double>&,
@@ -1566,6 +1623,63 @@ void DoScalarIndependentDefinitions(py::module m) {
       py::arg("friction") = std::nullopt, py::arg("properties"),
       doc.AddContactMaterial.doc_5args);
 
+  // MeshcatAnimation
+  {
+    using Class = MeshcatAnimation;
+    constexpr auto& cls_doc = doc.MeshcatAnimation;
+    py::class_<Class> cls(m, "MeshcatAnimation", cls_doc.doc);
+    py::enum_<Class::LoopMode>(cls, "LoopMode", cls_doc.LoopMode.doc)
+        .value("kLoopOnce", Class::LoopMode::kLoopOnce,
+            cls_doc.LoopMode.kLoopOnce.doc)
+        .value("kLoopRepeat", Class::LoopMode::kLoopRepeat,
+            cls_doc.LoopMode.kLoopRepeat.doc)
+        .value("kLoopPingPong", Class::LoopMode::kLoopPingPong,
+            cls_doc.LoopMode.kLoopPingPong.doc);
+    cls  // BR
+        .def(py::init<double>(), py::arg("frames_per_second") = 32.0,
+            cls_doc.ctor.doc)
+        .def("frames_per_second", &Class::frames_per_second,
+            cls_doc.frames_per_second.doc)
+        .def("frame", &Class::frame, py::arg("time_from_start"),
+            cls_doc.frame.doc)
+        .def("autoplay", &Class::autoplay, cls_doc.autoplay.doc)
+        .def("set_autoplay", &Class::set_autoplay, py::arg("play"),
+            cls_doc.set_autoplay.doc)
+        .def("loop_mode", &Class::loop_mode, cls_doc.loop_mode.doc)
+        .def("set_loop_mode", &Class::set_loop_mode, py::arg("mode"),
+            cls_doc.set_loop_mode.doc)
+        .def("repetitions", &Class::repetitions, cls_doc.repetitions.doc)
+        .def("set_repetitions", &Class::set_repetitions,
+            py::arg("repetitions"), cls_doc.set_repetitions.doc)
+        .def("clamp_when_finished", &Class::clamp_when_finished,
+            cls_doc.clamp_when_finished.doc)
+        .def("set_clamp_when_finished", &Class::set_clamp_when_finished,
+            py::arg("clamp"), cls_doc.set_clamp_when_finished.doc)
+        .def("max_keyframes", &Class::max_keyframes, cls_doc.max_keyframes.doc)
+        .def("set_max_keyframes", &Class::set_max_keyframes,
+            py::arg("max_keyframes"), cls_doc.set_max_keyframes.doc)
+        .def("num_keyframes", &Class::num_keyframes, cls_doc.num_keyframes.doc)
+        .def("SetTransform", &Class::SetTransform, py::arg("frame"),
+            py::arg("path"), py::arg("X_ParentPath"), cls_doc.SetTransform.doc)
+        .def("SetProperty",
+            py::overload_cast<int, const std::string&, const std::string&,
+                bool>(&Class::SetProperty),
+            py::arg("frame"), py::arg("path"), py::arg("property"),
+            py::arg("value"), cls_doc.SetProperty.doc_bool)
+        .def("SetProperty",
+            py::overload_cast<int, const std::string&, const std::string&,
+                double>(&Class::SetProperty),
+            py::arg("frame"), py::arg("path"), py::arg("property"),
+            py::arg("value"), cls_doc.SetProperty.doc_double)
+        .def("SetProperty",
+            py::overload_cast<int, const std::string&, const std::string&,
+                const std::vector<double>&>(&Class::SetProperty),
+            py::arg("frame"), py::arg("path"), py::arg("property"),
+            py::arg("value"), cls_doc.SetProperty.doc_vector_double);
+    // Note: we intentionally do not bind tracks(), which is intended primarily
+    // for serialization in C++.
+  }
+
   // Meshcat
   {
     using Class = Meshcat;
@@ -1589,6 +1703,9 @@ void DoScalarIndependentDefinitions(py::module m) {
             cls_doc.ResetRenderMode.doc)
         .def("SetTransform", &Class::SetTransform, py::arg("path"),
             py::arg("X_ParentPath"), cls_doc.SetTransform.doc)
+        .def("SetTransforms", &Class::SetTransforms, py::arg("paths"),
+            py::arg("X_ParentPaths"), py::arg("tolerance") = 0.0,
+            cls_doc.SetTransforms.doc)
         .def("Delete", &Class::Delete, py::arg("path") = "", cls_doc.Delete.doc)
         .def("SetProperty",
             py::overload_cast<std::string_view, std::string, bool>(
@@ -1600,6 +1717,9 @@ void DoScalarIndependentDefinitions(py::module m) {
                 &Class::SetProperty),
             py::arg("path"), py::arg("property"), py::arg("value"),
             cls_doc.SetProperty.doc_double)
+        .def("SetAnimation", &Class::SetAnimation, py::arg("animation"),
+            cls_doc.SetAnimation.doc)
+        .def("StaticHtml", &Class::StaticHtml, cls_doc.StaticHtml.doc)
         .def("AddButton", &Class::AddButton, py::arg("name"),
             cls_doc.AddButton.doc)
         .def("GetButtonClicks", &Class::GetButtonClicks, py::arg("name"),
@@ -313,7 +313,16 @@ class TestGeometry(unittest.TestCase):
             "DrakeVisualizerParams("
             "publish_period=0.1, "
             "role=Role.kIllustration, "
-            "default_color=Rgba(r=0.1, g=0.2, b=0.3, a=0.4))"]))
+            "default_color=Rgba(r=0.1, g=0.2, b=0.3, a=0.4), "
+            "publish_changed_poses_only=False, "
+            "pose_change_tolerance=0.0, "
+            "full_draw_period=1.0)"]))
+        changed_only_params = mut.DrakeVisualizerParams(
+            publish_changed_poses_only=True, pose_change_tolerance=1e-6,
+            full_draw_period=2.0)
+        self.assertTrue(changed_only_params.publish_changed_poses_only)
+        self.assertEqual(changed_only_params.pose_change_tolerance, 1e-6)
+        self.assertEqual(changed_only_params.full_draw_period, 2.0)
 
         # Add some subscribers to detect message broadcast.
         load_channel = "DRAKE_VIEWER_LOAD_ROBOT"
@@ -378,6 +387,9 @@ class TestGeometry(unittest.TestCase):
                           shape=mut.Box(1, 1, 1),
                           rgba=mut.Rgba(.5, .5, .5))
         meshcat.SetTransform(path="/test/box", X_ParentPath=RigidTransform())
+        meshcat.SetTransforms(paths=["/test/box"],
+                              X_ParentPaths=[RigidTransform()],
+                              tolerance=0.0)
         meshcat.SetProperty(path="/Background",
                             property="visible",
                             value=True)
@@ -395,6 +407,34 @@ class TestGeometry(unittest.TestCase):
             name="slider"), 0.7, delta=1e-14)
         meshcat.DeleteSlider(name="slider")
         meshcat.DeleteAddedControls()
+        animation = mut.MeshcatAnimation(frames_per_second=20.0)
+        meshcat.SetAnimation(animation=animation)
+        self.assertIn("meshcat-pane", meshcat.StaticHtml())
+
+    def test_meshcat_animation(self):
+        animation = mut.MeshcatAnimation(frames_per_second=64)
+        self.assertEqual(animation.frames_per_second(), 64)
+        self.assertEqual(animation.frame(1.0), 64)
+        animation.set_autoplay(play=False)
+        self.assertFalse(animation.autoplay())
+        animation.set_loop_mode(mode=mut.MeshcatAnimation.LoopMode.kLoopOnce)
+        self.assertEqual(animation.loop_mode(),
+                         mut.MeshcatAnimation.LoopMode.kLoopOnce)
+        animation.set_repetitions(repetitions=2)
+        self.assertEqual(animation.repetitions(), 2)
+        animation.set_clamp_when_finished(clamp=True)
+        self.assertTrue(animation.clamp_when_finished())
+        animation.set_max_keyframes(max_keyframes=100)
+        self.assertEqual(animation.max_keyframes(), 100)
+        animation.SetTransform(frame=0, path="sphere",
+                               X_ParentPath=RigidTransform())
+        animation.SetProperty(frame=0, path="sphere", property="visible",
+                              value=True)
+        animation.SetProperty(frame=0, path="sphere", property="opacity",
+                              value=0.5)
+        animation.SetProperty(frame=0, path="sphere", property="color",
+                              value=[1.0, 0.0, 0.0])
+        self.assertEqual(animation.num_keyframes(), 5)
 
     @numpy_compare.check_nonsymbolic_types
     def test_meshcat_visualizer(self, T):
@@ -408,6 +448,12 @@ class TestGeometry(unittest.TestCase):
         vis = mut.MeshcatVisualizerCpp_[T](meshcat=meshcat, params=params)
         vis.Delete()
         self.assertIsInstance(vis.query_object_input_port(), InputPort_[T])
+        animation = vis.StartRecording(set_transforms_while_recording=False)
+        self.assertIsInstance(animation, mut.MeshcatAnimation)
+        self.assertIsInstance(vis.get_recording(), mut.MeshcatAnimation)
+        vis.StopRecording()
+        vis.PublishRecording()
+        vis.DeleteRecording()
 
         builder = DiagramBuilder_[T]()
         scene_graph = builder.AddSystem(mut.SceneGraph_[T]())
@@ -498,6 +544,17 @@ class TestGeometry(unittest.TestCase):
         self.assertIsInstance(obj.distance, T)
         self.assertTupleEqual(obj.grad_W.shape, (3,))
 
+    @numpy_compare.check_nonsymbolic_types
+    def test_signed_distance_to_point_batch_api(self, T):
+        obj = mut.SignedDistanceToPointBatch_[T]()
+        self.assertEqual(obj.num_points(), 0)
+        self.assertEqual(obj.num_results(), 0)
+        self.assertListEqual(obj.offsets, [0])
+        self.assertListEqual(obj.id_G, [])
+        self.assertTupleEqual(obj.p_GN.shape, (3, 0))
+        self.assertTupleEqual(obj.distance.shape, (0,))
+        self.assertTupleEqual(obj.grad_W.shape, (3, 0))
+
     def test_shape_constructors(self):
         box_mesh_path = FindResourceOrThrow(
             "drake/systems/sensors/test/models/meshes/box.obj")
@@ -792,6 +849,28 @@ class TestGeometry(unittest.TestCase):
         self.assertEqual(props.GetProperty("hydroelastic", "slab_thickness"),
                          slab_thickness)
 
+    def test_signed_distance_field_properties(self):
+        props = mut.ProximityProperties()
+        mut.AddSignedDistanceFieldProperties(
+            resolution=0.01, band_width=0.05, properties=props)
+        self.assertEqual(
+            props.GetProperty("signed_distance_field", "resolution"), 0.01)
+        self.assertEqual(
+            props.GetProperty("signed_distance_field", "band_width"), 0.05)
+        self.assertFalse(
+            props.HasProperty("signed_distance_field", "cache_path"))
+
+        props = mut.ProximityProperties()
+        mut.AddSignedDistanceFieldProperties(
+            resolution=0.01, band_width=0.05, cache_path="/tmp/mesh.sdf",
+            max_memory_bytes=1e6, properties=props)
+        self.assertEqual(
+            props.GetProperty("signed_distance_field", "cache_path"),
+            "/tmp/mesh.sdf")
+        self.assertEqual(
+            props.GetProperty("signed_distance_field", "max_memory_bytes"),
+            1e6)
+
     def test_render_engine_vtk_params(self):
         # Confirm default construction of params.
         params = mut.render.RenderEngineVtkParams()
@@ -871,6 +950,10 @@ class TestGeometry(unittest.TestCase):
         self.assertEqual(len(results), 0)
         results = query_object.ComputeSignedDistanceToPoint(p_WQ=(1, 2, 3))
         self.assertEqual(len(results), 0)
+        results = query_object.ComputeSignedDistanceToPoints(
+            p_WQs=np.zeros((3, 2)))
+        self.assertEqual(results.num_points(), 2)
+        self.assertEqual(results.num_results(), 0)
         results = query_object.FindCollisionCandidates()
         self.assertEqual(len(results), 0)
         self.assertFalse(query_object.HasCollisions())
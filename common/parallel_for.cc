@@ -0,0 +1,70 @@
+#include "drake/common/parallel_for.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace internal {
+
+void ParallelFor(int begin, int end, int num_threads,
+                 const std::function<void(int)>& body) {
+  DRAKE_THROW_UNLESS(begin <= end);
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  DRAKE_THROW_UNLESS(body != nullptr);
+
+  const int num_indices = end - begin;
+  const int num_workers = std::min(num_threads, num_indices);
+  if (num_workers <= 1) {
+    for (int i = begin; i < end; ++i) {
+      body(i);
+    }
+    return;
+  }
+
+  std::atomic<int> next_index{begin};
+  std::atomic<bool> abandoned{false};
+  std::mutex exception_mutex;
+  std::exception_ptr first_exception;
+
+  auto work = [&]() {
+    while (!abandoned.load(std::memory_order_relaxed)) {
+      const int i = next_index.fetch_add(1, std::memory_order_relaxed);
+      if (i >= end) return;
+      try {
+        body(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (first_exception == nullptr) {
+          first_exception = std::current_exception();
+        }
+        abandoned.store(true, std::memory_order_relaxed);
+        return;
+      }
+    }
+  };
+
+  // The calling thread is one of the workers; spawn the rest.
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers - 1);
+  for (int t = 1; t < num_workers; ++t) {
+    threads.emplace_back(work);
+  }
+  work();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (first_exception != nullptr) {
+    std::rethrow_exception(first_exception);
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <functional>
+
+namespace drake {
+namespace internal {
+
+/* Evaluates `body(i)` for every index i in the half-open range [begin, end),
+ distributing the work across (at most) `num_threads` threads.
+
+ The threads are spawned (and joined) by each call, so this is only meant for
+ one-shot work whose cost dwarfs that of creating threads (e.g., building a
+ bounding volume hierarchy). Loops that are evaluated repeatedly (e.g., once
+ per time step) should use a persistent ThreadPool instead.
+
+ Indices are handed out to the workers dynamically (each worker claims the
+ next unprocessed index when it finishes its previous one), so the cost of
+ individual evaluations need not be uniform. The calling thread participates
+ as one of the workers. When `num_threads` is one (or the range holds a single
+ index), all evaluations happen serially on the calling thread in increasing
+ index order and no threads are spawned.
+
+ The order in which the indices are evaluated is otherwise unspecified; callers
+ that require deterministic results should have `body` write its output into a
+ slot keyed by `i` and combine the slots after this function returns.
+
+ If any evaluation of `body` throws, the remaining unclaimed indices are
+ abandoned, all workers are joined, and the first exception thrown is
+ rethrown on the calling thread.
+
+ @param begin        The first index to evaluate.
+ @param end          One past the last index to evaluate.
+ @param num_threads  The maximum number of threads to use (including the
+                     calling thread).
+ @param body         The function to evaluate at each index. It must be safe
+                     to call concurrently from multiple threads.
+ @pre begin <= end.
+ @pre num_threads >= 1.  */
+void ParallelFor(int begin, int end, int num_threads,
+                 const std::function<void(int)>& body);
+
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,62 @@
+#include "drake/common/parallel_for.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+// Every index in the range is visited exactly once, regardless of the number
+// of threads requested.
+GTEST_TEST(ParallelForTest, VisitsEveryIndexOnce) {
+  for (int num_threads : {1, 2, 3, 8, 64}) {
+    std::vector<std::atomic<int>> counts(100);
+    ParallelFor(0, 100, num_threads, [&counts](int i) {
+      ++counts[i];
+    });
+    for (int i = 0; i < 100; ++i) {
+      EXPECT_EQ(counts[i].load(), 1) << "num_threads = " << num_threads;
+    }
+  }
+}
+
+// A single thread evaluates the indices in order on the calling thread.
+GTEST_TEST(ParallelForTest, SerialOrder) {
+  std::vector<int> visited;
+  ParallelFor(3, 7, 1, [&visited](int i) { visited.push_back(i); });
+  EXPECT_EQ(visited, std::vector<int>({3, 4, 5, 6}));
+}
+
+GTEST_TEST(ParallelForTest, EmptyRange) {
+  int count = 0;
+  ParallelFor(5, 5, 4, [&count](int) { ++count; });
+  EXPECT_EQ(count, 0);
+}
+
+GTEST_TEST(ParallelForTest, BadArguments) {
+  auto body = [](int) {};
+  EXPECT_THROW(ParallelFor(1, 0, 1, body), std::exception);
+  EXPECT_THROW(ParallelFor(0, 1, 0, body), std::exception);
+}
+
+// An exception thrown by the body is propagated to the caller.
+GTEST_TEST(ParallelForTest, ExceptionPropagates) {
+  for (int num_threads : {1, 4}) {
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        ParallelFor(0, 50, num_threads,
+                    [](int i) {
+                      if (i == 17) throw std::runtime_error("index 17");
+                    }),
+        std::runtime_error, "index 17");
+  }
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,176 @@
+#include "drake/common/thread_pool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace internal {
+namespace {
+
+// Every index in the range is visited exactly once, for any number of threads
+// and grain size, over many loops on the same pool.
+GTEST_TEST(ThreadPoolTest, VisitsEveryIndexOnce) {
+  for (int num_threads : {1, 2, 3, 8}) {
+    ThreadPool pool(num_threads);
+    EXPECT_EQ(pool.num_threads(), num_threads);
+    for (int grain_size : {1, 3, 16, 1000}) {
+      for (int repeat = 0; repeat < 20; ++repeat) {
+        std::vector<std::atomic<int>> counts(257);
+        pool.ParallelFor(0, 257, grain_size, [&counts](int i) { ++counts[i]; });
+        for (int i = 0; i < 257; ++i) {
+          ASSERT_EQ(counts[i].load(), 1)
+              << "num_threads = " << num_threads
+              << ", grain_size = " << grain_size;
+        }
+      }
+    }
+  }
+}
+
+// Small ranges are evaluated in order on the calling thread.
+GTEST_TEST(ThreadPoolTest, SerialOrder) {
+  ThreadPool pool(4);
+  const std::thread::id caller = std::this_thread::get_id();
+  std::vector<int> visited;
+  pool.ParallelFor(3, 7, 4, [&](int i) {
+    EXPECT_EQ(std::this_thread::get_id(), caller);
+    visited.push_back(i);
+  });
+  EXPECT_EQ(visited, std::vector<int>({3, 4, 5, 6}));
+
+  int count = 0;
+  pool.ParallelFor(5, 5, 1, [&count](int) { ++count; });
+  EXPECT_EQ(count, 0);
+}
+
+// A loop within a loop body finds the pool busy, and runs serially rather than
+// deadlocking.
+GTEST_TEST(ThreadPoolTest, Nested) {
+  ThreadPool pool(3);
+  std::vector<std::atomic<int>> counts(20 * 20);
+  pool.ParallelFor(0, 20, 1, [&](int i) {
+    pool.ParallelFor(0, 20, 1, [&](int j) { ++counts[20 * i + j]; });
+  });
+  for (const auto& count : counts) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+// Loops may be started from several threads at once.
+GTEST_TEST(ThreadPoolTest, ConcurrentCallers) {
+  ThreadPool pool(3);
+  std::vector<std::atomic<int>> counts(4 * 100);
+  std::vector<std::thread> callers;
+  for (int c = 0; c < 4; ++c) {
+    callers.emplace_back([&pool, &counts, c]() {
+      for (int repeat = 0; repeat < 10; ++repeat) {
+        pool.ParallelFor(0, 100, 2, [&counts, c](int i) {
+          ++counts[100 * c + i];
+        });
+      }
+    });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  for (const auto& count : counts) {
+    EXPECT_EQ(count.load(), 10);
+  }
+}
+
+// Each thread index denotes the same OS thread in every loop, and is never
+// used by two evaluations at once.
+GTEST_TEST(ThreadPoolTest, ThreadIndex) {
+  ThreadPool pool(4);
+  std::vector<std::thread::id> owners(4);
+  for (int repeat = 0; repeat < 20; ++repeat) {
+    std::vector<std::atomic<int>> busy(4);
+    std::vector<std::atomic<int>> counts(200);
+    std::vector<std::thread::id> ids(4);
+    pool.ParallelForWithThreadIndex(0, 200, 1, [&](int thread_index, int i) {
+      ASSERT_GE(thread_index, 0);
+      ASSERT_LT(thread_index, 4);
+      EXPECT_EQ(busy[thread_index].fetch_add(1), 0);
+      ids[thread_index] = std::this_thread::get_id();
+      ++counts[i];
+      --busy[thread_index];
+    });
+    for (const auto& count : counts) {
+      ASSERT_EQ(count.load(), 1);
+    }
+    for (int t = 0; t < 4; ++t) {
+      if (ids[t] == std::thread::id()) continue;
+      if (owners[t] == std::thread::id()) owners[t] = ids[t];
+      EXPECT_EQ(ids[t], owners[t]) << "thread_index = " << t;
+    }
+  }
+  EXPECT_EQ(owners[0], std::this_thread::get_id());
+
+  // A loop that runs serially reports thread 0 on the calling thread.
+  pool.ParallelForWithThreadIndex(0, 3, 3, [](int thread_index, int) {
+    EXPECT_EQ(thread_index, 0);
+  });
+}
+
+// Every thread evaluates the body once, on the thread that the same index
+// denotes in loops; the pool must not be busy.
+GTEST_TEST(ThreadPoolTest, RunOnEachThread) {
+  for (int num_threads : {1, 3}) {
+    ThreadPool pool(num_threads);
+    std::vector<std::thread::id> ids(num_threads);
+    std::vector<std::atomic<int>> counts(num_threads);
+    for (int repeat = 0; repeat < 10; ++repeat) {
+      pool.RunOnEachThread([&](int thread_index) {
+        ++counts[thread_index];
+        ids[thread_index] = std::this_thread::get_id();
+      });
+    }
+    for (int t = 0; t < num_threads; ++t) {
+      EXPECT_EQ(counts[t].load(), 10);
+    }
+    EXPECT_EQ(ids[0], std::this_thread::get_id());
+    pool.ParallelForWithThreadIndex(0, 100, 1, [&](int thread_index, int) {
+      EXPECT_EQ(std::this_thread::get_id(), ids[thread_index]);
+    });
+  }
+
+  ThreadPool pool(2);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      pool.ParallelFor(0, 10, 1,
+                       [&pool](int) { pool.RunOnEachThread([](int) {}); }),
+      ".*RunOnEachThread.*busy.*");
+}
+
+GTEST_TEST(ThreadPoolTest, ExceptionPropagates) {
+  for (int num_threads : {1, 4}) {
+    ThreadPool pool(num_threads);
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        pool.ParallelFor(0, 50, 1,
+                         [](int i) {
+                           if (i == 17) throw std::runtime_error("index 17");
+                         }),
+        "index 17");
+    // The pool remains usable.
+    std::atomic<int> count{0};
+    pool.ParallelFor(0, 50, 1, [&count](int) { ++count; });
+    EXPECT_EQ(count.load(), 50);
+  }
+}
+
+GTEST_TEST(ThreadPoolTest, BadArguments) {
+  EXPECT_THROW(ThreadPool(0), std::exception);
+  ThreadPool pool(2);
+  auto body = [](int) {};
+  EXPECT_THROW(pool.ParallelFor(1, 0, 1, body), std::exception);
+  EXPECT_THROW(pool.ParallelFor(0, 1, 0, body), std::exception);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace drake
@@ -0,0 +1,165 @@
+#include "drake/common/thread_pool.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace internal {
+
+ThreadPool::ThreadPool(int num_threads)
+    : num_threads_(num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  slices_.reset(new Slice[num_threads]);
+  workers_.reserve(num_threads - 1);
+  for (int t = 1; t < num_threads; ++t) {
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, t);
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::ParallelFor(int begin, int end, int grain_size,
+                             const std::function<void(int)>& body) {
+  DRAKE_THROW_UNLESS(body != nullptr);
+  ParallelForWithThreadIndex(begin, end, grain_size,
+                             [&body](int, int i) { body(i); });
+}
+
+void ThreadPool::ParallelForWithThreadIndex(
+    int begin, int end, int grain_size,
+    const std::function<void(int thread_index, int i)>& body) {
+  DRAKE_THROW_UNLESS(begin <= end);
+  DRAKE_THROW_UNLESS(grain_size >= 1);
+  DRAKE_THROW_UNLESS(body != nullptr);
+
+  const int num_indices = end - begin;
+  bool expected = false;
+  if (workers_.empty() || num_indices <= grain_size ||
+      !busy_.compare_exchange_strong(expected, true)) {
+    for (int i = begin; i < end; ++i) {
+      body(0, i);
+    }
+    return;
+  }
+
+  // Split the range into one contiguous slice per thread.
+  for (int t = 0; t < num_threads_; ++t) {
+    const int64_t n = num_indices;
+    slices_[t].next.store(begin + static_cast<int>(n * t / num_threads_),
+                          std::memory_order_relaxed);
+    slices_[t].end = begin + static_cast<int>(n * (t + 1) / num_threads_);
+  }
+  Run(body, grain_size, true /* steal */);
+}
+
+void ThreadPool::RunOnEachThread(
+    const std::function<void(int thread_index)>& body) {
+  DRAKE_THROW_UNLESS(body != nullptr);
+  if (workers_.empty()) {
+    body(0);
+    return;
+  }
+  bool expected = false;
+  if (!busy_.compare_exchange_strong(expected, true)) {
+    throw std::logic_error(
+        "ThreadPool::RunOnEachThread() was called while the pool is busy");
+  }
+
+  // Each thread evaluates the single index of its own slice.
+  for (int t = 0; t < num_threads_; ++t) {
+    slices_[t].next.store(t, std::memory_order_relaxed);
+    slices_[t].end = t + 1;
+  }
+  Run([&body](int thread_index, int) { body(thread_index); }, 1,
+      false /* steal */);
+}
+
+void ThreadPool::Run(const std::function<void(int, int)>& body,
+                     int grain_size, bool steal) {
+  body_ = &body;
+  grain_size_ = grain_size;
+  steal_ = steal;
+  abandoned_.store(false, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++generation_;
+    num_running_ = static_cast<int>(workers_.size());
+  }
+  start_.notify_all();
+
+  RunChunks(0);
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return num_running_ == 0; });
+    std::swap(exception, first_exception_);
+  }
+  body_ = nullptr;
+  busy_.store(false);
+  if (exception != nullptr) {
+    std::rethrow_exception(exception);
+  }
+}
+
+void ThreadPool::RunChunks(int thread_index) {
+  const int num_slices = steal_ ? num_threads_ : 1;
+  for (int k = 0; k < num_slices; ++k) {
+    Slice& slice = slices_[(thread_index + k) % num_threads_];
+    while (!abandoned_.load(std::memory_order_relaxed)) {
+      const int start =
+          slice.next.fetch_add(grain_size_, std::memory_order_relaxed);
+      if (start >= slice.end) break;
+      const int stop = std::min(start + grain_size_, slice.end);
+      try {
+        for (int i = start; i < stop; ++i) {
+          (*body_)(thread_index, i);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (first_exception_ == nullptr) {
+          first_exception_ = std::current_exception();
+        }
+        abandoned_.store(true, std::memory_order_relaxed);
+        return;
+      }
+    }
+  }
+}
+
+void ThreadPool::WorkerLoop(int thread_index) {
+  int64_t last_generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      start_.wait(lock, [this, last_generation]() {
+        return stop_ || generation_ != last_generation;
+      });
+      if (stop_) return;
+      last_generation = generation_;
+    }
+    RunChunks(thread_index);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      DRAKE_ASSERT(num_running_ > 0);
+      if (--num_running_ == 0) {
+        done_.notify_one();
+      }
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace drake
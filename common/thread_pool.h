@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+
+namespace drake {
+namespace internal {
+
+/* A fixed set of persistent worker threads for evaluating many short parallel
+ loops, where spawning threads for each loop (as the ParallelFor() of
+ parallel_for.h does) would cost more than the loop itself.
+
+ Each loop's index range is split into one contiguous slice per thread. Every
+ thread claims chunks of `grain_size` indices from the front of its own slice,
+ and once that is exhausted, steals chunks from the other threads' slices. The
+ calling thread participates as thread 0.
+
+ Only one loop runs on the pool at a time. A ParallelFor() call that finds the
+ pool busy (because another thread is using it, or because it is called from
+ within a loop body) evaluates its loop serially on the calling thread instead
+ of waiting, so the pool can be safely shared and nested loops cannot
+ deadlock. */
+class ThreadPool {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(ThreadPool)
+
+  /* Creates a pool that evaluates loops on up to `num_threads` threads,
+   including the calling thread; i.e., `num_threads - 1` workers are spawned.
+   @pre num_threads >= 1. */
+  explicit ThreadPool(int num_threads);
+
+  /* Stops and joins the workers.
+   @pre No ParallelFor() call is in progress. */
+  ~ThreadPool();
+
+  int num_threads() const { return num_threads_; }
+
+  /* Evaluates `body(i)` for every index i in [begin, end), in chunks of
+   `grain_size` consecutive indices. Ranges of at most `grain_size` indices are
+   evaluated serially on the calling thread, in increasing order. If any
+   evaluation throws, the remaining chunks are abandoned and the first exception
+   is rethrown on the calling thread once all threads are done.
+   @pre begin <= end.
+   @pre grain_size >= 1. */
+  void ParallelFor(int begin, int end, int grain_size,
+                   const std::function<void(int)>& body);
+
+  /* Variant of ParallelFor() whose `body(thread_index, i)` is also given the
+   index of the pool thread evaluating it, in the range [0, num_threads()). The
+   calling thread is thread 0, and every other thread index always denotes the
+   same persistent worker thread, so per-thread resources that are bound to an
+   OS thread (e.g., graphics contexts) can be indexed by `thread_index`.
+
+   No two evaluations with the same `thread_index` happen concurrently within
+   one call, so `body` can use per-thread scratch memory indexed by
+   `thread_index` without synchronization. A call that runs serially because
+   the pool is busy evaluates every index with `thread_index` 0 on its own
+   calling thread; scratch memory shared by concurrent callers must therefore be
+   owned by each call rather than by the pool's user. */
+  void ParallelForWithThreadIndex(
+      int begin, int end, int grain_size,
+      const std::function<void(int thread_index, int i)>& body);
+
+  /* Evaluates `body(thread_index)` exactly once on each of the pool's threads,
+   concurrently, where thread 0 is the calling thread. This lets a caller
+   create, update, or destroy resources that must only ever be used by the
+   thread that owns them. Exceptions are handled as in ParallelFor() (so a
+   thread may skip `body` once another thread has thrown).
+   @throws std::exception if the pool is busy (e.g., if called from within a
+     loop body or concurrently with another loop), because the evaluations
+     could not then be placed on their threads. */
+  void RunOnEachThread(const std::function<void(int thread_index)>& body);
+
+ private:
+  // A slice of the current loop's index range; `next` is the first index that
+  // has not yet been claimed by any thread. Padded to avoid false sharing.
+  struct alignas(64) Slice {
+    std::atomic<int> next{0};
+    int end{0};
+  };
+
+  // Runs the loop whose slices have been set up on all threads, and rethrows
+  // the first exception thrown by `body`. Requires that busy_ has been set by
+  // the caller, and clears it.
+  void Run(const std::function<void(int, int)>& body, int grain_size,
+           bool steal);
+
+  // Evaluates chunks of the current loop, starting with the slice owned by
+  // `thread_index`, until all slices are exhausted (or only that slice, if the
+  // loop does not steal).
+  void RunChunks(int thread_index);
+
+  void WorkerLoop(int thread_index);
+
+  const int num_threads_;
+  std::vector<std::thread> workers_;
+
+  // True while a loop is running on the pool.
+  std::atomic<bool> busy_{false};
+
+  // The current loop. These are written only by the thread that owns the pool
+  // (i.e., set busy_), before the loop's generation is published.
+  const std::function<void(int, int)>* body_{};
+  int grain_size_{1};
+  bool steal_{true};
+  std::unique_ptr<Slice[]> slices_;
+  std::atomic<bool> abandoned_{false};
+
+  // Guards the members below.
+  std::mutex mutex_;
+  std::condition_variable start_;
+  std::condition_variable done_;
+  // Incremented to start each loop on the workers.
+  int64_t generation_{0};
+  // The number of workers that have not yet finished the current loop.
+  int num_running_{0};
+  bool stop_{false};
+  std::exception_ptr first_exception_;
+};
+
+}  // namespace internal
+}  // namespace drake
@@ -12,10 +12,12 @@
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/benchmarks/acrobot/make_acrobot_plant.h"
+#include "drake/multibody/plant/dynamics_derivatives.h"
 #include "drake/multibody/parsing/parser.h"
 #include "drake/tools/performance/fixture_common.h"
 
 using Eigen::MatrixXd;
+using Eigen::VectorXd;
 using drake::multibody::MultibodyPlant;
 using drake::systems::Context;
 using drake::systems::System;
@@ -142,6 +144,41 @@ BENCHMARK_F(MultibodyFixtureAdx, MultibodyAdxMassMatrixViaInverseDynamics)
   }
 }
 
+// The derivatives of the forward dynamics with respect to the state and the
+// actuation input, computed analytically in double and with AutoDiffXd.
+BENCHMARK_F(MultibodyFixtureD, MultibodyDForwardDynamicsDerivatives)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  const multibody::DynamicsDerivatives derivatives(plant_.get());
+  plant_->get_actuation_input_port().FixValue(
+      context_.get(), VectorXd::Zero(plant_->num_actuated_dofs()));
+  MatrixXd dvdot_dq, dvdot_dv, dvdot_du;
+  for (auto _ : state) {
+    InvalidateState();
+    derivatives.CalcForwardDynamicsDerivatives(*context_, &dvdot_dq,
+                                               &dvdot_dv, &dvdot_du);
+  }
+}
+
+BENCHMARK_F(MultibodyFixtureAdx, MultibodyAdxForwardDynamicsDerivatives)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  const int nx = x_.size();
+  const int nu = plant_->num_actuated_dofs();
+  VectorXd xu(nx + nu);
+  xu << math::DiscardGradient(x_), VectorXd::Zero(nu);
+  const VectorX<AutoDiffXd> xu_ad = math::initializeAutoDiff(xu);
+  plant_->SetPositionsAndVelocities(context_.get(), xu_ad.head(nx));
+  plant_->get_actuation_input_port().FixValue(
+      context_.get(), VectorX<AutoDiffXd>(xu_ad.tail(nu)));
+  for (auto _ : state) {
+    InvalidateState();
+    math::autoDiffToGradientMatrix(plant_->EvalTimeDerivatives(*context_)
+                                       .get_generalized_velocity()
+                                       .CopyToVector());
+  }
+}
+
 }  // namespace
 }  // namespace acrobot
 }  // namespace examples
@@ -1,3 +1,6 @@
+#include <memory>
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include "drake/common/find_resource.h"
@@ -5,6 +8,7 @@
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/plant/batch_evaluator.h"
 #include "drake/multibody/plant/multibody_plant.h"
 #include "drake/tools/performance/fixture_common.h"
 
@@ -138,6 +142,73 @@ BENCHMARK_F(CassieDoubleFixture, DoubleMassMatrix)(benchmark::State& state) {
   tracker_.Report(&state);
 }
 
+BENCHMARK_F(CassieDoubleFixture, DoubleMassMatrixFactorization)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  multibody::MassMatrixFactorization<double> factorization(*plant_);
+  for (auto _ : state) {
+    // @see LimitMalloc note above.
+    LimitMalloc guard({.max_num_allocations = 0});
+    InvalidateState();
+    plant_->CalcMassMatrixFactorization(*context_, &factorization);
+    tracker_.Update(guard.num_allocations());
+  }
+  tracker_.Report(&state);
+}
+
+// For comparison with DoubleMassMatrixFactorization, a dense factorization.
+BENCHMARK_F(CassieDoubleFixture, DoubleMassMatrixDenseFactorization)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  MatrixXd M(nv_, nv_);
+  Eigen::LLT<MatrixXd> llt(nv_);
+  for (auto _ : state) {
+    // @see LimitMalloc note above.
+    LimitMalloc guard;
+    InvalidateState();
+    plant_->CalcMassMatrix(*context_, &M);
+    llt.compute(M);
+    tracker_.Update(guard.num_allocations());
+  }
+  tracker_.Report(&state);
+}
+
+BENCHMARK_F(CassieDoubleFixture, DoubleMassMatrixSolve)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  multibody::MassMatrixFactorization<double> factorization(*plant_);
+  plant_->CalcMassMatrixFactorization(*context_, &factorization);
+  const VectorXd tau = VectorXd::LinSpaced(nv_, -1.0, 1.0);
+  VectorXd vdot(nv_);
+  for (auto _ : state) {
+    // @see LimitMalloc note above.
+    LimitMalloc guard({.max_num_allocations = 0});
+    vdot = tau;
+    factorization.SolveInPlace(&vdot);
+    tracker_.Update(guard.num_allocations());
+  }
+  tracker_.Report(&state);
+}
+
+// For comparison with DoubleMassMatrixSolve, a dense solve.
+BENCHMARK_F(CassieDoubleFixture, DoubleMassMatrixDenseSolve)
+    // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+    (benchmark::State& state) {
+  MatrixXd M(nv_, nv_);
+  plant_->CalcMassMatrix(*context_, &M);
+  const Eigen::LLT<MatrixXd> llt(M);
+  const VectorXd tau = VectorXd::LinSpaced(nv_, -1.0, 1.0);
+  VectorXd vdot(nv_);
+  for (auto _ : state) {
+    // @see LimitMalloc note above.
+    LimitMalloc guard({.max_num_allocations = 0});
+    vdot = tau;
+    llt.solveInPlace(vdot);
+    tracker_.Update(guard.num_allocations());
+  }
+  tracker_.Report(&state);
+}
+
 BENCHMARK_F(CassieDoubleFixture, DoubleInverseDynamics)
     // NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
     (benchmark::State& state) {
@@ -170,6 +241,103 @@ BENCHMARK_F(CassieDoubleFixture, DoubleForwardDynamics)
   tracker_.Report(&state);
 }
 
+// Fixture that holds a batch of Cassie states, to compare evaluating the batch
+// through a loop over one Context per state against a BatchEvaluator. The
+// benchmark argument is the number of threads used by the BatchEvaluator.
+class CassieBatchFixture : public CassieDoubleFixture {
+ public:
+  using CassieDoubleFixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    CassieDoubleFixture::SetUp(state);
+    // Perturb the default configuration through the single-dof joints only, so
+    // that the floating base quaternion remains valid.
+    q_ = plant_->GetPositions(*context_).replicate(1, kNumInstances);
+    for (int k = 0; k < kNumInstances; ++k) {
+      for (multibody::JointIndex i(0); i < plant_->num_joints(); ++i) {
+        const multibody::Joint<double>& joint = plant_->get_joint(i);
+        if (joint.num_positions() == 1) {
+          q_(joint.position_start(), k) += 0.01 * k;
+        }
+      }
+    }
+    v_ = MatrixXd::Constant(nv_, kNumInstances, 0.1);
+    vdot_ = MatrixXd::Zero(nv_, kNumInstances);
+    instance_contexts_.clear();
+    for (int k = 0; k < kNumInstances; ++k) {
+      instance_contexts_.push_back(plant_->CreateDefaultContext());
+      plant_->SetPositions(instance_contexts_.back().get(), q_.col(k));
+      plant_->SetVelocities(instance_contexts_.back().get(), v_.col(k));
+    }
+  }
+
+ protected:
+  static constexpr int kNumInstances = 64;
+  MatrixXd q_;
+  MatrixXd v_;
+  MatrixXd vdot_;
+  std::vector<std::unique_ptr<Context<double>>> instance_contexts_;
+};
+
+BENCHMARK_DEFINE_F(CassieBatchFixture, LoopMassMatrix)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  MatrixXd M(nv_, kNumInstances * nv_);
+  for (auto _ : state) {
+    for (int k = 0; k < kNumInstances; ++k) {
+      instance_contexts_[k]->NoteContinuousStateChange();
+      auto M_k = M.middleCols(k * nv_, nv_);
+      plant_->CalcMassMatrix(*instance_contexts_[k], &M_k);
+    }
+  }
+}
+BENCHMARK_REGISTER_F(CassieBatchFixture, LoopMassMatrix);
+
+BENCHMARK_DEFINE_F(CassieBatchFixture, BatchMassMatrix)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  const multibody::BatchEvaluator<double> evaluator(plant_.get(), *context_,
+                                                    state.range(0));
+  MatrixXd M(nv_, kNumInstances * nv_);
+  for (auto _ : state) {
+    evaluator.CalcMassMatrices(q_, &M);
+  }
+}
+BENCHMARK_REGISTER_F(CassieBatchFixture, BatchMassMatrix)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(4);
+
+BENCHMARK_DEFINE_F(CassieBatchFixture, LoopInverseDynamics)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  MatrixXd tau(nv_, kNumInstances);
+  multibody::MultibodyForces<double> forces(*plant_);
+  for (auto _ : state) {
+    for (int k = 0; k < kNumInstances; ++k) {
+      instance_contexts_[k]->NoteContinuousStateChange();
+      plant_->CalcForceElementsContribution(*instance_contexts_[k], &forces);
+      tau.col(k) = plant_->CalcInverseDynamics(*instance_contexts_[k],
+                                               vdot_.col(k), forces);
+    }
+  }
+}
+BENCHMARK_REGISTER_F(CassieBatchFixture, LoopInverseDynamics);
+
+BENCHMARK_DEFINE_F(CassieBatchFixture, BatchInverseDynamics)
+// NOLINTNEXTLINE(runtime/references) cpplint disapproves of gbench choices.
+(benchmark::State& state) {
+  const multibody::BatchEvaluator<double> evaluator(plant_.get(), *context_,
+                                                    state.range(0));
+  MatrixXd tau(nv_, kNumInstances);
+  for (auto _ : state) {
+    evaluator.CalcInverseDynamics(q_, v_, vdot_, &tau);
+  }
+}
+BENCHMARK_REGISTER_F(CassieBatchFixture, BatchInverseDynamics)
+    ->ArgName("threads")
+    ->Arg(1)
+    ->Arg(4);
+
 // Fixture that holds a Cassie robot model in a MultibodyPlant<AutoDiffXd>. It
 // also holds a default context for autodiff.
 class CassieAutodiffFixture : public CassieDoubleFixture {
@@ -0,0 +1,161 @@
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* @defgroup bvh_build_benchmarks Bounding Volume Hierarchy Construction
+ Benchmarks
+ @ingroup proximity_queries
+
+ The benchmark compares the strategies with which Bvh can be built (see
+ BvhBuildStrategy) on meshes of real robot links, read from the Wavefront .obj
+ files in manipulation/models with ReadObjToSurfaceMesh(). Unlike the meshes
+ Drake generates for primitive shapes, these meshes are irregular: they were
+ exported from CAD and mix long, thin triangles with densely tessellated
+ regions.
+
+ There are two families of benchmarks:
+ - __Build__: The cost of constructing the hierarchy.
+ - __Collide__: The cost of the broad-phase culling of a mesh-mesh query (the
+   traversal performed by Bvh::Collide(); no narrow-phase work is done) in which
+   the mesh is collided with a slightly displaced copy of itself. This measures
+   the quality of the hierarchy.
+
+ Arguments include:
+ - __asset__: An index into the list of .obj files below.
+ - __threads__: The number of threads used to build the hierarchy. (It doesn't
+   affect the hierarchy, so the Collide benchmarks don't vary it.)
+
+ <h2>Running the benchmark</h2>
+
+ The benchmark can be executed as:
+
+ ```
+ bazel run //geometry/benchmarking:bvh_build_benchmark
+ ```
+
+ Each line of the output has the form:
+
+ ```
+ BvhBuildBenchmark/<Family><Strategy>/asset:N[/threads:M]
+ ```
+
+ The `elements` counter reports the number of triangles in the mesh and the
+ `candidates` counter reports the number of unculled pairs.  */
+
+using Eigen::AngleAxisd;
+using Eigen::Vector3d;
+using math::RigidTransformd;
+
+const char* const kAssets[] = {
+    "drake/manipulation/models/allegro_hand_description/meshes/"
+    "base_link_left.obj",
+    "drake/manipulation/models/iiwa_description/meshes/visual/link_1.obj",
+    "drake/manipulation/models/iiwa_description/iiwa7/link_0.obj",
+    "drake/manipulation/models/iiwa_description/iiwa7/link_7.obj",
+};
+
+class BvhBuildBenchmark : public benchmark::Fixture {
+ public:
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    mesh_ = std::make_unique<SurfaceMesh<double>>(
+        ReadObjToSurfaceMesh(FindResourceOrThrow(kAssets[state.range(0)])));
+    // A small displacement (relative to the size of a link) so that a large
+    // portion of the mesh overlaps its copy without the features aligning.
+    X_AB_ = RigidTransformd(
+        AngleAxisd(M_PI / 20, Vector3d(1, 2, 3).normalized()),
+        Vector3d(0.004, -0.003, 0.005));
+  }
+
+  /* Runs the benchmark loop building the hierarchy with the given strategy
+   and the number of threads given by the benchmark's second argument.  */
+  void RunBuild(BvhBuildStrategy strategy, benchmark::State* state) {
+    const BvhBuildOptions options{strategy,
+                                  static_cast<int>(state->range(1))};
+    for (auto _ : *state) {
+      Bvh<Obb, SurfaceMesh<double>> bvh(*mesh_, options);
+      benchmark::DoNotOptimize(bvh);
+    }
+    state->counters["elements"] = mesh_->num_elements();
+  }
+
+  /* Runs the benchmark loop colliding the hierarchy (built with the given
+   strategy) with itself.  */
+  void RunCollide(BvhBuildStrategy strategy, benchmark::State* state) {
+    const Bvh<Obb, SurfaceMesh<double>> bvh(*mesh_, {strategy, 1});
+    int count = 0;
+    auto callback = [&count](SurfaceFaceIndex, SurfaceFaceIndex) {
+      ++count;
+      return BvttCallbackResult::Continue;
+    };
+    for (auto _ : *state) {
+      count = 0;
+      bvh.Collide(bvh, X_AB_, callback);
+      benchmark::DoNotOptimize(count);
+    }
+    state->counters["elements"] = mesh_->num_elements();
+    state->counters["candidates"] = count;
+  }
+
+  std::unique_ptr<SurfaceMesh<double>> mesh_;
+  RigidTransformd X_AB_;
+};
+
+BENCHMARK_DEFINE_F(BvhBuildBenchmark, BuildMedian)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  RunBuild(BvhBuildStrategy::kMedianSplit, &state);
+}
+BENCHMARK_REGISTER_F(BvhBuildBenchmark, BuildMedian)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgNames({"asset", "threads"})
+    ->ArgsProduct({{0, 1, 2, 3}, {1, 4}});
+
+BENCHMARK_DEFINE_F(BvhBuildBenchmark, BuildSah)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  RunBuild(BvhBuildStrategy::kSurfaceAreaHeuristic, &state);
+}
+BENCHMARK_REGISTER_F(BvhBuildBenchmark, BuildSah)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgNames({"asset", "threads"})
+    ->ArgsProduct({{0, 1, 2, 3}, {1, 4}});
+
+BENCHMARK_DEFINE_F(BvhBuildBenchmark, CollideMedian)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  RunCollide(BvhBuildStrategy::kMedianSplit, &state);
+}
+BENCHMARK_REGISTER_F(BvhBuildBenchmark, CollideMedian)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgName("asset")
+    ->DenseRange(0, 3);
+
+BENCHMARK_DEFINE_F(BvhBuildBenchmark, CollideSah)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  RunCollide(BvhBuildStrategy::kSurfaceAreaHeuristic, &state);
+}
+BENCHMARK_REGISTER_F(BvhBuildBenchmark, CollideSah)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgName("asset")
+    ->DenseRange(0, 3);
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+
+BENCHMARK_MAIN();
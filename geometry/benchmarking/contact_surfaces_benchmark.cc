@@ -0,0 +1,123 @@
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+
+#include "drake/geometry/proximity_engine.h"
+#include "drake/geometry/proximity_properties.h"
+#include "drake/geometry/shape_specification.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* @defgroup contact_surfaces_benchmarks Contact Surfaces Benchmarks
+ @ingroup proximity_queries
+
+ The benchmark evaluates how ProximityEngine::ComputeContactSurfaces() scales
+ with the number of hydroelastic contacts in the scene and with the number of
+ threads used to compute the contact surfaces (see
+ ProximityEngine::set_hydroelastic_num_threads()).
+
+ The scene is a row of soft spheres, each resting on (and penetrating) its own
+ rigid box. Every sphere-box pair produces one contact surface and no other
+ pairs collide, so the number of contact surfaces equals the number of pairs.
+ Arguments include:
+ - __num_pairs__: The number of sphere-box pairs in the scene.
+ - __num_threads__: The number of threads used to compute contact surfaces.
+
+ <h2>Running the benchmark</h2>
+
+ The benchmark can be executed as:
+
+ ```
+ bazel run //geometry/benchmarking:contact_surfaces_benchmark
+ ```
+
+ Each line of the output has the form:
+
+ ```
+ ContactSurfacesBenchmark/ComputeContactSurfaces/ARGS/real_time
+ ```
+
+ where `ARGS` is `num_pairs:N/num_threads:M`.
+
+ The reported time is wall-clock time, as the CPU time of the calling thread
+ does not account for the work done by the other threads. For a given
+ `num_pairs`, the ratio between the times reported for one thread and for N
+ threads is the speed up afforded by the thread pool.  */
+
+using math::RigidTransformd;
+
+const double kSphereRadius = 0.1;
+const double kResolutionHint = 0.02;
+const double kElasticModulus = 1.0e5;
+const Eigen::Vector3d kBoxSize{0.3, 0.3, 0.1};
+// The spacing between neighboring pairs, large enough that no two pairs
+// interact.
+const double kPairSpacing = 0.5;
+// How deeply each sphere penetrates its box.
+const double kPenetration = 0.02;
+
+class ContactSurfacesBenchmark : public benchmark::Fixture {
+ public:
+  // This apparently futile using statement works around "overloaded virtual"
+  // errors in g++. All of this is a consequence of the weird deprecation of
+  // const-ref State versions of SetUp() and TearDown() in benchmark.h.
+  using benchmark::Fixture::SetUp;
+  void SetUp(benchmark::State& state) override {
+    const int num_pairs = state.range(0);
+
+    ProximityProperties soft_properties;
+    AddContactMaterial(kElasticModulus, {}, {}, {}, &soft_properties);
+    AddSoftHydroelasticProperties(kResolutionHint, &soft_properties);
+    ProximityProperties rigid_properties;
+    AddRigidHydroelasticProperties(kResolutionHint, &rigid_properties);
+
+    engine_ = ProximityEngine<double>();
+    X_WGs_.clear();
+    const Sphere sphere(kSphereRadius);
+    const Box box(kBoxSize);
+    for (int i = 0; i < num_pairs; ++i) {
+      const double x = i * kPairSpacing;
+      const GeometryId sphere_id = GeometryId::get_new_id();
+      const RigidTransformd X_WS(
+          Eigen::Vector3d(x, 0, kSphereRadius - kPenetration));
+      engine_.AddDynamicGeometry(sphere, X_WS, sphere_id, soft_properties);
+      X_WGs_[sphere_id] = X_WS;
+
+      const GeometryId box_id = GeometryId::get_new_id();
+      const RigidTransformd X_WB(Eigen::Vector3d(x, 0, -kBoxSize.z() / 2));
+      engine_.AddDynamicGeometry(box, X_WB, box_id, rigid_properties);
+      X_WGs_[box_id] = X_WB;
+    }
+    engine_.UpdateWorldPoses(X_WGs_);
+    engine_.set_hydroelastic_num_threads(state.range(1));
+  }
+
+  ProximityEngine<double> engine_;
+  std::unordered_map<GeometryId, RigidTransformd> X_WGs_;
+};
+
+BENCHMARK_DEFINE_F(ContactSurfacesBenchmark, ComputeContactSurfaces)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  for (auto _ : state) {
+    const auto surfaces = engine_.ComputeContactSurfaces(X_WGs_);
+    if (static_cast<int>(surfaces.size()) != state.range(0)) {
+      state.SkipWithError("Unexpected number of contact surfaces");
+      break;
+    }
+  }
+}
+BENCHMARK_REGISTER_F(ContactSurfacesBenchmark, ComputeContactSurfaces)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->ArgNames({"num_pairs", "num_threads"})
+    ->ArgsProduct({{16, 64, 256}, {1, 2, 4, 8}});
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
+
+BENCHMARK_MAIN();
@@ -102,7 +102,9 @@ Resulting contact surface sizes:
  MeshIntersectionBenchmark/TestName/resolution/contact_overlap/rotation_factor/min_time
  ```
 
-   - __TestName__: RigidSoftMesh
+   - __TestName__: RigidSoftMesh, or RigidSoftMeshWorkspace when the
+     intersection reuses the same ContactSurfaceWorkspace in every iteration
+     (as ProximityEngine does) instead of allocating its buffers anew.
    - __resolution__: Affects the resolution of the ellipsoid and sphere
      meshes. Valid values must be one of [0, 1, 2, 3], where 0 produces the
      coarsest meshes and 3 produces the finest meshes. This is converted behind
@@ -244,22 +246,53 @@ BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, RigidSoftMesh)
   }
   RecordContactSurfaceResult(surface_SR.get(), "RigidSoftMesh", state);
 }
+
+BENCHMARK_DEFINE_F(MeshIntersectionBenchmark, RigidSoftMeshWorkspace)
+// NOLINTNEXTLINE(runtime/references)
+(benchmark::State& state) {
+  SetupMeshes(state);
+  const auto bvh_S = Bvh<Obb, VolumeMesh<double>>(mesh_S_);
+  const auto bvh_R = Bvh<Obb, SurfaceMesh<double>>(mesh_R_);
+  std::unique_ptr<SurfaceMesh<double>> surface_SR;
+  std::unique_ptr<SurfaceMeshFieldLinear<double, double>> e_SR;
+  std::vector<Vector3<double>> grad_eM_Ms;
+  ContactSurfaceWorkspace<double> workspace;
+  for (auto _ : state) {
+    SurfaceVolumeIntersector<double>(&workspace).SampleVolumeFieldOnSurface(
+        field_S_, bvh_S, mesh_R_, bvh_R, X_SR_,
+        ContactPolygonRepresentation::kCentroidSubdivision,
+        &surface_SR, &e_SR, &grad_eM_Ms);
+  }
+  RecordContactSurfaceResult(surface_SR.get(), "RigidSoftMeshWorkspace",
+                             state);
+}
+
+// The argument combinations of the RigidSoftMesh benchmarks.
+void RigidSoftMeshArgs(benchmark::internal::Benchmark* benchmark) {
+  benchmark
+      ->Args({0, 4, 0})  // 0 resolution, 4 contact overlap, 0 rotation factor.
+      ->Args({1, 4, 0})  // 1 resolution, 4 contact overlap, 0 rotation factor.
+      ->Args({2, 4, 0})  // 2 resolution, 4 contact overlap, 0 rotation factor.
+      ->Args({3, 4, 0})  // 3 resolution, 4 contact overlap, 0 rotation factor.
+      ->Args({2, 0, 0})  // 2 resolution, 0 contact overlap, 0 rotation factor.
+      ->Args({2, 1, 0})  // 2 resolution, 1 contact overlap, 0 rotation factor.
+      ->Args({2, 2, 0})  // 2 resolution, 2 contact overlap, 0 rotation factor.
+      ->Args({2, 3, 0})  // 2 resolution, 3 contact overlap, 0 rotation factor.
+      ->Args({2, 4, 1})  // 2 resolution, 4 contact overlap, 1 rotation factor.
+      ->Args({2, 4, 2})  // 2 resolution, 4 contact overlap, 2 rotation factor.
+      ->Args({2, 4, 3})  // 2 resolution, 4 contact overlap, 3 rotation factor.
+      ->Args({2, 3, 1})  // 2 resolution, 3 contact overlap, 1 rotation factor.
+      ->Args({2, 2, 2});  // 2 resolution, 2 contact overlap, 2 rotation factor.
+}
+
 BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, RigidSoftMesh)
     ->Unit(benchmark::kMillisecond)
     ->MinTime(2)
-    ->Args({0, 4, 0})   // 0 resolution, 4 contact overlap, 0 rotation factor.
-    ->Args({1, 4, 0})   // 1 resolution, 4 contact overlap, 0 rotation factor.
-    ->Args({2, 4, 0})   // 2 resolution, 4 contact overlap, 0 rotation factor.
-    ->Args({3, 4, 0})   // 3 resolution, 4 contact overlap, 0 rotation factor.
-    ->Args({2, 0, 0})   // 2 resolution, 0 contact overlap, 0 rotation factor.
-    ->Args({2, 1, 0})   // 2 resolution, 1 contact overlap, 0 rotation factor.
-    ->Args({2, 2, 0})   // 2 resolution, 2 contact overlap, 0 rotation factor.
-    ->Args({2, 3, 0})   // 2 resolution, 3 contact overlap, 0 rotation factor.
-    ->Args({2, 4, 1})   // 2 resolution, 4 contact overlap, 1 rotation factor.
-    ->Args({2, 4, 2})   // 2 resolution, 4 contact overlap, 2 rotation factor.
-    ->Args({2, 4, 3})   // 2 resolution, 4 contact overlap, 3 rotation factor.
-    ->Args({2, 3, 1})   // 2 resolution, 3 contact overlap, 1 rotation factor.
-    ->Args({2, 2, 2});  // 2 resolution, 2 contact overlap, 2 rotation factor.
+    ->Apply(RigidSoftMeshArgs);
+BENCHMARK_REGISTER_F(MeshIntersectionBenchmark, RigidSoftMeshWorkspace)
+    ->Unit(benchmark::kMillisecond)
+    ->MinTime(2)
+    ->Apply(RigidSoftMeshArgs);
 
 void ReportContactSurfaces() {
   std::cout << "Resulting contact surface sizes:" << std::endl;
@@ -53,7 +53,7 @@ const double kFovY = M_PI_4;
 
 /* The render engines generally supported by this benchmark; not all
  renderers are supported by all operating systems.  */
-enum class EngineType { Vtk, Gl };
+enum class EngineType { Vtk, VtkDepthOnly, Gl };
 
 /* Creates a render engine of the given type with the given background color.
  For each supported render engine type, this must be specialized. (See below.
@@ -171,6 +171,54 @@ class RenderBenchmark : public benchmark::Fixture {
     }
   }
 
+  /* Renders color, depth, and label images for every camera with a single
+   call to RenderEngine::RenderImages(). The benchmark state carries a fifth
+   argument: the number of render threads RenderEngineVtk may use.  */
+  // NOLINTNEXTLINE(runtime/references)
+  void BatchImages(::benchmark::State& state, const std::string& name) {
+    RenderEngineVtkParams params{{}, {}, bg_rgb_};
+    params.num_render_threads = state.range(4);
+    auto renderer = MakeRenderEngineVtk(params);
+    auto [sphere_count, camera_count, width, height] = ReadState(state);
+    SetupScene(sphere_count, camera_count, width, height, renderer.get());
+
+    /* Each camera writes to its own images; the requests may be rendered
+     concurrently.  */
+    std::vector<ImageRgba8U> color_images(camera_count,
+                                          ImageRgba8U(width, height));
+    std::vector<ImageDepth32F> depth_images(camera_count,
+                                            ImageDepth32F(width, height));
+    std::vector<ImageLabel16I> label_images(camera_count,
+                                            ImageLabel16I(width, height));
+    std::vector<ImageRenderRequest> requests(camera_count);
+    for (int i = 0; i < camera_count; ++i) {
+      ImageRenderRequest& request = requests[i];
+      request.X_WC = X_WC_;
+      request.color_camera =
+          ColorRenderCamera(depth_cameras_[i].core(), FLAGS_show_window);
+      request.depth_camera = depth_cameras_[i];
+      request.color_image_out = &color_images[i];
+      request.depth_image_out = &depth_images[i];
+      request.label_image_out = &label_images[i];
+    }
+
+    /* Warm start the engine (and its render threads); see ColorImage().  */
+    for (int i = 0; i < 2; ++i) {
+      renderer->RenderImages(requests);
+    }
+
+    /* Now the timed loop. */
+    for (auto _ : state) {
+      renderer->UpdatePoses(poses_);
+      renderer->RenderImages(requests);
+    }
+    if (!FLAGS_save_image_path.empty()) {
+      const std::string path_name = image_path_name(name, state, "png");
+      SaveToPng(color_images[0], path_name);
+      saved_image_paths.insert(path_name);
+    }
+  }
+
   /* Parse arguments from the benchmark state.
    @return A tuple representing the sphere count, camera count, width, and
            height.  */
@@ -285,9 +333,9 @@ class RenderBenchmark : public benchmark::Fixture {
     const Vector3d Cx_W{1, 0, 0};
     const Vector3d Cy_W{0, -1, 0};
     const Vector3d Cz_W{0, 0, -1};
-    RigidTransformd X_WC{
+    X_WC_ = RigidTransformd{
         RotationMatrixd::MakeFromOrthonormalColumns(Cx_W, Cy_W, Cz_W)};
-    engine->UpdateViewpoint(X_WC);
+    engine->UpdateViewpoint(X_WC_);
 
     // Add the cameras.
     for (int i = 0; i < camera_count; ++i) {
@@ -318,6 +366,7 @@ class RenderBenchmark : public benchmark::Fixture {
   const Vector3d bg_rgb_{200 / 255., 0, 250 / 255.};
   const Rgba sphere_rgba_{0, 0.8, 0.5, 1};
   std::unordered_map<GeometryId, RigidTransformd> poses_;
+  RigidTransformd X_WC_;
 };
 std::set<std::string> RenderBenchmark::saved_image_paths;
 
@@ -378,6 +427,32 @@ MAKE_BENCHMARK(Vtk, Color);
 MAKE_BENCHMARK(Vtk, Depth);
 MAKE_BENCHMARK(Vtk, Label);
 
+/* RenderEngineVtk configured to render depth images only.  */
+template <>
+std::unique_ptr<RenderEngine> MakeEngine<EngineType::VtkDepthOnly>(
+    const Vector3d& bg_rgb) {
+  RenderEngineVtkParams params{{}, {}, bg_rgb};
+  params.depth_only = true;
+  return MakeRenderEngineVtk(params);
+}
+
+MAKE_BENCHMARK(VtkDepthOnly, Depth);
+
+/* Batched multi-camera rendering with RenderEngineVtk. The parameters are
+ 5-tuples of: sphere count, camera count, image width, image height, and the
+ number of render threads.  */
+BENCHMARK_DEFINE_F(RenderBenchmark, VtkBatch)(benchmark::State& state) {
+  BatchImages(state, "VtkBatch");
+}
+BENCHMARK_REGISTER_F(RenderBenchmark, VtkBatch)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Args({120, 4, 640, 480, 1})
+    ->Args({120, 4, 640, 480, 2})
+    ->Args({120, 4, 640, 480, 4})
+    ->Args({1200, 10, 640, 480, 1})
+    ->Args({1200, 10, 640, 480, 4});
+
 #ifdef RENDER_ENGINE_GL_SUPPORTED
 template <>
 std::unique_ptr<RenderEngine> MakeEngine<EngineType::Gl>(
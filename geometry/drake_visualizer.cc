@@ -225,6 +225,19 @@ DrakeVisualizer<T>::DrakeVisualizer(lcm::DrakeLcmInterface* lcm,
         "Role::kUnassigned value. Please choose proximity, perception, or "
         "illustration");
   }
+  if (params_.publish_changed_poses_only) {
+    if (params_.pose_change_tolerance < 0) {
+      throw std::runtime_error(fmt::format(
+          "DrakeVisualizer requires a non-negative pose change tolerance; {} "
+          "was given",
+          params_.pose_change_tolerance));
+    }
+    if (params_.full_draw_period <= 0) {
+      throw std::runtime_error(fmt::format(
+          "DrakeVisualizer requires a positive full draw period; {} was given",
+          params_.full_draw_period));
+    }
+  }
 
   this->DeclarePeriodicPublishEvent(params_.publish_period, 0.0,
                                     &DrakeVisualizer<T>::SendGeometryMessage);
@@ -265,7 +278,7 @@ EventStatus DrakeVisualizer<T>::SendGeometryMessage(
   }
 
   SendDrawMessage(query_object, EvalDynamicFrameData(context),
-                  ExtractDoubleOrThrow(context.get_time()), lcm_);
+                  send_load_message, ExtractDoubleOrThrow(context.get_time()));
 
   return EventStatus::Succeeded();
 }
@@ -344,41 +357,79 @@ void DrakeVisualizer<T>::SendLoadMessage(
 template <typename T>
 void DrakeVisualizer<T>::SendDrawMessage(
     const QueryObject<T>& query_object,
-    const vector<internal::DynamicFrameData>& dynamic_frames, double time,
-    lcm::DrakeLcmInterface* lcm) {
+    const vector<internal::DynamicFrameData>& dynamic_frames, bool loaded,
+    double time) const {
+  const int frame_count = static_cast<int>(dynamic_frames.size());
+  vector<RigidTransformd> X_WFs;
+  X_WFs.reserve(frame_count);
+  for (int i = 0; i < frame_count; ++i) {
+    X_WFs.push_back(internal::convert_to_double(
+        query_object.GetPoseInWorld(dynamic_frames[i].frame_id)));
+  }
+
+  // The indices of the frames to include in the message.
+  vector<int> frames;
+  frames.reserve(frame_count);
+  if (params_.publish_changed_poses_only) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // A full draw message is due after a load message, after the full draw
+    // period, or if time has gone backwards (e.g., a new simulation).
+    const bool full_draw =
+        loaded || static_cast<int>(sent_poses_.size()) != frame_count ||
+        !last_full_draw_time_.has_value() || time < *last_full_draw_time_ ||
+        time >= *last_full_draw_time_ + params_.full_draw_period;
+    if (full_draw) {
+      last_full_draw_time_ = time;
+      sent_poses_ = X_WFs;
+    }
+    for (int i = 0; i < frame_count; ++i) {
+      if (full_draw) {
+        frames.push_back(i);
+      } else if (!X_WFs[i].IsNearlyEqualTo(sent_poses_[i],
+                                           params_.pose_change_tolerance)) {
+        sent_poses_[i] = X_WFs[i];
+        frames.push_back(i);
+      }
+    }
+  } else {
+    for (int i = 0; i < frame_count; ++i) {
+      frames.push_back(i);
+    }
+  }
+
   lcmt_viewer_draw message{};
 
-  const int frame_count = static_cast<int>(dynamic_frames.size());
+  const int link_count = static_cast<int>(frames.size());
 
   message.timestamp = static_cast<int64_t>(time * 1000.0);
-  message.num_links = frame_count;
-  message.link_name.resize(frame_count);
-  message.robot_num.resize(frame_count);
-  message.position.resize(frame_count);
-  message.quaternion.resize(frame_count);
+  message.num_links = link_count;
+  message.link_name.resize(link_count);
+  message.robot_num.resize(link_count);
+  message.position.resize(link_count);
+  message.quaternion.resize(link_count);
 
   const SceneGraphInspector<T>& inspector = query_object.inspector();
-  for (int i = 0; i < frame_count; ++i) {
+  for (int j = 0; j < link_count; ++j) {
+    const int i = frames[j];
     const FrameId frame_id = dynamic_frames[i].frame_id;
-    message.robot_num[i] = inspector.GetFrameGroup(frame_id);
-    message.link_name[i] = dynamic_frames[i].name;
+    message.robot_num[j] = inspector.GetFrameGroup(frame_id);
+    message.link_name[j] = dynamic_frames[i].name;
 
-    const math::RigidTransformd& X_WF =
-        internal::convert_to_double(query_object.GetPoseInWorld(frame_id));
-    message.position[i].resize(3);
-    message.position[i][0] = X_WF.translation()[0];
-    message.position[i][1] = X_WF.translation()[1];
-    message.position[i][2] = X_WF.translation()[2];
+    const math::RigidTransformd& X_WF = X_WFs[i];
+    message.position[j].resize(3);
+    message.position[j][0] = X_WF.translation()[0];
+    message.position[j][1] = X_WF.translation()[1];
+    message.position[j][2] = X_WF.translation()[2];
 
     const Eigen::Quaternion<double> q = X_WF.rotation().ToQuaternion();
-    message.quaternion[i].resize(4);
-    message.quaternion[i][0] = q.w();
-    message.quaternion[i][1] = q.x();
-    message.quaternion[i][2] = q.y();
-    message.quaternion[i][3] = q.z();
+    message.quaternion[j].resize(4);
+    message.quaternion[j][0] = q.w();
+    message.quaternion[j][1] = q.x();
+    message.quaternion[j][2] = q.y();
+    message.quaternion[j][3] = q.z();
   }
 
-  lcm::Publish(lcm, "DRAKE_VIEWER_DRAW", message, time);
+  lcm::Publish(lcm_, "DRAKE_VIEWER_DRAW", message, time);
 }
 
 template <typename T>
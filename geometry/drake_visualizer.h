@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -11,6 +12,7 @@
 #include "drake/geometry/geometry_version.h"
 #include "drake/geometry/query_object.h"
 #include "drake/lcm/drake_lcm_interface.h"
+#include "drake/math/rigid_transform.h"
 #include "drake/systems/framework/diagram_builder.h"
 #include "drake/systems/framework/event_status.h"
 #include "drake/systems/framework/input_port.h"
@@ -94,6 +96,14 @@ struct DynamicFrameData {
  specification files, they would not be parsed. They must be added to the
  geometries after parsing.
 
+ <h3>Change-only publishing</h3>
+
+ By default, every draw message includes the poses of all dynamic frames. With
+ DrakeVisualizerParams::publish_changed_poses_only, a draw message only includes
+ the frames whose poses have changed since they were last sent, with periodic
+ full draw messages so that a late-joining viewer can recover. This greatly
+ reduces the LCM bandwidth when most of the scene is static.
+
  <h3>Effective visualization</h3>
 
  The best visualization is when draw messages have been preceded by a compatible
@@ -128,7 +138,10 @@ class DrakeVisualizer final : public systems::LeafSystem<T> {
                   remain valid for the lifetime of this object.
    @param params  The set of parameters to control this system's behavior.
    @throws std::exception if `params.publish_period <= 0`.
-   @throws std::exception if `params.role == Role::kUnassigned`.  */
+   @throws std::exception if `params.role == Role::kUnassigned`.
+   @throws std::exception if `params.publish_changed_poses_only` is true and
+           `params.pose_change_tolerance < 0` or
+           `params.full_draw_period <= 0`.  */
   DrakeVisualizer(lcm::DrakeLcmInterface* lcm = nullptr,
                   DrakeVisualizerParams params = {});
 
@@ -219,11 +232,14 @@ class DrakeVisualizer final : public systems::LeafSystem<T> {
       double time, lcm::DrakeLcmInterface* lcm);
 
   /* Dispatches a "draw" message for geometry that is known to have been
-   loaded.  */
-  static void SendDrawMessage(
+   loaded. With params_.publish_changed_poses_only, the message only includes
+   the frames whose poses have changed since they were last sent, unless a
+   full draw message is due; `loaded` indicates that a load message was just
+   sent, which always requires a full draw message.  */
+  void SendDrawMessage(
       const QueryObject<T>& query_object,
       const std::vector<internal::DynamicFrameData>& dynamic_frames,
-      double time, lcm::DrakeLcmInterface* lcm);
+      bool loaded, double time) const;
 
   /* Identifies all of the frames with dynamic data and stores them (with
    additional data) in the given vector `frame_data`.  */
@@ -266,6 +282,13 @@ class DrakeVisualizer final : public systems::LeafSystem<T> {
   mutable GeometryVersion version_;
   mutable std::mutex mutex_;
 
+  /* With params_.publish_changed_poses_only, the poses last sent for the
+   dynamic frames (in the order of the dynamic frame data) and the time of the
+   last full draw message. Like version_, these model the state of the
+   drake_visualizer application and are guarded by mutex_.  */
+  mutable std::vector<math::RigidTransformd> sent_poses_;
+  mutable std::optional<double> last_full_draw_time_;
+
   /* The index of this System's QueryObject-valued input port.  */
   int query_object_input_port_{};
 
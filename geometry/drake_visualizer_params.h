@@ -17,6 +17,25 @@ struct DrakeVisualizerParams {
 
   /** The color to apply to any geometry that hasn't defined one.  */
   Rgba default_color{0.9, 0.9, 0.9, 1.0};
+
+  /** If true, a draw message only includes the frames whose poses have
+   changed (by more than `pose_change_tolerance`) since they were last sent;
+   the viewer keeps the last received pose of every omitted frame. When most
+   of the scene is static, this greatly reduces the size of the draw messages.
+   So that a viewer which starts listening late can recover the full scene, a
+   draw message with the poses of all frames is sent every `full_draw_period`
+   seconds (and with every load message).  */
+  bool publish_changed_poses_only{false};
+
+  /** When `publish_changed_poses_only` is true, a frame's pose has changed if
+   any element of its rotation matrix or its position differs from the pose
+   last sent by more than this tolerance (see
+   math::RigidTransform::IsNearlyEqualTo()).  */
+  double pose_change_tolerance{0.0};
+
+  /** When `publish_changed_poses_only` is true, the duration (in seconds)
+   between draw messages that include the poses of all frames.  */
+  double full_draw_period{1.0};
 };
 
 }  // namespace geometry
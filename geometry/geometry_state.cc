@@ -4,6 +4,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include <fmt/format.h>
@@ -11,6 +12,7 @@
 #include "drake/common/autodiff.h"
 #include "drake/common/default_scalars.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/unused.h"
 #include "drake/geometry/geometry_frame.h"
 #include "drake/geometry/geometry_instance.h"
 #include "drake/geometry/geometry_roles.h"
@@ -112,6 +114,21 @@ std::string get_missing_id_message<GeometryId>(const GeometryId& key) {
   return ss.str();
 }
 
+// Reports if the pose X_new differs from X_old. Only double-valued poses are
+// compared (exactly); poses of any other scalar type carry derivatives that
+// can change even when the values don't, so they are always reported as
+// changed.
+template <typename T>
+bool PoseChanged(const RigidTransform<T>& X_old,
+                 const RigidTransform<T>& X_new) {
+  if constexpr (std::is_same_v<T, double>) {
+    return !X_old.IsExactlyEqualTo(X_new);
+  } else {
+    unused(X_old, X_new);
+    return true;
+  }
+}
+
 //-----------------------------------------------------------------------------
 
 template <typename T>
@@ -556,6 +573,7 @@ FrameId GeometryState<T>::RegisterFrame(SourceId source_id, FrameId parent_id,
   }
 
   DRAKE_ASSERT(X_PF_.size() == frame_index_to_id_map_.size());
+  frames_need_pose_update_ = true;
   int index(static_cast<int>(X_PF_.size()));
   X_PF_.emplace_back(RigidTransform<T>::Identity());
   X_WF_.emplace_back(RigidTransform<T>::Identity());
@@ -947,8 +965,8 @@ void GeometryState<T>::AddRenderer(
       if (accepting_renderers.empty() || accepting_renderers.count(name) > 0) {
         const GeometryId id = id_geo_pair.first;
         accepted |= render_engine->RegisterVisual(
-            id, geometry.shape(), *properties, RigidTransformd(geometry.X_FG()),
-            geometry.is_dynamic());
+            id, geometry.shape(), *properties,
+            convert_to_double(X_WGs_.at(id)), geometry.is_dynamic());
       }
     }
   }
@@ -1009,6 +1027,75 @@ void GeometryState<T>::RenderLabelImage(const ColorRenderCamera& camera,
   engine.RenderLabelImage(camera, label_image_out);
 }
 
+template <typename T>
+void GeometryState<T>::RenderImages(
+    const std::vector<render::ImageRenderRequest>& requests) const {
+  // The requests are grouped by renderer (in order of first appearance); every
+  // renderer is looked up before any image is rendered.
+  std::vector<std::pair<const render::RenderEngine*,
+                        std::vector<render::ImageRenderRequest>>>
+      batches;
+  for (const render::ImageRenderRequest& request : requests) {
+    const std::string* renderer_name = nullptr;
+    if (request.color_camera.has_value()) {
+      renderer_name = &request.color_camera->core().renderer_name();
+    }
+    if (request.depth_camera.has_value()) {
+      const std::string& depth_renderer_name =
+          request.depth_camera->core().renderer_name();
+      if (renderer_name != nullptr && *renderer_name != depth_renderer_name) {
+        throw std::logic_error(fmt::format(
+            "RenderImages(): a request's color and depth cameras must use the "
+            "same renderer; given '{}' and '{}'",
+            *renderer_name, depth_renderer_name));
+      }
+      renderer_name = &depth_renderer_name;
+    }
+    if (renderer_name == nullptr) {
+      if (request.color_image_out != nullptr ||
+          request.depth_image_out != nullptr ||
+          request.label_image_out != nullptr) {
+        throw std::logic_error(
+            "RenderImages(): a request for an image must provide a camera");
+      }
+      continue;
+    }
+    const render::RenderEngine* engine =
+        &GetRenderEngineOrThrow(*renderer_name);
+    auto iter = std::find_if(batches.begin(), batches.end(),
+                             [engine](const auto& batch) {
+                               return batch.first == engine;
+                             });
+    if (iter == batches.end()) {
+      iter = batches.emplace(batches.end(), engine,
+                             std::vector<render::ImageRenderRequest>());
+    }
+    iter->second.push_back(request);
+  }
+
+  for (const auto& [engine, batch] : batches) {
+    engine->RenderImages(batch);
+  }
+}
+
+template <typename T>
+void GeometryState<T>::set_hydroelastic_contact_params(
+    const HydroelasticContactParams& params) {
+  geometry_engine_->set_hydroelastic_num_threads(params.num_threads);
+  geometry_engine_->set_hydroelastic_coherence_enabled(
+      params.exploit_temporal_coherence);
+}
+
+template <typename T>
+HydroelasticContactParams GeometryState<T>::get_hydroelastic_contact_params()
+    const {
+  HydroelasticContactParams params;
+  params.num_threads = geometry_engine_->hydroelastic_num_threads();
+  params.exploit_temporal_coherence =
+      geometry_engine_->hydroelastic_coherence_enabled();
+  return params;
+}
+
 template <typename T>
 std::unique_ptr<GeometryState<AutoDiffXd>> GeometryState<T>::ToAutoDiffXd()
     const {
@@ -1053,7 +1140,8 @@ void GeometryState<T>::SetFramePoses(
   ValidateFrameIds(source_id, poses);
   const RigidTransform<T> world_pose = RigidTransform<T>::Identity();
   for (auto frame_id : source_root_frame_map_[source_id]) {
-    UpdatePosesRecursively(frames_[frame_id], world_pose, poses);
+    UpdatePosesRecursively(frames_[frame_id], world_pose, poses,
+                           frames_need_pose_update_);
   }
 }
 
@@ -1084,10 +1172,16 @@ void GeometryState<T>::ValidateFrameIds(
 
 template <typename T>
 void GeometryState<T>::FinalizePoseUpdate() {
-  geometry_engine_->UpdateWorldPoses(X_WGs_);
+  // The engines received the current pose of every geometry when it was
+  // registered with them, so only the geometries that have moved since need
+  // to be pushed.
+  geometry_engine_->UpdateWorldPoses(updated_world_poses_);
   for (auto& pair : render_engines_) {
-    pair.second->UpdatePoses(X_WGs_);
+    pair.second->UpdatePoses(updated_world_poses_);
   }
+  num_geometries_with_updated_poses_ = updated_world_poses_.size();
+  updated_world_poses_.clear();
+  frames_need_pose_update_ = false;
 }
 
 template <typename T>
@@ -1151,26 +1245,31 @@ void GeometryState<T>::RemoveGeometryUnchecked(GeometryId geometry_id,
 template <typename T>
 void GeometryState<T>::UpdatePosesRecursively(
     const internal::InternalFrame& frame, const RigidTransform<T>& X_WP,
-    const FramePoseVector<T>& poses) {
+    const FramePoseVector<T>& poses, bool parent_moved) {
   const auto frame_id = frame.id();
   const auto& X_PF = poses.value(frame_id);
-  // Cache this transform for later use.
-  X_PF_[frame.index()] = X_PF;
-  RigidTransform<T> X_WF = X_WP * X_PF;
-  X_WF_[frame.index()] = X_WF;
-  // Update the geometry which belong to *this* frame.
-  for (auto child_id : frame.child_geometries()) {
-    auto& child_geometry = geometries_[child_id];
-    // X_FG() is always RigidTransform<double>, to account for
-    // GeometryState<AutoDiff>, we need to cast it to the common type T.
-    RigidTransform<double> X_FG(child_geometry.X_FG());
-    X_WGs_[child_id] = X_WF * X_FG.cast<T>();
-  }
-
-  // Update each child frame.
+  const bool moved = parent_moved || PoseChanged(X_PF_[frame.index()], X_PF);
+  if (moved) {
+    // Cache this transform for later use.
+    X_PF_[frame.index()] = X_PF;
+    X_WF_[frame.index()] = X_WP * X_PF;
+    const RigidTransform<T>& X_WF = X_WF_[frame.index()];
+    // Update the geometry which belong to *this* frame.
+    for (auto child_id : frame.child_geometries()) {
+      auto& child_geometry = geometries_[child_id];
+      // X_FG() is always RigidTransform<double>, to account for
+      // GeometryState<AutoDiff>, we need to cast it to the common type T.
+      RigidTransform<double> X_FG(child_geometry.X_FG());
+      RigidTransform<T>& X_WG = X_WGs_[child_id];
+      X_WG = X_WF * X_FG.cast<T>();
+      updated_world_poses_.Append(child_id, X_WG);
+    }
+  }
+
+  // Update each child frame; even if this frame didn't move, they may have.
   for (auto child_id : frame.child_frames()) {
     auto& child_frame = frames_[child_id];
-    UpdatePosesRecursively(child_frame, X_WF, poses);
+    UpdatePosesRecursively(child_frame, X_WF_[frame.index()], poses, moved);
   }
 }
 
@@ -18,12 +18,14 @@
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/geometry_set.h"
 #include "drake/geometry/geometry_version.h"
+#include "drake/geometry/hydroelastic_contact_params.h"
 #include "drake/geometry/internal_frame.h"
 #include "drake/geometry/internal_geometry.h"
 #include "drake/geometry/proximity_engine.h"
 #include "drake/geometry/render/render_camera.h"
 #include "drake/geometry/render/render_engine.h"
 #include "drake/geometry/utilities.h"
+#include "drake/geometry/world_pose_buffer.h"
 
 namespace drake {
 namespace geometry {
@@ -264,6 +266,16 @@ class GeometryState {
   /** Implementation of QueryObject::GetPoseInParent().  */
   const math::RigidTransform<T>& get_pose_in_parent(FrameId frame_id) const;
 
+  /** Reports the number of geometries whose world poses were recomputed (and
+   pushed to the proximity and render engines) by the most recent pose update.
+   A frame whose pose relative to its parent is unchanged since the previous
+   update is skipped along with its geometries, unless an ancestor frame
+   moved. (Only double-valued poses are compared; for other scalars every
+   frame is considered to have moved.)  */
+  int num_geometries_with_updated_poses() const {
+    return num_geometries_with_updated_poses_;
+  }
+
   //@}
 
   /** @name        State management
@@ -440,6 +452,12 @@ class GeometryState {
     return geometry_engine_->HasCollisions();
   }
 
+  /** Implementation of SceneGraph::set_hydroelastic_contact_params().  */
+  void set_hydroelastic_contact_params(const HydroelasticContactParams& params);
+
+  /** Implementation of SceneGraph::get_hydroelastic_contact_params().  */
+  HydroelasticContactParams get_hydroelastic_contact_params() const;
+
   //@}
 
   /** @name        Collision filtering    */
@@ -483,6 +501,13 @@ class GeometryState {
                                                           threshold);
   }
 
+  /** Implementation of QueryObject::ComputeSignedDistanceToPoints().  */
+  SignedDistanceToPointBatch<T> ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs, double threshold) const {
+    return geometry_engine_->ComputeSignedDistanceToPoints(p_WQs, X_WGs_,
+                                                           threshold);
+  }
+
   //@}
 
   //---------------------------------------------------------------------------
@@ -532,6 +557,11 @@ class GeometryState {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Implementation of QueryObject::RenderImages().
+   @pre All poses have already been updated.  */
+  void RenderImages(
+      const std::vector<render::ImageRenderRequest>& requests) const;
+
   //@}
 
   /** @name Scalar conversion */
@@ -567,7 +597,11 @@ class GeometryState {
         frame_index_to_id_map_(source.frame_index_to_id_map_),
         geometry_engine_(std::move(source.geometry_engine_->ToAutoDiffXd())),
         render_engines_(source.render_engines_),
-        geometry_version_(source.geometry_version_) {
+        geometry_version_(source.geometry_version_),
+        frames_need_pose_update_(source.frames_need_pose_update_),
+        updated_world_poses_(source.updated_world_poses_),
+        num_geometries_with_updated_poses_(
+            source.num_geometries_with_updated_poses_) {
     auto convert_pose_vector = [](const std::vector<math::RigidTransform<U>>& s,
                                   std::vector<math::RigidTransform<T>>* d) {
       std::vector<math::RigidTransform<T>>& dest = *d;
@@ -661,10 +695,14 @@ class GeometryState {
 
   // Recursively updates the frame and geometry _pose_ information for the tree
   // rooted at the given frame, whose parent's pose in the world frame is given
-  // as `X_WP`.
+  // as `X_WP`. Only those frames which moved (i.e., whose pose in their parent
+  // changed, or whose parent moved as indicated by `parent_moved`) are
+  // updated; their child geometries are recorded in
+  // `updated_world_poses_`.
   void UpdatePosesRecursively(const internal::InternalFrame& frame,
                               const math::RigidTransform<T>& X_WP,
-                              const FramePoseVector<T>& poses);
+                              const FramePoseVector<T>& poses,
+                              bool parent_moved);
 
   // Reports true if the given id refers to a _dynamic_ geometry. Assumes the
   // precondition that id refers to a valid geometry in the state.
@@ -834,6 +872,19 @@ class GeometryState {
 
   // The version for this geometry data.
   GeometryVersion geometry_version_;
+
+  // If true, the next pose update treats every frame as having moved. Newly
+  // registered frames report identity poses until they are first posed, so
+  // registering a frame sets this.
+  bool frames_need_pose_update_{false};
+
+  // The world poses of the geometries which have been recomputed by
+  // SetFramePoses() since the last FinalizePoseUpdate(); only these are pushed
+  // to the engines, which read them in place.
+  internal::WorldPoseBuffer updated_world_poses_;
+
+  // The size of updated_world_poses_ at the last FinalizePoseUpdate().
+  int num_geometries_with_updated_poses_{0};
 };
 }  // namespace geometry
 }  // namespace drake
@@ -0,0 +1,27 @@
+#pragma once
+
+namespace drake {
+namespace geometry {
+
+/** The set of parameters for configuring how SceneGraph computes hydroelastic
+ contact surfaces (see QueryObject::ComputeContactSurfaces() and its
+ variants). They affect the cost of the computation, but not the contact
+ surfaces it produces.  */
+struct HydroelasticContactParams {
+  /** The maximum number of threads used to compute the contact surfaces
+   (including the calling thread). With more than one thread, the candidate
+   pairs reported by the broadphase are collected first and their contact
+   surfaces are then computed concurrently.  */
+  int num_threads{1};
+
+  /** If true, the computation exploits the temporal coherence of consecutive
+   queries: for each pair of soft and rigid meshes, the next query's traversal
+   of their bounding volume hierarchies starts where the previous query's
+   stopped. This pays off when the geometries move little between queries
+   (e.g., in quasi-static manipulation). The data it keeps is specific to the
+   Context in which the queries are evaluated.  */
+  bool exploit_temporal_coherence{false};
+};
+
+}  // namespace geometry
+}  // namespace drake
@@ -1,11 +1,14 @@
 #include "drake/geometry/meshcat.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <exception>
 #include <fstream>
 #include <functional>
 #include <future>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <sstream>
@@ -13,6 +16,7 @@
 #include <thread>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <App.h>
 #include <fmt/format.h>
@@ -53,6 +57,43 @@ const std::string& GetUrlContent(std::string_view url_path) {
   return meshcat_html.access();
 }
 
+// Encodes `data` as base64 (RFC 4648, with padding).
+std::string EncodeBase64(std::string_view data) {
+  static constexpr char kAlphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string result;
+  result.reserve(4 * ((data.size() + 2) / 3));
+  size_t i = 0;
+  for (; i + 2 < data.size(); i += 3) {
+    const uint32_t bits = (static_cast<uint8_t>(data[i]) << 16) |
+                          (static_cast<uint8_t>(data[i + 1]) << 8) |
+                          static_cast<uint8_t>(data[i + 2]);
+    result.push_back(kAlphabet[(bits >> 18) & 0x3F]);
+    result.push_back(kAlphabet[(bits >> 12) & 0x3F]);
+    result.push_back(kAlphabet[(bits >> 6) & 0x3F]);
+    result.push_back(kAlphabet[bits & 0x3F]);
+  }
+  if (i < data.size()) {
+    uint32_t bits = static_cast<uint8_t>(data[i]) << 16;
+    if (i + 1 < data.size()) {
+      bits |= static_cast<uint8_t>(data[i + 1]) << 8;
+    }
+    result.push_back(kAlphabet[(bits >> 18) & 0x3F]);
+    result.push_back(kAlphabet[(bits >> 12) & 0x3F]);
+    result.push_back(i + 1 < data.size() ? kAlphabet[(bits >> 6) & 0x3F] : '=');
+    result.push_back('=');
+  }
+  return result;
+}
+
+// Replaces the (first) occurrence of `target` in `html` with `replacement`.
+void ReplaceInHtml(std::string_view target, std::string_view replacement,
+                   std::string* html) {
+  const size_t pos = html->find(target);
+  DRAKE_DEMAND(pos != std::string::npos);
+  html->replace(pos, target.size(), replacement);
+}
+
 }  // namespace
 
 namespace drake {
@@ -66,7 +107,9 @@ using math::RotationMatrixd;
 constexpr static bool kSsl = false;
 constexpr static bool kIsServer = true;
 struct PerSocketData {
-  // Intentionally left empty.
+  // True if this socket is (temporarily) not receiving set_transforms messages
+  // because it is congested.
+  bool skipping_transforms{false};
 };
 using WebSocket = uWS::WebSocket<kSsl, kIsServer, PerSocketData>;
 using MsgPackMap = std::map<std::string, msgpack::object>;
@@ -77,14 +120,24 @@ using MsgPackMap = std::map<std::string, msgpack::object>;
 // reasonable meshfiles.
 constexpr static double kMaxBackPressure{50 * 1024 * 1024};
 
+// The backpressure, in bytes, above which a websocket is considered congested
+// for transform updates. Rather than queueing more transforms behind a backlog,
+// a congested websocket skips set_transforms messages until it has drained,
+// and is then (alone) brought up to date with the latest transform of every
+// path. To that end, set_transforms messages are published to their own
+// "transforms" topic, rather than to "all".
+constexpr static unsigned int kMaxTransformBackPressure{256 * 1024};
+
 class SceneTreeElement {
  public:
   // Member access methods (object_, transform_, and properties_ should be
   // effectively public).
   const std::optional<std::string>& object() const { return object_; }
   std::optional<std::string>& object() { return object_; }
-  const std::optional<std::string>& transform() const { return transform_; }
-  std::optional<std::string>& transform() { return transform_; }
+  const std::optional<internal::SetTransformData>& transform() const {
+    return transform_;
+  }
+  std::optional<internal::SetTransformData>& transform() { return transform_; }
   const std::map<std::string, std::string>& properties() const {
     return properties_;
   }
@@ -159,22 +212,25 @@ class SceneTreeElement {
     child->second->Delete(path.substr(loc + 1));
   }
 
-  // Sends the entire tree on `ws`.
-  void Send(WebSocket* ws) {
+  // Calls `send` with each of the (msgpack'd) messages that reproduce the
+  // entire tree.
+  void Send(const std::function<void(const std::string&)>& send) const {
     if (object_) {
-      ws->send(*object_);
+      send(*object_);
     }
     if (transform_) {
-      ws->send(*transform_);
+      std::stringstream message_stream;
+      msgpack::pack(message_stream, *transform_);
+      send(message_stream.str());
     }
     for (const auto& [property, msg] : properties_) {
       unused(property);
-      ws->send(msg);
+      send(msg);
     }
 
     for (const auto& [name, child] : children_) {
       unused(name);
-      child->Send(ws);
+      child->Send(send);
     }
   }
 
@@ -184,8 +240,9 @@ class SceneTreeElement {
 
   // The msgpack'd set_object command.
   std::optional<std::string> object_{std::nullopt};
-  // The msgpack'd set_transform command.
-  std::optional<std::string> transform_{std::nullopt};
+  // The set_transform command; it is packed on demand because transforms are
+  // typically updated far more often than they are sent to new websockets.
+  std::optional<internal::SetTransformData> transform_{std::nullopt};
   // The msgpack'd set_property command(s).
   std::map<std::string, std::string> properties_{};
   // Children, with the key value denoting their (relative) path name.
@@ -419,6 +476,7 @@ class Meshcat::WebSocketPublisher {
       return;
     }
     object3d.geometry = reifier.uuid();
+    CloseTransformBatch();
 
     loop_->defer([this, data = std::move(data)]() {
       std::stringstream message_stream;
@@ -440,6 +498,7 @@ class Meshcat::WebSocketPublisher {
     internal::SetCameraData<CameraData> data;
     data.path = std::move(path);
     data.object.object = std::move(camera);
+    CloseTransformBatch();
 
     loop_->defer([this, data = std::move(data)]() {
       std::stringstream message_stream;
@@ -460,17 +519,78 @@ class Meshcat::WebSocketPublisher {
     internal::SetTransformData data;
     data.path = FullPath(path);
     Eigen::Map<Eigen::Matrix4d>(data.matrix) = X_ParentPath.GetAsMatrix4();
+    // The next SetTransforms() must not skip this path.
+    last_sent_transforms_.erase(data.path);
+    CloseTransformBatch();
 
     loop_->defer([this, data = std::move(data)]() {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
-      std::string message = message_stream.str();
-      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
+      latest_transforms_.erase(data.path);
       SceneTreeElement& e = scene_tree_root_[data.path];
-      e.transform() = std::move(message);
+      e.transform() = data;
     });
   }
 
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<RigidTransformd>& X_ParentPaths,
+                     double tolerance) {
+    DRAKE_DEMAND(std::this_thread::get_id() == main_thread_id_);
+    DRAKE_DEMAND(app_ != nullptr);
+    DRAKE_DEMAND(loop_ != nullptr);
+    DRAKE_THROW_UNLESS(paths.size() == X_ParentPaths.size());
+    DRAKE_THROW_UNLESS(tolerance >= 0.0);
+
+    // Collect the paths whose transforms have changed by more than tolerance
+    // since they were last sent.
+    std::vector<std::pair<std::string, Eigen::Matrix4d>> changed;
+    for (size_t i = 0; i < paths.size(); ++i) {
+      std::string full_path = FullPath(paths[i]);
+      const Eigen::Matrix4d matrix = X_ParentPaths[i].GetAsMatrix4();
+      auto iter = last_sent_transforms_.find(full_path);
+      if (iter != last_sent_transforms_.end()) {
+        if ((iter->second - matrix).cwiseAbs().maxCoeff() <= tolerance) {
+          continue;
+        }
+        iter->second = matrix;
+      } else {
+        last_sent_transforms_.emplace(full_path, matrix);
+      }
+      changed.emplace_back(std::move(full_path), matrix);
+    }
+    if (changed.empty()) return;
+
+    // Add the changes to the open batch if the websocket thread hasn't taken it
+    // yet; otherwise open a new batch. Frames published faster than the
+    // websocket thread can send them are thereby coalesced, rather than queued.
+    std::shared_ptr<TransformBatch> batch = open_transform_batch_;
+    std::unique_lock<std::mutex> lock;
+    if (batch != nullptr) {
+      lock = std::unique_lock<std::mutex>(batch->mutex);
+      if (batch->taken) {
+        lock.unlock();
+        batch.reset();
+      }
+    }
+    const bool new_batch = (batch == nullptr);
+    if (new_batch) {
+      batch = std::make_shared<TransformBatch>();
+      open_transform_batch_ = batch;
+      lock = std::unique_lock<std::mutex>(batch->mutex);
+    }
+    for (auto& [full_path, matrix] : changed) {
+      batch->transforms[std::move(full_path)] = matrix;
+    }
+    lock.unlock();
+
+    if (new_batch) {
+      loop_->defer([this, batch = std::move(batch)]() {
+        SendTransformBatch(batch.get());
+      });
+    }
+  }
+
   void Delete(std::string_view path) {
     DRAKE_DEMAND(std::this_thread::get_id() == main_thread_id_);
     DRAKE_DEMAND(app_ != nullptr);
@@ -478,12 +598,15 @@ class Meshcat::WebSocketPublisher {
 
     internal::DeleteData data;
     data.path = FullPath(path);
+    EraseSubtree(data.path, &last_sent_transforms_);
+    CloseTransformBatch();
 
     loop_->defer([this, data = std::move(data)]() {
       std::stringstream message_stream;
       msgpack::pack(message_stream, data);
       app_->publish("all", message_stream.str(), uWS::OpCode::BINARY, false);
       scene_tree_root_.Delete(data.path);
+      EraseSubtree(data.path, &latest_transforms_);
     });
   }
 
@@ -498,6 +621,7 @@ class Meshcat::WebSocketPublisher {
     data.path = FullPath(path);
     data.property = std::move(property);
     data.value = value;
+    CloseTransformBatch();
 
     loop_->defer([this, data = std::move(data)]() {
       std::stringstream message_stream;
@@ -509,6 +633,75 @@ class Meshcat::WebSocketPublisher {
     });
   }
 
+  void SetAnimation(const MeshcatAnimation& animation) {
+    DRAKE_DEMAND(std::this_thread::get_id() == main_thread_id_);
+    DRAKE_DEMAND(app_ != nullptr);
+    DRAKE_DEMAND(loop_ != nullptr);
+
+    internal::SetAnimationData data;
+    data.fps = animation.frames_per_second();
+    data.animations.reserve(animation.tracks().size());
+    for (const auto& [path, tracks] : animation.tracks()) {
+      data.animations.emplace_back(FullPath(path), &tracks);
+    }
+    data.options.play = animation.autoplay();
+    data.options.loopMode = animation.loop_mode();
+    data.options.repetitions = animation.repetitions();
+    data.options.clampWhenFinished = animation.clamp_when_finished();
+    // The data refers to the animation, so it is packed here (rather than in
+    // the websocket thread).
+    std::stringstream message_stream;
+    msgpack::pack(message_stream, data);
+    CloseTransformBatch();
+
+    loop_->defer([this, message = message_stream.str()]() {
+      app_->publish("all", message, uWS::OpCode::BINARY, false);
+      animation_ = std::move(message);
+    });
+  }
+
+  std::string StaticHtml() {
+    DRAKE_DEMAND(std::this_thread::get_id() == main_thread_id_);
+    DRAKE_DEMAND(loop_ != nullptr);
+
+    std::promise<std::vector<std::string>> p;
+    std::future<std::vector<std::string>> f = p.get_future();
+    loop_->defer([this, p = std::move(p)]() mutable {
+      std::vector<std::string> messages;
+      SendTree([&messages](const std::string& message) {
+        messages.push_back(message);
+      });
+      p.set_value(std::move(messages));
+    });
+    const std::vector<std::string> messages = f.get();
+
+    std::string html = GetUrlContent("/index.html");
+    // Inline the javascript library.
+    ReplaceInHtml(
+        R"""(<script type="text/javascript" src="meshcat.js"></script>)""",
+        fmt::format("<script type=\"text/javascript\">\n{}\n</script>",
+                    GetUrlContent("/meshcat.js")),
+        &html);
+    // Don't attempt to connect to a server.
+    ReplaceInHtml("const connect_to_server = true;",
+                  "const connect_to_server = false;", &html);
+    // Embed the messages which (re)create the scene.
+    std::string commands = R"""(<script id="embedded-json">
+    function handle_embedded_command(base64) {
+      const bytes = Uint8Array.from(atob(base64), c => c.charCodeAt(0));
+      viewer.handle_command_bytearray(bytes);
+    }
+)""";
+    for (const std::string& message : messages) {
+      commands += fmt::format("    handle_embedded_command(\"{}\");\n",
+                              EncodeBase64(message));
+    }
+    commands += "  </script>";
+    ReplaceInHtml(R"""(<script id="embedded-json"></script>)""", commands,
+                  &html);
+    return html;
+  }
+
   void AddButton(std::string name) {
     DRAKE_DEMAND(std::this_thread::get_id() == main_thread_id_);
     DRAKE_DEMAND(app_ != nullptr);
@@ -746,7 +939,9 @@ class Meshcat::WebSocketPublisher {
       if (!e || !e->transform()) {
         p.set_value("");
       } else {
-        p.set_value(*e->transform());
+        std::stringstream message_stream;
+        msgpack::pack(message_stream, *e->transform());
+        p.set_value(message_stream.str());
       }
     });
     return f.get();
@@ -789,6 +984,7 @@ class Meshcat::WebSocketPublisher {
     behavior.open = [this](WebSocket* ws) {
       websockets_.emplace(ws);
       ws->subscribe("all");
+      ws->subscribe("transforms");
       // Update this new connection with previously published data.
       SendTree(ws);
       std::lock_guard<std::mutex> lock(controls_mutex_);
@@ -849,6 +1045,9 @@ class Meshcat::WebSocketPublisher {
         }
       }
     };
+    behavior.drain = [this](WebSocket* ws) {
+      CatchUpTransforms(ws);
+    };
     behavior.close = [this](WebSocket* ws, int, std::string_view) {
       websockets_.erase(ws);
     };
@@ -885,8 +1084,120 @@ class Meshcat::WebSocketPublisher {
   }
 
   void SendTree(WebSocket* ws) {
+    SendTree([ws](const std::string& message) { ws->send(message); });
+  }
+
+  // Calls `send` with each of the messages that reproduce the scene tree,
+  // followed by the animation (if any).
+  void SendTree(const std::function<void(const std::string&)>& send) const {
+    DRAKE_DEMAND(std::this_thread::get_id() == websocket_thread_id_);
+    scene_tree_root_.Send(send);
+    if (animation_) {
+      send(*animation_);
+    }
+  }
+
+  // The transforms set by SetTransforms() which have not yet been sent, keyed
+  // by (full) path. The main thread adds to a batch until the websocket thread
+  // takes it.
+  struct TransformBatch {
+    std::mutex mutex;
+    bool taken{false};
+    std::map<std::string, Eigen::Matrix4d> transforms;
+  };
+
+  // Ensures that the next SetTransforms() starts a new batch, so that its
+  // transforms are not sent ahead of any command issued in the meantime.
+  void CloseTransformBatch() {
+    DRAKE_DEMAND(std::this_thread::get_id() == main_thread_id_);
+    open_transform_batch_.reset();
+  }
+
+  // Sends the transforms in `batch` as a single set_transforms message. A
+  // congested websocket stops receiving these messages until it has drained
+  // (see CatchUpTransforms()).
+  void SendTransformBatch(TransformBatch* batch) {
+    DRAKE_DEMAND(std::this_thread::get_id() == websocket_thread_id_);
+    std::map<std::string, Eigen::Matrix4d> transforms;
+    {
+      std::lock_guard<std::mutex> lock(batch->mutex);
+      batch->taken = true;
+      transforms.swap(batch->transforms);
+    }
+
+    for (const auto& [path, matrix] : transforms) {
+      SceneTreeElement& e = scene_tree_root_[path];
+      if (!e.transform()) {
+        e.transform().emplace();
+        e.transform()->path = path;
+      }
+      Eigen::Map<Eigen::Matrix4d>(e.transform()->matrix) = matrix;
+      latest_transforms_[path] = matrix.cast<float>();
+    }
+
+    for (WebSocket* ws : websockets_) {
+      PerSocketData& socket_data = *ws->getUserData();
+      if (!socket_data.skipping_transforms &&
+          ws->getBufferedAmount() > kMaxTransformBackPressure) {
+        ws->unsubscribe("transforms");
+        socket_data.skipping_transforms = true;
+      }
+    }
+
+    app_->publish("transforms", PackTransforms(transforms),
+                  uWS::OpCode::BINARY, false);
+  }
+
+  // Invoked when `ws` has drained some of its backlog. If it had been skipping
+  // set_transforms messages and is no longer congested, it is sent the latest
+  // transforms of all paths and receives the subsequent messages again.
+  void CatchUpTransforms(WebSocket* ws) {
     DRAKE_DEMAND(std::this_thread::get_id() == websocket_thread_id_);
-    scene_tree_root_.Send(ws);
+    PerSocketData& socket_data = *ws->getUserData();
+    if (!socket_data.skipping_transforms ||
+        ws->getBufferedAmount() > kMaxTransformBackPressure) {
+      return;
+    }
+    socket_data.skipping_transforms = false;
+    ws->subscribe("transforms");
+    if (!latest_transforms_.empty()) {
+      ws->send(PackTransforms(latest_transforms_), uWS::OpCode::BINARY);
+    }
+  }
+
+  // Returns a set_transforms message with the latest transforms of the paths
+  // that are the keys of `paths`.
+  template <typename Map>
+  std::string PackTransforms(const Map& paths) const {
+    internal::SetTransformsData data;
+    data.paths.reserve(paths.size());
+    data.matrices.reserve(paths.size() * sizeof(float) * 16);
+    for (const auto& item : paths) {
+      const std::string& path = item.first;
+      const Eigen::Matrix4f& matrix = latest_transforms_.at(path);
+      data.paths.push_back(path);
+      const char* bytes = reinterpret_cast<const char*>(matrix.data());
+      data.matrices.insert(data.matrices.end(), bytes,
+                           bytes + sizeof(float) * 16);
+    }
+    std::stringstream message_stream;
+    msgpack::pack(message_stream, data);
+    return message_stream.str();
+  }
+
+  // Erases the entries of `map` for `path` and all of its descendants.
+  template <typename Map>
+  static void EraseSubtree(const std::string& path, Map* map) {
+    auto iter = map->lower_bound(path);
+    while (iter != map->end() &&
+           iter->first.compare(0, path.size(), path) == 0) {
+      if (iter->first.size() == path.size() ||
+          iter->first[path.size()] == '/') {
+        iter = map->erase(iter);
+      } else {
+        ++iter;
+      }
+    }
   }
 
   std::string FullPath(std::string_view path) const {
@@ -917,10 +1228,19 @@ class Meshcat::WebSocketPublisher {
   std::thread::id main_thread_id_{};
   int port_{};
   std::mt19937 generator_{};
+  // The most recent transform of each path set via SetTransforms().
+  std::map<std::string, Eigen::Matrix4d, std::less<>> last_sent_transforms_{};
+  // The batch to which SetTransforms() adds, if the websocket thread hasn't
+  // taken it yet.
+  std::shared_ptr<TransformBatch> open_transform_batch_{};
 
   // These variables should only be accessed in the websocket thread.
   std::thread::id websocket_thread_id_{};
   SceneTreeElement scene_tree_root_{};
+  // The msgpack'd set_animation command of the last SetAnimation().
+  std::optional<std::string> animation_{std::nullopt};
+  // The most recent transform of each path set via SetTransforms().
+  std::map<std::string, Eigen::Matrix4f> latest_transforms_{};
 
   // These pointers should only be accessed in the main thread, but the objects
   // they are pointing to should be only used in the websocket thread.
@@ -975,6 +1295,12 @@ void Meshcat::SetTransform(std::string_view path,
   publisher_->SetTransform(path, X_ParentPath);
 }
 
+void Meshcat::SetTransforms(const std::vector<std::string>& paths,
+                            const std::vector<RigidTransformd>& X_ParentPaths,
+                            double tolerance) {
+  publisher_->SetTransforms(paths, X_ParentPaths, tolerance);
+}
+
 void Meshcat::Delete(std::string_view path) { publisher_->Delete(path); }
 
 void Meshcat::SetProperty(std::string_view path, std::string property,
@@ -992,6 +1318,14 @@ void Meshcat::SetProperty(std::string_view path, std::string property,
   publisher_->SetProperty(path, std::move(property), value);
 }
 
+void Meshcat::SetAnimation(const MeshcatAnimation& animation) {
+  publisher_->SetAnimation(animation);
+}
+
+std::string Meshcat::StaticHtml() {
+  return publisher_->StaticHtml();
+}
+
 void Meshcat::Set2dRenderMode(const math::RigidTransformd& X_WC, double xmin,
                               double xmax, double ymin, double ymax) {
   // Set orthographic camera.
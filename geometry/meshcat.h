@@ -8,6 +8,7 @@
 #include <Eigen/Core>
 
 #include "drake/common/drake_copyable.h"
+#include "drake/geometry/meshcat_animation.h"
 #include "drake/geometry/rgba.h"
 #include "drake/geometry/shape_specification.h"
 #include "drake/math/rigid_transform.h"
@@ -181,6 +182,32 @@ class Meshcat {
   void SetTransform(std::string_view path,
                     const math::RigidTransformd& X_ParentPath);
 
+  /** Sets the RigidTransforms for many paths in the scene tree at once; this
+  is equivalent to calling SetTransform() for each path, but is far more
+  efficient when updating many paths at a high rate (e.g., in a visualizer).
+
+  Only the paths whose transforms have changed since they were last set by this
+  method are sent: a path is skipped if no element of its transform (as a 4x4
+  matrix) differs by more than `tolerance` from the last transform sent. The
+  remaining transforms are sent to the browser in a single message, with their
+  values packed into one buffer of single-precision floats. If the transforms
+  are set faster than they can be sent, only the most recent transform of each
+  path is sent, and a browser whose connection is congested skips updates
+  until it catches up, after which it receives the latest transform of every
+  path.
+
+  @param paths the "/"-delimited paths in the scene tree; see
+               @ref meshcat_path "Meshcat paths" for the semantics.
+  @param X_ParentPaths the relative transform from each path to its immediate
+                       parent.
+  @param tolerance the largest change in the transform of a path that is not
+                   sent.
+  @throws std::exception if `paths` and `X_ParentPaths` differ in size or
+                         `tolerance` is negative. */
+  void SetTransforms(const std::vector<std::string>& paths,
+                     const std::vector<math::RigidTransformd>& X_ParentPaths,
+                     double tolerance = 0.0);
+
   /** Deletes the object at the given `path` as well as all of its children.
   See @ref meshcat_path for the detailed semantics of deletion. */
   void Delete(std::string_view path = "");
@@ -220,7 +247,23 @@ class Meshcat {
   void SetProperty(std::string_view path, std::string property,
                    const std::vector<double>& value);
 
-  // TODO(russt): Implement SetAnimation().
+  /** Sets the MeshcatAnimation, which is played back in the browser without
+  any further communication with this process. This replaces any previously
+  set animation. The paths in the animation are interpreted as in
+  SetTransform() and SetProperty(), and must already exist in the scene tree
+  when the animation is played back.
+
+  The animation is also sent to any browser that connects later, and it is
+  included in StaticHtml(). */
+  void SetAnimation(const MeshcatAnimation& animation);
+
+  /** Returns an HTML string that can be saved to a file for a snapshot of the
+  visualizer and its contents. The file is self-contained: it can be viewed in
+  the browser without a running %Meshcat (or websocket) server. It contains
+  the scene tree (objects, transforms and properties), along with any animation
+  set by SetAnimation(), as they are at the time of the call. The controls
+  (buttons and sliders) are not included. */
+  std::string StaticHtml();
 
   /** @name Meshcat Controls
    Meshcat "Controls" are user interface elements in the browser.  These
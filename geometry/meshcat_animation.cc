@@ -0,0 +1,146 @@
+#include "drake/geometry/meshcat_animation.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+
+namespace drake {
+namespace geometry {
+
+MeshcatAnimation::MeshcatAnimation(double frames_per_second)
+    : frames_per_second_(frames_per_second) {
+  DRAKE_THROW_UNLESS(frames_per_second > 0.0);
+}
+
+MeshcatAnimation::~MeshcatAnimation() = default;
+
+void MeshcatAnimation::set_repetitions(int repetitions) {
+  DRAKE_THROW_UNLESS(repetitions >= 1);
+  repetitions_ = repetitions;
+}
+
+void MeshcatAnimation::set_max_keyframes(int max_keyframes) {
+  DRAKE_THROW_UNLESS(max_keyframes >= num_keyframes_);
+  max_keyframes_ = max_keyframes;
+}
+
+void MeshcatAnimation::SetTransform(int frame, const std::string& path,
+                                    const math::RigidTransformd& X_ParentPath) {
+  const Eigen::Vector3d& p = X_ParentPath.translation();
+  // Three.js orders the quaternion values as x, y, z, w.
+  const Eigen::Quaterniond q = X_ParentPath.rotation().ToQuaternion();
+  const double quaternion[4] = {q.x(), q.y(), q.z(), q.w()};
+  // Check up front, so that either both tracks or neither are set.
+  ThrowIfFull(
+      CountNewKeyframes(frame, path, "position", "vector3", p.data(), 3) +
+          CountNewKeyframes(frame, path, "quaternion", "quaternion",
+                            quaternion, 4),
+      frame, path);
+  SetValue(frame, path, "position", "vector3", p.data(), 3);
+  SetValue(frame, path, "quaternion", "quaternion", quaternion, 4);
+}
+
+void MeshcatAnimation::SetProperty(int frame, const std::string& path,
+                                   const std::string& property, bool value) {
+  const double number = value ? 1.0 : 0.0;
+  SetValue(frame, path, property, "boolean", &number, 1);
+}
+
+void MeshcatAnimation::SetProperty(int frame, const std::string& path,
+                                   const std::string& property, double value) {
+  SetValue(frame, path, property, "number", &value, 1);
+}
+
+void MeshcatAnimation::SetProperty(int frame, const std::string& path,
+                                   const std::string& property,
+                                   const std::vector<double>& value) {
+  DRAKE_THROW_UNLESS(!value.empty());
+  SetValue(frame, path, property, "vector", value.data(),
+           static_cast<int>(value.size()));
+}
+
+void MeshcatAnimation::ThrowIfFull(int num_new_keyframes, int frame,
+                                   const std::string& path) const {
+  if (num_keyframes_ + num_new_keyframes > max_keyframes_) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatAnimation: cannot add a keyframe for {} at frame {}; the "
+        "animation already holds {} keyframes, and its maximum is {}.",
+        path, frame, num_keyframes_, max_keyframes_));
+  }
+}
+
+int MeshcatAnimation::CountNewKeyframes(int frame, const std::string& path,
+                                        const std::string& property,
+                                        const char* js_type,
+                                        const double* value, int size) const {
+  const auto path_iter = tracks_.find(path);
+  if (path_iter == tracks_.end()) return 1;
+  const auto track_iter = path_iter->second.find(property);
+  if (track_iter == path_iter->second.end()) return 1;
+  const Track& track = track_iter->second;
+  if (track.js_type != js_type || track.size != size) {
+    throw std::runtime_error(fmt::format(
+        "MeshcatAnimation: the property {} of {} was previously set to a "
+        "value of type {} (of size {}); it cannot be set to a value of type {} "
+        "(of size {}).",
+        property, path, track.js_type, track.size, js_type, size));
+  }
+
+  auto equals_value = [&track, value, size](int k) {
+    return std::equal(value, value + size, track.values.begin() + k * size);
+  };
+
+  const int num_keys = static_cast<int>(track.frames.size());
+  if (num_keys == 0 || frame > track.frames.back()) {
+    // The common case (e.g. recording): appending a keyframe. If the last two
+    // keyframes already hold this value, then the last one is redundant once
+    // this keyframe is added; it is moved to this frame instead.
+    return num_keys >= 2 && equals_value(num_keys - 1) &&
+                   equals_value(num_keys - 2)
+               ? 0
+               : 1;
+  }
+  // Otherwise, the keyframe is overwritten or inserted in place. Keyframes set
+  // out of order are not decimated.
+  return *std::lower_bound(track.frames.begin(), track.frames.end(), frame) ==
+                 frame
+             ? 0
+             : 1;
+}
+
+void MeshcatAnimation::SetValue(int frame, const std::string& path,
+                                const std::string& property,
+                                const char* js_type, const double* value,
+                                int size) {
+  // This also checks that the track (if any) has the same js_type and size.
+  const int num_new_keyframes =
+      CountNewKeyframes(frame, path, property, js_type, value, size);
+  ThrowIfFull(num_new_keyframes, frame, path);
+
+  Track& track = tracks_[path][property];
+  if (track.js_type.empty()) {
+    track.js_type = js_type;
+    track.size = size;
+  }
+  const auto iter =
+      std::lower_bound(track.frames.begin(), track.frames.end(), frame);
+  const int k = static_cast<int>(iter - track.frames.begin());
+  if (num_new_keyframes == 0) {
+    if (iter == track.frames.end()) {
+      // The decimated case of CountNewKeyframes(); the last keyframe moves.
+      track.frames.back() = frame;
+    } else {
+      std::copy(value, value + size, track.values.begin() + k * size);
+    }
+    return;
+  }
+  track.frames.insert(iter, frame);
+  track.values.insert(track.values.begin() + k * size, value, value + size);
+  ++num_keyframes_;
+}
+
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <cmath>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+
+/** An animation track for Meshcat, i.e., a set of keyframes that set the
+transforms and properties of paths in the scene tree over time. The animation
+is sent to Meshcat via Meshcat::SetAnimation() (or embedded in the file
+produced by Meshcat::StaticHtml()) and is played back in the browser, at the
+requested frame rate, without any further communication with this process.
+
+Keyframes are indexed by (integer) frame number; use frame() to convert a time
+to the nearest frame. The values of transforms and numeric properties are
+linearly interpolated between keyframes (rotations are interpolated with
+slerp); boolean properties are held until the next keyframe.
+
+Keyframes which only repeat the value of their neighbors are redundant, and
+are not stored: when the value of a track is the same for a run of consecutive
+keyframes (e.g. a body at rest), only the first and last keyframes of the run
+are kept. The number of keyframes is bounded by max_keyframes(), so that a long
+recording cannot consume arbitrary amounts of memory.
+
+See MeshcatVisualizer::StartRecording() for recording the publishes of a
+simulation as an animation. */
+class MeshcatAnimation {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MeshcatAnimation)
+
+  /** Constructs the animation object.
+   @param frames_per_second the (positive) rate at which the frames are played
+   back.
+   @throws std::exception if `frames_per_second <= 0`. */
+  explicit MeshcatAnimation(double frames_per_second = 32.0);
+
+  ~MeshcatAnimation();
+
+  /** The behavior of the animation when it reaches the last frame. The
+   values match the three.js constants. */
+  enum LoopMode {
+    /** Plays the clip once. */
+    kLoopOnce = 2200,
+    /** Plays the clip with the chosen number of repetitions, each time jumping
+     from the end of the clip directly to its beginning. */
+    kLoopRepeat = 2201,
+    /** Plays the clip with the chosen number of repetitions, alternately
+     playing forward and backward. */
+    kLoopPingPong = 2202
+  };
+
+  /** The default maximum number of keyframes; see max_keyframes(). */
+  static constexpr int kDefaultMaxKeyframes = 10'000'000;
+
+  /** Returns the frame rate at which the animation will be played back. */
+  double frames_per_second() const { return frames_per_second_; }
+
+  /** Uses the frame rate to convert from time to the frame number, using
+   std::round(). */
+  int frame(double time_from_start) const {
+    return static_cast<int>(std::round(time_from_start * frames_per_second_));
+  }
+
+  /** @name Animation options
+   These options are passed to the browser along with the keyframes. */
+  //@{
+
+  /** Returns true iff the playback starts as soon as the animation is sent. */
+  bool autoplay() const { return autoplay_; }
+
+  /** Sets whether the playback starts as soon as the animation is sent. */
+  void set_autoplay(bool play) { autoplay_ = play; }
+
+  LoopMode loop_mode() const { return loop_mode_; }
+
+  void set_loop_mode(LoopMode mode) { loop_mode_ = mode; }
+
+  /** Returns the number of times the animation is played. */
+  int repetitions() const { return repetitions_; }
+
+  /** Sets the number of times the animation is played.
+   @throws std::exception if `repetitions < 1`. */
+  void set_repetitions(int repetitions);
+
+  /** Returns true iff the paths hold their final values once the playback
+   ends (rather than being reset to their values at the first frame). */
+  bool clamp_when_finished() const { return clamp_when_finished_; }
+
+  /** Sets whether the paths hold their final values once the playback ends. */
+  void set_clamp_when_finished(bool clamp) { clamp_when_finished_ = clamp; }
+  //@}
+
+  /** Returns the maximum number of keyframes that this animation may store,
+   summed over all tracks. */
+  int max_keyframes() const { return max_keyframes_; }
+
+  /** Sets the maximum number of keyframes that this animation may store.
+   @throws std::exception if `max_keyframes < num_keyframes()`. */
+  void set_max_keyframes(int max_keyframes);
+
+  /** Returns the number of keyframes stored, summed over all tracks. */
+  int num_keyframes() const { return num_keyframes_; }
+
+  /** Sets the transform of the `path` (relative to its parent in the scene
+   tree) at `frame`. The transform is stored as the "position" and "quaternion"
+   properties of the path, i.e., as two tracks.
+   @throws std::exception if adding the keyframes would exceed
+   max_keyframes(). */
+  void SetTransform(int frame, const std::string& path,
+                    const math::RigidTransformd& X_ParentPath);
+
+  /** Sets a single named property of the object at `path` at `frame`. For
+   instance, `SetProperty(frame, "/Grid", "visible", false)`. See
+   Meshcat::SetProperty() for the semantics.
+   @throws std::exception if the property was previously set with a value of a
+   different type.
+   @throws std::exception if adding the keyframe would exceed max_keyframes().
+   @pydrake_mkdoc_identifier{bool} */
+  void SetProperty(int frame, const std::string& path,
+                   const std::string& property, bool value);
+
+  /** Sets a single named property of the object at `path` at `frame`. For
+   instance, `SetProperty(frame, "/Cameras/default/rotated/<object>", "zoom",
+   2.0)`. See Meshcat::SetProperty() for the semantics.
+   @throws std::exception if the property was previously set with a value of a
+   different type.
+   @throws std::exception if adding the keyframe would exceed max_keyframes().
+   @pydrake_mkdoc_identifier{double} */
+  void SetProperty(int frame, const std::string& path,
+                   const std::string& property, double value);
+
+  /** Sets a single named property of the object at `path` at `frame`. For
+   instance, `SetProperty(frame, "/Background", "top_color", {1.0, 0.0, 0.0})`.
+   See Meshcat::SetProperty() for the semantics.
+   @throws std::exception if the property was previously set with a value of a
+   different type or size.
+   @throws std::exception if adding the keyframe would exceed max_keyframes().
+   @pydrake_mkdoc_identifier{vector_double} */
+  void SetProperty(int frame, const std::string& path,
+                   const std::string& property,
+                   const std::vector<double>& value);
+
+  /** The keyframes of a single property of a single path. */
+  struct Track {
+    /** The name of the three.js keyframe track type: "vector3", "quaternion",
+     "vector", "number", or "boolean". */
+    std::string js_type;
+    /** The number of values per keyframe. */
+    int size{};
+    /** The (increasing) frame numbers of the keyframes. */
+    std::vector<int> frames;
+    /** The values of the keyframes, `size` values per keyframe. Boolean values
+     are stored as 0.0 or 1.0. */
+    std::vector<double> values;
+  };
+
+  /** Returns the tracks of this animation, keyed by path and then by property
+   name. This is intended to support serialization (e.g., by Meshcat). */
+  const std::map<std::string, std::map<std::string, Track>>& tracks() const {
+    return tracks_;
+  }
+
+ private:
+  // Throws if adding `num_new_keyframes` keyframes would exceed
+  // max_keyframes(); `frame` and `path` are for the error message.
+  void ThrowIfFull(int num_new_keyframes, int frame,
+                   const std::string& path) const;
+
+  // Returns the number of keyframes (zero or one) that SetValue() would add
+  // with the same arguments, accounting for decimation. Throws if the track
+  // already exists with a different js_type or size.
+  int CountNewKeyframes(int frame, const std::string& path,
+                        const std::string& property, const char* js_type,
+                        const double* value, int size) const;
+
+  // Sets the value of `property` of `path` at `frame`, checking that the track
+  // (if it already exists) has the same js_type and size.
+  void SetValue(int frame, const std::string& path,
+                const std::string& property, const char* js_type,
+                const double* value, int size);
+
+  double frames_per_second_{};
+  bool autoplay_{true};
+  LoopMode loop_mode_{kLoopRepeat};
+  int repetitions_{1};
+  bool clamp_when_finished_{false};
+  int max_keyframes_{kDefaultMaxKeyframes};
+  int num_keyframes_{0};
+
+  std::map<std::string, std::map<std::string, Track>> tracks_;
+};
+
+}  // namespace geometry
+}  // namespace drake
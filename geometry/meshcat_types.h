@@ -1,14 +1,17 @@
 #pragma once
 
 #include <limits>
+#include <map>
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <msgpack.hpp>
 
 #include "drake/geometry/meshcat.h"
+#include "drake/geometry/meshcat_animation.h"
 #include "drake/geometry/rgba.h"
 #include "drake/math/rigid_transform.h"
 
@@ -186,6 +189,18 @@ struct SetTransformData {
   MSGPACK_DEFINE_MAP(type, path, matrix);
 };
 
+// Sets the transforms of many paths in a single message. The transforms are
+// packed into one binary buffer (rather than being sent as one message per
+// path); see meshcat.html for the decoding.
+struct SetTransformsData {
+  std::string type{"set_transforms"};
+  std::vector<std::string> paths;
+  // The 4x4 matrices (column major) of all paths, stored as consecutive
+  // (native byte order) float32 values; 16 values per path.
+  std::vector<char> matrices;
+  MSGPACK_DEFINE_MAP(type, paths, matrices);
+};
+
 struct DeleteData {
   std::string type{"delete"};
   std::string path;
@@ -201,6 +216,89 @@ struct SetPropertyData {
   MSGPACK_DEFINE_MAP(type, path, property, value);
 };
 
+struct SetAnimationOptions {
+  bool play{true};
+  int loopMode{MeshcatAnimation::kLoopRepeat};
+  int repetitions{1};
+  bool clampWhenFinished{false};
+  MSGPACK_DEFINE_MAP(play, loopMode, repetitions, clampWhenFinished);
+};
+
+// Sets the animation of a MeshcatAnimation; each path's tracks become one
+// three.js AnimationClip (with the key times measured in frames, as expected by
+// AnimationClip.parse()). The data refers to the tracks of the animation, which
+// must outlive it.
+struct SetAnimationData {
+  std::string type{"set_animation"};
+  double fps{};
+  // The full path and the tracks (keyed by property name) of each path.
+  std::vector<std::pair<
+      std::string,
+      const std::map<std::string, MeshcatAnimation::Track>*>> animations;
+  SetAnimationOptions options;
+
+  template <typename Packer>
+  // NOLINTNEXTLINE(runtime/references) cpplint disapproves of msgpack choices.
+  void msgpack_pack(Packer& o) const {
+    o.pack_map(3);
+    o.pack("type");
+    o.pack(type);
+    o.pack("animations");
+    o.pack_array(animations.size());
+    for (const auto& [path, tracks] : animations) {
+      o.pack_map(2);
+      o.pack("path");
+      o.pack(path);
+      o.pack("clip");
+      o.pack_map(3);
+      o.pack("fps");
+      o.pack(fps);
+      o.pack("name");
+      o.pack("default");
+      o.pack("tracks");
+      int num_tracks = 0;
+      for (const auto& property_track : *tracks) {
+        if (!property_track.second.frames.empty()) ++num_tracks;
+      }
+      o.pack_array(num_tracks);
+      for (const auto& [property, track] : *tracks) {
+        if (track.frames.empty()) continue;
+        o.pack_map(3);
+        o.pack("name");
+        o.pack("." + property);
+        o.pack("type");
+        o.pack(track.js_type);
+        o.pack("keys");
+        o.pack_array(track.frames.size());
+        for (size_t k = 0; k < track.frames.size(); ++k) {
+          const double* value = &track.values[k * track.size];
+          o.pack_map(2);
+          o.pack("time");
+          o.pack(track.frames[k]);
+          o.pack("value");
+          if (track.js_type == "boolean") {
+            o.pack(*value != 0.0);
+          } else if (track.js_type == "number") {
+            o.pack(*value);
+          } else {
+            o.pack_array(track.size);
+            for (int i = 0; i < track.size; ++i) {
+              o.pack(value[i]);
+            }
+          }
+        }
+      }
+    }
+    o.pack("options");
+    o.pack(options);
+  }
+  // This method must be defined, but the implementation is not needed in the
+  // current workflows.
+  void msgpack_unpack(msgpack::object const&) {
+    throw std::runtime_error("unpack is not implemented for SetAnimationData.");
+  }
+};
+
 struct SetButtonControl {
   std::string type{"set_control"};
   int num_clicks{0};
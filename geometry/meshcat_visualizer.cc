@@ -3,9 +3,12 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include "drake/common/extract_double.h"
+#include "drake/common/text_logging.h"
 #include "drake/geometry/utilities.h"
 
 namespace drake {
@@ -25,6 +28,7 @@ MeshcatVisualizer<T>::MeshcatVisualizer(std::shared_ptr<Meshcat> meshcat,
         "Role::kUnassigned value. Please choose kProximity, kPerception, or "
         "kIllustration");
   }
+  DeleteRecording();
 
   this->DeclarePeriodicPublishEvent(params_.publish_period, 0.0,
                                     &MeshcatVisualizer<T>::UpdateMeshcat);
@@ -51,6 +55,33 @@ void MeshcatVisualizer<T>::Delete() const {
   version_ = GeometryVersion();
 }
 
+template <typename T>
+MeshcatAnimation& MeshcatVisualizer<T>::StartRecording(
+    bool set_transforms_while_recording) const {
+  recording_ = true;
+  set_transforms_while_recording_ = set_transforms_while_recording;
+  return *animation_;
+}
+
+template <typename T>
+void MeshcatVisualizer<T>::StopRecording() const {
+  recording_ = false;
+}
+
+template <typename T>
+void MeshcatVisualizer<T>::PublishRecording() const {
+  meshcat_->SetAnimation(*animation_);
+}
+
+template <typename T>
+void MeshcatVisualizer<T>::DeleteRecording() const {
+  // Play the animation back at the rate at which it is recorded.
+  animation_ = params_.publish_period > 0.0
+                   ? std::make_unique<MeshcatAnimation>(
+                         1.0 / params_.publish_period)
+                   : std::make_unique<MeshcatAnimation>();
+}
+
 template <typename T>
 const MeshcatVisualizer<T>& MeshcatVisualizer<T>::AddToBuilder(
     systems::DiagramBuilder<T>* builder, const SceneGraph<T>& scene_graph,
@@ -82,7 +113,7 @@ systems::EventStatus MeshcatVisualizer<T>::UpdateMeshcat(
     SetObjects(query_object.inspector());
     version_ = current_version;
   }
-  SetTransforms(query_object);
+  SetTransforms(context, query_object);
 
   return systems::EventStatus::Succeeded();
 }
@@ -149,11 +180,40 @@ void MeshcatVisualizer<T>::SetObjects(
 
 template <typename T>
 void MeshcatVisualizer<T>::SetTransforms(
+    const systems::Context<T>& context,
     const QueryObject<T>& query_object) const {
+  // The poses of all frames are sent together, in a single message.
+  std::vector<std::string> paths;
+  std::vector<math::RigidTransformd> X_WFs;
+  paths.reserve(dynamic_frames_.size());
+  X_WFs.reserve(dynamic_frames_.size());
   for (const auto& [frame_id, path] : dynamic_frames_) {
-    meshcat_->SetTransform(path, internal::convert_to_double(
-                                     query_object.GetPoseInWorld(frame_id)));
+    paths.push_back(path);
+    X_WFs.push_back(
+        internal::convert_to_double(query_object.GetPoseInWorld(frame_id)));
+  }
+  if (recording_) {
+    const double time = ExtractDoubleOrThrow(context.get_time());
+    // Each transform needs (at most) two keyframes.
+    const int num_new_keyframes = 2 * static_cast<int>(paths.size());
+    if (animation_->num_keyframes() + num_new_keyframes >
+        animation_->max_keyframes()) {
+      drake::log()->warn(
+          "MeshcatVisualizer: the recording has reached its maximum of {} "
+          "keyframes at time {}; recording has stopped.",
+          animation_->max_keyframes(), time);
+      recording_ = false;
+    } else {
+      const int frame = animation_->frame(time);
+      for (size_t i = 0; i < paths.size(); ++i) {
+        animation_->SetTransform(frame, paths[i], X_WFs[i]);
+      }
+      if (!set_transforms_while_recording_) {
+        return;
+      }
+    }
   }
+  meshcat_->SetTransforms(paths, X_WFs);
 }
 
 template <typename T>
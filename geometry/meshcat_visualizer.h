@@ -6,6 +6,7 @@
 
 #include "drake/geometry/geometry_roles.h"
 #include "drake/geometry/meshcat.h"
+#include "drake/geometry/meshcat_animation.h"
 #include "drake/geometry/meshcat_visualizer_params.h"
 #include "drake/geometry/rgba.h"
 #include "drake/geometry/scene_graph.h"
@@ -39,6 +40,12 @@ DrakeVisualizer which uses the same mechanisms for more details.
 
 Instances of %MeshcatVisualizer created by scalar-conversion will publish to the
 same Meshcat instance.
+
+%MeshcatVisualizer can also record the transforms that it publishes into a
+MeshcatAnimation; see StartRecording(). This allows a simulation to run at full
+speed (without sending any transforms to the browser, if so configured), and to
+be inspected afterwards by playing the animation back in the browser, or by
+saving Meshcat::StaticHtml() to a file.
 @tparam_nonsymbolic_scalar
 */
 template <typename T>
@@ -70,6 +77,43 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
    to determine whether this should be called on initialization. */
   void Delete() const;
 
+  /** Starts recording the transforms of the dynamic frames into a
+   MeshcatAnimation at each publish, at the frame corresponding to the
+   context time. Recording continues, adding to the same animation, until
+   StopRecording() is called; use DeleteRecording() to start over. The
+   animation is played back at the rate of the publish period (see
+   MeshcatVisualizerParams::publish_period).
+
+   The recording is bounded: once the animation holds its
+   MeshcatAnimation::max_keyframes(), the recording stops (with a warning).
+   Frames in which a transform doesn't change don't add to the animation,
+   beyond the two keyframes which begin and end the run of identical
+   transforms.
+
+   @param set_transforms_while_recording if true, the transforms are also sent
+   to Meshcat as usual while recording. If false, the transforms are only
+   recorded, which avoids the cost of sending them.
+   @returns the animation, e.g., for changing its options or its
+   MeshcatAnimation::max_keyframes(). */
+  MeshcatAnimation& StartRecording(
+      bool set_transforms_while_recording = true) const;
+
+  /** Stops recording the transforms; see StartRecording(). The recorded
+   animation is kept, and recording can be resumed by calling
+   StartRecording() again. */
+  void StopRecording() const;
+
+  /** Sends the recorded animation to Meshcat (see Meshcat::SetAnimation()),
+   where it replaces any previously set animation. */
+  void PublishRecording() const;
+
+  /** Discards the recorded animation. If recording, the recording continues
+   with an empty animation. */
+  void DeleteRecording() const;
+
+  /** Returns the recorded animation. */
+  const MeshcatAnimation& get_recording() const { return *animation_; }
+
   /** Returns the QueryObject-valued input port. It should be connected to
    SceneGraph's QueryObject-valued output port. Failure to do so will cause a
    runtime error when attempting to broadcast messages. */
@@ -109,9 +153,10 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
   /* Makes calls to Meshcat::SetObject to register geometry in SceneGraph. */
   void SetObjects(const SceneGraphInspector<T>& inspector) const;
 
-  /* Makes calls to Meshcat::SetTransform to update the poses from SceneGraph.
-   */
-  void SetTransforms(const QueryObject<T>& query_object) const;
+  /* Makes calls to Meshcat::SetTransform to update the poses from SceneGraph,
+   and records them if recording. */
+  void SetTransforms(const systems::Context<T>& context,
+                     const QueryObject<T>& query_object) const;
 
   /* Handles the initialization event. */
   systems::EventStatus OnInitialization(const systems::Context<T>&) const;
@@ -146,6 +191,13 @@ class MeshcatVisualizer final : public systems::LeafSystem<T> {
 
   /* The parameters for the visualizer.  */
   MeshcatVisualizerParams params_;
+
+  /* The recording; see StartRecording(). Like meshcat_, the recording is
+   modified during (const) publishing, and is therefore mutable; it is not
+   state of the system. */
+  mutable std::unique_ptr<MeshcatAnimation> animation_;
+  mutable bool recording_{false};
+  mutable bool set_transforms_while_recording_{true};
 };
 
 /** A convenient alias for the MeshcatVisualizer class when using the `double`
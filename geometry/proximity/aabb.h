@@ -94,6 +94,12 @@ class Aabb {
     return half_width_[0] * half_width_[1] * half_width_[2] * 8;
   }
 
+  /* @return Surface area of the bounding box.  */
+  double CalcSurfaceArea() const {
+    return (half_width_[0] * half_width_[1] + half_width_[1] * half_width_[2] +
+            half_width_[2] * half_width_[0]) * 8;
+  }
+
   /* Reports whether the two axis-aligned bounding boxes `a_G` and `b_H`
    intersect. The poses of `a_G` and `b_H` are defined in their corresponding
    hierarchy frames G and H, respectively.
@@ -1,10 +1,17 @@
 #include "drake/geometry/proximity/bvh.h"
 
 #include <algorithm>
-#include <memory>
+#include <array>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <optional>
 #include <set>
+#include <utility>
 #include <vector>
 
+#include "drake/common/drake_throw.h"
+#include "drake/common/parallel_for.h"
 #include "drake/geometry/utilities.h"
 
 namespace drake {
@@ -15,8 +22,28 @@ using Eigen::Matrix3d;
 using Eigen::Vector3d;
 using math::RotationMatrixd;
 
+namespace {
+
+// The number of bins along each axis used by the surface area heuristic.
+constexpr int kNumSahBins = 16;
+
+// Subtrees with fewer elements than this are built on a single thread; the
+// cost of handing them to another thread would outweigh the benefit.
+constexpr int kMinElementsPerThread = 512;
+
+double CalcSurfaceArea(const Eigen::AlignedBox3d& box) {
+  const Vector3d size = box.sizes();
+  return 2 * (size.x() * size.y() + size.y() * size.z() +
+              size.z() * size.x());
+}
+
+}  // namespace
+
 template <class BvType, class SourceMeshType>
-Bvh<BvType, SourceMeshType>::Bvh(const SourceMeshType& mesh) {
+Bvh<BvType, SourceMeshType>::Bvh(const SourceMeshType& mesh,
+                                 const BvhBuildOptions& options)
+    : options_(options) {
+  DRAKE_THROW_UNLESS(options.num_threads >= 1);
   // Generate element indices and corresponding centroids. These are used
   // for calculating the split point of the volumes.
   const int num_elements = mesh.num_elements();
@@ -25,16 +52,33 @@ Bvh<BvType, SourceMeshType>::Bvh(const SourceMeshType& mesh) {
     element_centroids.emplace_back(i, ComputeCentroid(mesh, i));
   }
 
-  root_node_ =
-      BuildBvTree(mesh, element_centroids.begin(), element_centroids.end());
+  // A binary tree with L >= 1 leaves has 2L - 1 nodes, and every leaf holds
+  // at least one element.
+  nodes_.reserve(std::max(1, 2 * num_elements - 1));
+  BuildBvTree(mesh, element_centroids.begin(), element_centroids.end(),
+              options_.strategy, options_.num_threads, &nodes_);
 }
 
 template <class BvType, class SourceMeshType>
-std::unique_ptr<BvNode<BvType, SourceMeshType>>
-Bvh<BvType, SourceMeshType>::BuildBvTree(
+void Bvh<BvType, SourceMeshType>::BuildBvTree(
     const SourceMeshType& mesh_M,
     const typename std::vector<CentroidPair>::iterator& start,
-    const typename std::vector<CentroidPair>::iterator& end) {
+    const typename std::vector<CentroidPair>::iterator& end,
+    BvhBuildStrategy strategy, int num_threads,
+    std::vector<NodeType>* nodes) {
+  if (num_threads > 1 && end - start >= 2 * kMinElementsPerThread) {
+    BuildBvTreeInParallel(mesh_M, start, end, strategy, num_threads, nodes);
+  } else {
+    BuildBvSubtree(mesh_M, start, end, strategy, nodes);
+  }
+}
+
+template <class BvType, class SourceMeshType>
+void Bvh<BvType, SourceMeshType>::BuildBvSubtree(
+    const SourceMeshType& mesh_M,
+    const typename std::vector<CentroidPair>::iterator& start,
+    const typename std::vector<CentroidPair>::iterator& end,
+    BvhBuildStrategy strategy, std::vector<NodeType>* nodes) {
   // Generate bounding volume.
   BvType bv_M = ComputeBoundingVolume(mesh_M, start, end);
 
@@ -45,62 +89,266 @@ Bvh<BvType, SourceMeshType>::BuildBvTree(
       data.indices[i] = (start + i)->first;
     }
     // Store element indices in this leaf node.
-    return std::make_unique<NodeType>(bv_M, data);
+    nodes->push_back(NodeType(bv_M, data));
   } else {
-    // Sort the elements by centroid along the axis of greatest spread.
-    // Note: We tried an alternative strategy for building the BVH using a
-    // volume-based metric.
-    // - Given a parent BV P, we would partition all of its contents into a left
-    //   BV, L, and a right BV, R, such that we wanted to minimize (V(L) + V(R))
-    //   / V(P). (V(X) is the volume measure of the bounding volume X).
-    // - We didn't explore all possible partitions (there are an exponential
-    //   number of such possible partitions).
-    // - Instead, we ordered the mesh elements along an axis and then would
-    //   consider partitions split between two adjacent elements in the sorted
-    //   set. This was repeated for each of the axes and the partition with the
-    //   minimum value was taken.
-    // - We did explore several ordering options, including sorting by centroid,
-    //   min, max, and a combination of them when the element overlapped the
-    //   partition boundary.
-    // This tentative partitioning strategy produced more BV-BV tests in some
-    // simple examples than the simple bisection shown below and was abandoned.
-    // Some possible reasons for this:
-    // - Sorting by an alternate criteria might be a better way to order them.
-    // - Only considering split points based on adjacent elements may be
-    //   problematic.
-    // - The elements individual extents are such they are not typically
-    //   axis-aligned so, partitioning between two elements would often produce
-    //   child BVs that have non-trivial overlap.
-    // Finally, the primitive meshes we are producing are relatively regular and
-    // are probably nicely compatible with the median split strategy. If we need
-    // to do irregular distribution of elements, a more sophisticated strategy
-    // may help. But proceed with caution -- there's no guarantee such a
-    // strategy will yield performance benefits.
-
-    // This ordering formulation satisfies both Aabb and Obb. It is true that
-    // the cost for Aabb is *slightly* more expensive than it *could* be. For
-    // Aabb, the possible value for Baxis_M are always the basis vectors so we
-    // wouldn't actually have to perform a dot product. However, as this is
-    // part of the one-time cost of construction, we're not going to worry about
-    // that cost versus the cost of re-expressing this operation to be BV
-    // dependent. That will be deferred to some future date when that's *known*
-    // to be necessary. See the todo on Aabb::pose().
-    int axis{};
-    bv_M.half_width().maxCoeff(&axis);
-    // B is the canonical frame of the bounding volume.
-    const math::RigidTransformd& X_MB = bv_M.pose();
-    const auto& Baxis_M = X_MB.rotation().col(axis);
-    std::sort(start, end,
-              [&Baxis_M](const CentroidPair& a, const CentroidPair& b) {
-                return Baxis_M.dot(a.second) < Baxis_M.dot(b.second);
-              });
-
-    // Continue with the next branches.
     const typename std::vector<CentroidPair>::iterator mid =
-        start + num_elements / 2;
-    return std::make_unique<NodeType>(bv_M, BuildBvTree(mesh_M, start, mid),
-                                      BuildBvTree(mesh_M, mid, end));
+        Partition(mesh_M, bv_M, start, end, strategy);
+
+    // Continue with the next branches. The left subtree immediately follows
+    // this node; the right subtree follows the left subtree. N.B. `nodes` may
+    // reallocate as the subtrees are added, so we refer to this node by index.
+    const int index = static_cast<int>(nodes->size());
+    nodes->push_back(NodeType(bv_M));
+    BuildBvSubtree(mesh_M, start, mid, strategy, nodes);
+    (*nodes)[index].set_right_offset(static_cast<int>(nodes->size()) - index);
+    BuildBvSubtree(mesh_M, mid, end, strategy, nodes);
+  }
+}
+
+template <class BvType, class SourceMeshType>
+void Bvh<BvType, SourceMeshType>::BuildBvTreeInParallel(
+    const SourceMeshType& mesh_M,
+    const typename std::vector<CentroidPair>::iterator& start,
+    const typename std::vector<CentroidPair>::iterator& end,
+    BvhBuildStrategy strategy, int num_threads,
+    std::vector<NodeType>* nodes) {
+  using Iterator = typename std::vector<CentroidPair>::iterator;
+
+  // The top of the hierarchy in depth-first pre-order. Each entry is either
+  // a branch node (its bounding volume) or a subtree below the cutoff (its
+  // index into `ranges`).
+  struct TopEntry {
+    std::optional<BvType> branch_bv;
+    int subtree{-1};
+  };
+  std::vector<TopEntry> top;
+  std::vector<std::pair<Iterator, Iterator>> ranges;
+
+  // Partition down to a depth with a few subtrees per thread, so that the
+  // threads stay busy even if the subtrees are unbalanced.
+  int max_depth = 0;
+  while ((1 << max_depth) < 4 * num_threads) ++max_depth;
+  std::function<void(Iterator, Iterator, int)> partition =
+      [&](Iterator first, Iterator last, int depth) {
+        if (depth == max_depth || last - first < 2 * kMinElementsPerThread) {
+          top.push_back({std::nullopt, static_cast<int>(ranges.size())});
+          ranges.emplace_back(first, last);
+          return;
+        }
+        BvType bv_M = ComputeBoundingVolume(mesh_M, first, last);
+        const Iterator mid = Partition(mesh_M, bv_M, first, last, strategy);
+        top.push_back({std::move(bv_M), -1});
+        partition(first, mid, depth + 1);
+        partition(mid, last, depth + 1);
+      };
+  partition(start, end, 0);
+
+  // The subtrees are independent; build them concurrently, each into its own
+  // storage.
+  const int num_subtrees = static_cast<int>(ranges.size());
+  std::vector<std::vector<NodeType>> subtrees(num_subtrees);
+  drake::internal::ParallelFor(0, num_subtrees, num_threads, [&](int i) {
+    const auto& [first, last] = ranges[i];
+    subtrees[i].reserve(2 * (last - first));
+    BuildBvSubtree(mesh_M, first, last, strategy, &subtrees[i]);
+  });
+
+  // Assemble the top and the subtrees in depth-first pre-order.
+  int next = 0;
+  std::function<void()> append = [&]() {
+    TopEntry& entry = top[next++];
+    if (entry.subtree >= 0) {
+      std::vector<NodeType>& subtree = subtrees[entry.subtree];
+      nodes->insert(nodes->end(), std::make_move_iterator(subtree.begin()),
+                    std::make_move_iterator(subtree.end()));
+      return;
+    }
+    const int index = static_cast<int>(nodes->size());
+    nodes->push_back(NodeType(std::move(*entry.branch_bv)));
+    append();
+    (*nodes)[index].set_right_offset(static_cast<int>(nodes->size()) - index);
+    append();
+  };
+  append();
+}
+
+template <class BvType, class SourceMeshType>
+auto Bvh<BvType, SourceMeshType>::Partition(
+    const SourceMeshType& mesh_M, const BvType& bv_M,
+    const typename std::vector<CentroidPair>::iterator& start,
+    const typename std::vector<CentroidPair>::iterator& end,
+    BvhBuildStrategy strategy) -> typename std::vector<CentroidPair>::iterator {
+  return strategy == BvhBuildStrategy::kSurfaceAreaHeuristic
+             ? PartitionBySah(mesh_M, bv_M, start, end)
+             : PartitionByMedian(bv_M, start, end);
+}
+
+template <class BvType, class SourceMeshType>
+auto Bvh<BvType, SourceMeshType>::PartitionByMedian(
+    const BvType& bv_M,
+    const typename std::vector<CentroidPair>::iterator& start,
+    const typename std::vector<CentroidPair>::iterator& end) ->
+    typename std::vector<CentroidPair>::iterator {
+  // Sort the elements by centroid along the axis of greatest spread.
+  // Note: We tried an alternative strategy for building the BVH using a
+  // volume-based metric.
+  // - Given a parent BV P, we would partition all of its contents into a left
+  //   BV, L, and a right BV, R, such that we wanted to minimize (V(L) + V(R))
+  //   / V(P). (V(X) is the volume measure of the bounding volume X).
+  // - We didn't explore all possible partitions (there are an exponential
+  //   number of such possible partitions).
+  // - Instead, we ordered the mesh elements along an axis and then would
+  //   consider partitions split between two adjacent elements in the sorted
+  //   set. This was repeated for each of the axes and the partition with the
+  //   minimum value was taken.
+  // - We did explore several ordering options, including sorting by centroid,
+  //   min, max, and a combination of them when the element overlapped the
+  //   partition boundary.
+  // This tentative partitioning strategy produced more BV-BV tests in some
+  // simple examples than the simple bisection shown below and was abandoned.
+  // Some possible reasons for this:
+  // - Sorting by an alternate criteria might be a better way to order them.
+  // - Only considering split points based on adjacent elements may be
+  //   problematic.
+  // - The elements individual extents are such they are not typically
+  //   axis-aligned so, partitioning between two elements would often produce
+  //   child BVs that have non-trivial overlap.
+  // Finally, the primitive meshes we are producing are relatively regular and
+  // are probably nicely compatible with the median split strategy. For
+  // irregular distributions of elements,
+  // BvhBuildStrategy::kSurfaceAreaHeuristic may help. But proceed with
+  // caution -- there's no guarantee such a strategy will yield performance
+  // benefits.
+
+  // This ordering formulation satisfies both Aabb and Obb. It is true that
+  // the cost for Aabb is *slightly* more expensive than it *could* be. For
+  // Aabb, the possible value for Baxis_M are always the basis vectors so we
+  // wouldn't actually have to perform a dot product. However, as this is
+  // part of the one-time cost of construction, we're not going to worry about
+  // that cost versus the cost of re-expressing this operation to be BV
+  // dependent. That will be deferred to some future date when that's *known*
+  // to be necessary. See the todo on Aabb::pose().
+  int axis{};
+  bv_M.half_width().maxCoeff(&axis);
+  // B is the canonical frame of the bounding volume.
+  const math::RigidTransformd& X_MB = bv_M.pose();
+  const auto& Baxis_M = X_MB.rotation().col(axis);
+  std::sort(start, end,
+            [&Baxis_M](const CentroidPair& a, const CentroidPair& b) {
+              return Baxis_M.dot(a.second) < Baxis_M.dot(b.second);
+            });
+  return start + (end - start) / 2;
+}
+
+template <class BvType, class SourceMeshType>
+auto Bvh<BvType, SourceMeshType>::PartitionBySah(
+    const SourceMeshType& mesh_M, const BvType& bv_M,
+    const typename std::vector<CentroidPair>::iterator& start,
+    const typename std::vector<CentroidPair>::iterator& end) ->
+    typename std::vector<CentroidPair>::iterator {
+  const int num_elements = end - start;
+  // The axis-aligned boxes bounding each element and the centroids.
+  std::vector<Eigen::AlignedBox3d> element_boxes(num_elements);
+  Eigen::AlignedBox3d centroid_box;
+  for (int i = 0; i < num_elements; ++i) {
+    const auto& element = mesh_M.element((start + i)->first);
+    for (int v = 0; v < kElementVertexCount; ++v) {
+      element_boxes[i].extend(
+          convert_to_double(mesh_M.vertex(element.vertex(v)).r_MV()));
+    }
+    centroid_box.extend((start + i)->second);
+  }
+
+  // The bins evenly divide the extent of the centroids along an axis.
+  auto calc_bin = [&centroid_box](int axis, const Vector3d& centroid) {
+    const double lower = centroid_box.min()[axis];
+    const double extent = centroid_box.max()[axis] - lower;
+    const int bin =
+        static_cast<int>((centroid[axis] - lower) / extent * kNumSahBins);
+    return std::min(bin, kNumSahBins - 1);
+  };
+
+  double best_cost = std::numeric_limits<double>::infinity();
+  int best_axis = -1;
+  int best_bin = -1;
+  for (int axis = 0; axis < 3; ++axis) {
+    if (!(centroid_box.max()[axis] > centroid_box.min()[axis])) continue;
+    std::array<int, kNumSahBins> bin_counts{};
+    std::array<Eigen::AlignedBox3d, kNumSahBins> bin_boxes;
+    for (int i = 0; i < num_elements; ++i) {
+      const int bin = calc_bin(axis, (start + i)->second);
+      ++bin_counts[bin];
+      bin_boxes[bin].extend(element_boxes[i]);
+    }
+    // right_costs[b] is the cost of a right child holding bins [b, N).
+    std::array<double, kNumSahBins> right_costs{};
+    Eigen::AlignedBox3d right_box;
+    int right_count = 0;
+    for (int b = kNumSahBins - 1; b > 0; --b) {
+      right_box.extend(bin_boxes[b]);
+      right_count += bin_counts[b];
+      if (right_count > 0) {
+        right_costs[b] = right_count * CalcSurfaceArea(right_box);
+      }
+    }
+    // Consider each split between bins b - 1 and b for which both children
+    // get elements.
+    Eigen::AlignedBox3d left_box;
+    int left_count = 0;
+    for (int b = 1; b < kNumSahBins; ++b) {
+      left_box.extend(bin_boxes[b - 1]);
+      left_count += bin_counts[b - 1];
+      if (left_count == 0 || left_count == num_elements) continue;
+      const double cost =
+          left_count * CalcSurfaceArea(left_box) + right_costs[b];
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_axis = axis;
+        best_bin = b;
+      }
+    }
+  }
+
+  if (best_axis < 0) return PartitionByMedian(bv_M, start, end);
+  return std::partition(
+      start, end, [&calc_bin, best_axis, best_bin](const CentroidPair& a) {
+        return calc_bin(best_axis, a.second) < best_bin;
+      });
+}
+
+template <class BvType, class SourceMeshType>
+int Bvh<BvType, SourceMeshType>::RebuildSubtree(const SourceMeshType& mesh,
+                                                int index) {
+  const int end = SubtreeEnd(index);
+  std::vector<CentroidPair> element_centroids;
+  for (int i = index; i < end; ++i) {
+    const NodeType& node = nodes_[i];
+    if (!node.is_leaf()) continue;
+    for (int e = 0; e < node.num_element_indices(); ++e) {
+      const IndexType element = node.element_index(e);
+      element_centroids.emplace_back(element, ComputeCentroid(mesh, element));
+    }
+  }
+  std::vector<NodeType> subtree;
+  subtree.reserve(end - index);
+  BuildBvTree(mesh, element_centroids.begin(), element_centroids.end(),
+              options_.strategy, options_.num_threads, &subtree);
+
+  // The only nodes whose offsets span the subtree are its ancestors whose
+  // right child follows it; they must account for any change in its size.
+  const int size_change = static_cast<int>(subtree.size()) - (end - index);
+  if (size_change != 0) {
+    for (int i = 0; i < index; ++i) {
+      NodeType& node = nodes_[i];
+      if (!node.is_leaf() && i + node.data_[0] > index) {
+        node.data_[0] += size_change;
+      }
+    }
   }
+  nodes_.erase(nodes_.begin() + index, nodes_.begin() + end);
+  nodes_.insert(nodes_.begin() + index, std::make_move_iterator(subtree.begin()),
+                std::make_move_iterator(subtree.end()));
+  return static_cast<int>(subtree.size());
 }
 
 template <class BvType, class SourceMeshType>
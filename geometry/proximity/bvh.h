@@ -1,10 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
-#include <memory>
+#include <cstdint>
 #include <stack>
 #include <utility>
-#include <variant>
 #include <vector>
 
 #include "drake/common/drake_assert.h"
@@ -37,7 +37,20 @@ struct MeshTraits<VolumeMesh<T>> {
   static constexpr int kMaxElementPerBvhLeaf = 1;
 };
 
-/* Node of the tree structure representing the Bvh.  */
+template <class BvType, class SourceMeshType>
+class Bvh;
+
+/* Node of the tree structure representing the Bvh.
+
+ The nodes of a Bvh are stored contiguously, in depth-first pre-order, in a
+ single array owned by the Bvh (see Bvh::root_node()). A branch node's left
+ child immediately follows it in the array and its right child is found at a
+ 32-bit offset from it. A leaf node stores its element indices inline. This
+ keeps the nodes compact and traversal cache-friendly, but it means that the
+ children of a branch node are only reachable when the node is part of its
+ Bvh's storage. Therefore nodes can't be copied (except by their Bvh, when it
+ copies all of them); they can only be moved, which Bvh does to manage its
+ storage.  */
 template <class BvType, class MeshType>
 class BvNode {
  public:
@@ -55,19 +68,16 @@ class BvNode {
    @param bv    The bounding volume encompassing the elements.
    @param data  The indices of the mesh elements contained in the leaf. */
   BvNode(BvType bv, LeafData data)
-      : bv_(std::move(bv)), child_(std::move(data)) {}
-
-  /* Constructor for branch/internal nodes.
-   @param bv The bounding volume encompassing the elements in child branches.
-   @param left Unique pointer to the left child branch.
-   @param right Unique pointer to the right child branch.
-   @pre Both children must be distinct and not null.   */
-  BvNode(BvType bv, std::unique_ptr<BvNode<BvType, MeshType>> left,
-         std::unique_ptr<BvNode<BvType, MeshType>> right)
-      : bv_(std::move(bv)),
-        child_(NodeChildren(std::move(left), std::move(right))) {}
+      : bv_(std::move(bv)), num_index_(data.num_index) {
+    DRAKE_DEMAND(0 <= data.num_index && data.num_index <= kMaxElementPerLeaf);
+    for (int i = 0; i < data.num_index; ++i) {
+      data_[i] = data.indices[i];
+    }
+  }
 
-  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(BvNode)
+  BvNode(BvNode&&) = default;
+  BvNode& operator=(BvNode&&) = default;
+  BvNode& operator=(const BvNode&) = delete;
 
   /* Returns the bounding volume.  */
   const BvType& bv() const { return bv_; }
@@ -75,33 +85,34 @@ class BvNode {
   /* Returns the number of element indices.
    @pre is_leaf() returns true. */
   int num_element_indices() const {
-    return std::get<LeafData>(child_).num_index;
+    DRAKE_ASSERT(is_leaf());
+    return num_index_;
   }
 
   /* Returns the i-th element index in the leaf data.
    @pre is_leaf() returns true.
    @pre `i` is less than LeafData::num_index, and i >= 0. */
   typename MeshType::ElementIndex element_index(int i) const {
-    DRAKE_ASSERT(0 <= i && i < std::get<LeafData>(child_).num_index);
-    return std::get<LeafData>(child_).indices[i];
+    DRAKE_ASSERT(0 <= i && i < num_index_);
+    return typename MeshType::ElementIndex(data_[i]);
   }
 
   /* Returns the left child branch.
    @pre is_leaf() returns false.  */
   const BvNode<BvType, MeshType>& left() const {
-    return *(std::get<NodeChildren>(child_).left);
+    DRAKE_ASSERT(!is_leaf());
+    return *(this + 1);
   }
 
   /* Returns the right child branch.
    @pre is_leaf() returns false.  */
   const BvNode<BvType, MeshType>& right() const {
-    return *(std::get<NodeChildren>(child_).right);
+    DRAKE_ASSERT(!is_leaf());
+    return *(this + data_[0]);
   }
 
   /* Returns whether this is a leaf node as opposed to a branch node.  */
-  bool is_leaf() const {
-    return std::holds_alternative<LeafData>(child_);
-  }
+  bool is_leaf() const { return num_index_ != kBranch; }
 
   /* Compares this node with the given node in a strictly *topological* manner.
    For them to be considered "equal leaves", both nodes must be leaves and must
@@ -132,45 +143,41 @@ class BvNode {
   }
 
  private:
+  friend class Bvh<BvType, MeshType>;
   template <typename> friend class BvhUpdater;
 
-  /* Provide disciplined access to BvhUpdater to a mutable child node. */
-  BvNode<BvType, MeshType>& left() {
-    return *(std::get<NodeChildren>(child_).left);
-  }
+  /* The value of num_index_ that marks a branch node.  */
+  static constexpr int32_t kBranch = -1;
 
-  /* Provide disciplined access to BvhUpdater to a mutable child node. */
-  BvNode<BvType, MeshType>& right() {
-    return *(std::get<NodeChildren>(child_).right);
-  }
+  /* Constructor for branch/internal nodes. The left child must be the next
+   node in the Bvh's node array; the right child's offset is set (via
+   set_right_offset()) once it is known.
+   @param bv The bounding volume encompassing the elements in child branches.
+   */
+  explicit BvNode(BvType bv) : bv_(std::move(bv)), num_index_(kBranch) {}
 
-  /* Provide disciplined access to BvhUpdater to a mutable bounding volume. */
-  BvType& bv() { return bv_; }
+  /* Only a Bvh copies its nodes (see Clone()).  */
+  BvNode(const BvNode&) = default;
 
-  struct NodeChildren {
-    std::unique_ptr<BvNode<BvType, MeshType>> left;
-    std::unique_ptr<BvNode<BvType, MeshType>> right;
+  /* Returns a copy of this node, for a Bvh that copies all of its nodes.  */
+  BvNode Clone() const { return *this; }
 
-    NodeChildren(std::unique_ptr<BvNode<BvType, MeshType>> left_in,
-                 std::unique_ptr<BvNode<BvType, MeshType>> right_in)
-        : left(std::move(left_in)), right(std::move(right_in)) {
-      DRAKE_DEMAND(left != nullptr);
-      DRAKE_DEMAND(right != nullptr);
-      DRAKE_DEMAND(left != right);
-    }
+  /* Sets the offset (in nodes) from this branch node to its right child.  */
+  void set_right_offset(int offset) {
+    DRAKE_DEMAND(!is_leaf() && offset > 1);
+    data_[0] = offset;
+  }
 
-    NodeChildren(const NodeChildren& other)
-        : NodeChildren{
-              std::make_unique<BvNode<BvType, MeshType>>(*other.left),
-              std::make_unique<BvNode<BvType, MeshType>>(*other.right)} {}
-  };
+  /* Provide disciplined access to BvhUpdater to a mutable bounding volume. */
+  BvType& bv() { return bv_; }
 
   BvType bv_;
 
-  // If this is a leaf node then the child refers to indices into the mesh's
-  // elements (i.e., triangles or tetrahedra) bounded by the node's bounding
-  // volume. Otherwise, it refers to child nodes further down the tree.
-  std::variant<LeafData, NodeChildren> child_;
+  // If this is a leaf node, num_index_ is the number of element indices (i.e.,
+  // into the mesh's triangles or tetrahedra) stored in data_. Otherwise, it is
+  // kBranch and data_[0] is the offset from this node to its right child.
+  int32_t num_index_{};
+  std::array<int32_t, kMaxElementPerLeaf> data_{};
 };
 
 /* Resulting instruction from performing the bounding volume tree traversal
@@ -187,6 +194,46 @@ template <class MeshType, class OtherMeshType>
 using BvttCallback = std::function<BvttCallbackResult(
     typename MeshType::ElementIndex, typename OtherMeshType::ElementIndex)>;
 
+/* The front of a bounding volume tree traversal (BVTT) of two hierarchies A
+ and B: the pairs of nodes (each referenced by its index in its hierarchy's
+ depth-first pre-order, i.e., the root is zero) at which the traversal stopped,
+ either because their bounding volumes were found to be separated or because
+ both nodes are leaves. The front is a complete cut of the BVTT: every pair of
+ leaves is the descendant of exactly one of its node pairs. See
+ Bvh::CollideFromFront().  */
+using BvttFront = std::vector<std::pair<int, int>>;
+
+/* The strategy with which Bvh divides the elements of a branch node between
+ its two children.  */
+enum class BvhBuildStrategy {
+  /* Sorts the elements by centroid along the longest axis of the node's
+   bounding volume and splits them in half. It produces balanced trees and
+   works well for the fairly regular meshes that Drake generates for primitive
+   shapes.  */
+  kMedianSplit,
+  /* Bins the element centroids along each of the three axes of the hierarchy's
+   frame and picks the split (between two adjacent bins) that minimizes the
+   surface area heuristic (SAH) cost: the sum, over both children, of the
+   number of elements times the surface area of the box bounding them. It
+   produces better trees for irregular meshes (e.g., those imported from CAD
+   with long thin features next to densely tessellated regions). The surface
+   areas are always those of axis-aligned boxes; for Obb they are a proxy for
+   the area of the eventual bounding volumes.  */
+  kSurfaceAreaHeuristic,
+};
+
+/* The options with which a Bvh is constructed.  */
+struct BvhBuildOptions {
+  BvhBuildStrategy strategy{BvhBuildStrategy::kMedianSplit};
+
+  /* The maximum number of threads used to build the hierarchy (including the
+   calling thread). The top levels of the hierarchy are split on the calling
+   thread until there are a few subtrees per thread (as long as they are large
+   enough to be worth it); those subtrees are then built concurrently. The
+   hierarchy doesn't depend on the number of threads.  */
+  int num_threads{1};
+};
+
 /* %Bvh is an acceleration structure for performing spatial queries against a
  collection of objects (in this case, triangles or tetrahedra). Specifically,
  for identifying those objects in or near a particular region of interest. It
@@ -209,21 +256,35 @@ class Bvh {
   using IndexType = typename MeshType::ElementIndex;
   using NodeType = BvNode<BvType, MeshType>;
 
-  explicit Bvh(const MeshType& mesh);
-
-  Bvh(const Bvh& bvh) { *this = bvh; }
-
-  Bvh& operator=(const Bvh& bvh) {
-    if (&bvh == this) return *this;
-
-    root_node_ = std::make_unique<NodeType>(*bvh.root_node_);
+  /* @name Implements CopyConstructible, CopyAssignable, MoveConstructible,
+   MoveAssignable  */
+  //@{
+  Bvh(const Bvh& other) : options_(other.options_) {
+    nodes_.reserve(other.nodes_.size());
+    for (const NodeType& node : other.nodes_) {
+      nodes_.push_back(node.Clone());
+    }
+  }
+  Bvh& operator=(const Bvh& other) {
+    if (this != &other) *this = Bvh(other);
     return *this;
   }
-
   Bvh(Bvh&&) = default;
   Bvh& operator=(Bvh&&) = default;
+  //@}
+
+  /* Builds the hierarchy of the given mesh.
+   @throws std::exception if `options.num_threads` is less than one.  */
+  explicit Bvh(const MeshType& mesh, const BvhBuildOptions& options = {});
 
-  const NodeType& root_node() const { return *root_node_; }
+  const NodeType& root_node() const { return nodes_[0]; }
+
+  /* Reports the options the hierarchy was built with. They also apply to any
+   later rebuild (see BvhUpdater).  */
+  const BvhBuildOptions& build_options() const { return options_; }
+
+  /* Reports the total number of (branch and leaf) nodes in the hierarchy.  */
+  int num_nodes() const { return static_cast<int>(nodes_.size()); }
 
   /* Perform a query of this %Bvh's mesh elements (measured and expressed in
    Frame A) against the given %Bvh's mesh elements (measured and expressed in
@@ -280,6 +341,97 @@ class Bvh {
     }
   }
 
+  /* Variant of Collide() that exploits temporal coherence between queries
+   on the same two hierarchies whose relative pose changes a little between
+   queries. Rather than starting at the pair of roots, the traversal starts at
+   the node pairs of the given `front` (as recorded by the previous query) and
+   so skips the bounding volume tests above it. If `front` is empty, the
+   traversal starts at the roots. On return, `front` holds the front of this
+   traversal.
+
+   The callback is invoked on every pair of elements Collide() would report
+   (an element pair whose bounding volumes all overlap descends from one of
+   the front's node pairs) but, because the tests above the front are skipped,
+   it may also be invoked on some pairs that Collide() would have culled. The
+   front is recorded (and traversed) in the same depth-first order as
+   Collide()'s traversal, so the pairs that Collide() would report are
+   reported in the same order. The front never moves towards the roots, so the
+   caller should discard it (i.e., clear it) once it has grown too large to be
+   worth it.
+
+   If the callback terminates the traversal, `front` is cleared.
+
+   @param bvh_B           The bounding volume hierarchy to collide with.
+   @param X_AB            The relative pose of the two hierarchies.
+   @param callback        The callback to invoke on each unculled pair.
+   @param[in,out] front   The front of the traversal.
+   @pre `front` is empty or was produced by a previous call on these two
+        hierarchies (which haven't been modified since).  */
+  template <class OtherBvhType>
+  void CollideFromFront(
+      const OtherBvhType& bvh_B, const math::RigidTransformd& X_AB,
+      BvttCallback<MeshType, typename OtherBvhType::MeshType> callback,
+      BvttFront* front) const {
+    DRAKE_DEMAND(front != nullptr);
+    using OtherNodeType = typename OtherBvhType::NodeType;
+    const NodeType* const nodes_a = &root_node();
+    const OtherNodeType* const nodes_b = &bvh_B.root_node();
+    // The front is recorded in traversal order, but it is consumed as a stack
+    // (from the back); reverse it to traverse it in the same order.
+    BvttFront node_pairs;
+    node_pairs.swap(*front);
+    std::reverse(node_pairs.begin(), node_pairs.end());
+    if (node_pairs.empty()) node_pairs.emplace_back(0, 0);
+
+    while (!node_pairs.empty()) {
+      const auto [a, b] = node_pairs.back();
+      node_pairs.pop_back();
+      DRAKE_ASSERT(a < num_nodes() && b < bvh_B.num_nodes());
+      const NodeType& node_a = nodes_a[a];
+      const OtherNodeType& node_b = nodes_b[b];
+
+      if (!BvType::HasOverlap(node_a.bv(), node_b.bv(), X_AB)) {
+        front->emplace_back(a, b);
+        continue;
+      }
+
+      if (node_a.is_leaf() && node_b.is_leaf()) {
+        front->emplace_back(a, b);
+        const int num_a_elements = node_a.num_element_indices();
+        const int num_b_elements = node_b.num_element_indices();
+        for (int i = 0; i < num_a_elements; ++i) {
+          for (int j = 0; j < num_b_elements; ++j) {
+            const BvttCallbackResult result =
+                callback(node_a.element_index(i), node_b.element_index(j));
+            if (result == BvttCallbackResult::Terminate) {
+              front->clear();
+              return;
+            }
+          }
+        }
+        continue;
+      }
+      // A branch's left child immediately follows it; its right child is
+      // found by its address relative to the root.
+      if (node_b.is_leaf()) {
+        const int a_right = static_cast<int>(&node_a.right() - nodes_a);
+        node_pairs.emplace_back(a + 1, b);
+        node_pairs.emplace_back(a_right, b);
+      } else if (node_a.is_leaf()) {
+        const int b_right = static_cast<int>(&node_b.right() - nodes_b);
+        node_pairs.emplace_back(a, b + 1);
+        node_pairs.emplace_back(a, b_right);
+      } else {
+        const int a_right = static_cast<int>(&node_a.right() - nodes_a);
+        const int b_right = static_cast<int>(&node_b.right() - nodes_b);
+        node_pairs.emplace_back(a + 1, b + 1);
+        node_pairs.emplace_back(a_right, b + 1);
+        node_pairs.emplace_back(a + 1, b_right);
+        node_pairs.emplace_back(a_right, b_right);
+      }
+    }
+  }
+
   /* Culls the nodes of the BVH based on the nodes' bounding volumes'
    relationships with a primitive object. This is different from the BVH-BVH
    Collide() method in that when a node is found to be overlapping the
@@ -364,13 +516,81 @@ class Bvh {
 
   template <typename> friend class BvhUpdater;
 
-  NodeType& mutable_root_node() { return *root_node_; }
+  /* Provides BvhUpdater mutable access to the nodes (stored in depth-first
+   pre-order, so every node precedes its descendants).  */
+  std::vector<NodeType>& mutable_nodes() { return nodes_; }
+
+  /* Returns the index one past the last node of the subtree rooted at
+   nodes_[index]; the subtree occupies the range [index, SubtreeEnd(index)).  */
+  int SubtreeEnd(int index) const {
+    DRAKE_ASSERT(0 <= index && index < num_nodes());
+    while (!nodes_[index].is_leaf()) {
+      index += nodes_[index].data_[0];
+    }
+    return index + 1;
+  }
+
+  /* Rebuilds the subtree rooted at nodes_[index] from the current vertex
+   positions of `mesh`, the mesh this hierarchy was built on. The subtree holds
+   the same elements afterwards, but both its topology and its number of nodes
+   may change; nodes outside the subtree keep their bounding volumes but nodes
+   after it are shifted accordingly.
+   @returns The number of nodes in the rebuilt subtree.  */
+  int RebuildSubtree(const MeshType& mesh, int index);
 
   using CentroidPair = std::pair<IndexType, Vector3<double>>;
 
-  static std::unique_ptr<NodeType> BuildBvTree(
+  /* Appends the subtree for the elements in the range [start, end) to
+   `nodes`, in depth-first pre-order, partitioning the elements with the given
+   `strategy` and using up to `num_threads` threads.  */
+  static void BuildBvTree(
+      const MeshType& mesh,
+      const typename std::vector<CentroidPair>::iterator& start,
+      const typename std::vector<CentroidPair>::iterator& end,
+      BvhBuildStrategy strategy, int num_threads,
+      std::vector<NodeType>* nodes);
+
+  /* The single-threaded implementation of BuildBvTree().  */
+  static void BuildBvSubtree(
       const MeshType& mesh,
       const typename std::vector<CentroidPair>::iterator& start,
+      const typename std::vector<CentroidPair>::iterator& end,
+      BvhBuildStrategy strategy, std::vector<NodeType>* nodes);
+
+  /* The multi-threaded implementation of BuildBvTree(). It partitions the top
+   levels of the hierarchy on the calling thread, until there are a few
+   subtrees per thread (or the subtrees get too small to be worth a thread),
+   and then builds those subtrees concurrently with a single ParallelFor().
+   The result is the same as BuildBvSubtree()'s.  */
+  static void BuildBvTreeInParallel(
+      const MeshType& mesh,
+      const typename std::vector<CentroidPair>::iterator& start,
+      const typename std::vector<CentroidPair>::iterator& end,
+      BvhBuildStrategy strategy, int num_threads,
+      std::vector<NodeType>* nodes);
+
+  /* Dispatches to PartitionByMedian() or PartitionBySah(), per `strategy`.  */
+  static typename std::vector<CentroidPair>::iterator Partition(
+      const MeshType& mesh_M, const BvType& bv_M,
+      const typename std::vector<CentroidPair>::iterator& start,
+      const typename std::vector<CentroidPair>::iterator& end,
+      BvhBuildStrategy strategy);
+
+  /* Reorders the elements in the range [start, end) (whose bounding volume is
+   `bv_M`) such that the elements of the left child precede those of the right
+   child, and returns the first element of the right child. Each child gets at
+   least one element.  */
+  static typename std::vector<CentroidPair>::iterator PartitionByMedian(
+      const BvType& bv_M,
+      const typename std::vector<CentroidPair>::iterator& start,
+      const typename std::vector<CentroidPair>::iterator& end);
+
+  /* Variant of PartitionByMedian() for
+   BvhBuildStrategy::kSurfaceAreaHeuristic. Falls back to PartitionByMedian()
+   if the centroids all coincide.  */
+  static typename std::vector<CentroidPair>::iterator PartitionBySah(
+      const MeshType& mesh_M, const BvType& bv_M,
+      const typename std::vector<CentroidPair>::iterator& start,
       const typename std::vector<CentroidPair>::iterator& end);
 
   static BvType ComputeBoundingVolume(
@@ -411,7 +631,10 @@ class Bvh {
 
   static constexpr int kElementVertexCount = MeshType::kVertexPerElement;
 
-  std::unique_ptr<NodeType> root_node_;
+  BvhBuildOptions options_;
+
+  // The nodes of the tree, in depth-first pre-order; nodes_[0] is the root.
+  std::vector<NodeType> nodes_;
 };
 
 }  // namespace internal
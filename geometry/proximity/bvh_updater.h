@@ -1,8 +1,11 @@
 #pragma once
 
+#include <chrono>
+#include <cmath>
 #include <limits>
 #include <vector>
 
+#include "drake/common/drake_throw.h"
 #include "drake/geometry/proximity/aabb.h"
 #include "drake/geometry/proximity/bvh.h"
 
@@ -10,6 +13,50 @@ namespace drake {
 namespace geometry {
 namespace internal {
 
+/* The policy by which BvhUpdater decides whether refitting the hierarchy's
+ bounding volumes suffices or whether (part of) the hierarchy should be rebuilt.
+
+ Refitting preserves the hierarchy's topology. As a mesh deforms, elements that
+ were once near each other (and were grouped in the same subtree) can drift
+ apart, so that the refit bounding volumes grow and overlap and the hierarchy
+ culls poorly. The quality of the subtree rooted at node N is measured as the
+ summed surface area of the bounding volumes in the subtree, normalized by the
+ area of N's bounding volume (a surface area heuristic cost). It is invariant
+ to rigid motions and uniform scaling of the subtree. The *degradation* of a
+ subtree is the ratio of its current quality to its quality when it was last
+ built; it is one for a freshly built subtree and grows as the subtree's fit
+ deteriorates.
+
+ The default policy always refits and never rebuilds.  */
+struct BvhUpdatePolicy {
+  /* If the degradation of the whole hierarchy exceeds this ratio, the entire
+   hierarchy is rebuilt.  */
+  double full_rebuild_ratio{std::numeric_limits<double>::infinity()};
+
+  /* Otherwise, every maximal (proper) subtree whose degradation exceeds this
+   ratio is rebuilt in place.  */
+  double subtree_rebuild_ratio{std::numeric_limits<double>::infinity()};
+};
+
+/* Statistics accumulated by BvhUpdater over its calls to Update(). The times
+ are wall-clock times, in seconds, and can be compared with the time spent
+ querying the hierarchy to tune a BvhUpdatePolicy.  */
+struct BvhUpdateStatistics {
+  /* The number of calls to Update() (that had work to do).  */
+  int num_updates{0};
+  /* The total number of subtrees rebuilt in place.  */
+  int num_subtree_rebuilds{0};
+  /* The number of times the whole hierarchy was rebuilt.  */
+  int num_full_rebuilds{0};
+  /* The total time spent refitting and measuring the hierarchy's quality.  */
+  double refit_time{0};
+  /* The total time spent rebuilding (sub)trees.  */
+  double rebuild_time{0};
+  /* The degradation of the whole hierarchy measured by the most recent call to
+   Update() (after refitting, before any rebuild).  */
+  double last_degradation{1.0};
+};
+
 /* This class can be used to update a bounding-volume hierarchy (BVH). It
  doesn't own the BVH or the corresponding mesh, but merely applies an algorithm
  to the BVH which compares its current configuration against the underlying
@@ -18,6 +65,11 @@ namespace internal {
  This will frequently be combined with a MeshDeformer so that when a mesh is
  updated, the corresponding Bvh can likewise be updated.
 
+ By default, an update refits the bounding volumes to the mesh without changing
+ the hierarchy's topology. A BvhUpdatePolicy can allow the updater to rebuild
+ subtrees (or the whole hierarchy) whose quality has degraded too far; see
+ BvhUpdatePolicy for the quality metric.
+
  This current incarnation only supports Bvhs constructed with axis-aligned
  bounding boxes.
 
@@ -46,21 +98,83 @@ class BvhUpdater {
       : mesh_(*mesh_M), bvh_(*bvh_M) {
     DRAKE_DEMAND(mesh_M != nullptr);
     DRAKE_DEMAND(bvh_M != nullptr);
+    CalcQuality();
+    reference_quality_ = quality_;
   }
 
   const MeshType& mesh() const { return mesh_; }
   const Bvh<Aabb, MeshType>& bvh() const { return bvh_; }
 
+  /* Sets the policy used by Update() to choose between refitting and
+   rebuilding.
+   @throws std::exception if either ratio in `policy` is less than one.  */
+  void set_policy(const BvhUpdatePolicy& policy) {
+    DRAKE_THROW_UNLESS(policy.full_rebuild_ratio >= 1.0);
+    DRAKE_THROW_UNLESS(policy.subtree_rebuild_ratio >= 1.0);
+    policy_ = policy;
+  }
+
+  const BvhUpdatePolicy& policy() const { return policy_; }
+
+  /* Returns the statistics accumulated over all calls to Update().  */
+  const BvhUpdateStatistics& statistics() const { return statistics_; }
+
+  /* Copies the policy, statistics, and per-node reference qualities of
+   `other`, for use after this updater's bvh has been assigned a copy of (or
+   has taken over) the `other` updater's bvh (see DeformableVolumeMesh).
+   @pre bvh() has the nodes that `other.bvh()` had when `other` last measured
+        its quality.  */
+  void CopyStateFrom(const BvhUpdater& other) {
+    DRAKE_DEMAND(bvh_.num_nodes() == static_cast<int>(other.quality_.size()));
+    policy_ = other.policy_;
+    statistics_ = other.statistics_;
+    quality_ = other.quality_;
+    reference_quality_ = other.reference_quality_;
+  }
+
   /* Updates the referenced bvh to maintain a good fit on the referenced mesh.
-   */
+   All bounding volumes are refit; then, subject to the policy(), degraded
+   subtrees or the whole hierarchy are rebuilt.  */
   void Update() {
     /* Get the *double-valued* mesh vertices. */
     const auto& vertices = GetMeshVertices(mesh_.vertices());
     if (vertices.size() == 0) return;
+    ++statistics_.num_updates;
 
-    /* This implementation doesn't change the bvh topology; it simply passes
-     through each box in a bottom-up manner refitting the box to the data. */
-    UpdateRecursive(&bvh_.mutable_root_node(), vertices);
+    const auto refit_start = Clock::now();
+    /* This passes through each box in a bottom-up manner refitting the box to
+     the data. The nodes are stored in depth-first pre-order, so visiting them
+     in reverse order visits every node after all of its descendants. */
+    std::vector<NodeType>& nodes = bvh_.mutable_nodes();
+    for (auto node = nodes.rbegin(); node != nodes.rend(); ++node) {
+      RefitNode(&*node, vertices);
+    }
+    CalcQuality();
+    /* If the hierarchy was replaced with one of a different size (e.g., by
+     assignment), the current quality becomes the reference. */
+    if (reference_quality_.size() != quality_.size()) {
+      reference_quality_ = quality_;
+    }
+    statistics_.last_degradation = CalcDegradation(0);
+    const auto rebuild_start = Clock::now();
+    statistics_.refit_time += Duration(rebuild_start - refit_start).count();
+
+    bool rebuilt = false;
+    if (statistics_.last_degradation > policy_.full_rebuild_ratio) {
+      bvh_ = Bvh<Aabb, MeshType>(mesh_, bvh_.build_options());
+      ++statistics_.num_full_rebuilds;
+      CalcQuality();
+      reference_quality_ = quality_;
+      rebuilt = true;
+    } else if (std::isfinite(policy_.subtree_rebuild_ratio)) {
+      rebuilt = RebuildDegradedSubtrees();
+    } else {
+      return;
+    }
+    /* Looking for degraded subtrees without finding any only measures the
+     hierarchy's quality. */
+    const double elapsed = Duration(Clock::now() - rebuild_start).count();
+    (rebuilt ? statistics_.rebuild_time : statistics_.refit_time) += elapsed;
   }
 
  private:
@@ -84,9 +198,81 @@ class BvhUpdater {
     return vertices_dbl;
   }
 
-  // Helper function to perform a bottom-up refit.
-  void UpdateRecursive(
-      typename Bvh<Aabb, MeshType>::NodeType* node,
+  using NodeType = typename Bvh<Aabb, MeshType>::NodeType;
+  using Clock = std::chrono::steady_clock;
+  using Duration = std::chrono::duration<double>;
+
+  /* Computes quality_ for every node of the (already fit) hierarchy; see
+   BvhUpdatePolicy.  */
+  void CalcQuality() {
+    const std::vector<NodeType>& nodes = bvh_.mutable_nodes();
+    const int num_nodes = static_cast<int>(nodes.size());
+    summed_area_.resize(num_nodes);
+    quality_.resize(num_nodes);
+    for (int i = num_nodes - 1; i >= 0; --i) {
+      const NodeType& node = nodes[i];
+      const double area = node.bv().CalcSurfaceArea();
+      summed_area_[i] = area;
+      if (!node.is_leaf()) {
+        summed_area_[i] += summed_area_[i + 1] +
+                           summed_area_[&node.right() - &nodes[0]];
+      }
+      quality_[i] = area > 0 ? summed_area_[i] / area : 1.0;
+    }
+  }
+
+  double CalcDegradation(int i) const {
+    return quality_[i] / reference_quality_[i];
+  }
+
+  /* Rebuilds each maximal proper subtree whose degradation exceeds the
+   policy's subtree threshold. Rebuilt subtrees get fresh reference
+   qualities. Returns true if any subtree was rebuilt.  */
+  bool RebuildDegradedSubtrees() {
+    /* A pre-order scan that skips the subtree of every node it selects finds
+     the maximal subtrees. We skip the root; rebuilding it is a full rebuild. */
+    std::vector<int> roots;
+    for (int i = 1; i < static_cast<int>(quality_.size());) {
+      if (!bvh_.mutable_nodes()[i].is_leaf() &&
+          CalcDegradation(i) > policy_.subtree_rebuild_ratio) {
+        roots.push_back(i);
+        i = bvh_.SubtreeEnd(i);
+      } else {
+        ++i;
+      }
+    }
+    if (roots.empty()) return false;
+
+    /* Rebuild from back to front so that the indices of the remaining roots
+     are unaffected by changes in the size of the rebuilt subtrees. The
+     rebuilt subtrees' reference values are marked (NaN) for replacement. */
+    constexpr double kUnset = std::numeric_limits<double>::quiet_NaN();
+    for (auto root = roots.rbegin(); root != roots.rend(); ++root) {
+      const int begin = *root;
+      const int end = bvh_.SubtreeEnd(begin);
+      const int new_size = bvh_.RebuildSubtree(mesh_, begin);
+      reference_quality_.erase(reference_quality_.begin() + begin,
+                               reference_quality_.begin() + end);
+      reference_quality_.insert(reference_quality_.begin() + begin, new_size,
+                                kUnset);
+    }
+    statistics_.num_subtree_rebuilds += static_cast<int>(roots.size());
+
+    /* The rebuilt subtrees bound the same elements, so the bounding volumes
+     of their ancestors remain fit; only the qualities need updating. */
+    CalcQuality();
+    for (int i = 0; i < static_cast<int>(quality_.size()); ++i) {
+      if (std::isnan(reference_quality_[i])) {
+        reference_quality_[i] = quality_[i];
+      }
+    }
+    return true;
+  }
+
+  // Helper function to refit a single node; the boxes of a branch node's
+  // children must already have been refit.
+  void RefitNode(
+      NodeType* node,
       const std::vector<typename MeshType::template VertexType<double>>&
           vertices) {
     using Vector3d = Eigen::Vector3d;
@@ -111,17 +297,26 @@ class BvhUpdater {
         }
       }
     } else {
-      UpdateRecursive(&node->left(), vertices);
-      UpdateRecursive(&node->right(), vertices);
       // Update box on child boxes.
-      lower = node->left().bv().lower().cwiseMin(node->right().bv().lower());
-      upper = node->left().bv().upper().cwiseMax(node->right().bv().upper());
+      const Aabb& left = node->left().bv();
+      const Aabb& right = node->right().bv();
+      lower = left.lower().cwiseMin(right.lower());
+      upper = left.upper().cwiseMax(right.upper());
     }
     node->bv().set_bounds(lower, upper);
   }
 
   const MeshType& mesh_;
   Bvh<Aabb, MeshType>& bvh_;
+  BvhUpdatePolicy policy_;
+  BvhUpdateStatistics statistics_;
+
+  // The per-node quality of the hierarchy as of the last update and as of when
+  // each node was (re)built, respectively. Indexed as the hierarchy's nodes.
+  std::vector<double> quality_;
+  std::vector<double> reference_quality_;
+  // Scratch space for CalcQuality().
+  std::vector<double> summed_area_;
 };
 
 }  // namespace internal
@@ -0,0 +1,39 @@
+#include "drake/geometry/proximity/cache_file.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include <fmt/format.h>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+bool WriteFileAtomically(const std::string& filename,
+                         const std::function<bool(std::ostream*)>& write) {
+  // The temporary name is unique to the writing thread, so that concurrent
+  // writers of the same file don't interfere.
+  const std::string temp_filename = fmt::format(
+      "{}.{}.{}.tmp", filename, getpid(),
+      std::hash<std::thread::id>{}(std::this_thread::get_id()));
+  bool written = false;
+  std::ofstream out(temp_filename, std::ios::binary | std::ios::trunc);
+  if (out.is_open()) {
+    written = write(&out);
+    // Closing flushes the stream; that must succeed too.
+    out.close();
+    written = written && !out.fail();
+  }
+  if (!written || std::rename(temp_filename.c_str(), filename.c_str()) != 0) {
+    std::remove(temp_filename.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* @name Helpers for on-disk caches
+
+ The proximity engine caches some expensive, derived geometry data (e.g.,
+ hydroelastic representations and signed distance fields) in files. The files
+ hold raw values in the machine's native binary format; they are only an
+ optimization, so every read reports failure rather than throwing, and the
+ caller falls back to computing the data.  */
+//@{
+
+/* Writes the bytes of `value` to `out`.  */
+template <typename T>
+void WriteValue(std::ostream* out, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  out->write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/* Reads a value written by WriteValue(); returns false on failure.  */
+template <typename T>
+bool ReadValue(std::istream* in, T* value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  in->read(reinterpret_cast<char*>(value), sizeof(T));
+  return static_cast<bool>(*in);
+}
+
+/* Writes the size of `values` and then the bytes of its elements to `out`.  */
+template <typename T>
+void WriteVector(std::ostream* out, const std::vector<T>& values) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  WriteValue(out, static_cast<uint64_t>(values.size()));
+  out->write(reinterpret_cast<const char*>(values.data()),
+             values.size() * sizeof(T));
+}
+
+/* Reads `size` elements written by WriteVector() into `values`; the caller
+ reads (and bounds) the size first. Returns false on failure.  */
+template <typename T>
+bool ReadVector(std::istream* in, uint64_t size, std::vector<T>* values) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  values->resize(size);
+  in->read(reinterpret_cast<char*>(values->data()), size * sizeof(T));
+  return static_cast<bool>(*in);
+}
+
+/* Writes a file by invoking `write` on a binary stream to a temporary file in
+ the same directory, and then renaming it to `filename`. Other threads and
+ processes reading `filename` see either its old contents or the complete new
+ ones, never a partially written file. `write` reports whether it succeeded.
+ Returns true iff the file was written and renamed; otherwise, the temporary
+ file is removed and `filename` is left untouched.  */
+bool WriteFileAtomically(const std::string& filename,
+                         const std::function<bool(std::ostream*)>& write);
+
+//@}
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
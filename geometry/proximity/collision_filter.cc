@@ -1,5 +1,7 @@
 #include "drake/geometry/proximity/collision_filter.h"
 
+#include <algorithm>
+
 #include "drake/common/drake_assert.h"
 #include "drake/common/unused.h"
 
@@ -36,7 +38,8 @@ void CollisionFilter::Apply(const CollisionFilterDeclaration& declaration,
   //    - In the case where there is *only* persistent state, don't use the
   //      copy as the persistent state *is* its own composite state.
   /* Keep current configuration and persistent base in sync. */
-  Apply(declaration, extract_ids, is_invariant, &filter_state_);
+  Apply(declaration, extract_ids, is_invariant, &filter_state_,
+        &filter_matrix_);
   Apply(declaration, extract_ids, is_invariant,
         &filter_history_[0].filter_state);
 }
@@ -62,7 +65,8 @@ FilterId CollisionFilter::ApplyTransient(
   //  declaration and applying the declaration twice. If this cost is too high,
   //  even for out-of-the-loop configuration, revisit how we represent the
   //  history and maintain the composite copy.
-  Apply(declaration, extract_ids, is_invariant, &filter_state_);
+  Apply(declaration, extract_ids, is_invariant, &filter_state_,
+        &filter_matrix_);
   filter_history_.emplace_back(
       InitializeTransientState(filter_state_, kUndefined),
       FilterId::get_new_id());
@@ -107,6 +111,8 @@ bool CollisionFilter::RemoveDeclaration(FilterId id) {
         }
       }
     }
+    /* Removing a declaration can change any pair; recompile everything. */
+    filter_matrix_.Compile(filter_state_);
     return true;
   }
   return false;
@@ -124,6 +130,7 @@ void CollisionFilter::AddGeometry(GeometryId new_id) {
    unfiltered status. */
   AddGeometry(new_id, &filter_state_, kUnfiltered);
   AddGeometry(new_id, &filter_history_[0].filter_state, kUnfiltered);
+  filter_matrix_.AddGeometry(new_id);
   // TODO(SeanCurtis): Can I skip this work by allowing delta filter state to be
   //  incomplete? If each transient delta *only* contains explicitly declared
   //  changes, iterating through it would be faster. More complex, but faster.
@@ -139,47 +146,41 @@ void CollisionFilter::RemoveGeometry(GeometryId remove_id) {
   for (auto& delta : filter_history_) {
     RemoveGeometry(remove_id, &delta.filter_state);
   }
-}
-
-bool CollisionFilter::CanCollideWith(GeometryId id_A, GeometryId id_B) const {
-  if (id_A == id_B) return false;
-  if (id_A < id_B) {
-    return filter_state_.at(id_A).at(id_B) == kUnfiltered;
-  } else {
-    return filter_state_.at(id_B).at(id_A) == kUnfiltered;
-  }
+  filter_matrix_.RemoveGeometry(remove_id);
 }
 
 void CollisionFilter::AddFiltersBetween(
     const GeometrySet& set_A, const GeometrySet& set_B,
     const CollisionFilter::ExtractIds& extract_ids, bool is_invariant,
-    FilterState* state_out) {
+    FilterState* state_out, FilterMatrix* matrix) {
   const std::unordered_set<GeometryId> ids_A = extract_ids(set_A);
   const std::unordered_set<GeometryId>& ids_B =
       &set_A == &set_B ? ids_A : extract_ids(set_B);
   for (GeometryId id_A : ids_A) {
     for (GeometryId id_B : ids_B) {
-      AddFilteredPair(id_A, id_B, is_invariant, state_out);
+      AddFilteredPair(id_A, id_B, is_invariant, state_out, matrix);
     }
   }
 }
 
 void CollisionFilter::RemoveFiltersBetween(
     const GeometrySet& set_A, const GeometrySet& set_B,
-    const CollisionFilter::ExtractIds& extract_ids, FilterState* state_out) {
+    const CollisionFilter::ExtractIds& extract_ids, FilterState* state_out,
+    FilterMatrix* matrix) {
   const std::unordered_set<GeometryId> ids_A = extract_ids(set_A);
   const std::unordered_set<GeometryId>& ids_B =
       &set_A == &set_B ? ids_A : extract_ids(set_B);
   for (GeometryId id_A : ids_A) {
     for (GeometryId id_B : ids_B) {
-      RemoveFilteredPair(id_A, id_B, state_out);
+      RemoveFilteredPair(id_A, id_B, state_out, matrix);
     }
   }
 }
 
 void CollisionFilter::AddFilteredPair(GeometryId id_A, GeometryId id_B,
                                       bool is_invariant,
-                                      FilterState* state_out) {
+                                      FilterState* state_out,
+                                      FilterMatrix* matrix) {
   FilterState& filter_state = *state_out;
   DRAKE_DEMAND(filter_state.count(id_A) == 1 &&
                filter_state.count(id_B) == 1);
@@ -189,10 +190,12 @@ void CollisionFilter::AddFilteredPair(GeometryId id_A, GeometryId id_B,
       id_A < id_B ? filter_state[id_A][id_B] : filter_state[id_B][id_A];
   if (pair_relation == kInvariantFilter) return;
   pair_relation = is_invariant ? kInvariantFilter : kFiltered;
+  if (matrix != nullptr) matrix->Set(id_A, id_B, false);
 }
 
 void CollisionFilter::RemoveFilteredPair(GeometryId id_A, GeometryId id_B,
-                                         FilterState* state_out) {
+                                         FilterState* state_out,
+                                         FilterMatrix* matrix) {
   FilterState& filter_state = *state_out;
   DRAKE_DEMAND(filter_state.count(id_A) == 1 &&
                filter_state.count(id_B) == 1);
@@ -201,6 +204,7 @@ void CollisionFilter::RemoveFilteredPair(GeometryId id_A, GeometryId id_B,
       id_A < id_B ? filter_state[id_A][id_B] : filter_state[id_B][id_A];
   if (pair_relation == kInvariantFilter) return;
   pair_relation = kUnfiltered;
+  if (matrix != nullptr) matrix->Set(id_A, id_B, true);
 }
 
 bool CollisionFilter::operator==(const CollisionFilter& other) const {
@@ -226,12 +230,16 @@ CollisionFilter CollisionFilter::MakeClearCopy() const {
   CollisionFilter new_filter;
   new_filter.filter_state_ = clear_state;
   new_filter.filter_history_[0].filter_state = clear_state;
+  /* The copy keeps the geometries' indices.  */
+  new_filter.filter_matrix_ = filter_matrix_;
+  new_filter.filter_matrix_.Compile(clear_state);
   return new_filter;
 }
 
 void CollisionFilter::Apply(const CollisionFilterDeclaration& declaration,
                             const CollisionFilter::ExtractIds& extract_ids,
-                            bool is_invariant, FilterState* filter_state) {
+                            bool is_invariant, FilterState* filter_state,
+                            FilterMatrix* matrix) {
   using Operation = CollisionFilterDeclaration::StatementOp;
   for (const auto& statement : declaration.statements()) {
     switch (statement.operation) {
@@ -240,20 +248,20 @@ void CollisionFilter::Apply(const CollisionFilterDeclaration& declaration,
         // while removing collision filters.
         DRAKE_DEMAND(!is_invariant);
         RemoveFiltersBetween(statement.set_A, statement.set_B, extract_ids,
-                             filter_state);
+                             filter_state, matrix);
         break;
       case Operation::kAllowWithin:
         DRAKE_DEMAND(!is_invariant);
         RemoveFiltersBetween(statement.set_A, statement.set_A, extract_ids,
-                             filter_state);
+                             filter_state, matrix);
         break;
       case Operation::kExcludeWithin:
         AddFiltersBetween(statement.set_A, statement.set_A, extract_ids,
-                          is_invariant, filter_state);
+                          is_invariant, filter_state, matrix);
         break;
       case Operation::kExcludeBetween:
         AddFiltersBetween(statement.set_A, statement.set_B, extract_ids,
-                          is_invariant, filter_state);
+                          is_invariant, filter_state, matrix);
         break;
     }
   }
@@ -306,6 +314,72 @@ CollisionFilter::FilterState CollisionFilter::InitializeTransientState(
   }
   return new_state;
 }
+
+void CollisionFilter::FilterMatrix::AddGeometry(GeometryId id) {
+  DRAKE_DEMAND(index_.count(id) == 0);
+  int row{};
+  if (!free_rows_.empty()) {
+    row = free_rows_.back();
+    free_rows_.pop_back();
+  } else {
+    row = static_cast<int>(ids_.size());
+    if (row == 64 * words_per_row_) {
+      /* Out of capacity: double the row length (and number of rows).  */
+      const int new_words_per_row = std::max(1, 2 * words_per_row_);
+      std::vector<uint64_t> new_bits(64 * new_words_per_row * new_words_per_row,
+                                     0);
+      for (int i = 0; i < row; ++i) {
+        std::copy(bits_.begin() + i * words_per_row_,
+                  bits_.begin() + (i + 1) * words_per_row_,
+                  new_bits.begin() + i * new_words_per_row);
+      }
+      words_per_row_ = new_words_per_row;
+      bits_ = std::move(new_bits);
+    }
+    ids_.emplace_back();
+  }
+  index_[id] = row;
+  ids_[row] = id;
+  /* A reused row was cleared when it was vacated.  */
+  for (int i = 0; i < static_cast<int>(ids_.size()); ++i) {
+    if (i == row || !ids_[i].is_valid()) continue;
+    SetBit(i, row, true);
+    SetBit(row, i, true);
+  }
+}
+
+void CollisionFilter::FilterMatrix::RemoveGeometry(GeometryId id) {
+  const int row = index_.at(id);
+  /* Clear the vacated row and column so that the row is clean for reuse.  */
+  for (int i = 0; i < static_cast<int>(ids_.size()); ++i) {
+    SetBit(row, i, false);
+    SetBit(i, row, false);
+  }
+  ids_[row] = GeometryId{};
+  free_rows_.push_back(row);
+  index_.erase(id);
+}
+
+void CollisionFilter::FilterMatrix::Set(GeometryId id_A, GeometryId id_B,
+                                        bool can_collide) {
+  DRAKE_ASSERT(id_A != id_B);
+  const int i = index_.at(id_A);
+  const int j = index_.at(id_B);
+  SetBit(i, j, can_collide);
+  SetBit(j, i, can_collide);
+}
+
+void CollisionFilter::FilterMatrix::Compile(const FilterState& filter_state) {
+  DRAKE_DEMAND(filter_state.size() == index_.size());
+  std::fill(bits_.begin(), bits_.end(), 0);
+  /* The filter state holds each pair once (and each geometry with itself).  */
+  for (const auto& [id_A, geometry_map] : filter_state) {
+    for (const auto& [id_B, relationship] : geometry_map) {
+      if (id_A != id_B && relationship == kUnfiltered) Set(id_A, id_B, true);
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
 #include "drake/geometry/collision_filter_declaration.h"
 #include "drake/geometry/geometry_ids.h"
 
@@ -20,7 +23,16 @@ namespace internal {
 
  Geometries are identified by their geometry ids. The filter status of the
  geometry pair (g, h) can only be modified if both g and h have already been
- added to this filter system (via AddGeometry()). */
+ added to this filter system (via AddGeometry()).
+
+ CanCollideWith() is evaluated in every broadphase callback of every proximity
+ query, so the filter state is additionally compiled into a dense bit matrix
+ (see FilterMatrix). Each geometry is assigned a row of the matrix, its index
+ (see GetIndex()), when it is added. The proximity engine stores that index with
+ the geometry's fcl object so that the broadphase callbacks can query the
+ matrix by index: a single bit test, with no hashing. The matrix is updated
+ incrementally as geometries are added and removed and as declarations are
+ applied. */
 class CollisionFilter {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CollisionFilter)
@@ -108,10 +120,27 @@ class CollisionFilter {
    @pre `remove_id` is part of this filter system. */
   void RemoveGeometry(GeometryId remove_id);
 
+  /* Reports the index assigned to the geometry with the given `id`. The index
+   is unchanged for as long as the geometry is part of this filter system (and
+   carries over to copies of it); the index of a removed geometry may be
+   assigned to a geometry added later.
+   @pre `id` is part of this filter system. */
+  int GetIndex(GeometryId id) const { return filter_matrix_.index(id); }
+
+  /* Reports true if the geometry pair with indices (`index_A`, `index_B`) is
+   considered to be unfiltered.
+   @pre `index_A` and `index_B` are indices of geometries that are part of this
+        filter system (see GetIndex()). */
+  bool CanCollideWith(int index_A, int index_B) const {
+    return filter_matrix_.CanCollide(index_A, index_B);
+  }
+
   /* Reports true if the geometry pair (`id_A`, `id_B`) is considered to be
    unfiltered.
    @pre `id_A` and `id_B` are both part of this filter system. */
-  bool CanCollideWith(GeometryId id_A, GeometryId id_B) const;
+  bool CanCollideWith(GeometryId id_A, GeometryId id_B) const {
+    return CanCollideWith(GetIndex(id_A), GetIndex(id_B));
+  }
 
   /* Reports if two collision filters are configured the same. They are
    considered the same if the two filter systems report the same results for
@@ -175,10 +204,76 @@ class CollisionFilter {
 
   using FilterState = std::unordered_map<GeometryId, GeometryMap>;
 
-  /* Applies the given declaration to an arbitrary `filter_state`. */
+  /* The compiled form of the composite filter state: a symmetric bit matrix
+   with a row for each registered geometry, where bit (i, j) is set iff the
+   geometries of rows i and j can collide. Each geometry is assigned a row when
+   added and keeps it until it is removed; a removed geometry's row is cleared
+   and reused by the next geometry added. Each row is padded to a whole number
+   of 64-bit words, with room to grow, so that adding a geometry only
+   occasionally reallocates the matrix.  */
+  class FilterMatrix {
+   public:
+    DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(FilterMatrix)
+
+    FilterMatrix() = default;
+
+    /* Adds the geometry, unfiltered with respect to all other geometries.
+     @pre `id` has not been added.  */
+    void AddGeometry(GeometryId id);
+
+    /* Removes the geometry.
+     @pre `id` has been added.  */
+    void RemoveGeometry(GeometryId id);
+
+    /* Reports the row of the geometry.
+     @pre `id` has been added.  */
+    int index(GeometryId id) const { return index_.at(id); }
+
+    /* Sets whether the (distinct) geometries can collide.
+     @pre `id_A` and `id_B` have been added.  */
+    void Set(GeometryId id_A, GeometryId id_B, bool can_collide);
+
+    /* Reports whether the geometries of rows `i` and `j` can collide; a
+     geometry can't collide with itself.
+     @pre `i` and `j` are rows of added geometries.  */
+    bool CanCollide(int i, int j) const {
+      DRAKE_ASSERT(i >= 0 && i < static_cast<int>(ids_.size()));
+      DRAKE_ASSERT(j >= 0 && j < static_cast<int>(ids_.size()));
+      return GetBit(i, j);
+    }
+
+    /* Recompiles the bits of the matrix from the given (composite) filter
+     state. The rows of the geometries are unchanged.
+     @pre `filter_state` contains exactly the added geometries.  */
+    void Compile(const FilterState& filter_state);
+
+   private:
+    void SetBit(int i, int j, bool value) {
+      uint64_t& word = bits_[i * words_per_row_ + j / 64];
+      const uint64_t mask = uint64_t{1} << (j % 64);
+      word = value ? (word | mask) : (word & ~mask);
+    }
+
+    bool GetBit(int i, int j) const {
+      return (bits_[i * words_per_row_ + j / 64] >> (j % 64)) & 1;
+    }
+
+    // The row of each geometry, and the geometry of each row (invalid for a
+    // vacated row). Vacated rows are reused before the matrix grows.
+    std::unordered_map<GeometryId, int> index_;
+    std::vector<GeometryId> ids_;
+    std::vector<int> free_rows_;
+    // The rows of the matrix; there is capacity for 64 * words_per_row_ rows.
+    int words_per_row_{0};
+    std::vector<uint64_t> bits_;
+  };
+
+  /* Applies the given declaration to an arbitrary `filter_state`. If `matrix`
+   is not null, it is updated to match the changes to `filter_state`. */
   static void Apply(const CollisionFilterDeclaration& declaration,
                     const ExtractIds& extract_ids, bool is_invariant,
-                    FilterState* filter_state);
+                    FilterState* filter_state,
+                    FilterMatrix* matrix = nullptr);
 
   /* Adds the geometry with the given `id` to the given filter state with the
    given initial_state for all pairs including the new id. */
@@ -202,7 +297,8 @@ class CollisionFilter {
   static void AddFiltersBetween(const GeometrySet& set_A,
                                 const GeometrySet& set_B,
                                 const ExtractIds& extract_ids,
-                                bool is_invariant, FilterState* state_out);
+                                bool is_invariant, FilterState* state_out,
+                                FilterMatrix* matrix);
 
   /* Declares pairs (`id_A`, `id_B`) `∀ id_A ∈ set_A, id_B ∈ set_B` to be
    unfiltered (if the filter isn't invariant). For each pair, if they are
@@ -212,15 +308,17 @@ class CollisionFilter {
   static void RemoveFiltersBetween(const GeometrySet& set_A,
                                    const GeometrySet& set_B,
                                    const ExtractIds& extract_ids,
-                                   FilterState* state_out);
+                                   FilterState* state_out,
+                                   FilterMatrix* matrix);
 
   /* Atomic operation in support of AddFiltersBetween().  */
   static void AddFilteredPair(GeometryId id_A, GeometryId id_B,
-                              bool is_invariant, FilterState* state_out);
+                              bool is_invariant, FilterState* state_out,
+                              FilterMatrix* matrix);
 
   /* Atomic operation in support of RemoveFilterBetween().  */
   static void RemoveFilteredPair(GeometryId id_A, GeometryId id_B,
-                                 FilterState* state_out);
+                                 FilterState* state_out, FilterMatrix* matrix);
 
   /* Instantiates a FilterState such that all known pairs have given
    default relationship. */
@@ -237,6 +335,10 @@ class CollisionFilter {
    */
   FilterState filter_state_;
 
+  /* filter_state_ compiled for fast lookup; it must always agree with
+   filter_state_.  */
+  FilterMatrix filter_matrix_;
+
   /* The underlying data for transient history: the assigned filter id and
    the filter state instance which represents the applied transient declaration.
    The filter state has been initialized with all registered geometry and
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/sorted_pair.h"
+#include "drake/geometry/proximity/surface_mesh.h"
+#include "drake/geometry/proximity/volume_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* Scratch memory for the computation of contact surfaces between soft volume
+ meshes and rigid meshes or half spaces. The intermediate quantities of a
+ contact surface (its faces, vertices, and field values, as well as the
+ polygon clipping and culling buffers) are accumulated in the workspace's
+ buffers; the resulting ContactSurface gets copies of them in vectors of
+ exactly the required size.
+
+ A workspace is meant to be owned by a long-lived object (e.g.,
+ ProximityEngine keeps one per worker thread) and passed to every computation.
+ The buffers are cleared, but not freed, before each use. After a few
+ computations they have grown to the sizes the computations need and no
+ further allocations are necessary; the only allocations left are those of the
+ contact surfaces themselves, one per buffer.
+
+ A workspace must not be used by more than one computation at a time.
+
+ @tparam_nonsymbolic_scalar  */
+template <typename T>
+struct ContactSurfaceWorkspace {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(ContactSurfaceWorkspace)
+
+  ContactSurfaceWorkspace() = default;
+
+  /* Clears the buffers that accumulate a contact surface, retaining their
+   memory.  */
+  void ClearSurface() {
+    faces.clear();
+    vertices.clear();
+    e.clear();
+    grad_e.clear();
+  }
+
+  /* @name  Accumulated contact surface
+   The faces, vertices (in the frame the computation is performed in), sampled
+   field values (one per vertex), and field gradients (one per face) of the
+   contact surface being computed.  */
+  //@{
+  std::vector<SurfaceFace> faces;
+  std::vector<SurfaceVertex<T>> vertices;
+  std::vector<T> e;
+  std::vector<Vector3<T>> grad_e;
+  //@}
+
+  /* The indices of the vertices of a single contact polygon.  */
+  std::vector<SurfaceVertexIndex> polygon_indices;
+
+  /* A pair of buffers for clipping polygons (see SurfaceVolumeIntersector).  */
+  std::vector<Vector3<T>> polygon[2];
+
+  /* The tetrahedra whose bounding volumes aren't culled by a plane.  */
+  std::vector<VolumeElementIndex> tet_indices;
+
+  /* The mesh edges cut by a plane, mapped to the contact surface vertices
+   they produce.  */
+  std::unordered_map<SortedPair<VolumeVertexIndex>, SurfaceVertexIndex>
+      cut_edges;
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
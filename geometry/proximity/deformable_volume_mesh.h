@@ -42,27 +42,35 @@ class DeformableVolumeMesh {
   // we can't default those semantics on DeformableVolumeMesh. The deformer_
   // and bvh_updater_ are configured to *always* point to the instance's
   // *members* mesh_ and bvh_. That never changes during the entire lifetime of
-  // a DeformableVolumeMesh instance. So, the assignment operators only have to
-  // worry about setting the member mesh and bvh to the assigned data; we don't
-  // have to (and can't) make any modifications to the deformer or bvh updater.
+  // a DeformableVolumeMesh instance. So, the copy and move operations only have
+  // to worry about setting the member mesh and bvh to the given data and
+  // carrying over the bvh updater's state (its policy, statistics, and the
+  // reference quality of the copied bvh); we don't have to (and can't) make
+  // any other modifications to the deformer or bvh updater.
 
   DeformableVolumeMesh(const DeformableVolumeMesh& other)
-      : DeformableVolumeMesh(other.mesh_, other.bvh_) {}
+      : DeformableVolumeMesh(other.mesh_, other.bvh_) {
+    bvh_updater_.CopyStateFrom(other.bvh_updater_);
+  }
 
   DeformableVolumeMesh& operator=(const DeformableVolumeMesh& other) {
     if (this == &other) return *this;
     mesh_ = other.mesh();
     bvh_ = other.bvh_;
+    bvh_updater_.CopyStateFrom(other.bvh_updater_);
     return *this;
   }
 
   DeformableVolumeMesh(DeformableVolumeMesh&& other)
-      : DeformableVolumeMesh(std::move(other.mesh_), std::move(other.bvh_)) {}
+      : DeformableVolumeMesh(std::move(other.mesh_), std::move(other.bvh_)) {
+    bvh_updater_.CopyStateFrom(other.bvh_updater_);
+  }
 
   DeformableVolumeMesh& operator=(DeformableVolumeMesh&& other) {
     if (this == &other) return *this;
     mesh_ = std::move(other.mesh_);
     bvh_ = std::move(other.bvh_);
+    bvh_updater_.CopyStateFrom(other.bvh_updater_);
     return *this;
   }
 
@@ -88,6 +96,18 @@ class DeformableVolumeMesh {
   @pre q.size == 3 * mesh().num_vertices(). */
   void UpdateVertexPositions(const Eigen::Ref<const VectorX<T>>& q);
 
+  /* Sets the policy by which UpdateVertexPositions() chooses between refitting
+   and rebuilding the bvh(). By default, it is only refit.  */
+  void set_bvh_update_policy(const BvhUpdatePolicy& policy) {
+    bvh_updater_.set_policy(policy);
+  }
+
+  /* Reports the statistics of the bvh() updates performed by
+   UpdateVertexPositions() over the lifetime of this instance.  */
+  const BvhUpdateStatistics& bvh_update_statistics() const {
+    return bvh_updater_.statistics();
+  }
+
  private:
   // The delegate constructor used by move and copy constructors. We can't have
   // all three constructors delegate to this same constructor because the base
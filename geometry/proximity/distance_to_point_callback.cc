@@ -1,5 +1,7 @@
 #include "drake/geometry/proximity/distance_to_point_callback.h"
 
+#include <optional>
+
 #include "drake/common/default_scalars.h"
 
 namespace drake {
@@ -495,6 +497,220 @@ bool ScalarSupport<double>::is_supported(fcl::NODE_TYPE node_type) {
   }
 }
 
+namespace {
+
+/* Evaluates `distance_to_point` on the shape of the given fcl geometry, or
+ returns nullopt if the shape is not one that DistanceToPoint knows.  */
+template <typename T>
+std::optional<SignedDistanceToPoint<T>> ComputeDistanceToShape(
+    const fcl::CollisionGeometryd& collision_geometry,
+    DistanceToPoint<T>* distance_to_point) {
+  switch (collision_geometry.getNodeType()) {
+    case fcl::GEOM_BOX:
+      return (*distance_to_point)(
+          static_cast<const fcl::Boxd&>(collision_geometry));
+    case fcl::GEOM_CAPSULE:
+      return (*distance_to_point)(
+          static_cast<const fcl::Capsuled&>(collision_geometry));
+    case fcl::GEOM_CYLINDER:
+      return (*distance_to_point)(
+          static_cast<const fcl::Cylinderd&>(collision_geometry));
+    case fcl::GEOM_ELLIPSOID:
+      return (*distance_to_point)(
+          static_cast<const fcl::Ellipsoidd&>(collision_geometry));
+    case fcl::GEOM_HALFSPACE:
+      return (*distance_to_point)(
+          static_cast<const fcl::Halfspaced&>(collision_geometry));
+    case fcl::GEOM_SPHERE:
+      return (*distance_to_point)(
+          static_cast<const fcl::Sphered&>(collision_geometry));
+    default:
+      return std::nullopt;
+  }
+}
+
+// The batched kernels below store the query points (expressed in the
+// geometry's frame) one row per point in a column-major array. Each coordinate
+// of all of the points is therefore contiguous in memory and every kernel is a
+// short sequence of coefficient-wise array expressions that Eigen vectorizes.
+// Each kernel mirrors the scalar computation of the same shape above --
+// including its tolerances and its choices where the gradient is not unique --
+// so that both produce the same answers up to round-off.
+template <int dim>
+using PointArray = Eigen::Array<double, Eigen::Dynamic, dim>;
+template <int dim>
+using MaskArray = Eigen::Array<bool, Eigen::Dynamic, dim>;
+
+/* The per-point results of a batched kernel, all quantities measured and
+ expressed in the geometry's frame G.  */
+struct KernelResult {
+  PointArray<3> p_GN;
+  PointArray<3> grad_G;
+  Eigen::ArrayXd distance;
+};
+
+/* Computes the signed distance to the geometry for each point as the
+ projection of p_NQ onto the gradient (see SphereDistanceInSphereFrame() for
+ why this is preferred over ‖p_NQ‖).  */
+void ComputeKernelDistance(const PointArray<3>& p_GQ, KernelResult* result) {
+  result->distance =
+      ((p_GQ - result->p_GN) * result->grad_G).rowwise().sum();
+}
+
+/* Batched SphereDistanceInSphereFrame().  */
+void SphereKernel(double radius, const PointArray<3>& p_SQ,
+                  KernelResult* result) {
+  const double tolerance = DistanceToPointRelativeTolerance(radius);
+  const auto x = p_SQ.col(0);
+  const auto y = p_SQ.col(1);
+  const auto z = p_SQ.col(2);
+  const Eigen::ArrayXd dist_SQ = (x * x + y * y + z * z).sqrt();
+  const MaskArray<1> non_zero_displacement = dist_SQ > tolerance;
+  result->grad_G.resize(p_SQ.rows(), 3);
+  result->grad_G.col(0) = non_zero_displacement.select(x / dist_SQ, 1.0);
+  result->grad_G.col(1) = non_zero_displacement.select(y / dist_SQ, 0.0);
+  result->grad_G.col(2) = non_zero_displacement.select(z / dist_SQ, 0.0);
+  result->p_GN = radius * result->grad_G;
+  ComputeKernelDistance(p_SQ, result);
+}
+
+/* Batched ComputeDistanceToPrimitive() for a halfspace.  */
+void HalfspaceKernel(const PointArray<3>& p_GQ, KernelResult* result) {
+  result->p_GN = p_GQ;
+  result->p_GN.col(2).setZero();
+  result->grad_G = PointArray<3>::Zero(p_GQ.rows(), 3);
+  result->grad_G.col(2).setOnes();
+  result->distance = p_GQ.col(2);
+}
+
+/* Batched ComputeDistanceToPrimitive() for a capsule. The scalar version's
+ end-cap and spine cases are both the distance to a sphere centered on the
+ point of the spine nearest Q (its z-coordinate clamped to the spine).  */
+void CapsuleKernel(double radius, double half_length,
+                   const PointArray<3>& p_GQ, KernelResult* result) {
+  const Eigen::ArrayXd z_GS = p_GQ.col(2).max(-half_length).min(half_length);
+  PointArray<3> p_SQ = p_GQ;
+  p_SQ.col(2) -= z_GS;
+  SphereKernel(radius, p_SQ, result);
+  result->p_GN.col(2) += z_GS;
+}
+
+/* Batched DistanceToPoint::ComputeDistanceToBox(), reporting the nearest
+ points and the gradients.  */
+template <int dim>
+void BoxKernel(const Vector<double, dim>& h, const PointArray<dim>& p_GQ,
+               PointArray<dim>* p_GN, PointArray<dim>* grad_G) {
+  const int num_points = static_cast<int>(p_GQ.rows());
+  // Classify each coordinate as inside, on the boundary of, or outside of its
+  // interval [-h(i), h(i)] and clamp it onto the box; see the scalar version.
+  MaskArray<dim> outside(num_points, dim);
+  MaskArray<dim> boundary(num_points, dim);
+  PointArray<dim> sign(num_points, dim);
+  PointArray<dim> p_GC(num_points, dim);
+  for (int i = 0; i < dim; ++i) {
+    const double tolerance = DistanceToPointRelativeTolerance(h(i));
+    const auto coord = p_GQ.col(i);
+    const Eigen::ArrayXd abs_coord = coord.abs();
+    outside.col(i) = abs_coord > h(i) + tolerance;
+    boundary.col(i) = !outside.col(i) && abs_coord >= h(i) - tolerance;
+    sign.col(i) =
+        (coord < 0.0).select(Eigen::ArrayXd::Constant(num_points, -1.0), 1.0);
+    p_GC.col(i) =
+        (outside.col(i) || boundary.col(i)).select(sign.col(i) * h(i), coord);
+  }
+  const MaskArray<1> any_outside = outside.rowwise().any();
+  const MaskArray<1> any_boundary = boundary.rowwise().any();
+
+  // Outside: the gradient is the direction from C to Q.
+  const PointArray<dim> p_CQ = p_GQ - p_GC;
+  const Eigen::ArrayXd dist_CQ = p_CQ.square().rowwise().sum().sqrt();
+  // On the boundary: the gradient is the normalized sum of the normals of the
+  // faces Q is on.
+  const PointArray<dim> boundary_normal = boundary.select(sign, 0.0);
+  const Eigen::ArrayXd boundary_normal_norm =
+      boundary_normal.square().rowwise().sum().sqrt();
+  // Inside: N is the projection of Q onto the nearest face. As with
+  // ExtremalAxis(), ties go to the lowest axis.
+  Eigen::ArrayXi axis = Eigen::ArrayXi::Zero(num_points);
+  Eigen::ArrayXd min_dist = h(0) - p_GQ.col(0).abs();
+  for (int i = 1; i < dim; ++i) {
+    const Eigen::ArrayXd dist = h(i) - p_GQ.col(i).abs();
+    const MaskArray<1> closer = dist < min_dist;
+    axis = closer.select(i, axis);
+    min_dist = closer.select(dist, min_dist);
+  }
+  const MaskArray<1> inside = !(any_outside || any_boundary);
+
+  p_GN->resize(num_points, dim);
+  grad_G->resize(num_points, dim);
+  for (int i = 0; i < dim; ++i) {
+    const MaskArray<1> on_axis = axis == i;
+    p_GN->col(i) =
+        (inside && on_axis).select(sign.col(i) * h(i), p_GC.col(i));
+    grad_G->col(i) = any_outside.select(
+        p_CQ.col(i) / dist_CQ,
+        any_boundary.select(boundary_normal.col(i) / boundary_normal_norm,
+                            on_axis.select(sign.col(i), 0.0)));
+  }
+}
+
+/* Batched DistanceToPoint::operator() for a box.  */
+void BoxKernel(const fcl::Boxd& box, const PointArray<3>& p_GQ,
+               KernelResult* result) {
+  const Vector3d h = box.side / 2.0;
+  BoxKernel<3>(h, p_GQ, &result->p_GN, &result->grad_G);
+  ComputeKernelDistance(p_GQ, result);
+}
+
+/* Batched DistanceToPoint::operator() for a cylinder. As in the scalar
+ version, the problem is mapped to the 2D box B of the cylinder's cross section
+ through Q and the center line, (x, y, z) -> (r, z).  */
+void CylinderKernel(const fcl::Cylinderd& cylinder, const PointArray<3>& p_GQ,
+                    KernelResult* result) {
+  const int num_points = static_cast<int>(p_GQ.rows());
+  const auto x = p_GQ.col(0);
+  const auto y = p_GQ.col(1);
+  const Eigen::ArrayXd r_Q = (x * x + y * y).sqrt();
+  const MaskArray<1> near_center_line =
+      r_Q < DistanceToPointRelativeTolerance(cylinder.radius);
+  // The basis vector Br expressed in G (its z-component is implicitly zero).
+  const Eigen::ArrayXd v_GBr_x = near_center_line.select(1.0, x / r_Q);
+  const Eigen::ArrayXd v_GBr_y = near_center_line.select(0.0, y / r_Q);
+
+  PointArray<2> p_BQ(num_points, 2);
+  p_BQ.col(0) = r_Q;
+  p_BQ.col(1) = p_GQ.col(2);
+  PointArray<2> p_BN;
+  PointArray<2> grad_B;
+  BoxKernel<2>(Eigen::Vector2d(cylinder.radius, cylinder.lz / 2.0), p_BQ,
+               &p_BN, &grad_B);
+
+  result->p_GN.resize(num_points, 3);
+  result->p_GN.col(0) = p_BN.col(0) * v_GBr_x;
+  result->p_GN.col(1) = p_BN.col(0) * v_GBr_y;
+  result->p_GN.col(2) = p_BN.col(1);
+  result->grad_G.resize(num_points, 3);
+  result->grad_G.col(0) = grad_B.col(0) * v_GBr_x;
+  result->grad_G.col(1) = grad_B.col(0) * v_GBr_y;
+  result->grad_G.col(2) = grad_B.col(1);
+  ComputeKernelDistance(p_GQ, result);
+}
+
+}  // namespace
+
+template <typename T>
+SignedDistanceToPoint<T> ComputeDistanceToField(
+    const SignedDistanceField& field, GeometryId id,
+    const math::RigidTransform<T>& X_WG, const Vector3<T>& p_WQ) {
+  const Vector3<T> p_GQ = X_WG.inverse() * p_WQ;
+  T distance;
+  Vector3<T> grad_G;
+  field.Evaluate(p_GQ, &distance, &grad_G);
+  const Vector3<T> p_GN = p_GQ - distance * grad_G;
+  return SignedDistanceToPoint<T>(id, p_GN, distance,
+                                  X_WG.rotation() * grad_G);
+}
+
 template <typename T>
 bool Callback(fcl::CollisionObjectd* object_A_ptr,
               fcl::CollisionObjectd* object_B_ptr,
@@ -531,47 +747,136 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
     const math::RigidTransform<T> typed_X_WG(data.X_WGs.at(geometry_id));
     DistanceToPoint<T> distance_to_point(geometry_id, typed_X_WG, data.p_WQ_W);
 
-    SignedDistanceToPoint<T> distance;
-    switch (collision_geometry->getNodeType()) {
-      case fcl::GEOM_BOX:
-        distance = distance_to_point(
-            *static_cast<const fcl::Boxd*>(collision_geometry));
-        break;
-      case fcl::GEOM_CAPSULE:
-        distance = distance_to_point(
-            *static_cast<const fcl::Capsuled*>(collision_geometry));
-        break;
-      case fcl::GEOM_CYLINDER:
-        distance = distance_to_point(
-            *static_cast<const fcl::Cylinderd*>(collision_geometry));
-        break;
-      case fcl::GEOM_ELLIPSOID:
-        distance = distance_to_point(
-            *static_cast<const fcl::Ellipsoidd*>(collision_geometry));
-        break;
-      case fcl::GEOM_HALFSPACE:
-        distance = distance_to_point(
-            *static_cast<const fcl::Halfspaced*>(collision_geometry));
-        break;
-      case fcl::GEOM_SPHERE:
-        distance = distance_to_point(
-            *static_cast<const fcl::Sphered*>(collision_geometry));
-        break;
-      default:
-        // Returning false tells fcl to continue to other objects.
-        return false;
-    }
+    const std::optional<SignedDistanceToPoint<T>> distance =
+        ComputeDistanceToShape(*collision_geometry, &distance_to_point);
 
-    if (distance.distance <= data.threshold) {
-      data.distances.emplace_back(distance);
+    if (distance.has_value() && distance->distance <= data.threshold) {
+      data.distances.emplace_back(*distance);
+    }
+  } else if (data.signed_distance_fields != nullptr) {
+    const auto iter = data.signed_distance_fields->find(geometry_id);
+    if (iter != data.signed_distance_fields->end()) {
+      const SignedDistanceToPoint<T> distance = ComputeDistanceToField(
+          *iter->second, geometry_id, data.X_WGs.at(geometry_id), data.p_WQ_W);
+      if (distance.distance <= data.threshold) {
+        data.distances.emplace_back(distance);
+      }
     }
   }
 
   return false;  // Returning false tells fcl to continue to other objects.
 }
 
+bool BatchCallback(fcl::CollisionObjectd* object_A_ptr,
+                   fcl::CollisionObjectd* object_B_ptr,
+                   // NOLINTNEXTLINE
+                   void* callback_data, double& threshold) {
+  auto& data = *static_cast<BatchCallbackData*>(callback_data);
+
+  // See Callback() for why the threshold is reset on every invocation.
+  const double kEps = std::numeric_limits<double>::epsilon() / 10;
+  threshold = std::max(data.threshold, kEps);
+
+  const fcl::CollisionObjectd* geometry_object =
+      (&data.query_batch == object_A_ptr) ? object_B_ptr : object_A_ptr;
+  data.candidates.push_back(geometry_object);
+
+  return false;  // Returning false tells fcl to continue to other objects.
+}
+
+template <typename T>
+void ComputeDistancesToPoints(
+    const fcl::CollisionObjectd& geometry_object,
+    const math::RigidTransform<T>& X_WG, const Matrix3X<T>& p_WQs,
+    double threshold,
+    std::vector<std::pair<int, SignedDistanceToPoint<T>>>* distances,
+    const SignedDistanceField* field) {
+  DRAKE_DEMAND(distances != nullptr);
+  const GeometryId geometry_id = EncodedData(geometry_object).id();
+  if (field != nullptr) {
+    for (int i = 0; i < p_WQs.cols(); ++i) {
+      const SignedDistanceToPoint<T> distance = ComputeDistanceToField(
+          *field, geometry_id, X_WG, Vector3<T>(p_WQs.col(i)));
+      if (distance.distance <= threshold) {
+        distances->emplace_back(i, distance);
+      }
+    }
+    return;
+  }
+  const fcl::CollisionGeometryd& collision_geometry =
+      *geometry_object.collisionGeometry();
+  const fcl::NODE_TYPE node_type = collision_geometry.getNodeType();
+  if (!ScalarSupport<T>::is_supported(node_type)) return;
+
+  if constexpr (std::is_same_v<T, double>) {
+    if (node_type != fcl::GEOM_ELLIPSOID) {
+      // Row i is p_GQᵢᵀ = (R_GW⋅(p_WQᵢ - p_WGo))ᵀ = (p_WQᵢ - p_WGo)ᵀ⋅R_WG.
+      const Eigen::MatrixX3d p_GQs =
+          (p_WQs.colwise() - X_WG.translation()).transpose() *
+          X_WG.rotation().matrix();
+      const PointArray<3> p_GQ = p_GQs.array();
+      KernelResult result;
+      switch (node_type) {
+        case fcl::GEOM_BOX:
+          BoxKernel(static_cast<const fcl::Boxd&>(collision_geometry), p_GQ,
+                    &result);
+          break;
+        case fcl::GEOM_CAPSULE: {
+          const auto& capsule =
+              static_cast<const fcl::Capsuled&>(collision_geometry);
+          CapsuleKernel(capsule.radius, capsule.lz / 2, p_GQ, &result);
+          break;
+        }
+        case fcl::GEOM_CYLINDER:
+          CylinderKernel(
+              static_cast<const fcl::Cylinderd&>(collision_geometry), p_GQ,
+              &result);
+          break;
+        case fcl::GEOM_HALFSPACE: {
+          const auto& halfspace =
+              static_cast<const fcl::Halfspaced&>(collision_geometry);
+          DRAKE_ASSERT(halfspace.n == Vector3d::UnitZ());
+          DRAKE_DEMAND(halfspace.d == 0);
+          HalfspaceKernel(p_GQ, &result);
+          break;
+        }
+        case fcl::GEOM_SPHERE:
+          SphereKernel(
+              static_cast<const fcl::Sphered&>(collision_geometry).radius,
+              p_GQ, &result);
+          break;
+        default:
+          DRAKE_UNREACHABLE();
+      }
+
+      const Matrix3<double>& R_WG = X_WG.rotation().matrix();
+      for (int i = 0; i < p_GQ.rows(); ++i) {
+        if (result.distance(i) <= threshold) {
+          distances->emplace_back(
+              i, SignedDistanceToPoint<double>(
+                     geometry_id, result.p_GN.row(i).transpose().matrix(),
+                     result.distance(i),
+                     R_WG * result.grad_G.row(i).transpose().matrix()));
+        }
+      }
+      return;
+    }
+  }
+
+  for (int i = 0; i < p_WQs.cols(); ++i) {
+    DistanceToPoint<T> distance_to_point(geometry_id, X_WG, p_WQs.col(i));
+    const std::optional<SignedDistanceToPoint<T>> distance =
+        ComputeDistanceToShape(collision_geometry, &distance_to_point);
+    if (distance.has_value() && distance->distance <= threshold) {
+      distances->emplace_back(i, *distance);
+    }
+  }
+}
+
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS((
-    &Callback<T>
+    &ComputeDistanceToField<T>,
+    &Callback<T>,
+    &ComputeDistancesToPoints<T>
 ))
 
 }  // namespace point_distance
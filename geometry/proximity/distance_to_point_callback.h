@@ -4,6 +4,7 @@
 #include <limits>
 #include <tuple>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fcl/fcl.h>
@@ -12,6 +13,7 @@
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
+#include "drake/geometry/proximity/signed_distance_field.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/math/rigid_transform.h"
 
@@ -30,6 +32,8 @@ namespace point_distance {
       keyed on their GeometryId.
     - A vector of distance results -- one instance of SignedDistanceToPoint for
       every supported geometry which lies with the threshold.
+    - Optionally, the precomputed signed distance fields of geometries whose
+      shapes are otherwise unsupported (i.e., meshes).
  */
 template <typename T>
 struct CallbackData {
@@ -43,18 +47,22 @@ struct CallbackData {
    @param p_WQ_W_in           The T-valued position of the query point.
    @param X_WGs_in            The T-valued poses. Aliased.
    @param distances_in[out]   The output results. Aliased.
+   @param signed_distance_fields_in  The signed distance fields (may be null).
+                                     Aliased.
    */
   CallbackData(
       fcl::CollisionObjectd* query_in,
       const double threshold_in,
       const Vector3<T>& p_WQ_W_in,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>* X_WGs_in,
-      std::vector<SignedDistanceToPoint<T>>* distances_in)
+      std::vector<SignedDistanceToPoint<T>>* distances_in,
+      const SignedDistanceFields* signed_distance_fields_in = nullptr)
       : query_point(*query_in),
         threshold(threshold_in),
         p_WQ_W(p_WQ_W_in),
         X_WGs(*X_WGs_in),
-        distances(*distances_in) {
+        distances(*distances_in),
+        signed_distance_fields(signed_distance_fields_in) {
     DRAKE_DEMAND(query_in != nullptr);
     DRAKE_DEMAND(X_WGs_in != nullptr);
     DRAKE_DEMAND(distances_in != nullptr);
@@ -74,6 +82,9 @@ struct CallbackData {
 
   /* The accumulator for results.  */
   std::vector<SignedDistanceToPoint<T>>& distances;
+
+  /* The signed distance fields, if any.  */
+  const SignedDistanceFields* const signed_distance_fields;
 };
 
 /* @name Functions for computing distance from point to primitives
@@ -128,6 +139,15 @@ void ComputeDistanceToPrimitive(const fcl::Capsuled& capsule,
 
 // TODO(DamrongGuoy): Add overloads for all supported geometries.
 
+/* Computes the distance from a point to a geometry represented by its
+ precomputed signed distance field, which is measured and expressed in the
+ geometry's frame G. The witness point N is Q projected along the field's
+ gradient onto its zero level set.  */
+template <typename T>
+SignedDistanceToPoint<T> ComputeDistanceToField(
+    const SignedDistanceField& field, GeometryId id,
+    const math::RigidTransform<T>& X_WG, const Vector3<T>& p_WQ);
+
 //@}
 
 /* A functor to compute signed distance between a point and a geometry. By
@@ -258,8 +278,10 @@ struct ScalarSupport<Eigen::AutoDiffScalar<DerType>> {
 //@}
 
 /* The callback function for computing the signed distance between a point and
- a supported shape. Intended to be invoked as a result of broadphase culling
- of candidate geometry pairs for the pair (`object_A_ptr`, `object_B_ptr`).
+ a supported shape (or a geometry with a signed distance field in
+ CallbackData::signed_distance_fields). Intended to be invoked as a result of
+ broadphase culling of candidate geometry pairs for the pair (`object_A_ptr`,
+ `object_B_ptr`).
 
  @pre The `callback_data` is an instance of point_distance::CallbackData.
  @pre One of the two fcl objects matches the CallbackData.query_point object.
@@ -270,6 +292,79 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
               // NOLINTNEXTLINE
               void* callback_data, double& threshold);
 
+/* Supporting data for the broadphase culling of a _batch_ of query points (see
+ BatchCallback below). The batch (typically a cluster of nearby points) is
+ represented by a single fcl object, e.g., a box spanning the axis-aligned
+ bounding box of the points, so that each tree is traversed once per batch
+ instead of once per point. It includes:
+    - The fcl collision object representing the batch.
+    - A distance threshold beyond which distances will not be reported.
+    - The candidate geometries -- every geometry whose bounding box lies within
+      the threshold of the batch's bounding box.
+ */
+struct BatchCallbackData {
+  /* Constructs the fully-specified callback data. The parameters are aliased in
+   the data and must remain valid at least as long as the BatchCallbackData
+   instance.
+
+   @param query_in            The object representing the batch.
+   @param threshold_in        The query threshold.
+   @param candidates_in[out]  The candidate geometries.  */
+  BatchCallbackData(fcl::CollisionObjectd* query_in, const double threshold_in,
+                    std::vector<const fcl::CollisionObjectd*>* candidates_in)
+      : query_batch(*query_in),
+        threshold(threshold_in),
+        candidates(*candidates_in) {
+    DRAKE_DEMAND(query_in != nullptr);
+    DRAKE_DEMAND(candidates_in != nullptr);
+  }
+
+  /* The query fcl object.  */
+  const fcl::CollisionObjectd& query_batch;
+
+  /* The query threshold.  */
+  const double threshold;
+
+  /* The accumulator for candidate geometries.  */
+  std::vector<const fcl::CollisionObjectd*>& candidates;
+};
+
+/* The broadphase callback for a batch of query points. It does no narrowphase
+ work; it merely records the geometry as a candidate for
+ ComputeDistancesToPoints().
+
+ @pre The `callback_data` is an instance of point_distance::BatchCallbackData.
+ @pre One of the two fcl objects matches the BatchCallbackData.query_batch
+      object.  */
+bool BatchCallback(fcl::CollisionObjectd* object_A_ptr,
+                   fcl::CollisionObjectd* object_B_ptr,
+                   // NOLINTNEXTLINE
+                   void* callback_data, double& threshold);
+
+/* Computes the signed distance from each of the query points Qᵢ (the columns
+ of `p_WQs`) to the geometry G represented by `geometry_object`. For every
+ point whose signed distance is no greater than `threshold` the pair
+ (i, distance) is appended to `distances` (in increasing i). The values match
+ those produced by Callback() for the individual points; unsupported
+ scalar-shape combinations likewise report nothing.
+
+ For T = double, spheres, boxes, capsules, cylinders, and halfspaces are
+ evaluated for all points at once: the points are expressed in G's frame with
+ a single matrix product and stored coordinate by coordinate, so that the
+ per-shape computation reduces to coefficient-wise array expressions which
+ Eigen vectorizes. Other shapes (and all shapes for T = AutoDiffXd) are
+ evaluated point by point with DistanceToPoint. If the geometry has a signed
+ distance `field`, all of the points are evaluated with it instead.
+
+ @pre `geometry_object` encodes the id of a geometry whose pose is X_WG.  */
+template <typename T>
+void ComputeDistancesToPoints(
+    const fcl::CollisionObjectd& geometry_object,
+    const math::RigidTransform<T>& X_WG, const Matrix3X<T>& p_WQs,
+    double threshold,
+    std::vector<std::pair<int, SignedDistanceToPoint<T>>>* distances,
+    const SignedDistanceField* field = nullptr);
+
 }  // namespace point_distance
 }  // namespace internal
 }  // namespace geometry
@@ -25,7 +25,7 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
   const EncodedData encoding_b(*object_B_ptr);
 
   const bool can_collide = data.collision_filter.CanCollideWith(
-      encoding_a.id(), encoding_b.id());
+      encoding_a.filter_index(), encoding_b.filter_index());
   if (can_collide) {
     data.pairs.emplace_back(encoding_a.id(), encoding_b.id());
   }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -8,9 +9,12 @@
 #include <fcl/fcl.h>
 #include <fmt/format.h>
 
+#include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
+#include "drake/common/sorted_pair.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/collision_filter.h"
+#include "drake/geometry/proximity/contact_surface_workspace.h"
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 #include "drake/geometry/proximity/mesh_half_space_intersection.h"
 #include "drake/geometry/proximity/mesh_intersection.h"
@@ -27,6 +31,70 @@ namespace geometry {
 namespace internal {
 namespace hydroelastic {
 
+/* A cache of the temporal coherence data (see MeshIntersectionCoherence) of
+ the pairs of geometries whose contact surfaces are computed by intersecting a
+ soft volume mesh with a rigid surface mesh, keyed by the pairs' ids. The
+ cache is used over a sequence of rounds of queries (e.g., one call to
+ ProximityEngine::ComputeContactSurfaces() per time step); the entries of the
+ pairs that aren't queried in a round are discarded at the start of the next
+ one.  */
+class CoherenceCache {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(CoherenceCache)
+
+  CoherenceCache() = default;
+
+  /* Starts a new round of queries, discarding the entries of the pairs that
+   weren't accessed (see get()) during the previous round.  */
+  void BeginRound() {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (it->second.round < round_) {
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    ++round_;
+  }
+
+  /* Returns the coherence data of the pair of geometries with the given ids,
+   creating it if the pair doesn't have an entry yet. Creating an entry must not
+   happen concurrently with any other access to the cache; accessing existing
+   entries of distinct pairs concurrently is safe.  */
+  MeshIntersectionCoherence& get(GeometryId id_A, GeometryId id_B) {
+    const SortedPair<GeometryId> key(id_A, id_B);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) it = entries_.emplace(key, Entry{}).first;
+    it->second.round = round_;
+    return it->second.coherence;
+  }
+
+  /* Discards the entries of all pairs that include the geometry with the given
+   id (e.g., because its representation has changed).  */
+  void Remove(GeometryId id) {
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      if (it->first.first() == id || it->first.second() == id) {
+        it = entries_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  /* Reports the number of pairs with an entry.  */
+  int size() const { return static_cast<int>(entries_.size()); }
+
+ private:
+  struct Entry {
+    MeshIntersectionCoherence coherence;
+    // The round in which the entry was last accessed.
+    int64_t round{};
+  };
+
+  std::unordered_map<SortedPair<GeometryId>, Entry> entries_;
+  int64_t round_{};
+};
+
 /* Supporting data for the shape-to-shape hydroelastic contact callback (see
  Callback below). It includes:
 
@@ -38,6 +106,8 @@ namespace hydroelastic {
     - The choice of how to represent contact polygons.
     - A vector of contact surfaces -- one instance of ContactSurface for
       every supported, unfiltered penetrating pair.
+    - An optional cache of the pairs' temporal coherence data.
+    - Optional scratch memory for the computations.
 
  @tparam T The computation scalar.  */
 template <typename T>
@@ -53,18 +123,26 @@ struct CallbackData {
                                   representations. Aliased.
    @param polygon_representation_in  The choice of representation of contact
                                   polygons.
-   @param surfaces_in             The output results. Aliased.  */
+   @param surfaces_in             The output results. Aliased.
+   @param coherence_cache_in      The optional coherence cache (may be null).
+                                  Aliased.
+   @param workspace_in            The optional scratch memory (may be null).
+                                  Aliased.  */
   CallbackData(
       const CollisionFilter* collision_filter_in,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>* X_WGs_in,
       const Geometries* geometries_in,
       ContactPolygonRepresentation polygon_representation_in,
-      std::vector<ContactSurface<T>>* surfaces_in)
+      std::vector<ContactSurface<T>>* surfaces_in,
+      CoherenceCache* coherence_cache_in = nullptr,
+      ContactSurfaceWorkspace<T>* workspace_in = nullptr)
       : collision_filter(*collision_filter_in),
         X_WGs(*X_WGs_in),
         geometries(*geometries_in),
         polygon_representation(polygon_representation_in),
-        surfaces(*surfaces_in) {
+        surfaces(*surfaces_in),
+        coherence_cache(coherence_cache_in),
+        workspace(workspace_in) {
     DRAKE_DEMAND(collision_filter_in != nullptr);
     DRAKE_DEMAND(X_WGs_in != nullptr);
     DRAKE_DEMAND(geometries_in != nullptr);
@@ -84,6 +162,14 @@ struct CallbackData {
 
   /* The results of the distance query.  */
   std::vector<ContactSurface<T>>& surfaces;
+
+  /* If not null, the mesh-mesh contact surfaces are computed with the pairs'
+   temporal coherence data.  */
+  CoherenceCache* const coherence_cache;
+
+  /* If not null, the contact surfaces are computed with this scratch memory
+   (see ContactSurfaceWorkspace).  */
+  ContactSurfaceWorkspace<T>* const workspace;
 };
 
 enum class CalcContactSurfaceResult {
@@ -96,14 +182,19 @@ enum class CalcContactSurfaceResult {
 };
 
 /* Computes ContactSurface using the algorithm appropriate to the Shape types
- represented by the given `soft` and `rigid` geometries.
+ represented by the given `soft` and `rigid` geometries. If `coherence_cache`
+ is not null and both geometries are meshes, the pair's temporal coherence data
+ is used (see MeshIntersectionCoherence). If `workspace` is not null, the
+ computation uses it as scratch memory (see ContactSurfaceWorkspace).
  @pre The geometries are not *both* half spaces.  */
 template <typename T>
 std::unique_ptr<ContactSurface<T>> DispatchRigidSoftCalculation(
     const SoftGeometry& soft, const math::RigidTransform<T>& X_WS,
     GeometryId id_S, const RigidGeometry& rigid,
     const math::RigidTransform<T>& X_WR, GeometryId id_R,
-    ContactPolygonRepresentation representation) {
+    ContactPolygonRepresentation representation,
+    CoherenceCache* coherence_cache = nullptr,
+    ContactSurfaceWorkspace<T>* workspace = nullptr) {
   if (soft.is_half_space() || rigid.is_half_space()) {
     if (soft.is_half_space()) {
       DRAKE_DEMAND(!rigid.is_half_space());
@@ -119,7 +210,7 @@ std::unique_ptr<ContactSurface<T>> DispatchRigidSoftCalculation(
           soft.pressure_field();
       const Bvh<Obb, VolumeMesh<double>>& bvh_S = soft.bvh();
       return ComputeContactSurfaceFromSoftVolumeRigidHalfSpace(
-          id_S, field_S, bvh_S, X_WS, id_R, X_WR, representation);
+          id_S, field_S, bvh_S, X_WS, id_R, X_WR, representation, workspace);
     }
   } else {
     // soft cannot be a half space; so this must be mesh-mesh.
@@ -129,8 +220,12 @@ std::unique_ptr<ContactSurface<T>> DispatchRigidSoftCalculation(
     const SurfaceMesh<double>& mesh_R = rigid.mesh();
     const Bvh<Obb, SurfaceMesh<double>>& bvh_R = rigid.bvh();
 
+    MeshIntersectionCoherence* coherence =
+        coherence_cache != nullptr ? &coherence_cache->get(id_S, id_R)
+                                   : nullptr;
     return ComputeContactSurfaceFromSoftVolumeRigidSurface(
-        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation);
+        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR, representation,
+        coherence, workspace);
   }
 }
 
@@ -181,7 +276,8 @@ CalcContactSurfaceResult MaybeCalcContactSurface(
   const math::RigidTransform<T>& X_WR(data->X_WGs.at(id_R));
 
   std::unique_ptr<ContactSurface<T>> surface = DispatchRigidSoftCalculation(
-      soft, X_WS, id_S, rigid, X_WR, id_R, data->polygon_representation);
+      soft, X_WS, id_S, rigid, X_WR, id_R, data->polygon_representation,
+      data->coherence_cache, data->workspace);
 
   if (surface != nullptr) {
     DRAKE_DEMAND(surface->id_M() < surface->id_N());
@@ -207,7 +303,7 @@ bool Callback(fcl::CollisionObjectd* object_A_ptr,
   const EncodedData encoding_b(*object_B_ptr);
 
   const bool can_collide = data.collision_filter.CanCollideWith(
-      encoding_a.id(), encoding_b.id());
+      encoding_a.filter_index(), encoding_b.filter_index());
 
   if (can_collide) {
     CalcContactSurfaceResult result =
@@ -285,7 +381,7 @@ bool CallbackWithFallback(fcl::CollisionObjectd* object_A_ptr,
   const EncodedData encoding_b(*object_B_ptr);
 
   const bool can_collide = data.data.collision_filter.CanCollideWith(
-      encoding_a.id(), encoding_b.id());
+      encoding_a.filter_index(), encoding_b.filter_index());
 
   if (can_collide) {
     CalcContactSurfaceResult result =
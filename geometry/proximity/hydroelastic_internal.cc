@@ -1,9 +1,20 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include "drake/common/hash.h"
+#include "drake/common/never_destroyed.h"
+#include "drake/common/text_logging.h"
+#include "drake/common/unused.h"
+#include "drake/geometry/proximity/cache_file.h"
 #include "drake/geometry/proximity/make_box_field.h"
 #include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/make_capsule_field.h"
@@ -26,16 +37,440 @@ namespace hydroelastic {
 using std::make_unique;
 using std::move;
 
-SoftMesh& SoftMesh::operator=(const SoftMesh& s) {
-  if (this == &s) return *this;
+namespace {
 
-  mesh_ = make_unique<VolumeMesh<double>>(s.mesh());
-  // We can't simply copy the mesh field; the copy must contain a pointer to
-  // the new mesh. So, we use CloneAndSetMesh() instead.
-  pressure_ = s.pressure().CloneAndSetMesh(mesh_.get());
-  bvh_ = make_unique<Bvh<Obb, VolumeMesh<double>>>(s.bvh());
+// Helpers for the on-disk representation cache. The files hold a magic string,
+// the full key of the representation, and then the raw vertex, element, and
+// (for soft meshes) pressure data, in the machine's native binary format.
 
-  return *this;
+constexpr char kDiskCacheMagic[] = "drake_hydroelastic_representation_v1";
+
+// An upper bound on the sizes read from a file, so that a corrupt file can't
+// trigger an enormous allocation.
+constexpr int64_t kMaxDiskCacheCount = int64_t{1} << 30;
+
+void WriteString(std::ostream* out, const std::string& value) {
+  WriteValue<int64_t>(out, value.size());
+  out->write(value.data(), value.size());
+}
+
+bool ReadString(std::istream* in, std::string* value) {
+  int64_t size{};
+  if (!ReadValue(in, &size) || size < 0 || size > kMaxDiskCacheCount) {
+    return false;
+  }
+  value->resize(size);
+  in->read(value->data(), size);
+  return in->good();
+}
+
+// Reads a count that must be positive, e.g., the number of vertices.
+bool ReadCount(std::istream* in, int* count) {
+  int64_t value{};
+  if (!ReadValue(in, &value) || value <= 0 || value > kMaxDiskCacheCount) {
+    return false;
+  }
+  *count = static_cast<int>(value);
+  return true;
+}
+
+template <typename VertexType>
+void WriteVertices(std::ostream* out, const std::vector<VertexType>& vertices) {
+  WriteValue<int64_t>(out, vertices.size());
+  for (const VertexType& vertex : vertices) {
+    for (int i = 0; i < 3; ++i) WriteValue<double>(out, vertex.r_MV()[i]);
+  }
+}
+
+template <typename VertexType>
+bool ReadVertices(std::istream* in, std::vector<VertexType>* vertices) {
+  int num_vertices{};
+  if (!ReadCount(in, &num_vertices)) return false;
+  vertices->reserve(num_vertices);
+  for (int v = 0; v < num_vertices; ++v) {
+    Eigen::Vector3d r_MV;
+    for (int i = 0; i < 3; ++i) {
+      if (!ReadValue(in, &r_MV[i])) return false;
+    }
+    vertices->emplace_back(r_MV);
+  }
+  return true;
+}
+
+// Writes the elements (tetrahedra or triangles) as kNumVertices vertex indices
+// each.
+template <int kNumVertices, typename ElementType>
+void WriteElements(std::ostream* out,
+                   const std::vector<ElementType>& elements) {
+  WriteValue<int64_t>(out, elements.size());
+  for (const ElementType& element : elements) {
+    for (int i = 0; i < kNumVertices; ++i) {
+      WriteValue<int32_t>(out, element.vertex(i));
+    }
+  }
+}
+
+template <int kNumVertices, typename ElementType>
+bool ReadElements(std::istream* in, int num_vertices,
+                  std::vector<ElementType>* elements) {
+  int num_elements{};
+  if (!ReadCount(in, &num_elements)) return false;
+  elements->reserve(num_elements);
+  for (int e = 0; e < num_elements; ++e) {
+    int v[kNumVertices];
+    for (int i = 0; i < kNumVertices; ++i) {
+      int32_t index{};
+      if (!ReadValue(in, &index) || index < 0 || index >= num_vertices) {
+        return false;
+      }
+      v[i] = index;
+    }
+    elements->emplace_back(v);
+  }
+  return true;
+}
+
+// Soft meshes are written as their volume mesh and the values (and name) of
+// their pressure field; the field's gradients and the bounding volume
+// hierarchy are recomputed when read. Half spaces aren't written.
+bool WriteRepresentation(std::ostream* out, const SoftGeometry& soft) {
+  if (soft.is_half_space()) return false;
+  const VolumeMesh<double>& mesh = soft.mesh();
+  WriteVertices(out, mesh.vertices());
+  WriteElements<4>(out, mesh.tetrahedra());
+  const VolumeMeshFieldLinear<double, double>& pressure = soft.pressure_field();
+  WriteString(out, pressure.name());
+  for (const double value : pressure.values()) WriteValue<double>(out, value);
+  return true;
+}
+
+bool WriteRepresentation(std::ostream* out, const RigidGeometry& rigid) {
+  if (rigid.is_half_space()) return false;
+  const SurfaceMesh<double>& mesh = rigid.mesh();
+  WriteVertices(out, mesh.vertices());
+  WriteElements<3>(out, mesh.faces());
+  return true;
+}
+
+std::optional<SoftGeometry> ReadSoftRepresentation(
+    std::istream* in, const BvhBuildOptions& bvh_options) {
+  std::vector<VolumeVertex<double>> vertices;
+  std::vector<VolumeElement> tetrahedra;
+  if (!ReadVertices(in, &vertices)) return std::nullopt;
+  const int num_vertices = static_cast<int>(vertices.size());
+  if (!ReadElements<4>(in, num_vertices, &tetrahedra)) return std::nullopt;
+  std::string name;
+  if (!ReadString(in, &name)) return std::nullopt;
+  std::vector<double> values(num_vertices);
+  for (double& value : values) {
+    if (!ReadValue(in, &value)) return std::nullopt;
+  }
+  auto mesh =
+      make_unique<VolumeMesh<double>>(move(tetrahedra), move(vertices));
+  auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+      move(name), move(values), mesh.get());
+  return SoftGeometry(SoftMesh(move(mesh), move(pressure), bvh_options));
+}
+
+std::optional<RigidGeometry> ReadRigidRepresentation(
+    std::istream* in, const BvhBuildOptions& bvh_options) {
+  std::vector<SurfaceVertex<double>> vertices;
+  std::vector<SurfaceFace> faces;
+  if (!ReadVertices(in, &vertices)) return std::nullopt;
+  const int num_vertices = static_cast<int>(vertices.size());
+  if (!ReadElements<3>(in, num_vertices, &faces)) return std::nullopt;
+  return RigidGeometry(RigidMesh(
+      make_unique<SurfaceMesh<double>>(move(faces), move(vertices)),
+      bvh_options));
+}
+
+// Reads the representation with the given key from `filename`; returns
+// nullopt if the file doesn't exist or doesn't hold a valid representation
+// with that key.
+template <typename RepresentationType>
+std::optional<RepresentationType> ReadRepresentationFile(
+    const std::string& filename, const std::string& key,
+    const BvhBuildOptions& bvh_options) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in.is_open()) return std::nullopt;
+  std::string magic;
+  std::string file_key;
+  if (!ReadString(&in, &magic) || magic != kDiskCacheMagic ||
+      !ReadString(&in, &file_key) || file_key != key) {
+    return std::nullopt;
+  }
+  if constexpr (std::is_same_v<RepresentationType, SoftGeometry>) {
+    return ReadSoftRepresentation(&in, bvh_options);
+  } else {
+    return ReadRigidRepresentation(&in, bvh_options);
+  }
+}
+
+// Writes the representation with the given key to `filename`, atomically (see
+// WriteFileAtomically()). Failures are logged, but otherwise ignored; the
+// on-disk cache is only an optimization.
+template <typename RepresentationType>
+void WriteRepresentationFile(const std::string& filename,
+                             const std::string& key,
+                             const RepresentationType& representation) {
+  const bool written =
+      WriteFileAtomically(filename, [&key, &representation](std::ostream* out) {
+        WriteString(out, kDiskCacheMagic);
+        WriteString(out, key);
+        return WriteRepresentation(out, representation);
+      });
+  if (!written) {
+    drake::log()->debug(
+        "Unable to write the hydroelastic representation cache file {}",
+        filename);
+  }
+}
+
+// Functions for the parts of the representation keys which describe the
+// shape. The keys must include every parameter which affects a
+// representation, formatted exactly; fmt formats doubles with the shortest
+// representation that round trips.
+
+std::optional<std::string> ShapeKey(const Sphere& sphere) {
+  return fmt::format("Sphere(radius={})", sphere.radius());
+}
+
+std::optional<std::string> ShapeKey(const Cylinder& cylinder) {
+  return fmt::format("Cylinder(radius={}, length={})", cylinder.radius(),
+                     cylinder.length());
+}
+
+std::optional<std::string> ShapeKey(const HalfSpace&) {
+  return std::string("HalfSpace()");
+}
+
+std::optional<std::string> ShapeKey(const Box& box) {
+  return fmt::format("Box(width={}, depth={}, height={})", box.width(),
+                     box.depth(), box.height());
+}
+
+std::optional<std::string> ShapeKey(const Capsule& capsule) {
+  return fmt::format("Capsule(radius={}, length={})", capsule.radius(),
+                     capsule.length());
+}
+
+std::optional<std::string> ShapeKey(const Ellipsoid& ellipsoid) {
+  return fmt::format("Ellipsoid(a={}, b={}, c={})", ellipsoid.a(),
+                     ellipsoid.b(), ellipsoid.c());
+}
+
+// Mesh files are addressed by their contents (as well as their names, which
+// determine how relative references are resolved). Files which can't be read
+// aren't cached, so that the usual error is reported.
+std::optional<std::string> MeshFileKey(const char* type_name,
+                                       const std::string& filename,
+                                       double scale) {
+  std::ifstream in(filename, std::ios::binary);
+  if (!in.is_open()) return std::nullopt;
+  std::stringstream contents;
+  contents << in.rdbuf();
+  if (!in.good() && !in.eof()) return std::nullopt;
+  const std::string data = contents.str();
+  return fmt::format("{}(filename={}, scale={}, size={}, hash={:016x})",
+                     type_name, filename, scale, data.size(),
+                     DefaultHash{}(data));
+}
+
+std::optional<std::string> ShapeKey(const Mesh& mesh) {
+  return MeshFileKey("Mesh", mesh.filename(), mesh.scale());
+}
+
+std::optional<std::string> ShapeKey(const Convex& convex) {
+  return MeshFileKey("Convex", convex.filename(), convex.scale());
+}
+
+// Appends ", name=value" to the key if the property is defined. Returns false
+// if the property has an unexpected type; such representations aren't cached,
+// so that the usual error is reported.
+template <typename ValueType>
+bool AppendPropertyKey(const ProximityProperties& props, const char* group,
+                       const char* name, std::string* key) {
+  if (!props.HasProperty(group, name)) return true;
+  const ValueType* value =
+      props.GetPropertyAbstract(group, name).maybe_get_value<ValueType>();
+  if (value == nullptr) return false;
+  if constexpr (std::is_enum_v<ValueType>) {
+    *key += fmt::format(", {}={}", name, static_cast<int>(*value));
+  } else {
+    *key += fmt::format(", {}={}", name, *value);
+  }
+  return true;
+}
+
+// Returns the options with which to build the hierarchy of a representation,
+// per its hydroelastic properties.
+BvhBuildOptions GetBvhBuildOptions(const ProximityProperties& props) {
+  return BvhBuildOptions{
+      props.GetPropertyOrDefault(kHydroGroup, kBvhBuildStrategy,
+                                 BvhBuildStrategy::kMedianSplit),
+      props.GetPropertyOrDefault(kHydroGroup, kBvhBuildThreads, 1)};
+}
+
+// Returns the key of the representation of the given shape, or nullopt if it
+// shouldn't be cached.
+template <typename ShapeType>
+std::optional<std::string> RepresentationKey(
+    const ShapeType& shape, HydroelasticType type,
+    const ProximityProperties& props) {
+  std::optional<std::string> shape_key = ShapeKey(shape);
+  if (!shape_key.has_value()) return std::nullopt;
+  std::string key = fmt::format(
+      "{}:{}", type == HydroelasticType::kSoft ? "soft" : "rigid", *shape_key);
+  // Every property that is consulted by the Make*Representation() functions,
+  // except for the number of threads used to build the hierarchy (which
+  // doesn't change the hierarchy).
+  if (!AppendPropertyKey<double>(props, kHydroGroup, kRezHint, &key) ||
+      !AppendPropertyKey<TessellationStrategy>(
+          props, kHydroGroup, "tessellation_strategy", &key) ||
+      !AppendPropertyKey<double>(props, kHydroGroup, kSlabThickness, &key) ||
+      !AppendPropertyKey<BvhBuildStrategy>(props, kHydroGroup,
+                                           kBvhBuildStrategy, &key) ||
+      !AppendPropertyKey<double>(props, kMaterialGroup, kElastic, &key)) {
+    return std::nullopt;
+  }
+  return key;
+}
+
+// Only the shapes that are tessellated according to a resolution hint are
+// expensive enough to be worth persisting.
+template <typename ShapeType>
+constexpr bool kPersistRepresentation =
+    std::is_same_v<ShapeType, Sphere> || std::is_same_v<ShapeType, Cylinder> ||
+    std::is_same_v<ShapeType, Capsule> || std::is_same_v<ShapeType, Ellipsoid>;
+
+}  // namespace
+
+RepresentationCache::RepresentationCache() = default;
+
+RepresentationCache::~RepresentationCache() = default;
+
+RepresentationCache& RepresentationCache::Global() {
+  static never_destroyed<RepresentationCache> global;
+  static const bool initialized = []() {
+    const char* const directory = std::getenv("DRAKE_HYDROELASTIC_CACHE_DIR");
+    if (directory != nullptr) {
+      global.access().set_disk_cache_directory(directory);
+    }
+    return true;
+  }();
+  unused(initialized);
+  return global.access();
+}
+
+std::optional<SoftGeometry> RepresentationCache::GetOrMakeSoft(
+    const std::string& key, bool persist,
+    const std::function<std::optional<SoftGeometry>()>& make,
+    const BvhBuildOptions& bvh_options) {
+  return GetOrMake<SoftGeometry>(key, persist, make, bvh_options);
+}
+
+std::optional<RigidGeometry> RepresentationCache::GetOrMakeRigid(
+    const std::string& key, bool persist,
+    const std::function<std::optional<RigidGeometry>()>& make,
+    const BvhBuildOptions& bvh_options) {
+  return GetOrMake<RigidGeometry>(key, persist, make, bvh_options);
+}
+
+int RepresentationCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int>(entries_.size());
+}
+
+int RepresentationCache::capacity() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return capacity_;
+}
+
+void RepresentationCache::set_capacity(int capacity) {
+  DRAKE_DEMAND(capacity >= 0);
+  std::lock_guard<std::mutex> lock(mutex_);
+  capacity_ = capacity;
+  while (static_cast<int>(entries_.size()) > capacity_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+}
+
+void RepresentationCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  index_.clear();
+  entries_.clear();
+}
+
+std::string RepresentationCache::disk_cache_directory() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return disk_cache_directory_;
+}
+
+void RepresentationCache::set_disk_cache_directory(std::string directory) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  disk_cache_directory_ = move(directory);
+}
+
+template <typename RepresentationType>
+std::optional<RepresentationType> RepresentationCache::GetOrMake(
+    const std::string& key, bool persist,
+    const std::function<std::optional<RepresentationType>()>& make,
+    const BvhBuildOptions& bvh_options) {
+  if (std::optional<Representation> cached = Find(key)) {
+    return std::get<RepresentationType>(move(*cached));
+  }
+
+  // The representation is computed without holding the lock; if two threads
+  // compute the same representation concurrently, the first one to be
+  // inserted is shared.
+  const std::string filename = persist ? DiskCacheFilename(key) : "";
+  std::optional<RepresentationType> result;
+  if (!filename.empty()) {
+    result =
+        ReadRepresentationFile<RepresentationType>(filename, key, bvh_options);
+  }
+  if (!result.has_value()) {
+    result = make();
+    if (!result.has_value()) return std::nullopt;
+    if (!filename.empty()) WriteRepresentationFile(filename, key, *result);
+  }
+  return std::get<RepresentationType>(Insert(key, move(*result)));
+}
+
+std::optional<RepresentationCache::Representation> RepresentationCache::Find(
+    const std::string& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = index_.find(key);
+  if (iter == index_.end()) return std::nullopt;
+  entries_.splice(entries_.begin(), entries_, iter->second);
+  return iter->second->second;
+}
+
+RepresentationCache::Representation RepresentationCache::Insert(
+    const std::string& key, Representation representation) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = index_.find(key);
+  if (iter != index_.end()) {
+    entries_.splice(entries_.begin(), entries_, iter->second);
+    return iter->second->second;
+  }
+  if (capacity_ == 0) return representation;
+  if (static_cast<int>(entries_.size()) == capacity_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+  entries_.emplace_front(key, representation);
+  index_[key] = entries_.begin();
+  return representation;
+}
+
+std::string RepresentationCache::DiskCacheFilename(
+    const std::string& key) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (disk_cache_directory_.empty()) return "";
+  return fmt::format("{}/{:016x}.hydroelastic", disk_cache_directory_,
+                     DefaultHash{}(key));
 }
 
 HydroelasticType Geometries::hydroelastic_type(GeometryId id) const {
@@ -96,13 +531,31 @@ void Geometries::ImplementGeometry(const Convex& convex, void* user_data) {
 
 template <typename ShapeType>
 void Geometries::MakeShape(const ShapeType& shape, const ReifyData& data) {
+  const std::optional<std::string> key =
+      RepresentationKey(shape, data.type, data.properties);
+  const BvhBuildOptions bvh_options = GetBvhBuildOptions(data.properties);
+  RepresentationCache& cache = RepresentationCache::Global();
   switch (data.type) {
     case HydroelasticType::kRigid: {
-      auto hydro_geometry = MakeRigidRepresentation(shape, data.properties);
+      auto make = [&shape, &data]() {
+        return MakeRigidRepresentation(shape, data.properties);
+      };
+      auto hydro_geometry =
+          key.has_value()
+              ? cache.GetOrMakeRigid(*key, kPersistRepresentation<ShapeType>,
+                                     make, bvh_options)
+              : make();
       if (hydro_geometry) AddGeometry(data.id, move(*hydro_geometry));
     } break;
     case HydroelasticType::kSoft: {
-      auto hydro_geometry = MakeSoftRepresentation(shape, data.properties);
+      auto make = [&shape, &data]() {
+        return MakeSoftRepresentation(shape, data.properties);
+      };
+      auto hydro_geometry =
+          key.has_value()
+              ? cache.GetOrMakeSoft(*key, kPersistRepresentation<ShapeType>,
+                                    make, bvh_options)
+              : make();
       if (hydro_geometry) AddGeometry(data.id, move(*hydro_geometry));
     } break;
     case HydroelasticType::kUndefined:
@@ -198,11 +651,11 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
   auto mesh = make_unique<SurfaceMesh<double>>(
       MakeSphereSurfaceMesh<double>(sphere, edge_length));
 
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(RigidMesh(move(mesh), GetBvhBuildOptions(props)));
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
-    const Box& box, const ProximityProperties&) {
+    const Box& box, const ProximityProperties& props) {
   PositiveDouble validator("Box", "rigid");
   // Use the coarsest mesh for the box. The safety factor 1.1 guarantees the
   // resolution-hint argument is larger than the box size, so the mesh
@@ -210,7 +663,7 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
   auto mesh = make_unique<SurfaceMesh<double>>(
       MakeBoxSurfaceMesh<double>(box, 1.1 * box.size().maxCoeff()));
 
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(RigidMesh(move(mesh), GetBvhBuildOptions(props)));
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
@@ -220,7 +673,7 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
   auto mesh = make_unique<SurfaceMesh<double>>(
       MakeCylinderSurfaceMesh<double>(cylinder, edge_length));
 
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(RigidMesh(move(mesh), GetBvhBuildOptions(props)));
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
@@ -230,7 +683,7 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
   auto mesh = make_unique<SurfaceMesh<double>>(
       MakeCapsuleSurfaceMesh<double>(capsule, edge_length));
 
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(RigidMesh(move(mesh), GetBvhBuildOptions(props)));
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
@@ -240,25 +693,25 @@ std::optional<RigidGeometry> MakeRigidRepresentation(
   auto mesh = make_unique<SurfaceMesh<double>>(
       MakeEllipsoidSurfaceMesh<double>(ellipsoid, edge_length));
 
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(RigidMesh(move(mesh), GetBvhBuildOptions(props)));
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
-    const Mesh& mesh_spec, const ProximityProperties&) {
-  // Mesh does not use any properties.
+    const Mesh& mesh_spec, const ProximityProperties& props) {
+  // Mesh only uses the properties of its hierarchy.
   auto mesh = make_unique<SurfaceMesh<double>>(
       ReadObjToSurfaceMesh(mesh_spec.filename(), mesh_spec.scale()));
 
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(RigidMesh(move(mesh), GetBvhBuildOptions(props)));
 }
 
 std::optional<RigidGeometry> MakeRigidRepresentation(
-    const Convex& convex_spec, const ProximityProperties&) {
-  // Convex does not use any properties.
+    const Convex& convex_spec, const ProximityProperties& props) {
+  // Convex only uses the properties of its hierarchy.
   auto mesh = make_unique<SurfaceMesh<double>>(
       ReadObjToSurfaceMesh(convex_spec.filename(), convex_spec.scale()));
 
-  return RigidGeometry(RigidMesh(move(mesh)));
+  return RigidGeometry(RigidMesh(move(mesh), GetBvhBuildOptions(props)));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -279,7 +732,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeSpherePressureField(sphere, mesh.get(), elastic_modulus));
 
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return SoftGeometry(
+      SoftMesh(move(mesh), move(pressure), GetBvhBuildOptions(props)));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -295,7 +749,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeBoxPressureField(box, mesh.get(), elastic_modulus));
 
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return SoftGeometry(
+      SoftMesh(move(mesh), move(pressure), GetBvhBuildOptions(props)));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -312,7 +767,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeCylinderPressureField(cylinder, mesh.get(), elastic_modulus));
 
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return SoftGeometry(
+      SoftMesh(move(mesh), move(pressure), GetBvhBuildOptions(props)));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -329,7 +785,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeCapsulePressureField(capsule, mesh.get(), elastic_modulus));
 
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return SoftGeometry(
+      SoftMesh(move(mesh), move(pressure), GetBvhBuildOptions(props)));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -350,7 +807,8 @@ std::optional<SoftGeometry> MakeSoftRepresentation(
   auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
       MakeEllipsoidPressureField(ellipsoid, mesh.get(), elastic_modulus));
 
-  return SoftGeometry(SoftMesh(move(mesh), move(pressure)));
+  return SoftGeometry(
+      SoftMesh(move(mesh), move(pressure), GetBvhBuildOptions(props)));
 }
 
 std::optional<SoftGeometry> MakeSoftRepresentation(
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <functional>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <variant>
 
-#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_assert.h"
 #include "drake/common/text_logging.h"
 #include "drake/geometry/geometry_ids.h"
@@ -27,23 +30,25 @@ namespace hydroelastic {
 /* Defines a soft mesh -- a mesh, its linearized pressure field, p̃(e), and its
  bounding volume hierarchy. While this class retains ownership of the mesh,
  we assume that both the pressure field and the bounding volume hierarchy
- are derived from the mesh. */
+ are derived from the mesh.
+
+ The mesh, field, and hierarchy are immutable once constructed, so copies of a
+ %SoftMesh share them (rather than duplicating them). */
 class SoftMesh {
  public:
   SoftMesh() = default;
 
   SoftMesh(std::unique_ptr<VolumeMesh<double>> mesh,
-           std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure)
+           std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure,
+           const BvhBuildOptions& bvh_options = {})
       : mesh_(std::move(mesh)),
         pressure_(std::move(pressure)),
-        bvh_(std::make_unique<Bvh<Obb, VolumeMesh<double>>>(*mesh_)) {
+        bvh_(std::make_shared<const Bvh<Obb, VolumeMesh<double>>>(
+            *mesh_, bvh_options)) {
     DRAKE_ASSERT(mesh_.get() == &pressure_->mesh());
   }
 
-  SoftMesh(const SoftMesh& s) { *this = s; }
-  SoftMesh& operator=(const SoftMesh& s);
-  SoftMesh(SoftMesh&&) = default;
-  SoftMesh& operator=(SoftMesh&&) = default;
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SoftMesh)
 
   const VolumeMesh<double>& mesh() const {
     DRAKE_DEMAND(mesh_ != nullptr);
@@ -59,9 +64,11 @@ class SoftMesh {
   }
 
  private:
-  std::unique_ptr<VolumeMesh<double>> mesh_;
-  std::unique_ptr<VolumeMeshFieldLinear<double, double>> pressure_;
-  std::unique_ptr<Bvh<Obb, VolumeMesh<double>>> bvh_;
+  // The pressure field refers to mesh_, so the three are always copied (and
+  // therefore shared) together.
+  std::shared_ptr<const VolumeMesh<double>> mesh_;
+  std::shared_ptr<const VolumeMeshFieldLinear<double, double>> pressure_;
+  std::shared_ptr<const Bvh<Obb, VolumeMesh<double>>> bvh_;
 };
 
 /* Defines a soft half space. The half space is defined such that the half
@@ -177,15 +184,17 @@ class SoftGeometry {
 
 /* Defines a rigid mesh -- a surface mesh and its bounding volume hierarchy.
  This class retains ownership of the mesh, with the bounding volume hierarchy
- just referencing it.  */
+ just referencing it. Like SoftMesh, copies share the (immutable) mesh and
+ hierarchy.  */
 class RigidMesh {
  public:
   RigidMesh() = default;
 
-  explicit RigidMesh(std::unique_ptr<SurfaceMesh<double>> mesh)
+  explicit RigidMesh(std::unique_ptr<SurfaceMesh<double>> mesh,
+                     const BvhBuildOptions& bvh_options = {})
       : mesh_(std::move(mesh)),
-        bvh_(std::make_unique<Bvh<Obb, SurfaceMesh<double>>>(
-            *mesh_)) {}
+        bvh_(std::make_shared<const Bvh<Obb, SurfaceMesh<double>>>(
+            *mesh_, bvh_options)) {}
 
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RigidMesh)
 
@@ -199,8 +208,8 @@ class RigidMesh {
   }
 
  private:
-  copyable_unique_ptr<SurfaceMesh<double>> mesh_;
-  copyable_unique_ptr<Bvh<Obb, SurfaceMesh<double>>> bvh_;
+  std::shared_ptr<const SurfaceMesh<double>> mesh_;
+  std::shared_ptr<const Bvh<Obb, SurfaceMesh<double>>> bvh_;
 };
 
 /* The base representation of rigid geometries. Generally, a rigid geometry
@@ -248,6 +257,122 @@ class RigidGeometry {
   std::optional<RigidMesh> geometry_{std::nullopt};
 };
 
+/* A process-wide cache of hydroelastic representations, keyed by their
+ content: the compliance type, the shape's type and parameters, and the values
+ of the properties that determine the representation. Because the
+ representations are immutable and their copies share data (see SoftMesh and
+ RigidMesh), every Geometries instance that requests an identical
+ representation -- e.g., the clones of a ProximityEngine, or the many diagrams
+ built during a Monte Carlo study -- shares a single copy of its meshes,
+ pressure field, and bounding volume hierarchy, and the (often expensive)
+ tessellation is done once per process.
+
+ The cache holds at most capacity() representations. When it is full, the
+ least recently used representation is dropped from the cache; it remains valid
+ for every Geometries instance that already uses it.
+
+ The representations that are tessellated according to a resolution hint
+ (spheres, cylinders, capsules, and ellipsoids) can additionally be stored on
+ disk, so that later processes skip the tessellation as well. The on-disk cache
+ is disabled by default; it is enabled by setting the environment variable
+ `DRAKE_HYDROELASTIC_CACHE_DIR` to an existing directory (or by calling
+ set_disk_cache_directory()). Each file is named by a hash of its key and
+ stores the full key, which is validated when the file is read. The files are
+ written in the native binary format of the machine; files which are
+ unreadable, truncated, or don't match their key are ignored and overwritten.
+
+ All methods are thread safe.  */
+class RepresentationCache {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(RepresentationCache)
+
+  /* The default maximum number of cached representations.  */
+  static constexpr int kDefaultCapacity = 128;
+
+  /* Constructs an empty cache with the default capacity and no on-disk
+   cache.  */
+  RepresentationCache();
+
+  ~RepresentationCache();
+
+  /* Returns the process-wide cache used by Geometries. Its on-disk cache
+   directory is initialized from the `DRAKE_HYDROELASTIC_CACHE_DIR` environment
+   variable.  */
+  static RepresentationCache& Global();
+
+  /* Returns the soft representation with the given `key`. If it is not
+   cached (in memory, or on disk when `persist` is true and the on-disk cache
+   is enabled), it is computed by `make` and, if `make` returns a
+   representation, cached. Exceptions thrown by `make` are propagated (and
+   nothing is cached). The bounding volume hierarchy of a representation read
+   from the on-disk cache is built with `bvh_options`.  */
+  std::optional<SoftGeometry> GetOrMakeSoft(
+      const std::string& key, bool persist,
+      const std::function<std::optional<SoftGeometry>()>& make,
+      const BvhBuildOptions& bvh_options = {});
+
+  /* The rigid analog to GetOrMakeSoft().  */
+  std::optional<RigidGeometry> GetOrMakeRigid(
+      const std::string& key, bool persist,
+      const std::function<std::optional<RigidGeometry>()>& make,
+      const BvhBuildOptions& bvh_options = {});
+
+  /* Returns the number of cached representations (in memory).  */
+  int size() const;
+
+  int capacity() const;
+
+  /* Sets the maximum number of cached representations, dropping the least
+   recently used representations as necessary. A capacity of zero disables the
+   in-memory cache.
+   @pre capacity >= 0.  */
+  void set_capacity(int capacity);
+
+  /* Drops all representations from the in-memory cache. The on-disk cache is
+   unaffected.  */
+  void Clear();
+
+  /* Returns the on-disk cache directory; the empty string means the on-disk
+   cache is disabled.  */
+  std::string disk_cache_directory() const;
+
+  /* Sets the on-disk cache directory; the empty string disables the on-disk
+   cache.  */
+  void set_disk_cache_directory(std::string directory);
+
+ private:
+  using Representation = std::variant<SoftGeometry, RigidGeometry>;
+  using Entry = std::pair<std::string, Representation>;
+
+  template <typename RepresentationType>
+  std::optional<RepresentationType> GetOrMake(
+      const std::string& key, bool persist,
+      const std::function<std::optional<RepresentationType>()>& make,
+      const BvhBuildOptions& bvh_options);
+
+  // Returns the cached representation with the given key (marking it as the
+  // most recently used), or nullopt.
+  std::optional<Representation> Find(const std::string& key);
+
+  // Adds the representation to the in-memory cache, dropping the least
+  // recently used representation if necessary, and returns the cached
+  // representation. If another thread has already cached a representation with
+  // the same key, that representation is returned instead.
+  Representation Insert(const std::string& key, Representation representation);
+
+  // Returns the name of the file that persists the representation with the
+  // given key, or the empty string if the on-disk cache is disabled.
+  std::string DiskCacheFilename(const std::string& key) const;
+
+  mutable std::mutex mutex_;
+  int capacity_{kDefaultCapacity};
+  std::string disk_cache_directory_;
+  // The cached representations, in order from most to least recently used,
+  // along with an index into the list by key.
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+
 /* This class stores all instantiated hydroelastic representations of declared
  geometry. They are keyed by the geometry's global GeometryId.
 
@@ -262,7 +387,11 @@ class RigidGeometry {
      RemoveGeometry().
 
  If two geometries are in contact, in order to produce the corresponding
- ContactSurface, both ids must have a valid representation in this set.  */
+ ContactSurface, both ids must have a valid representation in this set.
+
+ The representations are obtained through RepresentationCache::Global(), so
+ identical declarations share their representations (and copies of this class
+ are cheap).  */
 class Geometries final : public ShapeReifier {
  public:
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(Geometries);
@@ -305,6 +434,11 @@ class Geometries final : public ShapeReifier {
    not supported in the current infrastructure. However, if it *is* supported,
    but the properties are malformed, an exception will be thrown.
 
+   The bounding volume hierarchy of a mesh representation is built with the
+   BvhBuildStrategy in the optional ('hydroelastic', kBvhBuildStrategy)
+   property (default kMedianSplit) using up to the number of threads in the
+   optional ('hydroelastic', kBvhBuildThreads) property (default one).
+
    @param shape         The shape to possibly represent.
    @param id            The unique identifier for the geometry.
    @param properties    The proximity properties which will determine if a
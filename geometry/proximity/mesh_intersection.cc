@@ -43,6 +43,106 @@ namespace internal {
 //  outside another tetrahedron. Right now it will be considered inside both
 //  tetrahedrons.
 
+namespace {
+
+// The four triangular faces of a tetrahedron, such that each right-handed face
+// normal points outward from the tetrahedron (assuming the fourth vertex sees
+// the first three vertices in CCW order). See ClipTriangleByTetrahedron().
+constexpr int kTetFaces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
+
+// Creates the half space bounded by the given face of the tetrahedron whose
+// vertices are p_MVs. Both TriTetBatch and ClipTriangleByTetrahedron() use
+// this, so that they classify vertices against identical planes.
+PosedHalfSpace<double> MakeTetFaceHalfSpace(const Vector3<double> p_MVs[4],
+                                            int face) {
+  const Vector3<double>& p_MA = p_MVs[kTetFaces[face][0]];
+  const Vector3<double>& p_MB = p_MVs[kTetFaces[face][1]];
+  const Vector3<double>& p_MC = p_MVs[kTetFaces[face][2]];
+  // We'll allow the PosedHalfSpace to normalize our vector.
+  const Vector3<double> normal_M = (p_MB - p_MA).cross(p_MC - p_MA);
+  return PosedHalfSpace<double>(normal_M, p_MA);
+}
+
+}  // namespace
+
+void TriTetBatch::Add(VolumeElementIndex tet,
+                      const VolumeMesh<double>& volume_M,
+                      SurfaceFaceIndex tri,
+                      const SurfaceMesh<double>& surface_N,
+                      const math::RigidTransform<double>& X_MN) {
+  DRAKE_ASSERT(!full());
+  const int i = size_++;
+  tets_[i] = tet;
+  tris_[i] = tri;
+  for (int v = 0; v < 3; ++v) {
+    const Vector3<double> p_MV =
+        X_MN * surface_N.vertex(surface_N.element(tri).vertex(v)).r_MV();
+    vertex_x_[v][i] = p_MV.x();
+    vertex_y_[v][i] = p_MV.y();
+    vertex_z_[v][i] = p_MV.z();
+  }
+  Vector3<double> p_MVs[4];
+  for (int v = 0; v < 4; ++v) {
+    p_MVs[v] = volume_M.vertex(volume_M.element(tet).vertex(v)).r_MV();
+  }
+  for (int f = 0; f < 4; ++f) {
+    const PosedHalfSpace<double> half_space_M = MakeTetFaceHalfSpace(p_MVs, f);
+    const Vector3<double>& nhat_M = half_space_M.normal();
+    normal_x_[f][i] = nhat_M.x();
+    normal_y_[f][i] = nhat_M.y();
+    normal_z_[f][i] = nhat_M.z();
+    // The signed distance is nhat⋅p - displacement, so this is exact.
+    displacement_[f][i] =
+        -half_space_M.CalcSignedDistance(Vector3<double>(0, 0, 0));
+  }
+}
+
+void TriTetBatch::Classify() {
+  // The signed distances below and those computed by PosedHalfSpace are
+  // evaluated in (possibly) different orders. Each is within γ₄⋅S of the exact
+  // value, where S is the sum of the magnitudes of the terms and γ₄ ≈ 2ε, so
+  // they differ by less than 4ε⋅S. We use a four-fold safety factor. A vertex
+  // is only considered outside (inside) a plane if its distance is beyond
+  // that bound; then PosedHalfSpace agrees.
+  constexpr double kErrorFactor = 16 * std::numeric_limits<double>::epsilon();
+  // The loops over the lanes of the batch have no dependencies between lanes;
+  // they are written over the full capacity so that they vectorize (unused
+  // lanes hold stale, but valid, values).
+  bool disjoint[kCapacity];
+  bool contained[kCapacity];
+  for (int i = 0; i < kCapacity; ++i) {
+    disjoint[i] = false;
+    contained[i] = true;
+  }
+  for (int f = 0; f < 4; ++f) {
+    bool all_outside[kCapacity];
+    for (int i = 0; i < kCapacity; ++i) all_outside[i] = true;
+    for (int v = 0; v < 3; ++v) {
+      for (int i = 0; i < kCapacity; ++i) {
+        const double x = normal_x_[f][i] * vertex_x_[v][i];
+        const double y = normal_y_[f][i] * vertex_y_[v][i];
+        const double z = normal_z_[f][i] * vertex_z_[v][i];
+        const double d = displacement_[f][i];
+        const double distance = x + y + z - d;
+        const double bound = kErrorFactor * (std::abs(x) + std::abs(y) +
+                                             std::abs(z) + std::abs(d));
+        all_outside[i] = all_outside[i] && distance > bound;
+        contained[i] = contained[i] && distance < -bound;
+      }
+    }
+    // If all of the triangle's vertices are outside a single face plane, so is
+    // the whole triangle.
+    for (int i = 0; i < kCapacity; ++i) {
+      disjoint[i] = disjoint[i] || all_outside[i];
+    }
+  }
+  for (int i = 0; i < size_; ++i) {
+    overlaps_[i] = disjoint[i]    ? TriTetOverlap::kDisjoint
+                   : contained[i] ? TriTetOverlap::kContained
+                                  : TriTetOverlap::kUnknown;
+  }
+}
+
 // TODO(DamrongGuoy): Handle the case that the line is parallel to the plane.
 template <typename T>
 Vector3<T> SurfaceVolumeIntersector<T>::CalcIntersection(
@@ -195,13 +295,14 @@ const std::vector<Vector3<T>>&
 SurfaceVolumeIntersector<T>::ClipTriangleByTetrahedron(
     VolumeElementIndex element, const VolumeMesh<double>& volume_M,
     SurfaceFaceIndex face, const SurfaceMesh<double>& surface_N,
-    const math::RigidTransform<T>& X_MN) {
+    const math::RigidTransform<T>& X_MN, TriTetOverlap overlap) {
   // Although polygon_M starts out pointing to polygon_[0] that is not an
   // invariant in this function.
   std::vector<Vector3<T>>* polygon_M = &(polygon_[0]);
   // Initialize output polygon in M's frame from the triangular `face` of
   // surface_N.
   polygon_M->clear();
+  if (overlap == TriTetOverlap::kDisjoint) return *polygon_M;
   for (int i = 0; i < 3; ++i) {
     SurfaceVertexIndex v = surface_N.element(face).vertex(i);
     // TODO(SeanCurtis-TRI): The `M` in `r_MV()` is different from the M in this
@@ -209,56 +310,56 @@ SurfaceVolumeIntersector<T>::ClipTriangleByTetrahedron(
     const Vector3<T>& p_NV = surface_N.vertex(v).r_MV().cast<T>();
     polygon_M->push_back(X_MN * p_NV);
   }
-  // Get the positions, in M's frame, of the four vertices of the tetrahedral
-  // `element` of volume_M. Because we are doing this in the M frame, we can
-  // leave the volume mesh's quantities as double-valued -- T-values will arise
-  // as we do transformed computations below.
-  Vector3<double> p_MVs[4];
-  for (int i = 0; i < 4; ++i) {
-    VolumeVertexIndex v = volume_M.element(element).vertex(i);
-    p_MVs[i] = volume_M.vertex(v).r_MV();
-  }
-  // Sets up the four half spaces associated with the four triangular faces of
-  // the tetrahedron. Assume the tetrahedron has the fourth vertex seeing the
-  // first three vertices in CCW order; for example, a tetrahedron of (Zero(),
-  // UnitX(), UnitY(), UnitZ()) (see the picture below) has this orientation.
-  //
-  //      +Z
-  //       |
-  //       v3
-  //       |
-  //       |
-  //     v0+------v2---+Y
-  //      /
-  //     /
-  //   v1
-  //   /
-  // +X
-  //
-  // This table encodes the four triangular faces of the tetrahedron in such
-  // a way that each right-handed face normal points outward from the
-  // tetrahedron, which is suitable for setting up the half space. Refer to
-  // the above picture.
-  const int faces[4][3] = {{1, 2, 3}, {0, 3, 2}, {0, 1, 3}, {0, 2, 1}};
-  // Although this assertion appears trivially true, its presence is protection
-  // for the subsequent code, which heavily relies on it being true, from any
-  // changes that may be applied to the previous code.
-  DRAKE_ASSERT(polygon_M == &(polygon_[0]));
-  std::vector<Vector3<T>>* in_M = polygon_M;
-  std::vector<Vector3<T>>* out_M = &(polygon_[1]);
-  for (auto& face_vertex : faces) {
-    const Vector3<double>& p_MA = p_MVs[face_vertex[0]];
-    const Vector3<double>& p_MB = p_MVs[face_vertex[1]];
-    const Vector3<double>& p_MC = p_MVs[face_vertex[2]];
-    // We'll allow the PosedHalfSpace to normalize our vector.
-    const Vector3<double> normal_M = (p_MB - p_MA).cross(p_MC - p_MA);
-    PosedHalfSpace<double> half_space_M(normal_M, p_MA);
-    // Intersects the output polygon by the half space of each face of the
-    // tetrahedron.
-    ClipPolygonByHalfSpace(*in_M, half_space_M, out_M);
-    std::swap(in_M, out_M);
+  // A contained triangle would be unchanged by every clipping pass below.
+  if (overlap != TriTetOverlap::kContained) {
+    // Get the positions, in M's frame, of the four vertices of the tetrahedral
+    // `element` of volume_M. Because we are doing this in the M frame, we can
+    // leave the volume mesh's quantities as double-valued -- T-values will
+    // arise as we do transformed computations below.
+    Vector3<double> p_MVs[4];
+    for (int i = 0; i < 4; ++i) {
+      VolumeVertexIndex v = volume_M.element(element).vertex(i);
+      p_MVs[i] = volume_M.vertex(v).r_MV();
+    }
+    // Sets up the four half spaces associated with the four triangular faces
+    // of the tetrahedron. Assume the tetrahedron has the fourth vertex seeing
+    // the first three vertices in CCW order; for example, a tetrahedron of
+    // (Zero(), UnitX(), UnitY(), UnitZ()) (see the picture below) has this
+    // orientation.
+    //
+    //      +Z
+    //       |
+    //       v3
+    //       |
+    //       |
+    //     v0+------v2---+Y
+    //      /
+    //     /
+    //   v1
+    //   /
+    // +X
+    //
+    // The table kTetFaces encodes the four triangular faces of the
+    // tetrahedron in such a way that each right-handed face normal points
+    // outward from the tetrahedron, which is suitable for setting up the half
+    // space. Refer to the above picture.
+    //
+    // Although this assertion appears trivially true, its presence is
+    // protection for the subsequent code, which heavily relies on it being
+    // true, from any changes that may be applied to the previous code.
+    DRAKE_ASSERT(polygon_M == &(polygon_[0]));
+    std::vector<Vector3<T>>* in_M = polygon_M;
+    std::vector<Vector3<T>>* out_M = &(polygon_[1]);
+    for (int f = 0; f < 4; ++f) {
+      const PosedHalfSpace<double> half_space_M =
+          MakeTetFaceHalfSpace(p_MVs, f);
+      // Intersects the output polygon by the half space of each face of the
+      // tetrahedron.
+      ClipPolygonByHalfSpace(*in_M, half_space_M, out_M);
+      std::swap(in_M, out_M);
+    }
+    polygon_M = in_M;
   }
-  polygon_M = in_M;
 
   // TODO(DamrongGuoy): Remove the code below when ClipPolygonByHalfSpace()
   //  stops generating duplicate vertices. See the note in
@@ -301,32 +402,48 @@ void SurfaceVolumeIntersector<T>::SampleVolumeFieldOnSurface(
     ContactPolygonRepresentation representation,
     std::unique_ptr<SurfaceMesh<T>>* surface_MN_M,
     std::unique_ptr<SurfaceMeshFieldLinear<T, T>>* e_MN,
-    std::vector<Vector3<T>>* grad_eM_Ms) {
+    std::vector<Vector3<T>>* grad_eM_Ms,
+    MeshIntersectionCoherence* coherence) {
   DRAKE_DEMAND(surface_MN_M != nullptr);
   DRAKE_DEMAND(e_MN != nullptr);
   DRAKE_DEMAND(grad_eM_Ms != nullptr);
   grad_eM_Ms->clear();
 
-  std::vector<SurfaceFace> surface_faces;
-  std::vector<SurfaceVertex<T>> surface_vertices_M;
-  std::vector<T> surface_e;
+  // The surface is accumulated in the workspace's buffers, which retain their
+  // memory from one computation to the next.
+  workspace_->ClearSurface();
+  std::vector<SurfaceFace>& surface_faces = workspace_->faces;
+  std::vector<SurfaceVertex<T>>& surface_vertices_M = workspace_->vertices;
+  std::vector<T>& surface_e = workspace_->e;
+  std::vector<Vector3<T>>& grad_eM_M = workspace_->grad_e;
+  if (coherence != nullptr) {
+    // The contact surface changes little from one query to the next; size the
+    // buffers for the previous one (with some slack) so they don't have to
+    // grow.
+    const int num_faces = coherence->num_faces + coherence->num_faces / 8;
+    const int num_vertices =
+        coherence->num_vertices + coherence->num_vertices / 8;
+    surface_faces.reserve(num_faces);
+    grad_eM_M.reserve(num_faces);
+    surface_vertices_M.reserve(num_vertices);
+    surface_e.reserve(num_vertices);
+  }
   const VolumeMesh<double>& mesh_M = volume_field_M.mesh();
   // We know that each contact polygon has at most 7 vertices because
   // each surface triangle is clipped by four half-spaces of the four
   // triangular faces of a tetrahedron.
-  std::vector<SurfaceVertexIndex> contact_polygon;
+  std::vector<SurfaceVertexIndex>& contact_polygon =
+      workspace_->polygon_indices;
   contact_polygon.reserve(7);
 
   const math::RigidTransform<double> X_MN_d = convert_to_double(X_MN);
-  auto callback = [&volume_field_M, &surface_N, &surface_faces,
-                   &surface_vertices_M, &surface_e, &mesh_M, &X_MN_d, &X_MN,
-                   &contact_polygon, grad_eM_Ms, representation,
-                   this](VolumeElementIndex tet_index,
-                         SurfaceFaceIndex tri_index) -> BvttCallbackResult {
-    if (!this->IsFaceNormalAlongPressureGradient(
-            volume_field_M, surface_N, X_MN_d, tet_index, tri_index)) {
-      return BvttCallbackResult::Continue;
-    }
+  // Adds the intersection of the given tetrahedron and triangle (if any) to
+  // the surface.
+  auto add_polygon = [&volume_field_M, &surface_N, &surface_faces,
+                      &surface_vertices_M, &surface_e, &mesh_M, &X_MN,
+                      &contact_polygon, &grad_eM_M, representation,
+                      this](VolumeElementIndex tet_index,
+                            SurfaceFaceIndex tri_index, TriTetOverlap overlap) {
 
     // TODO(SeanCurtis-TRI): This redundantly transforms surface mesh vertex
     //  positions. Specifically, each vertex will be transformed M times (once
@@ -340,10 +457,10 @@ void SurfaceVolumeIntersector<T>::SampleVolumeFieldOnSurface(
     //  best balance for best average performance.
     const std::vector<Vector3<T>>& polygon_vertices_M =
         this->ClipTriangleByTetrahedron(tet_index, mesh_M, tri_index, surface_N,
-                                        X_MN);
+                                        X_MN, overlap);
 
     const int poly_vertex_count = static_cast<int>(polygon_vertices_M.size());
-    if (poly_vertex_count < 3) return BvttCallbackResult::Continue;
+    if (poly_vertex_count < 3) return;
 
     const int num_previous_vertices = surface_vertices_M.size();
     if (representation == ContactPolygonRepresentation::kCentroidSubdivision) {
@@ -374,7 +491,7 @@ void SurfaceVolumeIntersector<T>::SampleVolumeFieldOnSurface(
     const Vector3<double>& grad_eMi_M =
         volume_field_M.EvaluateGradient(tet_index);
     for (size_t i = old_count; i < surface_faces.size(); ++i) {
-      grad_eM_Ms->push_back(grad_eMi_M.cast<T>());
+      grad_eM_M.push_back(grad_eMi_M.cast<T>());
     }
 
     const int num_current_vertices = surface_vertices_M.size();
@@ -384,18 +501,74 @@ void SurfaceVolumeIntersector<T>::SampleVolumeFieldOnSurface(
       const T pressure = volume_field_M.EvaluateCartesian(tet_index, r_MV);
       surface_e.push_back(pressure);
     }
+  };
+
+  // The candidate pairs are classified in batches (in the order in which the
+  // traversal reports them, so the surface is the same as if each pair were
+  // clipped as it is reported); most are resolved without clipping.
+  TriTetBatch batch;
+  auto process_batch = [&batch, &add_polygon]() {
+    batch.Classify();
+    for (int i = 0; i < batch.size(); ++i) {
+      if (batch.overlap(i) != TriTetOverlap::kDisjoint) {
+        add_polygon(batch.tet(i), batch.tri(i), batch.overlap(i));
+      }
+    }
+    batch.Clear();
+  };
+  auto callback = [&volume_field_M, &surface_N, &mesh_M, &X_MN_d, &batch,
+                   &process_batch,
+                   this](VolumeElementIndex tet_index,
+                         SurfaceFaceIndex tri_index) -> BvttCallbackResult {
+    if (!this->IsFaceNormalAlongPressureGradient(
+            volume_field_M, surface_N, X_MN_d, tet_index, tri_index)) {
+      return BvttCallbackResult::Continue;
+    }
+    batch.Add(tet_index, mesh_M, tri_index, surface_N, X_MN_d);
+    if (batch.full()) process_batch();
     return BvttCallbackResult::Continue;
   };
-  bvh_M.Collide(bvh_N, X_MN_d, callback);
+  if (coherence == nullptr) {
+    bvh_M.Collide(bvh_N, X_MN_d, callback);
+    process_batch();
+  } else {
+    BvttFront& front = coherence->front;
+    const bool from_roots =
+        front.empty() ||
+        static_cast<int>(front.size()) >
+            MeshIntersectionCoherence::kMaxFrontGrowth *
+                coherence->root_front_size;
+    if (from_roots) front.clear();
+    bvh_M.CollideFromFront(bvh_N, X_MN_d, callback, &front);
+    process_batch();
+    if (from_roots) coherence->root_front_size = static_cast<int>(front.size());
+    coherence->num_faces = static_cast<int>(surface_faces.size());
+    coherence->num_vertices = static_cast<int>(surface_vertices_M.size());
+  }
 
   DRAKE_DEMAND(surface_vertices_M.size() == surface_e.size());
   if (surface_faces.empty()) return;
 
-  *surface_MN_M = std::make_unique<SurfaceMesh<T>>(
-      std::move(surface_faces), std::move(surface_vertices_M));
   const bool calculate_gradient = false;
+  if (workspace_ == &owned_workspace_) {
+    // Nobody else reuses our own buffers; hand them over to the outputs.
+    *grad_eM_Ms = std::move(grad_eM_M);
+    *surface_MN_M = std::make_unique<SurfaceMesh<T>>(
+        std::move(surface_faces), std::move(surface_vertices_M));
+    *e_MN = std::make_unique<SurfaceMeshFieldLinear<T, T>>(
+        "e", std::move(surface_e), surface_MN_M->get(), calculate_gradient);
+    return;
+  }
+  // The given workspace keeps its buffers for the next computation; the
+  // outputs get exactly-sized copies.
+  grad_eM_Ms->assign(grad_eM_M.begin(), grad_eM_M.end());
+  *surface_MN_M = std::make_unique<SurfaceMesh<T>>(
+      std::vector<SurfaceFace>(surface_faces.begin(), surface_faces.end()),
+      std::vector<SurfaceVertex<T>>(surface_vertices_M.begin(),
+                                    surface_vertices_M.end()));
   *e_MN = std::make_unique<SurfaceMeshFieldLinear<T, T>>(
-      "e", std::move(surface_e), surface_MN_M->get(), calculate_gradient);
+      "e", std::vector<T>(surface_e.begin(), surface_e.end()),
+      surface_MN_M->get(), calculate_gradient);
 }
 
 template <typename T>
@@ -407,7 +580,9 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const SurfaceMesh<double>& mesh_R,
     const Bvh<Obb, SurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    ContactPolygonRepresentation representation) {
+    ContactPolygonRepresentation representation,
+    MeshIntersectionCoherence* coherence,
+    ContactSurfaceWorkspace<T>* workspace) {
   // TODO(SeanCurtis-TRI): This function is insufficiently templated. Generally,
   //  there are three types of scalars: the pose scalar, the mesh field *value*
   //  scalar, and the mesh vertex-position scalar. However, short term, it is
@@ -427,11 +602,13 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
   // frame.
   std::unique_ptr<SurfaceMesh<T>> surface_SR;
   std::unique_ptr<SurfaceMeshFieldLinear<T, T>> e_SR;
-  std::vector<Vector3<T>> grad_eS_S;
+  // The gradients are sampled in frame S and then re-expressed in place.
+  auto grad_eS_W = std::make_unique<std::vector<Vector3<T>>>();
+  std::vector<Vector3<T>>& grad_eS_S = *grad_eS_W;
 
-  SurfaceVolumeIntersector<T>().SampleVolumeFieldOnSurface(
+  SurfaceVolumeIntersector<T>(workspace).SampleVolumeFieldOnSurface(
       field_S, bvh_S, mesh_R, bvh_R, X_SR, representation,
-      &surface_SR, &e_SR, &grad_eS_S);
+      &surface_SR, &e_SR, &grad_eS_S, coherence);
 
   if (surface_SR == nullptr) return nullptr;
 
@@ -447,11 +624,8 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
   //    (grad_eS_S) in the world frame (grad_eS_W).
   surface_SR->TransformVertices(X_WS);
   e_SR->TransformGradients(X_WS);
-  std::unique_ptr<std::vector<Vector3<T>>> grad_eS_W;
-  grad_eS_W = std::make_unique<std::vector<Vector3<T>>>();
-  grad_eS_W->reserve(grad_eS_S.size());
-  for (const auto& grad_eSi_S : grad_eS_S) {
-    grad_eS_W->emplace_back(X_WS.rotation() * grad_eSi_S);
+  for (auto& grad_eSi : grad_eS_S) {
+    grad_eSi = X_WS.rotation() * grad_eSi;
   }
 
   // The contact surface is documented as having the normals pointing *out* of
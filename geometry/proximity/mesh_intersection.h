@@ -3,10 +3,12 @@
 #include <memory>
 #include <vector>
 
+#include "drake/common/drake_copyable.h"
 #include "drake/common/eigen_types.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/bvh.h"
 #include "drake/geometry/proximity/contact_surface_utility.h"
+#include "drake/geometry/proximity/contact_surface_workspace.h"
 #include "drake/geometry/proximity/posed_half_space.h"
 #include "drake/geometry/proximity/surface_mesh.h"
 #include "drake/geometry/proximity/surface_mesh_field.h"
@@ -22,17 +24,142 @@ namespace internal {
 // Forward declaration of Tester class, so we can grant friend access.
 template <typename T> class SurfaceVolumeIntersectorTester;
 
+/* The data that lets the intersection of a soft volume mesh and a rigid
+ surface mesh exploit the temporal coherence of repeated queries on the same
+ pair of geometries (e.g., consecutive time steps of a simulation). It
+ persists between queries; it starts out empty and is updated by each query
+ it is passed to.
+
+ It records the front of the previous query's bounding volume tree traversal,
+ from which the next query's traversal starts (see Bvh::CollideFromFront()),
+ and the size of the previous query's contact surface, which is used to size
+ the buffers of the next one up front.
+
+ It is only valid for the pair of hierarchies it was first used with; it must
+ be discarded if either hierarchy changes.  */
+struct MeshIntersectionCoherence {
+  /* A front that has grown by more than this factor since it was last
+   computed from the roots is discarded; the next traversal starts from the
+   roots again.  */
+  static constexpr int kMaxFrontGrowth = 2;
+
+  /* The front of the previous traversal.  */
+  BvttFront front;
+
+  /* The size of the front when it was last computed from the roots.  */
+  int root_front_size{};
+
+  /* The number of faces and vertices in the previous contact surface.  */
+  int num_faces{};
+  int num_vertices{};
+};
+
+/* The relationship between a triangle and a tetrahedron, as far as it can be
+ determined without clipping the triangle.  */
+enum class TriTetOverlap {
+  /* The relationship is unknown; the triangle must be clipped.  */
+  kUnknown,
+  /* The triangle is outside the tetrahedron; their intersection is empty.  */
+  kDisjoint,
+  /* The triangle is inside the tetrahedron; their intersection is the
+   triangle.  */
+  kContained,
+};
+
+/* A batch of candidate (tetrahedron, triangle) pairs -- e.g., those reported by
+ a bounding volume hierarchy traversal -- staged so that they can be classified
+ together. Most candidate pairs are either disjoint or (for fine surface
+ meshes) have the triangle fully inside the tetrahedron; Classify() identifies
+ those pairs with a handful of signed distances per pair, so that only the
+ remaining pairs need to be clipped (see
+ SurfaceVolumeIntersector::ClipTriangleByTetrahedron()).
+
+ The vertex positions and the tetrahedra's face planes are stored as structures
+ of arrays, with one lane per pair, so that the signed distances of all pairs
+ in the batch are computed with SIMD instructions.
+
+ The classification is conservative: the signed distances are compared against
+ a bound on their rounding error, so that a pair is only classified as
+ kDisjoint or kContained if clipping the triangle would produce exactly that
+ result; all other pairs are kUnknown.  */
+class TriTetBatch {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(TriTetBatch)
+
+  /* The number of pairs in a full batch.  */
+  static constexpr int kCapacity = 8;
+
+  TriTetBatch() = default;
+
+  /* Adds the pair of tetrahedron `tet` of `volume_M` and triangle `tri` of
+   `surface_N` to the batch.
+   @pre !full().  */
+  void Add(VolumeElementIndex tet, const VolumeMesh<double>& volume_M,
+           SurfaceFaceIndex tri, const SurfaceMesh<double>& surface_N,
+           const math::RigidTransform<double>& X_MN);
+
+  /* Classifies every pair in the batch; see overlap().  */
+  void Classify();
+
+  /* Empties the batch.  */
+  void Clear() { size_ = 0; }
+
+  int size() const { return size_; }
+  bool full() const { return size_ == kCapacity; }
+  VolumeElementIndex tet(int i) const { return tets_[i]; }
+  SurfaceFaceIndex tri(int i) const { return tris_[i]; }
+
+  /* Returns the classification of the i-th pair.
+   @pre Classify() has been called since the pair was added.  */
+  TriTetOverlap overlap(int i) const { return overlaps_[i]; }
+
+ private:
+  int size_{0};
+  VolumeElementIndex tets_[kCapacity];
+  SurfaceFaceIndex tris_[kCapacity];
+  // The positions of the three triangle vertices, in frame M; e.g.,
+  // vertex_x_[v][i] is the x-coordinate of vertex v of the i-th triangle.
+  double vertex_x_[3][kCapacity];
+  double vertex_y_[3][kCapacity];
+  double vertex_z_[3][kCapacity];
+  // The four (outward) face planes of the tetrahedra, in frame M: the unit
+  // normal and the displacement of each plane.
+  double normal_x_[4][kCapacity];
+  double normal_y_[4][kCapacity];
+  double normal_z_[4][kCapacity];
+  double displacement_[4][kCapacity];
+  TriTetOverlap overlaps_[kCapacity];
+};
+
 /* %SurfaceVolumeIntersector performs a mesh-intersection algorithm between a
  triangulated surface mesh and a tetrahedral volume mesh with a field
  variable. It also interpolates the field variable onto the resulted
  surface.
 
+ The candidate (tetrahedron, triangle) pairs reported by the bounding volume
+ hierarchies are classified in batches (see TriTetBatch), and only the pairs
+ whose intersection can't be determined that way are clipped.
+
+ All of the intermediate quantities are accumulated in a
+ ContactSurfaceWorkspace. By default, the intersector owns one; when an
+ intersector is created for each computation, it is more efficient to give it a
+ long-lived workspace instead.
+
  @tparam_nonsymbolic_scalar
  */
 template <typename T>
 class SurfaceVolumeIntersector {
  public:
-  SurfaceVolumeIntersector() {
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(SurfaceVolumeIntersector)
+
+  /* Constructs the intersector.
+   @param workspace  The scratch memory to use; if null, the intersector uses
+                     its own. If not null, it is aliased and must remain valid
+                     for the lifetime of the intersector.  */
+  explicit SurfaceVolumeIntersector(
+      ContactSurfaceWorkspace<T>* workspace = nullptr)
+      : workspace_(workspace != nullptr ? workspace : &owned_workspace_),
+        polygon_(workspace_->polygon) {
     // We know that each contact polygon has at most 7 vertices.
     // Each surface triangle is clipped by four half-spaces of the four
     // triangular faces of a tetrahedron.
@@ -79,6 +206,10 @@ class SurfaceVolumeIntersector {
    @param[out] grad_eM_Ms
        The sampled gradient of the soft mesh pressure field (one sample per
        triangle in `surface_MN_M`).
+   @param[in,out] coherence
+       If not null, the traversal of the hierarchies starts from (and updates)
+       the given coherence data. The intersecting surface is the same as it
+       would be without it.
    @note
        The output surface mesh may have duplicate vertices.
    */
@@ -91,7 +222,8 @@ class SurfaceVolumeIntersector {
       ContactPolygonRepresentation representation,
       std::unique_ptr<SurfaceMesh<T>>* surface_MN_M,
       std::unique_ptr<SurfaceMeshFieldLinear<T, T>>* e_MN,
-      std::vector<Vector3<T>>* grad_eM_Ms);
+      std::vector<Vector3<T>>* grad_eM_Ms,
+      MeshIntersectionCoherence* coherence = nullptr);
 
  private:
   /* Calculates the intersection point between an infinite straight line
@@ -179,6 +311,12 @@ class SurfaceVolumeIntersector {
        The surface mesh whose vertex positions are expressed in N's frame.
    @param X_MN
        The pose of the surface frame N in the volume frame M.
+   @param overlap
+       The relationship between the triangle and the tetrahedron, if it is
+       already known (see TriTetBatch). A kDisjoint pair produces an empty
+       polygon and a kContained pair produces the (transformed) triangle,
+       without any clipping; the result is the same as if the triangle had
+       been clipped.
    @retval polygon_M
        The output polygon represented by a sequence of positions of its
        vertices, expressed in M's frame. The nature of triangle-tetrahedron
@@ -214,7 +352,8 @@ class SurfaceVolumeIntersector {
   const std::vector<Vector3<T>>& ClipTriangleByTetrahedron(
       VolumeElementIndex element, const VolumeMesh<double>& volume_M,
       SurfaceFaceIndex face, const SurfaceMesh<double>& surface_N,
-      const math::RigidTransform<T>& X_MN);
+      const math::RigidTransform<T>& X_MN,
+      TriTetOverlap overlap = TriTetOverlap::kUnknown);
 
   /* Determines whether a triangle of a rigid surface N and a tetrahedron of a
    soft volume M are suitable for building contact surface based on the face
@@ -300,8 +439,15 @@ class SurfaceVolumeIntersector {
       const math::RigidTransform<double>& X_MN,
       const VolumeElementIndex& tet_index, const SurfaceFaceIndex& tri_index);
 
+  // The workspace used when none is given to the constructor.
+  ContactSurfaceWorkspace<T> owned_workspace_;
+
+  // The scratch memory in use; either owned_workspace_ or the one given to the
+  // constructor.
+  ContactSurfaceWorkspace<T>* const workspace_;
+
   // To avoid heap allocation by std::vector in low-level functions, we use
-  // these member variables instead of local variables in the functions.
+  // these workspace buffers instead of local variables in the functions.
   // The two vectors are not guaranteed to have any particular semantic
   // interpretation during the execution of this class's main method. This array
   // represents a pool of resources; any entry could have arbitrary meaning (or
@@ -309,7 +455,7 @@ class SurfaceVolumeIntersector {
   // Furthermore, any changes to the existing algorithm that make use of these
   // pool variables should take care that conflicting use of the resources are
   // not introduced.
-  std::vector<Vector3<T>> polygon_[2];
+  std::vector<Vector3<T>>* const polygon_;
 
   friend class SurfaceVolumeIntersectorTester<T>;
 };
@@ -341,6 +487,13 @@ class SurfaceVolumeIntersector {
  @param[in] representation
      Specify the preferred representation of each contact polygon between the
      two geometries.
+ @param[in,out] coherence
+     Optional temporal coherence data for the pair of geometries (see
+     MeshIntersectionCoherence). If given, the contact surface is the same as
+     it would be without it.
+ @param[in,out] workspace
+     Optional scratch memory for the computation (see ContactSurfaceWorkspace).
+     If not given, the computation allocates its own.
  @return
      The contact surface between M and N. Geometries S and R map to M and N
      with a consistent mapping (as documented in ContactSurface) but without any
@@ -374,7 +527,9 @@ ComputeContactSurfaceFromSoftVolumeRigidSurface(
     const GeometryId id_R, const SurfaceMesh<double>& mesh_R,
     const Bvh<Obb, SurfaceMesh<double>>& bvh_R,
     const math::RigidTransform<T>& X_WR,
-    ContactPolygonRepresentation representation);
+    ContactPolygonRepresentation representation,
+    MeshIntersectionCoherence* coherence = nullptr,
+    ContactSurfaceWorkspace<T>* workspace = nullptr);
 
 }  // namespace internal
 }  // namespace geometry
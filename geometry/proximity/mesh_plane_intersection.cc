@@ -1,6 +1,8 @@
 #include "drake/geometry/proximity/mesh_plane_intersection.h"
 
 #include <array>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 #include "drake/common/default_scalars.h"
@@ -177,44 +179,56 @@ std::unique_ptr<ContactSurface<T>> ComputeContactSurface(
     GeometryId plane_id, const Plane<T>& plane_M,
     const std::vector<VolumeElementIndex>& tet_indices,
     const math::RigidTransform<T>& X_WM,
-    ContactPolygonRepresentation representation) {
+    ContactPolygonRepresentation representation,
+    ContactSurfaceWorkspace<T>* workspace) {
   if (tet_indices.size() == 0) return nullptr;
 
-  std::vector<SurfaceFace> faces;
-  std::vector<SurfaceVertex<T>> vertices_W;
-  std::vector<T> surface_e;
-  std::unordered_map<SortedPair<VolumeVertexIndex>, SurfaceVertexIndex>
-      cut_edges;
+  // The surface is accumulated in the workspace's buffers, which retain their
+  // memory from one computation to the next.
+  ContactSurfaceWorkspace<T> local_workspace;
+  if (workspace == nullptr) workspace = &local_workspace;
+  workspace->ClearSurface();
+  workspace->cut_edges.clear();
+  std::vector<SurfaceFace>& faces = workspace->faces;
+  std::vector<SurfaceVertex<T>>& vertices_W = workspace->vertices;
+  std::vector<T>& surface_e = workspace->e;
+  std::vector<Vector3<T>>& grad_eM_W = workspace->grad_e;
 
-  auto grad_eM_W = std::make_unique<std::vector<Vector3<T>>>();
   size_t old_face_count = 0;
   for (const auto& tet_index : tet_indices) {
     const Vector3<T>& grad_eMi_W =
         X_WM.rotation() * mesh_field_M.EvaluateGradient(tet_index).cast<T>();
     SliceTetWithPlane(tet_index, mesh_field_M, plane_M, X_WM, representation,
-                      &faces, &vertices_W, &surface_e, &cut_edges);
+                      &faces, &vertices_W, &surface_e, &workspace->cut_edges);
     // The gradient of every triangle that arises from slicing a tet with a
     // plane is the *constant* gradient inside that tet.
     for (size_t i = old_face_count; i < faces.size(); ++i) {
-      grad_eM_W->push_back(grad_eMi_W);
+      grad_eM_W.push_back(grad_eMi_W);
     }
     old_face_count = faces.size();
   }
 
-  // Construct the contact surface from the components.
   DRAKE_DEMAND(vertices_W.size() == surface_e.size());
   if (faces.empty()) return nullptr;
 
+  // Construct the contact surface from the components. The local workspace's
+  // buffers are simply moved; a caller's workspace keeps its buffers for the
+  // next computation, so the surface gets exactly-sized copies.
+  const bool is_local = workspace == &local_workspace;
+  auto take = [is_local](auto& buffer) {
+    using Buffer = std::decay_t<decltype(buffer)>;
+    return is_local ? std::move(buffer) : Buffer(buffer.begin(), buffer.end());
+  };
   auto mesh_W =
-      std::make_unique<SurfaceMesh<T>>(std::move(faces), std::move(vertices_W));
+      std::make_unique<SurfaceMesh<T>>(take(faces), take(vertices_W));
   auto field_W = std::make_unique<SurfaceMeshFieldLinear<T, T>>(
-      "pressure", std::move(surface_e), mesh_W.get(),
+      "pressure", take(surface_e), mesh_W.get(),
       false /* calculate_gradient */);
   // SliceTetWithPlane promises to make the surface normals point in the plane
   // normal direction (i.e., out of the plane and into the mesh).
   return std::make_unique<ContactSurface<T>>(
       mesh_id, plane_id, std::move(mesh_W), std::move(field_W),
-      std::move(grad_eM_W), nullptr);
+      std::make_unique<std::vector<Vector3<T>>>(take(grad_eM_W)), nullptr);
 }
 
 template <typename T>
@@ -224,8 +238,12 @@ ComputeContactSurfaceFromSoftVolumeRigidHalfSpace(
     const Bvh<Obb, VolumeMesh<double>>& bvh_S,
     const math::RigidTransform<T>& X_WS, const GeometryId id_R,
     const math::RigidTransform<T>& X_WR,
-    ContactPolygonRepresentation representation) {
-  std::vector<VolumeElementIndex> tet_indices;
+    ContactPolygonRepresentation representation,
+    ContactSurfaceWorkspace<T>* workspace) {
+  std::vector<VolumeElementIndex> local_tet_indices;
+  std::vector<VolumeElementIndex>& tet_indices =
+      workspace != nullptr ? workspace->tet_indices : local_tet_indices;
+  tet_indices.clear();
   tet_indices.reserve(field_S.mesh().num_elements());
   auto callback = [&tet_indices](VolumeElementIndex tet_index) {
     tet_indices.push_back(tet_index);
@@ -250,7 +268,7 @@ ComputeContactSurfaceFromSoftVolumeRigidHalfSpace(
   // Build the contact surface from the plane and the list of tetrahedron
   // indices.
   return ComputeContactSurface(id_S, field_S, id_R, plane_S, tet_indices, X_WS,
-                               representation);
+                               representation, workspace);
 }
 
 DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS((
@@ -8,6 +8,7 @@
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/bvh.h"
 #include "drake/geometry/proximity/contact_surface_utility.h"
+#include "drake/geometry/proximity/contact_surface_workspace.h"
 #include "drake/geometry/proximity/plane.h"
 #include "drake/geometry/proximity/volume_mesh_field.h"
 #include "drake/geometry/query_results/contact_surface.h"
@@ -113,6 +114,11 @@ void SliceTetWithPlane(VolumeElementIndex tet_index,
                             frame.
  @param[in] representation  The preferred representation of each contact
                             polygon.
+ @param[in,out] workspace   Optional scratch memory for the computation (see
+                            ContactSurfaceWorkspace). If not given, the
+                            computation allocates its own. Its `tet_indices`
+                            are left untouched (so they can be passed as
+                            `tet_indices`).
 
  @returns `nullptr` if there is no intersection, otherwise the appropriate
            ContactSurface. The normals of the contact surface mesh will all
@@ -127,7 +133,8 @@ std::unique_ptr<ContactSurface<T>> ComputeContactSurface(
     GeometryId plane_id, const Plane<T>& plane_M,
     const std::vector<VolumeElementIndex>& tet_indices,
     const math::RigidTransform<T>& X_WM,
-    ContactPolygonRepresentation representation);
+    ContactPolygonRepresentation representation,
+    ContactSurfaceWorkspace<T>* workspace = nullptr);
 
 // TODO(SeanCurtis-TRI): This is, in some sense, the "public" api. It refers to
 //  half spaces. Does it belong in this file? Does it belong elsewhere? At the
@@ -153,6 +160,9 @@ std::unique_ptr<ContactSurface<T>> ComputeContactSurface(
                         space is defined in -- and the world frame W.
  @param[in] representation  The preferred representation of each contact
                             polygon.
+ @param[in,out] workspace   Optional scratch memory for the computation (see
+                            ContactSurfaceWorkspace). If not given, the
+                            computation allocates its own.
 
  @returns `nullptr` if there is no collision, otherwise the ContactSurface
           between geometries S and R. The normals of the contact surface mesh
@@ -166,7 +176,8 @@ ComputeContactSurfaceFromSoftVolumeRigidHalfSpace(
     const Bvh<Obb, VolumeMesh<double>>& bvh_S,
     const math::RigidTransform<T>& X_WS, const GeometryId id_R,
     const math::RigidTransform<T>& X_WR,
-    ContactPolygonRepresentation representation);
+    ContactPolygonRepresentation representation,
+    ContactSurfaceWorkspace<T>* workspace = nullptr);
 
 }  // namespace internal
 }  // namespace geometry
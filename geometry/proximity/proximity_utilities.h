@@ -36,21 +36,31 @@ constexpr double DistanceToPointRelativeTolerance(double size) {
 
  It stores this data by compactly "encoding" them. The encoding packs a geometry
  id value with a bit indicating if the id refers to dynamic or anchored geometry
- (proximity engine segregates them). The highest-order bit indicates dynamic (1)
- or anchored (0). The remaining lower bits store the id. The data is stored in a
- pointer-sized integer. This integer is, in turn, stored directly into
+ (proximity engine segregates them) and the geometry's index in the engine's
+ CollisionFilter (see CollisionFilter::GetIndex()). The highest-order bit
+ indicates dynamic (1) or anchored (0), the next kFilterIndexBits bits store the
+ filter index, and the remaining lower bits store the id. The data is stored in
+ a pointer-sized integer. This integer is, in turn, stored directly into
  fcl::CollisionObject's void* user data member.  */
 class EncodedData {
  public:
   using ValueType = decltype(GeometryId::get_new_id().get_value());
 
-  /* Constructs encoded data directly from the id and the known
-   anchored/dynamic characterization.  */
-  EncodedData(GeometryId id, bool is_dynamic)
+  /* The number of bits reserved for the collision filter index.  */
+  static constexpr int kFilterIndexBits = 23;
+
+  /* Constructs encoded data directly from the id, the known anchored/dynamic
+   characterization, and the geometry's collision filter index. Geometry that
+   isn't part of a CollisionFilter can leave the index at zero.  */
+  EncodedData(GeometryId id, bool is_dynamic, int filter_index = 0)
       : data_(static_cast<ValueType>(id.get_value())) {
-    // Make sure we haven't used so many ids that we're *using* the highest-
-    // order bit -- i.e., it must be strictly positive.
-    DRAKE_DEMAND(data_ > 0);
+    // Make sure we haven't used so many ids that we're *using* the bits of the
+    // filter index -- i.e., it must be strictly positive and fit in the id
+    // bits.
+    DRAKE_DEMAND(data_ > 0 && data_ <= kIdMask);
+    DRAKE_DEMAND(filter_index >= 0 &&
+                 filter_index < (ValueType{1} << kFilterIndexBits));
+    data_ |= static_cast<ValueType>(filter_index) << kIdBits;
     if (is_dynamic) set_dynamic();
     // NOTE: data is encoded as anchored by default. So, an action only needs to
     // be taken in the dynamic case.
@@ -87,8 +97,11 @@ class EncodedData {
   bool is_dynamic() const { return (data_ & kIsDynamicMask) != 0; }
 
   /* Reports the stored id.  */
-  GeometryId id() const {
-    return static_cast<GeometryId>(data_ & ~kIsDynamicMask);
+  GeometryId id() const { return static_cast<GeometryId>(data_ & kIdMask); }
+
+  /* Reports the stored collision filter index.  */
+  int filter_index() const {
+    return static_cast<int>((data_ & ~kIsDynamicMask) >> kIdBits);
   }
 
   /* Reports the encoded data.  */
@@ -119,7 +132,11 @@ class EncodedData {
   static const ValueType kIsDynamicMask = ValueType{1}
       << (sizeof(void*) * 8 - 1);
 
-  // The encoded data - id and mobility type masked together.
+  // The id occupies the bits below the filter index.
+  static constexpr int kIdBits = sizeof(void*) * 8 - 1 - kFilterIndexBits;
+  static constexpr ValueType kIdMask = (ValueType{1} << kIdBits) - 1;
+
+  // The encoded data - id, filter index, and mobility type masked together.
   ValueType data_{};
 };
 
@@ -0,0 +1,597 @@
+#include "drake/geometry/proximity/signed_distance_field.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/default_scalars.h"
+#include "drake/common/extract_double.h"
+#include "drake/common/hash.h"
+#include "drake/common/sorted_pair.h"
+#include "drake/common/text_logging.h"
+#include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/cache_file.h"
+#include "drake/geometry/proximity/obj_to_surface_mesh.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+// The version of the cache file format; bump it whenever the format or the
+// field's construction changes.
+constexpr uint32_t kFileVersion = 1;
+constexpr char kFileMagic[8] = {'D', 'R', 'K', 'S', 'D', 'F', '\0', '\0'};
+
+// An upper bound on the number of samples (and bricks) read from a cache file.
+constexpr int64_t kMaxFileCount = int64_t{1} << 30;
+
+/* The feature of a triangle nearest a point: one of its three vertices, one of
+ its three edges (edge i connects vertex i and vertex i + 1), or its face.  */
+enum class Feature { kVertex0, kVertex1, kVertex2, kEdge0, kEdge1, kEdge2,
+                     kFace };
+
+/* Computes the point N of triangle abc nearest to point p, together with the
+ feature containing N. This is the algorithm from section 5.1.5 of Christer
+ Ericson, "Real-Time Collision Detection", 2005.  */
+std::pair<Vector3d, Feature> CalcNearestPointOnTriangle(
+    const Vector3d& p, const Vector3d& a, const Vector3d& b,
+    const Vector3d& c) {
+  const Vector3d ab = b - a;
+  const Vector3d ac = c - a;
+  const Vector3d ap = p - a;
+  const double d1 = ab.dot(ap);
+  const double d2 = ac.dot(ap);
+  if (d1 <= 0 && d2 <= 0) return {a, Feature::kVertex0};
+
+  const Vector3d bp = p - b;
+  const double d3 = ab.dot(bp);
+  const double d4 = ac.dot(bp);
+  if (d3 >= 0 && d4 <= d3) return {b, Feature::kVertex1};
+
+  const double vc = d1 * d4 - d3 * d2;
+  if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+    return {a + d1 / (d1 - d3) * ab, Feature::kEdge0};
+  }
+
+  const Vector3d cp = p - c;
+  const double d5 = ab.dot(cp);
+  const double d6 = ac.dot(cp);
+  if (d6 >= 0 && d5 <= d6) return {c, Feature::kVertex2};
+
+  const double vb = d5 * d2 - d1 * d6;
+  if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+    return {a + d2 / (d2 - d6) * ac, Feature::kEdge2};
+  }
+
+  const double va = d3 * d6 - d5 * d4;
+  if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) {
+    const double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    return {b + w * (c - b), Feature::kEdge1};
+  }
+
+  const double denom = 1 / (va + vb + vc);
+  return {a + ab * (vb * denom) + ac * (vc * denom), Feature::kFace};
+}
+
+/* Computes the exact signed distance from points to a closed, outward oriented
+ mesh. The nearest point is found by a branch-and-bound traversal of a bounding
+ volume hierarchy; its sign comes from the angle-weighted pseudonormal of the
+ nearest feature (J. A. Bærentzen and H. Aanæs, "Signed distance computation
+ using the angle weighted pseudonormal", IEEE TVCG, 2005).  */
+class MeshSignedDistance {
+ public:
+  explicit MeshSignedDistance(const SurfaceMesh<double>& mesh_M)
+      : mesh_M_(mesh_M), bvh_M_(mesh_M),
+        vertex_normals_(mesh_M.num_vertices(), Vector3d::Zero()),
+        edge_normals_(mesh_M.num_faces()) {
+    std::unordered_map<SortedPair<SurfaceVertexIndex>, Vector3d> edge_sums;
+    for (SurfaceFaceIndex f(0); f < mesh_M.num_faces(); ++f) {
+      const SurfaceFace& face = mesh_M.element(f);
+      const Vector3d& n = mesh_M.face_normal(f);
+      for (int i = 0; i < 3; ++i) {
+        const SurfaceVertexIndex v = face.vertex(i);
+        const SurfaceVertexIndex v_next = face.vertex((i + 1) % 3);
+        const Vector3d& p_V = mesh_M.vertex(v).r_MV();
+        const Vector3d u1 = mesh_M.vertex(v_next).r_MV() - p_V;
+        const Vector3d u2 =
+            mesh_M.vertex(face.vertex((i + 2) % 3)).r_MV() - p_V;
+        const double angle = std::atan2(u1.cross(u2).norm(), u1.dot(u2));
+        vertex_normals_[v] += angle * n;
+        auto [iter, inserted] =
+            edge_sums.emplace(SortedPair(v, v_next), Vector3d::Zero());
+        iter->second += n;
+      }
+    }
+    for (SurfaceFaceIndex f(0); f < mesh_M.num_faces(); ++f) {
+      const SurfaceFace& face = mesh_M.element(f);
+      for (int i = 0; i < 3; ++i) {
+        edge_normals_[f][i] =
+            edge_sums.at(SortedPair(face.vertex(i), face.vertex((i + 1) % 3)));
+      }
+    }
+  }
+
+  /* Returns the signed distance from Q to the mesh; negative inside.  */
+  double Calc(const Vector3d& p_MQ) const {
+    using NodeType = typename Bvh<Aabb, SurfaceMesh<double>>::NodeType;
+    double best_distance_squared = std::numeric_limits<double>::infinity();
+    Vector3d p_MN = Vector3d::Zero();
+    SurfaceFaceIndex best_face(0);
+    Feature best_feature{Feature::kFace};
+
+    // Squared distance from Q to a node's box (zero if Q is inside it).
+    auto distance_squared_to = [&p_MQ](const NodeType& node) {
+      const Vector3d d = ((p_MQ - node.bv().center()).cwiseAbs() -
+                          node.bv().half_width())
+                             .cwiseMax(0.0);
+      return d.squaredNorm();
+    };
+
+    std::vector<const NodeType*> stack{&bvh_M_.root_node()};
+    while (!stack.empty()) {
+      const NodeType& node = *stack.back();
+      stack.pop_back();
+      if (distance_squared_to(node) >= best_distance_squared) continue;
+      if (node.is_leaf()) {
+        for (int i = 0; i < node.num_element_indices(); ++i) {
+          const SurfaceFaceIndex f = node.element_index(i);
+          const SurfaceFace& face = mesh_M_.element(f);
+          const auto [p_MN_f, feature] = CalcNearestPointOnTriangle(
+              p_MQ, mesh_M_.vertex(face.vertex(0)).r_MV(),
+              mesh_M_.vertex(face.vertex(1)).r_MV(),
+              mesh_M_.vertex(face.vertex(2)).r_MV());
+          const double distance_squared = (p_MQ - p_MN_f).squaredNorm();
+          if (distance_squared < best_distance_squared) {
+            best_distance_squared = distance_squared;
+            p_MN = p_MN_f;
+            best_face = f;
+            best_feature = feature;
+          }
+        }
+      } else {
+        // Visit the nearer child first so that it is more likely to tighten
+        // the bound before the farther child is considered.
+        const NodeType* near = &node.left();
+        const NodeType* far = &node.right();
+        if (distance_squared_to(*far) < distance_squared_to(*near)) {
+          std::swap(near, far);
+        }
+        stack.push_back(far);
+        stack.push_back(near);
+      }
+    }
+
+    const double distance = std::sqrt(best_distance_squared);
+    const Vector3d& normal = pseudonormal(best_face, best_feature);
+    return (p_MQ - p_MN).dot(normal) < 0 ? -distance : distance;
+  }
+
+ private:
+  const Vector3d& pseudonormal(SurfaceFaceIndex f, Feature feature) const {
+    const SurfaceFace& face = mesh_M_.element(f);
+    switch (feature) {
+      case Feature::kVertex0: return vertex_normals_[face.vertex(0)];
+      case Feature::kVertex1: return vertex_normals_[face.vertex(1)];
+      case Feature::kVertex2: return vertex_normals_[face.vertex(2)];
+      case Feature::kEdge0: return edge_normals_[f][0];
+      case Feature::kEdge1: return edge_normals_[f][1];
+      case Feature::kEdge2: return edge_normals_[f][2];
+      case Feature::kFace: return mesh_M_.face_normal(f);
+    }
+    DRAKE_UNREACHABLE();
+  }
+
+  const SurfaceMesh<double>& mesh_M_;
+  const Bvh<Aabb, SurfaceMesh<double>> bvh_M_;
+  // The angle-weighted pseudonormal of each vertex.
+  std::vector<Vector3d> vertex_normals_;
+  // The pseudonormal of each edge of each face (the sum of the normals of the
+  // edge's two faces; it needn't be normalized for the sign test).
+  std::vector<std::array<Vector3d, 3>> edge_normals_;
+};
+
+uint64_t CalcKey(const SurfaceMesh<double>& mesh_M,
+                 const SignedDistanceFieldOptions& options) {
+  DefaultHasher hasher;
+  hash_append(hasher, kFileVersion);
+  hash_append(hasher, options.resolution);
+  hash_append(hasher, options.band_width);
+  for (SurfaceVertexIndex v(0); v < mesh_M.num_vertices(); ++v) {
+    const Vector3d& p_MV = mesh_M.vertex(v).r_MV();
+    hash_append(hasher, p_MV.x());
+    hash_append(hasher, p_MV.y());
+    hash_append(hasher, p_MV.z());
+  }
+  for (SurfaceFaceIndex f(0); f < mesh_M.num_faces(); ++f) {
+    for (int i = 0; i < 3; ++i) {
+      hash_append(hasher, static_cast<int>(mesh_M.element(f).vertex(i)));
+    }
+  }
+  return static_cast<uint64_t>(static_cast<size_t>(hasher));
+}
+
+void ThrowIfTooLarge(double memory_bytes,
+                     const SignedDistanceFieldOptions& options) {
+  if (memory_bytes > static_cast<double>(options.max_memory_bytes)) {
+    throw std::runtime_error(fmt::format(
+        "SignedDistanceField: the field would occupy {} bytes, more than the "
+        "limit of {} bytes; increase the resolution or reduce the band width",
+        memory_bytes, options.max_memory_bytes));
+  }
+}
+
+// Eigen vectors aren't trivially copyable; the cache file holds their
+// coefficients.
+template <typename V>
+bool ReadVector3(std::istream* in, Vector3<V>* value) {
+  for (int i = 0; i < 3; ++i) {
+    if (!ReadValue(in, &(*value)[i])) return false;
+  }
+  return true;
+}
+
+template <typename V>
+void WriteVector3(std::ostream* out, const Vector3<V>& value) {
+  for (int i = 0; i < 3; ++i) WriteValue(out, value[i]);
+}
+
+}  // namespace
+
+SignedDistanceField::SignedDistanceField(
+    const SurfaceMesh<double>& mesh_M,
+    const SignedDistanceFieldOptions& options)
+    : key_(CalcKey(mesh_M, options)), resolution_(options.resolution) {
+  if (!(options.resolution > 0 && std::isfinite(options.resolution))) {
+    throw std::logic_error(fmt::format(
+        "SignedDistanceField: the resolution must be positive and finite; "
+        "given {}",
+        options.resolution));
+  }
+  if (!(options.band_width >= 0 && std::isfinite(options.band_width))) {
+    throw std::logic_error(fmt::format(
+        "SignedDistanceField: the band width must be non-negative and finite; "
+        "given {}",
+        options.band_width));
+  }
+
+  // The domain D is the bounding box inflated by the band width, rounded up to
+  // a whole number of bricks.
+  const auto [center, size] = mesh_M.CalcBoundingBox();
+  const double brick_size = kBrickVoxels * resolution_;
+  const Vector3d extent = size + Vector3d::Constant(2 * options.band_width);
+  const Vector3d num_bricks =
+      (extent / brick_size).array().ceil().max(1.0).matrix();
+  p_MD_ = center - num_bricks * brick_size / 2;
+  // Check the size of the dense part of the representation before allocating
+  // it; (num_bricks + 1)³ may not even fit in an int.
+  const double num_bricks_total = num_bricks.prod();
+  const double num_coarse_total = (num_bricks.array() + 1).prod();
+  ThrowIfTooLarge((num_bricks_total + num_coarse_total) * 4, options);
+  num_bricks_ = num_bricks.cast<int>();
+
+  const MeshSignedDistance mesh_distance(mesh_M);
+  auto p_MD_node = [this](const Vector3<int>& node) {
+    return Vector3d(p_MD_ + resolution_ * node.cast<double>());
+  };
+
+  coarse_samples_.resize(static_cast<size_t>(num_coarse_total));
+  for (int i = 0; i <= num_bricks_.x(); ++i) {
+    for (int j = 0; j <= num_bricks_.y(); ++j) {
+      for (int k = 0; k <= num_bricks_.z(); ++k) {
+        const Vector3<int> node = kBrickVoxels * Vector3<int>(i, j, k);
+        coarse_samples_[coarse_index(i, j, k)] =
+            static_cast<float>(mesh_distance.Calc(p_MD_node(node)));
+      }
+    }
+  }
+
+  // A brick is sampled finely if any of its points could be within the band
+  // width of the surface: the distance at its center is compared against the
+  // band width plus the distance from the center to its corners.
+  const double half_diagonal = std::sqrt(3.0) * brick_size / 2;
+  fine_offsets_.resize(static_cast<size_t>(num_bricks_total), -1);
+  int num_fine = 0;
+  for (int i = 0; i < num_bricks_.x(); ++i) {
+    for (int j = 0; j < num_bricks_.y(); ++j) {
+      for (int k = 0; k < num_bricks_.z(); ++k) {
+        const Vector3d p_MC =
+            p_MD_ + brick_size * (Vector3d(i, j, k) + Vector3d::Constant(0.5));
+        if (std::abs(mesh_distance.Calc(p_MC)) <=
+            options.band_width + half_diagonal) {
+          fine_offsets_[brick_index(i, j, k)] = num_fine++;
+        }
+      }
+    }
+  }
+  ThrowIfTooLarge(static_cast<double>(memory_bytes()) +
+                      4.0 * num_fine * kBrickSamples,
+                  options);
+
+  fine_samples_.resize(static_cast<size_t>(num_fine) * kBrickSamples);
+  for (int i = 0; i < num_bricks_.x(); ++i) {
+    for (int j = 0; j < num_bricks_.y(); ++j) {
+      for (int k = 0; k < num_bricks_.z(); ++k) {
+        const int offset = fine_offsets_[brick_index(i, j, k)];
+        if (offset < 0) continue;
+        float* samples = &fine_samples_[offset * kBrickSamples];
+        const Vector3<int> first_node = kBrickVoxels * Vector3<int>(i, j, k);
+        for (int a = 0; a < kBrickNodes; ++a) {
+          for (int b = 0; b < kBrickNodes; ++b) {
+            for (int c = 0; c < kBrickNodes; ++c) {
+              samples[(a * kBrickNodes + b) * kBrickNodes + c] =
+                  static_cast<float>(mesh_distance.Calc(
+                      p_MD_node(first_node + Vector3<int>(a, b, c))));
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+SignedDistanceField SignedDistanceField::LoadOrBuild(
+    const SurfaceMesh<double>& mesh_M,
+    const SignedDistanceFieldOptions& options,
+    const std::string& cache_path) {
+  SignedDistanceField field;
+  if (field.Read(cache_path, CalcKey(mesh_M, options))) {
+    ThrowIfTooLarge(static_cast<double>(field.memory_bytes()), options);
+    return field;
+  }
+  field = SignedDistanceField(mesh_M, options);
+  if (!field.Write(cache_path)) {
+    drake::log()->warn(
+        "SignedDistanceField: unable to write the cache file '{}'", cache_path);
+  }
+  return field;
+}
+
+template <typename T>
+void SignedDistanceField::Evaluate(const Vector3<T>& p_MQ, T* distance,
+                                   Vector3<T>* grad_M) const {
+  DRAKE_DEMAND(distance != nullptr);
+  DRAKE_DEMAND(grad_M != nullptr);
+  // The coordinates of Q in voxels, measured from the domain's lower corner,
+  // and those of the point C of the domain nearest Q.
+  const Vector3<T> u_Q = (p_MQ - p_MD_.cast<T>()) / resolution_;
+  const Vector3d u_max = (kBrickVoxels * num_bricks_).cast<double>();
+  Vector3<T> u_C = u_Q;
+  bool is_outside = false;
+  for (int i = 0; i < 3; ++i) {
+    if (u_Q(i) < 0) {
+      u_C(i) = 0;
+      is_outside = true;
+    } else if (u_Q(i) > u_max(i)) {
+      u_C(i) = u_max(i);
+      is_outside = true;
+    }
+  }
+
+  if (is_outside) {
+    Vector3<T> grad_C;
+    EvaluateInDomain(u_C, distance, &grad_C);
+    const Vector3<T> p_CQ = (u_Q - u_C) * resolution_;
+    const T dist_CQ = p_CQ.norm();
+    *distance += dist_CQ;
+    *grad_M = p_CQ / dist_CQ;
+    return;
+  }
+
+  EvaluateInDomain(u_Q, distance, grad_M);
+  const T grad_norm = grad_M->norm();
+  if (grad_norm > 0) {
+    *grad_M /= grad_norm;
+  } else {
+    *grad_M = Vector3<T>::UnitX();
+  }
+}
+
+template <typename T>
+void SignedDistanceField::EvaluateInDomain(const Vector3<T>& u, T* distance,
+                                           Vector3<T>* grad) const {
+  // The brick containing the point (points on the domain's upper boundary
+  // belong to the last brick) and the point's coordinates w within it.
+  Vector3<int> brick;
+  for (int i = 0; i < 3; ++i) {
+    const int b = static_cast<int>(
+        std::floor(ExtractDoubleOrThrow(u(i)) / kBrickVoxels));
+    brick(i) = std::clamp(b, 0, num_bricks_(i) - 1);
+  }
+  const Vector3<T> w = u - (kBrickVoxels * brick).cast<double>().cast<T>();
+
+  // The samples at the corners of the cell containing the point, the point's
+  // coordinates t ∈ [0, 1]³ in the cell, and the cell's edge length.
+  std::array<double, 8> s;
+  Vector3<T> t;
+  double cell_size;
+  const int offset =
+      fine_offsets_[brick_index(brick.x(), brick.y(), brick.z())];
+  if (offset >= 0) {
+    Vector3<int> cell;
+    for (int i = 0; i < 3; ++i) {
+      cell(i) = std::clamp(
+          static_cast<int>(std::floor(ExtractDoubleOrThrow(w(i)))), 0,
+          kBrickVoxels - 1);
+    }
+    t = w - cell.cast<double>().cast<T>();
+    cell_size = resolution_;
+    const float* samples = &fine_samples_[offset * kBrickSamples];
+    for (int n = 0; n < 8; ++n) {
+      const int a = cell.x() + ((n >> 2) & 1);
+      const int b = cell.y() + ((n >> 1) & 1);
+      const int c = cell.z() + (n & 1);
+      s[n] = samples[(a * kBrickNodes + b) * kBrickNodes + c];
+    }
+  } else {
+    t = w / kBrickVoxels;
+    cell_size = kBrickVoxels * resolution_;
+    for (int n = 0; n < 8; ++n) {
+      s[n] = coarse_samples_[coarse_index(brick.x() + ((n >> 2) & 1),
+                                          brick.y() + ((n >> 1) & 1),
+                                          brick.z() + (n & 1))];
+    }
+  }
+
+  // Trilinear interpolation of s[abc] (a, b, c ∈ {0, 1} index the corners
+  // along x, y, and z) and its gradient.
+  const T& x = t.x();
+  const T& y = t.y();
+  const T& z = t.z();
+  const T s00 = s[0] + (s[1] - s[0]) * z;  // (a, b) = (0, 0).
+  const T s01 = s[2] + (s[3] - s[2]) * z;  // (a, b) = (0, 1).
+  const T s10 = s[4] + (s[5] - s[4]) * z;  // (a, b) = (1, 0).
+  const T s11 = s[6] + (s[7] - s[6]) * z;  // (a, b) = (1, 1).
+  const T s0 = s00 + (s01 - s00) * y;
+  const T s1 = s10 + (s11 - s10) * y;
+  *distance = s0 + (s1 - s0) * x;
+
+  const T ds00 = s[1] - s[0];
+  const T ds01 = s[3] - s[2];
+  const T ds10 = s[5] - s[4];
+  const T ds11 = s[7] - s[6];
+  const T ds0 = ds00 + (ds01 - ds00) * y;
+  const T ds1 = ds10 + (ds11 - ds10) * y;
+  (*grad)(0) = (s1 - s0) / cell_size;
+  (*grad)(1) = ((s01 - s00) + ((s11 - s10) - (s01 - s00)) * x) / cell_size;
+  (*grad)(2) = (ds0 + (ds1 - ds0) * x) / cell_size;
+}
+
+int64_t SignedDistanceField::memory_bytes() const {
+  return static_cast<int64_t>(coarse_samples_.size() * sizeof(float) +
+                              fine_offsets_.size() * sizeof(int) +
+                              fine_samples_.size() * sizeof(float));
+}
+
+bool SignedDistanceField::Equal(const SignedDistanceField& other) const {
+  return key_ == other.key_ && p_MD_ == other.p_MD_ &&
+         resolution_ == other.resolution_ &&
+         num_bricks_ == other.num_bricks_ &&
+         coarse_samples_ == other.coarse_samples_ &&
+         fine_offsets_ == other.fine_offsets_ &&
+         fine_samples_ == other.fine_samples_;
+}
+
+bool SignedDistanceField::Read(const std::string& path, uint64_t key) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return false;
+  char magic[sizeof(kFileMagic)];
+  in.read(magic, sizeof(magic));
+  uint32_t version{};
+  uint64_t file_key{};
+  if (!in || std::memcmp(magic, kFileMagic, sizeof(magic)) != 0 ||
+      !ReadValue(&in, &version) || version != kFileVersion ||
+      !ReadValue(&in, &file_key) || file_key != key) {
+    return false;
+  }
+  key_ = file_key;
+  if (!ReadVector3(&in, &p_MD_) || !ReadValue(&in, &resolution_) ||
+      !ReadVector3(&in, &num_bricks_) || (num_bricks_.array() <= 0).any() ||
+      (num_bricks_.array() >= kMaxFileCount).any()) {
+    return false;
+  }
+  // Every count is checked against the grid dimensions (and those against
+  // kMaxFileCount) before anything is allocated, so that a corrupt file can't
+  // trigger an enormous allocation.
+  const int64_t num_bricks = static_cast<int64_t>(num_bricks_.x()) *
+                             num_bricks_.y() * num_bricks_.z();
+  const int64_t expected_coarse = static_cast<int64_t>(num_bricks_.x() + 1) *
+                                  (num_bricks_.y() + 1) * (num_bricks_.z() + 1);
+  if (expected_coarse > kMaxFileCount) return false;
+  uint64_t num_coarse{}, num_offsets{}, num_fine{};
+  if (!ReadValue(&in, &num_coarse) ||
+      num_coarse != static_cast<uint64_t>(expected_coarse) ||
+      !ReadVector(&in, num_coarse, &coarse_samples_) ||
+      !ReadValue(&in, &num_offsets) ||
+      num_offsets != static_cast<uint64_t>(num_bricks) ||
+      !ReadVector(&in, num_offsets, &fine_offsets_) ||
+      !ReadValue(&in, &num_fine) || num_fine % kBrickSamples != 0 ||
+      num_fine / kBrickSamples > static_cast<uint64_t>(num_bricks) ||
+      num_fine > static_cast<uint64_t>(kMaxFileCount) ||
+      !ReadVector(&in, num_fine, &fine_samples_)) {
+    return false;
+  }
+  const int num_fine_bricks = static_cast<int>(num_fine / kBrickSamples);
+  return std::all_of(fine_offsets_.begin(), fine_offsets_.end(),
+                     [num_fine_bricks](int offset) {
+                       return offset >= -1 && offset < num_fine_bricks;
+                     });
+}
+
+bool SignedDistanceField::Write(const std::string& path) const {
+  return WriteFileAtomically(path, [this](std::ostream* out) {
+    out->write(kFileMagic, sizeof(kFileMagic));
+    WriteValue(out, kFileVersion);
+    WriteValue(out, key_);
+    WriteVector3(out, p_MD_);
+    WriteValue(out, resolution_);
+    WriteVector3(out, num_bricks_);
+    WriteVector(out, coarse_samples_);
+    WriteVector(out, fine_offsets_);
+    WriteVector(out, fine_samples_);
+    return static_cast<bool>(*out);
+  });
+}
+
+std::unique_ptr<SignedDistanceField> MaybeMakeSignedDistanceField(
+    const Shape& shape, const ProximityProperties& properties) {
+  if (!properties.HasGroup(kSdfGroup)) return nullptr;
+
+  // Reports the file and scale of Mesh and Convex; all other shapes have
+  // analytical distance functions and get no field.
+  class MeshFile final : public ShapeReifier {
+   public:
+    explicit MeshFile(const Shape& s) { s.Reify(this); }
+    std::optional<std::pair<std::string, double>> file_and_scale;
+
+   private:
+    using ShapeReifier::ImplementGeometry;
+
+    void ImplementGeometry(const Mesh& mesh, void*) final {
+      file_and_scale = std::make_pair(mesh.filename(), mesh.scale());
+    }
+    void ImplementGeometry(const Convex& convex, void*) final {
+      file_and_scale = std::make_pair(convex.filename(), convex.scale());
+    }
+    void ThrowUnsupportedGeometry(const std::string&) final {}
+  };
+  const MeshFile mesh_file(shape);
+  if (!mesh_file.file_and_scale.has_value()) return nullptr;
+
+  SignedDistanceFieldOptions options;
+  options.resolution =
+      properties.GetProperty<double>(kSdfGroup, kSdfResolution);
+  options.band_width =
+      properties.GetProperty<double>(kSdfGroup, kSdfBandWidth);
+  if (properties.HasProperty(kSdfGroup, kSdfMaxMemory)) {
+    options.max_memory_bytes = static_cast<int64_t>(
+        properties.GetProperty<double>(kSdfGroup, kSdfMaxMemory));
+  }
+  const auto& [filename, scale] = *mesh_file.file_and_scale;
+  const SurfaceMesh<double> mesh_M = ReadObjToSurfaceMesh(filename, scale);
+  const std::string cache_path =
+      properties.GetPropertyOrDefault(kSdfGroup, kSdfCachePath, std::string());
+  if (cache_path.empty()) {
+    return std::make_unique<SignedDistanceField>(mesh_M, options);
+  }
+  return std::make_unique<SignedDistanceField>(
+      SignedDistanceField::LoadOrBuild(mesh_M, options, cache_path));
+}
+
+DRAKE_DEFINE_FUNCTION_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS((
+    &SignedDistanceField::Evaluate<T>
+))
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/surface_mesh.h"
+#include "drake/geometry/proximity_properties.h"
+#include "drake/geometry/shape_specification.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* The parameters of a SignedDistanceField.  */
+struct SignedDistanceFieldOptions {
+  /* The edge length of the field's cubic voxels (in meters).  */
+  double resolution{};
+
+  /* The field is sampled at full resolution wherever the mesh surface lies
+   within this distance (in meters). Elsewhere, only a coarse sample per brick
+   of voxels is kept.  */
+  double band_width{};
+
+  /* The largest number of bytes the field's samples may occupy.  */
+  int64_t max_memory_bytes{int64_t{256} << 20};
+};
+
+/* A precomputed signed distance field φ: ℝ³ → ℝ for the volume bounded by a
+ rigid, closed, and consistently (outward) oriented triangle mesh M. It turns
+ point-to-mesh distance queries into constant-time lookups; in contrast to the
+ convex hull otherwise used for meshes, it respects non-convex features.
+
+ <h3>Representation</h3>
+
+ The field covers the mesh's axis-aligned bounding box inflated by the band
+ width; that domain is partitioned into cubic _bricks_ of kBrickVoxels³ voxels.
+ The field is sparse: only the bricks within the band width of the surface
+ store their (kBrickVoxels + 1)³ samples. Every brick keeps the samples at its
+ eight corners (shared with its neighbors), which is all that is stored for
+ the bricks away from the surface. φ is the trilinear interpolation of the
+ samples of the brick containing the query point: accurate up to the
+ discretization error in the band, a coarse approximation (on the scale of a
+ brick) elsewhere. Beyond the domain, φ(Q) = φ(C) + |Q - C|, where C is the
+ point of the domain nearest Q -- an upper bound on the distance.
+
+ <h3>Sign</h3>
+
+ The samples are computed exactly from the mesh at construction. The sign of
+ each sample is determined by the angle-weighted pseudonormal of the nearest
+ feature (face, edge, or vertex) of the mesh, which is correct for closed,
+ consistently oriented meshes. Meshes with holes or inconsistent winding
+ produce an unreliable sign.  */
+class SignedDistanceField {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SignedDistanceField)
+
+  /* The number of voxels along each edge of a brick.  */
+  static constexpr int kBrickVoxels = 8;
+
+  /* Builds the signed distance field of the given mesh.
+   @param mesh_M    The closed, outward oriented mesh, measured and expressed
+                    in its frame M.
+   @param options   The field's parameters.
+   @throws std::exception if the options are invalid (non-positive resolution,
+                          negative band width) or if the field would occupy
+                          more than `options.max_memory_bytes`.  */
+  SignedDistanceField(const SurfaceMesh<double>& mesh_M,
+                      const SignedDistanceFieldOptions& options);
+
+  /* Returns the field for the given mesh read from `cache_path`, if that file
+   holds a field built from the same mesh and options. Otherwise, builds the
+   field and attempts to write it to `cache_path` (a failure to write is logged
+   as a warning, not an error).
+   @throws std::exception under the same conditions as the constructor.  */
+  static SignedDistanceField LoadOrBuild(
+      const SurfaceMesh<double>& mesh_M,
+      const SignedDistanceFieldOptions& options,
+      const std::string& cache_path);
+
+  /* Evaluates the signed distance φ(Q) and its gradient ∇φ(Q) for the query
+   point Q. The gradient is normalized; where it vanishes, it is reported as
+   the unit vector Mx by convention.
+   @param p_MQ         The position of Q, measured and expressed in frame M.
+   @param distance     The signed distance φ(Q); negative inside the mesh.
+   @param grad_M       The unit gradient ∇φ(Q), expressed in frame M.
+   @tparam T  double or AutoDiffXd.  */
+  template <typename T>
+  void Evaluate(const Vector3<T>& p_MQ, T* distance, Vector3<T>* grad_M) const;
+
+  /* Returns the number of bricks along each axis.  */
+  const Vector3<int>& num_bricks() const { return num_bricks_; }
+
+  /* Returns the number of bricks that store all of their samples.  */
+  int num_fine_bricks() const {
+    return static_cast<int>(fine_samples_.size()) / kBrickSamples;
+  }
+
+  /* Returns the number of bytes occupied by the field's samples.  */
+  int64_t memory_bytes() const;
+
+  /* Returns the key identifying the mesh and options from which the field was
+   built; two fields with the same key are interchangeable.  */
+  uint64_t key() const { return key_; }
+
+  /* Reports whether the two fields are identical (bit-for-bit).  */
+  bool Equal(const SignedDistanceField& other) const;
+
+ private:
+  static constexpr int kBrickNodes = kBrickVoxels + 1;
+  static constexpr int kBrickSamples = kBrickNodes * kBrickNodes * kBrickNodes;
+
+  // Constructor for LoadOrBuild(); leaves the field empty.
+  SignedDistanceField() = default;
+
+  // Reads the field from `path`; returns false if the file doesn't exist or
+  // doesn't hold a field with the given key.
+  bool Read(const std::string& path, uint64_t key);
+
+  // Writes the field to `path`, atomically (see WriteFileAtomically()) so that
+  // concurrent readers never see a partial file; returns false on failure.
+  bool Write(const std::string& path) const;
+
+  // Returns the index of the coarse sample at the given corner of the brick
+  // grid.
+  int coarse_index(int i, int j, int k) const {
+    return (i * (num_bricks_.y() + 1) + j) * (num_bricks_.z() + 1) + k;
+  }
+
+  // Returns the index of the brick with the given brick coordinates.
+  int brick_index(int i, int j, int k) const {
+    return (i * num_bricks_.y() + j) * num_bricks_.z() + k;
+  }
+
+  // Evaluates the field at the point with the given coordinates (measured in
+  // voxels from the domain's lower corner), which lies in the domain.
+  template <typename T>
+  void EvaluateInDomain(const Vector3<T>& u, T* distance,
+                        Vector3<T>* grad) const;
+
+  uint64_t key_{};
+  // The lower corner of the domain, measured and expressed in frame M.
+  Vector3<double> p_MD_;
+  double resolution_{};
+  Vector3<int> num_bricks_;
+  // The samples at the bricks' corners; (num_bricks_ + 1)³ of them.
+  std::vector<float> coarse_samples_;
+  // For each brick, the offset of its samples in fine_samples_ (in units of
+  // kBrickSamples), or -1 if only its corners are sampled.
+  std::vector<int> fine_offsets_;
+  // The samples of the bricks near the surface, kBrickSamples per brick.
+  std::vector<float> fine_samples_;
+};
+
+/* The signed distance fields of the geometries that have one. They are
+ immutable once built and shared by copies of the engine.  */
+using SignedDistanceFields =
+    std::unordered_map<GeometryId, std::shared_ptr<const SignedDistanceField>>;
+
+/* Creates the signed distance field for the given shape if it is a Mesh or
+ Convex and the given properties declare one (see
+ AddSignedDistanceFieldProperties()); returns nullptr otherwise. The mesh is
+ read from the shape's .obj file and scaled by its scale factor, so the field
+ is measured and expressed in the shape's frame.
+ @throws std::exception if the field can't be built (see SignedDistanceField).
+ */
+std::unique_ptr<SignedDistanceField> MaybeMakeSignedDistanceField(
+    const Shape& shape, const ProximityProperties& properties);
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
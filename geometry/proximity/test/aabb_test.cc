@@ -41,12 +41,17 @@ GTEST_TEST(AabbTest, Construction) {
   const Vector3d half_size{0.75, 0.875, 1.25};
   const double expected_volume =
       2 * half_size.x() * 2 * half_size.y() * 2 * half_size.z();
+  const double expected_area =
+      2 * (2 * half_size.x() * 2 * half_size.y() +
+           2 * half_size.y() * 2 * half_size.z() +
+           2 * half_size.z() * 2 * half_size.x());
 
   const Aabb aabb(p_HB, half_size);
 
   EXPECT_TRUE(CompareMatrices(aabb.center(), p_HB));
   EXPECT_TRUE(CompareMatrices(aabb.half_width(), half_size));
   EXPECT_EQ(aabb.CalcVolume(), expected_volume);
+  EXPECT_DOUBLE_EQ(aabb.CalcSurfaceArea(), expected_area);
   EXPECT_TRUE(CompareMatrices(aabb.lower(), p_HB - half_size));
   EXPECT_TRUE(CompareMatrices(aabb.upper(), p_HB + half_size));
 
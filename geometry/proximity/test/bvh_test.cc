@@ -1,10 +1,18 @@
 #include "drake/geometry/proximity/bvh.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <set>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/proximity/make_ellipsoid_mesh.h"
 #include "drake/geometry/proximity/make_sphere_mesh.h"
 #include "drake/geometry/proximity/obb.h"
@@ -279,6 +287,150 @@ TYPED_TEST(BvhTest, TestCopy) {
   check_copy(this->bvh_.root_node(), bvh_copy.root_node());
 }
 
+// Tests the flat storage of the nodes: they are stored contiguously in
+// depth-first pre-order, so a branch's left child immediately follows it and
+// its right child follows the left child's entire subtree.
+TYPED_TEST(BvhTest, TestFlatLayout) {
+  using BvType = TypeParam;
+  using NodeType = BvNode<BvType, SurfaceMesh<double>>;
+  const auto mesh = MakeSphereSurfaceMesh<double>(Sphere(1.5), 0.5);
+  const Bvh<BvType, SurfaceMesh<double>> bvh(mesh);
+  ASSERT_EQ(bvh.num_nodes(), CountAllNodes(bvh.root_node()));
+
+  std::function<void(const NodeType&)> check_node;
+  check_node = [&check_node](const NodeType& node) {
+    if (node.is_leaf()) return;
+    EXPECT_EQ(&node.left(), &node + 1);
+    EXPECT_EQ(&node.right(), &node + 1 + CountAllNodes(node.left()));
+    check_node(node.left());
+    check_node(node.right());
+  };
+  check_node(bvh.root_node());
+
+  // The nodes of a copy live in the copy's storage.
+  const Bvh<BvType, SurfaceMesh<double>> copy(bvh);
+  const NodeType* const begin = &copy.root_node();
+  const NodeType* const end = begin + copy.num_nodes();
+  std::function<void(const NodeType&)> check_in_copy;
+  check_in_copy = [&check_in_copy, begin, end](const NodeType& node) {
+    EXPECT_TRUE(begin <= &node && &node < end);
+    if (node.is_leaf()) return;
+    check_in_copy(node.left());
+    check_in_copy(node.right());
+  };
+  check_in_copy(copy.root_node());
+  EXPECT_TRUE(copy.Equal(bvh));
+
+  // A node copied out of its Bvh's storage would have dangling children, so
+  // nodes can't be copied.
+  static_assert(!std::is_copy_constructible_v<NodeType>);
+  static_assert(!std::is_copy_assignable_v<NodeType>);
+}
+
+// Tests the construction options: both strategies produce valid hierarchies
+// (every element is in exactly one leaf, and every bounding volume contains
+// the elements of its subtree) and the hierarchy doesn't depend on the number
+// of threads used to build it.
+TYPED_TEST(BvhTest, TestBuildOptions) {
+  using BvType = TypeParam;
+  using NodeType = BvNode<BvType, SurfaceMesh<double>>;
+  // The mesh must be large enough for the subtrees to be built concurrently.
+  const auto mesh = MakeSphereSurfaceMesh<double>(Sphere(1.5), 0.1);
+  ASSERT_GT(mesh.num_elements(), 4096);
+
+  // Returns the elements of the subtree rooted at `node` after confirming that
+  // the node's bounding volume contains them (to within rounding error; an
+  // Aabb fits its vertices exactly).
+  std::function<std::vector<SurfaceFaceIndex>(const NodeType&)> check_node;
+  check_node = [&check_node, &mesh](const NodeType& node) {
+    std::vector<SurfaceFaceIndex> elements;
+    if (node.is_leaf()) {
+      for (int i = 0; i < node.num_element_indices(); ++i) {
+        elements.push_back(node.element_index(i));
+      }
+    } else {
+      elements = check_node(node.left());
+      const std::vector<SurfaceFaceIndex> right = check_node(node.right());
+      elements.insert(elements.end(), right.begin(), right.end());
+    }
+    const RigidTransformd X_BM = node.bv().pose().inverse();
+    const Vector3d bound = node.bv().half_width().array() + 1e-14;
+    for (const SurfaceFaceIndex e : elements) {
+      for (int v = 0; v < 3; ++v) {
+        const Vector3d p_BV =
+            X_BM * mesh.vertex(mesh.element(e).vertex(v)).r_MV();
+        EXPECT_TRUE((p_BV.cwiseAbs().array() <= bound.array()).all());
+      }
+    }
+    return elements;
+  };
+
+  for (const BvhBuildStrategy strategy :
+       {BvhBuildStrategy::kMedianSplit,
+        BvhBuildStrategy::kSurfaceAreaHeuristic}) {
+    const Bvh<BvType, SurfaceMesh<double>> serial(mesh, {strategy, 1});
+    EXPECT_EQ(serial.build_options().strategy, strategy);
+    EXPECT_EQ(serial.build_options().num_threads, 1);
+    std::set<SurfaceFaceIndex> element_indices;
+    for (const SurfaceFaceIndex index : check_node(serial.root_node())) {
+      EXPECT_TRUE(element_indices.insert(index).second);
+    }
+    EXPECT_EQ(element_indices.size(), mesh.num_elements());
+
+    for (int num_threads : {2, 3, 4}) {
+      const Bvh<BvType, SurfaceMesh<double>> parallel(mesh,
+                                                      {strategy, num_threads});
+      EXPECT_EQ(parallel.num_nodes(), serial.num_nodes());
+      EXPECT_TRUE(parallel.Equal(serial));
+    }
+  }
+
+  // The default options preserve the original behavior.
+  using BvhType = Bvh<BvType, SurfaceMesh<double>>;
+  const BvhBuildOptions median_options{BvhBuildStrategy::kMedianSplit, 1};
+  EXPECT_TRUE(BvhType(mesh).Equal(BvhType(mesh, median_options)));
+
+  const BvhBuildOptions bad_options{BvhBuildStrategy::kMedianSplit, 0};
+  DRAKE_EXPECT_THROWS_MESSAGE(BvhType(mesh, bad_options),
+                              ".*num_threads >= 1.*");
+}
+
+// The surface area heuristic separates a dense cluster of elements from a
+// distant outlier, whereas the median split (which balances the number of
+// elements) lumps the outlier with half of the cluster.
+GTEST_TEST(BvhSahTest, IsolatesOutlier) {
+  const SurfaceMesh<double> sphere =
+      MakeSphereSurfaceMesh<double>(Sphere(1.0), 0.5);
+  std::vector<SurfaceFace> faces = sphere.faces();
+  std::vector<SurfaceVertex<double>> vertices = sphere.vertices();
+  const int first = static_cast<int>(vertices.size());
+  for (const Vector3d& p : {Vector3d(100, 0, 0), Vector3d(100.1, 0, 0),
+                            Vector3d(100, 0.1, 0)}) {
+    vertices.emplace_back(p);
+  }
+  faces.emplace_back(SurfaceVertexIndex(first), SurfaceVertexIndex(first + 1),
+                     SurfaceVertexIndex(first + 2));
+  const SurfaceFaceIndex outlier(static_cast<int>(faces.size()) - 1);
+  const SurfaceMesh<double> mesh(std::move(faces), std::move(vertices));
+
+  // Reports the number of elements in the subtree rooted at `node`.
+  std::function<int(const BvNode<Aabb, SurfaceMesh<double>>&)> count;
+  count = [&count](const BvNode<Aabb, SurfaceMesh<double>>& node) {
+    return node.is_leaf() ? node.num_element_indices()
+                          : count(node.left()) + count(node.right());
+  };
+
+  const Bvh<Aabb, SurfaceMesh<double>> sah(
+      mesh, {BvhBuildStrategy::kSurfaceAreaHeuristic, 1});
+  const auto& right = sah.root_node().right();
+  ASSERT_TRUE(right.is_leaf());
+  EXPECT_EQ(right.num_element_indices(), 1);
+  EXPECT_EQ(right.element_index(0), outlier);
+
+  const Bvh<Aabb, SurfaceMesh<double>> median(mesh);
+  EXPECT_EQ(count(median.root_node().left()), mesh.num_elements() / 2);
+}
+
 // Tests colliding while traversing through the bvh trees. We want to ensure
 // that the case of no overlap is covered as well as the 4 cases of branch and
 // leaf comparisons, i.e:
@@ -360,6 +512,84 @@ TYPED_TEST(BvhTest, TestCollideEarlyExit) {
   EXPECT_EQ(count, 5);
 }
 
+// Tests colliding from the front of a previous traversal. Starting from the
+// roots, it reports exactly what Collide() reports. Starting from a previous
+// front (after the hierarchies have moved a little), it reports everything
+// Collide() reports (and perhaps more), each pair once. In all cases, the
+// resulting front is a complete cut of the traversal tree.
+TYPED_TEST(BvhTest, TestCollideFromFront) {
+  using BvType = TypeParam;
+  const auto volume = MakeSphereVolumeMesh<double>(
+      Sphere(0.8), 0.3, TessellationStrategy::kDenseInteriorVertices);
+  const auto surface = MakeSphereSurfaceMesh<double>(Sphere(1.0), 0.2);
+  const Bvh<BvType, VolumeMesh<double>> bvh_A(volume);
+  const Bvh<BvType, SurfaceMesh<double>> bvh_B(surface);
+  using Candidate = std::pair<VolumeElementIndex, SurfaceFaceIndex>;
+
+  // Confirms that every pair of leaves descends from exactly one pair of nodes
+  // in the front: the numbers of leaf pairs below the front's node pairs add
+  // up to the total number of leaf pairs.
+  auto expect_complete_cut = [&bvh_A, &bvh_B](const BvttFront& front) {
+    int64_t num_leaf_pairs = 0;
+    for (const auto& [a, b] : front) {
+      ASSERT_LT(a, bvh_A.num_nodes());
+      ASSERT_LT(b, bvh_B.num_nodes());
+      num_leaf_pairs +=
+          static_cast<int64_t>(CountLeafNodes((&bvh_A.root_node())[a])) *
+          CountLeafNodes((&bvh_B.root_node())[b]);
+    }
+    EXPECT_EQ(num_leaf_pairs,
+              static_cast<int64_t>(CountLeafNodes(bvh_A.root_node())) *
+                  CountLeafNodes(bvh_B.root_node()));
+  };
+
+  BvttFront front;
+  std::vector<Candidate> candidates;
+  auto callback = [&candidates](VolumeElementIndex a, SurfaceFaceIndex b) {
+    candidates.emplace_back(a, b);
+    return BvttCallbackResult::Continue;
+  };
+  for (int i = 0; i < 5; ++i) {
+    const RigidTransformd X_AB(
+        AngleAxisd(0.02 * i, Vector3d(1, 2, 3).normalized()),
+        Vector3d(0.9 + 0.01 * i, 0.1, -0.05 * i));
+    std::vector<Candidate> expected =
+        bvh_A.GetCollisionCandidates(bvh_B, X_AB);
+    candidates.clear();
+    bvh_A.CollideFromFront(bvh_B, X_AB, callback, &front);
+    expect_complete_cut(front);
+    if (i == 0) {
+      // Starting from the roots, the traversal is the same as Collide()'s.
+      EXPECT_EQ(candidates, expected);
+    }
+    // The pairs that Collide() reports are reported in the same order.
+    const std::set<Candidate> expected_set(expected.begin(), expected.end());
+    std::vector<Candidate> reported_in_order;
+    std::copy_if(candidates.begin(), candidates.end(),
+                 std::back_inserter(reported_in_order),
+                 [&expected_set](const Candidate& candidate) {
+                   return expected_set.count(candidate) > 0;
+                 });
+    EXPECT_EQ(reported_in_order, expected);
+    std::sort(expected.begin(), expected.end());
+    std::sort(candidates.begin(), candidates.end());
+    EXPECT_EQ(std::adjacent_find(candidates.begin(), candidates.end()),
+              candidates.end());
+    EXPECT_TRUE(std::includes(candidates.begin(), candidates.end(),
+                              expected.begin(), expected.end()));
+    ASSERT_FALSE(expected.empty());
+  }
+
+  // Terminating the traversal discards the front.
+  bvh_A.CollideFromFront(
+      bvh_B, RigidTransformd(Vector3d(0.9, 0.1, 0)),
+      [](VolumeElementIndex, SurfaceFaceIndex) {
+        return BvttCallbackResult::Terminate;
+      },
+      &front);
+  EXPECT_TRUE(front.empty());
+}
+
 // Confirms that we can collide bvh trees on different mesh types: surface vs.
 // volume. We construct two meshes with known intersection and confirm that
 // the BVH produces candidates which include the intersecting elements, and
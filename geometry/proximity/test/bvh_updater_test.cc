@@ -1,12 +1,17 @@
 #include "drake/geometry/proximity/bvh_updater.h"
 
+#include <algorithm>
+#include <functional>
+#include <random>
 #include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/proximity/bvh.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
 #include "drake/geometry/proximity/mesh_deformer.h"
 
 namespace drake {
@@ -193,6 +198,179 @@ TYPED_TEST(BvhUpdaterTest, Update) {
   EXPECT_TRUE(CompareMatrices(
       right.bv().half_width(),
       (R * expected_right_bv.half_width().cast<T>()).cwiseAbs(), 2 * kEps));
+
+  /* The default policy only refits; a rigid rotation doesn't degrade the
+   hierarchy. */
+  const BvhUpdateStatistics& stats = updater.statistics();
+  EXPECT_EQ(stats.num_updates, 1);
+  EXPECT_EQ(stats.num_subtree_rebuilds, 0);
+  EXPECT_EQ(stats.num_full_rebuilds, 0);
+  EXPECT_NEAR(stats.last_degradation, 1.0, 1e-14);
+  EXPECT_GE(stats.refit_time, 0.0);
+  EXPECT_EQ(stats.rebuild_time, 0.0);
+}
+
+/* Fixture for testing the refit vs rebuild policy on a mesh large enough to
+ have a deep hierarchy. The mesh is a "soup" of disjoint tetrahedra (the
+ tetrahedra of a sphere mesh, each with its own vertices). The deformation
+ moves each tetrahedron rigidly to the location of another (randomly chosen)
+ one, so that the elements grouped together in the hierarchy are no longer
+ near each other and the refit hierarchy is badly degraded, even though a
+ rebuilt hierarchy would be as good as the original one. */
+class BvhUpdaterPolicyTest : public ::testing::Test {
+ protected:
+  BvhUpdaterPolicyTest()
+      : mesh_(MakeTetrahedronSoup()),
+        bvh_(mesh_),
+        updater_(&mesh_, &bvh_),
+        deformer_(&mesh_) {}
+
+  static VolumeMesh<double> MakeTetrahedronSoup() {
+    const VolumeMesh<double> sphere = MakeSphereVolumeMesh<double>(
+        Sphere(1.0), 0.25, TessellationStrategy::kDenseInteriorVertices);
+    std::vector<VolumeElement> tets;
+    std::vector<VolumeVertex<double>> vertices;
+    for (VolumeElementIndex e(0); e < sphere.num_elements(); ++e) {
+      const int first = static_cast<int>(vertices.size());
+      for (int v = 0; v < 4; ++v) {
+        vertices.push_back(sphere.vertex(sphere.element(e).vertex(v)));
+      }
+      tets.emplace_back(VolumeVertexIndex(first), VolumeVertexIndex(first + 1),
+                        VolumeVertexIndex(first + 2),
+                        VolumeVertexIndex(first + 3));
+    }
+    return VolumeMesh<double>(std::move(tets), std::move(vertices));
+  }
+
+  void ShuffleElements() {
+    const int num_elements = mesh_.num_elements();
+    std::vector<int> permutation(num_elements);
+    for (int i = 0; i < num_elements; ++i) permutation[i] = i;
+    std::mt19937 generator(1234);
+    std::shuffle(permutation.begin(), permutation.end(), generator);
+    // Element i's vertices are 4i, ..., 4i + 3.
+    auto centroid = [this](int e) {
+      Vector3d sum = Vector3d::Zero();
+      for (int v = 0; v < 4; ++v) {
+        sum += mesh_.vertex(VolumeVertexIndex(4 * e + v)).r_MV();
+      }
+      return Vector3d(sum / 4);
+    };
+    VectorX<double> p_MVs(3 * mesh_.num_vertices());
+    for (int e = 0; e < num_elements; ++e) {
+      const Vector3d offset = centroid(permutation[e]) - centroid(e);
+      for (int v = 0; v < 4; ++v) {
+        p_MVs.segment<3>(3 * (4 * e + v)) =
+            mesh_.vertex(VolumeVertexIndex(4 * e + v)).r_MV() + offset;
+      }
+    }
+    deformer_.SetAllPositions(p_MVs);
+  }
+
+  /* Confirms that every element is in exactly one leaf and that every bounding
+   volume bounds its contents (to within round-off).  */
+  void ExpectValidHierarchy() const {
+    constexpr double kTol = 1e-14;
+    std::vector<int> counts(mesh_.num_elements(), 0);
+    std::function<void(const BvNode<Aabb, VolumeMesh<double>>&)> check;
+    check = [this, &counts, &check, kTol](
+                const BvNode<Aabb, VolumeMesh<double>>& node) {
+      const Vector3d lower = node.bv().lower().array() - kTol;
+      const Vector3d upper = node.bv().upper().array() + kTol;
+      if (node.is_leaf()) {
+        for (int e = 0; e < node.num_element_indices(); ++e) {
+          ++counts[node.element_index(e)];
+          for (int v = 0; v < 4; ++v) {
+            const Vector3d& p_MV =
+                mesh_.vertex(mesh_.element(node.element_index(e)).vertex(v))
+                    .r_MV();
+            EXPECT_TRUE((p_MV.array() >= lower.array()).all());
+            EXPECT_TRUE((p_MV.array() <= upper.array()).all());
+          }
+        }
+        return;
+      }
+      for (const auto* child : {&node.left(), &node.right()}) {
+        EXPECT_TRUE((child->bv().lower().array() >= lower.array()).all());
+        EXPECT_TRUE((child->bv().upper().array() <= upper.array()).all());
+        check(*child);
+      }
+    };
+    check(bvh_.root_node());
+    for (int count : counts) EXPECT_EQ(count, 1);
+  }
+
+  VolumeMesh<double> mesh_;
+  Bvh<Aabb, VolumeMesh<double>> bvh_;
+  BvhUpdater<VolumeMesh<double>> updater_;
+  MeshDeformer<VolumeMesh<double>> deformer_;
+};
+
+TEST_F(BvhUpdaterPolicyTest, BadPolicy) {
+  BvhUpdatePolicy policy;
+  policy.full_rebuild_ratio = 0.5;
+  EXPECT_THROW(updater_.set_policy(policy), std::exception);
+  policy = {};
+  policy.subtree_rebuild_ratio = 0.99;
+  EXPECT_THROW(updater_.set_policy(policy), std::exception);
+}
+
+/* With the default policy, the degraded hierarchy is only refit.  */
+TEST_F(BvhUpdaterPolicyTest, RefitOnly) {
+  ShuffleElements();
+  updater_.Update();
+  const BvhUpdateStatistics& stats = updater_.statistics();
+  EXPECT_EQ(stats.num_updates, 1);
+  EXPECT_EQ(stats.num_subtree_rebuilds, 0);
+  EXPECT_EQ(stats.num_full_rebuilds, 0);
+  EXPECT_GT(stats.last_degradation, 2.0);
+  ExpectValidHierarchy();
+  EXPECT_FALSE(bvh_.Equal(Bvh<Aabb, VolumeMesh<double>>(mesh_)));
+}
+
+/* A full rebuild produces the hierarchy we'd get from scratch, and resets the
+ reference quality.  */
+TEST_F(BvhUpdaterPolicyTest, FullRebuild) {
+  BvhUpdatePolicy policy;
+  policy.full_rebuild_ratio = 1.5;
+  updater_.set_policy(policy);
+  ShuffleElements();
+  updater_.Update();
+  EXPECT_EQ(updater_.statistics().num_full_rebuilds, 1);
+  EXPECT_EQ(updater_.statistics().num_subtree_rebuilds, 0);
+  ExpectValidHierarchy();
+  EXPECT_TRUE(bvh_.Equal(Bvh<Aabb, VolumeMesh<double>>(mesh_)));
+
+  // Without further deformation, there is no degradation.
+  updater_.Update();
+  EXPECT_EQ(updater_.statistics().num_full_rebuilds, 1);
+  EXPECT_NEAR(updater_.statistics().last_degradation, 1.0, 1e-14);
+}
+
+/* Rebuilding the degraded subtrees improves the hierarchy without a full
+ rebuild.  */
+TEST_F(BvhUpdaterPolicyTest, SubtreeRebuild) {
+  BvhUpdatePolicy policy;
+  policy.subtree_rebuild_ratio = 1.5;
+  updater_.set_policy(policy);
+  ShuffleElements();
+  updater_.Update();
+  const BvhUpdateStatistics& stats = updater_.statistics();
+  EXPECT_GT(stats.num_subtree_rebuilds, 0);
+  EXPECT_EQ(stats.num_full_rebuilds, 0);
+  const double degradation_before_rebuild = stats.last_degradation;
+  ExpectValidHierarchy();
+
+  // The next update measures the quality of the partially rebuilt hierarchy.
+  const int num_subtree_rebuilds = stats.num_subtree_rebuilds;
+  const double rebuild_time = stats.rebuild_time;
+  EXPECT_GE(rebuild_time, 0.0);
+  updater_.Update();
+  EXPECT_LT(stats.last_degradation, degradation_before_rebuild);
+  // Nothing has moved, so no more subtrees need rebuilding (nor is any time
+  // charged to rebuilding).
+  EXPECT_EQ(stats.num_subtree_rebuilds, num_subtree_rebuilds);
+  EXPECT_EQ(stats.rebuild_time, rebuild_time);
 }
 
 }  // namespace
@@ -0,0 +1,89 @@
+#include "drake/geometry/proximity/cache_file.h"
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/filesystem.h"
+#include "drake/common/temp_directory.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+// Values and vectors round trip, and reads past the end of the data fail.
+GTEST_TEST(CacheFileTest, ValuesRoundTrip) {
+  std::stringstream stream;
+  WriteValue(&stream, 1.5);
+  WriteValue<int64_t>(&stream, -7);
+  WriteVector(&stream, std::vector<float>{1.f, 2.f, 3.f});
+
+  double d{};
+  int64_t i{};
+  uint64_t size{};
+  std::vector<float> values;
+  ASSERT_TRUE(ReadValue(&stream, &d));
+  ASSERT_TRUE(ReadValue(&stream, &i));
+  ASSERT_TRUE(ReadValue(&stream, &size));
+  ASSERT_TRUE(ReadVector(&stream, size, &values));
+  EXPECT_EQ(d, 1.5);
+  EXPECT_EQ(i, -7);
+  EXPECT_EQ(values, std::vector<float>({1.f, 2.f, 3.f}));
+  EXPECT_FALSE(ReadValue(&stream, &d));
+}
+
+std::string ReadFile(const std::string& filename) {
+  std::ifstream in(filename, std::ios::binary);
+  std::stringstream contents;
+  contents << in.rdbuf();
+  return contents.str();
+}
+
+// Confirms that the file is replaced only once it is completely written, and
+// that no temporary files are left behind, whether the write succeeds or not.
+GTEST_TEST(CacheFileTest, WriteFileAtomically) {
+  const std::string directory = temp_directory();
+  const std::string filename = directory + "/cache";
+  auto num_files = [&directory]() {
+    return std::distance(filesystem::directory_iterator(directory),
+                         filesystem::directory_iterator{});
+  };
+
+  EXPECT_TRUE(WriteFileAtomically(filename, [&](std::ostream* out) {
+    *out << "old";
+    // Nothing is visible under the final name until the write is done.
+    EXPECT_FALSE(filesystem::exists(filename));
+    return true;
+  }));
+  EXPECT_EQ(ReadFile(filename), "old");
+
+  // A failed write leaves the existing file alone.
+  EXPECT_FALSE(WriteFileAtomically(filename, [](std::ostream* out) {
+    *out << "partial";
+    return false;
+  }));
+  EXPECT_EQ(ReadFile(filename), "old");
+  EXPECT_EQ(num_files(), 1);
+
+  EXPECT_TRUE(WriteFileAtomically(filename, [&](std::ostream* out) {
+    *out << "new";
+    EXPECT_EQ(ReadFile(filename), "old");
+    return true;
+  }));
+  EXPECT_EQ(ReadFile(filename), "new");
+  EXPECT_EQ(num_files(), 1);
+
+  // A directory that doesn't exist can't be written to.
+  EXPECT_FALSE(WriteFileAtomically(directory + "/no/such/dir/cache",
+                                   [](std::ostream*) { return true; }));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -616,9 +616,9 @@ void CharacterizeResultTest<T>::RunCharacterization(const QueryInstance& query,
 template <typename T>
 GeometryId CharacterizeResultTest<T>::EncodeData(fcl::CollisionObjectd* obj) {
   const GeometryId id = GeometryId::get_new_id();
-  const EncodedData data(id, true);
+  collision_filter_.AddGeometry(id);
+  const EncodedData data(id, true, collision_filter_.GetIndex(id));
   data.write_to(obj);
-  collision_filter_.AddGeometry(data.id());
   return id;
 }
 
@@ -1,6 +1,8 @@
 #include "drake/geometry/proximity/collision_filter.h"
 
+#include <random>
 #include <tuple>
+#include <unordered_map>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -85,6 +87,36 @@ class CollisionFilterTest : public ::testing::Test {
   static CollisionFilter ClearCopy(const CollisionFilter& filter) {
     return filter.MakeClearCopy();
   }
+
+  /* Reports whether the filter's map-based state (the source of truth that
+   the bit matrix is compiled from) says the pair can collide.  */
+  static bool ReferenceCanCollide(const CollisionFilter& filter,
+                                  GeometryId id_A, GeometryId id_B) {
+    if (id_A == id_B) return false;
+    if (id_B < id_A) std::swap(id_A, id_B);
+    return filter.filter_state_.at(id_A).at(id_B) ==
+           CollisionFilter::kUnfiltered;
+  }
+
+  /* Confirms that CanCollideWith() (by id and by index) agrees with the
+   reference state for every pair of the given geometries.  */
+  static ::testing::AssertionResult MatchesReference(
+      const CollisionFilter& filter, const vector<GeometryId>& ids) {
+    for (GeometryId id_A : ids) {
+      for (GeometryId id_B : ids) {
+        const bool expected = ReferenceCanCollide(filter, id_A, id_B);
+        if (filter.CanCollideWith(id_A, id_B) != expected ||
+            filter.CanCollideWith(filter.GetIndex(id_A),
+                                  filter.GetIndex(id_B)) != expected) {
+          return ::testing::AssertionFailure()
+                 << "For pair (" << id_A << ", " << id_B
+                 << "), the reference state reports can-collide = "
+                 << expected << ", but CanCollideWith() disagrees";
+        }
+      }
+    }
+    return ::testing::AssertionSuccess();
+  }
 };
 
 /* Tests that declaration statements that allow collisions between geometries
@@ -489,6 +521,133 @@ TEST_F(CollisionFilterTest, Equality) {
   EXPECT_TRUE(filters1 != filters2);
 }
 
+/* CanCollideWith() is answered by a bit matrix which is updated incrementally
+ as geometries come and go and as declarations are applied or removed. This
+ exercises a random sequence of all such changes, with enough geometries to
+ force the matrix to grow past a single 64-bit word per row, and confirms the
+ matrix always agrees with the filter state it is derived from.  */
+TEST_F(CollisionFilterTest, BitMatrixMatchesFilterState) {
+  CollisionFilter filter;
+  vector<GeometryId> ids;
+  std::mt19937 generator(1234);
+  auto random_index = [&generator](int size) {
+    return std::uniform_int_distribution<int>(0, size - 1)(generator);
+  };
+  auto random_subset = [&ids, &generator]() {
+    std::bernoulli_distribution include(0.2);
+    std::unordered_set<GeometryId> subset;
+    for (GeometryId id : ids) {
+      if (include(generator)) subset.insert(id);
+    }
+    return GeometrySet(subset);
+  };
+
+  /* The index of each geometry, recorded when it is added.  */
+  std::unordered_map<GeometryId, int> indices;
+  auto add_geometry = [&]() {
+    ids.push_back(GeometryId::get_new_id());
+    filter.AddGeometry(ids.back());
+    indices[ids.back()] = filter.GetIndex(ids.back());
+  };
+  auto indices_unchanged = [&](const CollisionFilter& f) {
+    for (GeometryId id : ids) {
+      if (f.GetIndex(id) != indices.at(id)) return false;
+    }
+    return true;
+  };
+
+  for (int i = 0; i < 70; ++i) {
+    add_geometry();
+  }
+  filter.Apply(CollisionFilterDeclaration().ExcludeWithin(random_subset()),
+               get_extract_ids_functor(), true /* is_invariant */);
+  filter.Apply(CollisionFilterDeclaration().ExcludeBetween(random_subset(),
+                                                           random_subset()),
+               get_extract_ids_functor(), false /* is_invariant */);
+  ASSERT_TRUE(MatchesReference(filter, ids));
+
+  vector<FilterId> transient_ids;
+  for (int step = 0; step < 200; ++step) {
+    switch (random_index(5)) {
+      case 0: {
+        add_geometry();
+        break;
+      }
+      case 1: {
+        if (ids.size() < 2) break;
+        const int i = random_index(ids.size());
+        filter.RemoveGeometry(ids[i]);
+        ids.erase(ids.begin() + i);
+        break;
+      }
+      case 2: {
+        transient_ids.push_back(filter.ApplyTransient(
+            CollisionFilterDeclaration().ExcludeWithin(random_subset()),
+            get_extract_ids_functor()));
+        break;
+      }
+      case 3: {
+        transient_ids.push_back(filter.ApplyTransient(
+            CollisionFilterDeclaration().AllowBetween(random_subset(),
+                                                      random_subset()),
+            get_extract_ids_functor()));
+        break;
+      }
+      case 4: {
+        if (transient_ids.empty()) break;
+        const int i = random_index(transient_ids.size());
+        EXPECT_TRUE(filter.RemoveDeclaration(transient_ids[i]));
+        transient_ids.erase(transient_ids.begin() + i);
+        break;
+      }
+    }
+    ASSERT_TRUE(MatchesReference(filter, ids)) << "at step " << step;
+    ASSERT_TRUE(indices_unchanged(filter)) << "at step " << step;
+  }
+
+  /* Copies carry their matrix, and the clear copy compiles its own; both keep
+   the indices.  */
+  const CollisionFilter copy(filter);
+  EXPECT_TRUE(MatchesReference(copy, ids));
+  EXPECT_TRUE(indices_unchanged(copy));
+  const CollisionFilter clear = ClearCopy(filter);
+  EXPECT_TRUE(MatchesReference(clear, ids));
+  EXPECT_TRUE(indices_unchanged(clear));
+}
+
+/* Removing a geometry leaves the indices of the others alone; its index is
+ reused by the next geometry added, which starts out unfiltered.  */
+TEST_F(CollisionFilterTest, IndexReuse) {
+  CollisionFilter filter;
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  const GeometryId id_C = GeometryId::get_new_id();
+  filter.AddGeometry(id_A);
+  filter.AddGeometry(id_B);
+  filter.AddGeometry(id_C);
+  const int index_A = filter.GetIndex(id_A);
+  const int index_B = filter.GetIndex(id_B);
+  const int index_C = filter.GetIndex(id_C);
+  EXPECT_NE(index_A, index_B);
+  EXPECT_NE(index_A, index_C);
+  EXPECT_NE(index_B, index_C);
+
+  filter.Apply(CollisionFilterDeclaration().ExcludeWithin(
+                   GeometrySet{id_A, id_B, id_C}),
+               get_extract_ids_functor());
+  filter.RemoveGeometry(id_B);
+  EXPECT_EQ(filter.GetIndex(id_A), index_A);
+  EXPECT_EQ(filter.GetIndex(id_C), index_C);
+  EXPECT_FALSE(filter.CanCollideWith(index_A, index_C));
+
+  const GeometryId id_D = GeometryId::get_new_id();
+  filter.AddGeometry(id_D);
+  EXPECT_EQ(filter.GetIndex(id_D), index_B);
+  EXPECT_TRUE(filter.CanCollideWith(index_A, index_B));
+  EXPECT_TRUE(filter.CanCollideWith(index_C, index_B));
+  EXPECT_FALSE(filter.CanCollideWith(index_B, index_B));
+}
+
 }  // namespace internal
 }  // namespace geometry
 }  // namespace drake
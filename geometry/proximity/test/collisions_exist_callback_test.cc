@@ -46,12 +46,15 @@ using std::make_shared;
 GTEST_TEST(CollisionsExistCallback, Exist) {
   CollisionFilter collision_filter;
 
-  const EncodedData data_A(GeometryId::get_new_id(), true);
-  const EncodedData data_B(GeometryId::get_new_id(), true);
-  const EncodedData data_C(GeometryId::get_new_id(), true);
-  collision_filter.AddGeometry(data_A.id());
-  collision_filter.AddGeometry(data_B.id());
-  collision_filter.AddGeometry(data_C.id());
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  const GeometryId id_C = GeometryId::get_new_id();
+  collision_filter.AddGeometry(id_A);
+  collision_filter.AddGeometry(id_B);
+  collision_filter.AddGeometry(id_C);
+  const EncodedData data_A(id_A, true, collision_filter.GetIndex(id_A));
+  const EncodedData data_B(id_B, true, collision_filter.GetIndex(id_B));
+  const EncodedData data_C(id_C, true, collision_filter.GetIndex(id_C));
 
   CollisionObjectd box_A(make_shared<Boxd>(0.25, 0.3, 0.4));
   data_A.write_to(&box_A);
@@ -88,10 +91,12 @@ GTEST_TEST(CollisionsExistCallback, Exist) {
 GTEST_TEST(CollisionsExistCallback, RespectsCollisionFilter) {
   CollisionFilter collision_filter;
 
-  EncodedData data_A(GeometryId::get_new_id(), true);
-  EncodedData data_B(GeometryId::get_new_id(), true);
-  collision_filter.AddGeometry(data_A.id());
-  collision_filter.AddGeometry(data_B.id());
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  collision_filter.AddGeometry(id_A);
+  collision_filter.AddGeometry(id_B);
+  const EncodedData data_A(id_A, true, collision_filter.GetIndex(id_A));
+  const EncodedData data_B(id_B, true, collision_filter.GetIndex(id_B));
 
   CollisionObjectd box_A(make_shared<Boxd>(0.25, 0.3, 0.4));
   data_A.write_to(&box_A);
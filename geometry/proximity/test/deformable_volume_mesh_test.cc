@@ -169,6 +169,19 @@ TYPED_TEST(DeformableVolumeMeshTest, CopyAssignment) {
   EXPECT_NE(&dut.bvh(), &small.bvh());
   EXPECT_TRUE(dut.bvh().Equal(small.bvh()));
 
+  /* The bvh updater's state comes along with the bvh, even though the
+   hierarchies have the same size.  */
+  DeformableVolumeMesh<T> updated(this->MakeBox());
+  updated.set_bvh_update_policy({.full_rebuild_ratio = 2.0});
+  updated.UpdateVertexPositions(
+      this->ExtractVertexPositions(this->MakeBox(0.5)));
+  DeformableVolumeMesh<T> assigned(this->MakeBox(2.0));
+  ASSERT_EQ(assigned.bvh().num_nodes(), updated.bvh().num_nodes());
+  assigned = updated;
+  EXPECT_EQ(assigned.bvh_update_statistics().num_updates, 1);
+  EXPECT_EQ(assigned.bvh_update_statistics().last_degradation,
+            updated.bvh_update_statistics().last_degradation);
+
   /* Moving copy's vertex positions leaves mesh_'s vertex positions in place.
    We'll create a scaled version of the box and use its vertex positions. */
   constexpr double kScale = 0.25;
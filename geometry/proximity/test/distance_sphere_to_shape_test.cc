@@ -482,10 +482,10 @@ class CallbackScalarSupport : public ::testing::Test {
     // Populate the callback data structures.
     const GeometryId id_A = GeometryId::get_new_id();
     const GeometryId id_B = GeometryId::get_new_id();
-    EncodedData data_A(id_A, true);
-    EncodedData data_B(id_B, true);
-    collision_filter_.AddGeometry(data_A.id());
-    collision_filter_.AddGeometry(data_B.id());
+    collision_filter_.AddGeometry(id_A);
+    collision_filter_.AddGeometry(id_B);
+    EncodedData data_A(id_A, true, collision_filter_.GetIndex(id_A));
+    EncodedData data_B(id_B, true, collision_filter_.GetIndex(id_B));
     X_WGs_[id_A] = RigidTransform<T>{Translation3<T>{10, 11, 12}};
     X_WGs_[id_B] = RigidTransform<T>::Identity();
 
@@ -620,10 +620,10 @@ GTEST_TEST(Callback, ScalarSupportWithFilters) {
   const GeometryId id_B = GeometryId::get_new_id();
   CollisionFilter collision_filter;
 
-  EncodedData data_A(id_A, true);
-  EncodedData data_B(id_B, true);
-  collision_filter.AddGeometry(data_A.id());
-  collision_filter.AddGeometry(data_B.id());
+  collision_filter.AddGeometry(id_A);
+  collision_filter.AddGeometry(id_B);
+  EncodedData data_A(id_A, true, collision_filter.GetIndex(id_A));
+  EncodedData data_B(id_B, true, collision_filter.GetIndex(id_B));
 
   // Filter the pair (A, B); we'll put the ids in a set and simply return that
   // set for the extract ids function.
@@ -656,8 +656,11 @@ GTEST_TEST(Callback, RespectCollisionFiltering) {
   const GeometryId id_B = GeometryId::get_new_id();
   CollisionObjectd sphere_A(make_shared<Sphered>(0.25));
   CollisionObjectd sphere_B(make_shared<Sphered>(0.25));
-  EncodedData data_A(id_A, true);
-  EncodedData data_B(id_B, true);
+  CollisionFilter collision_filter;
+  collision_filter.AddGeometry(id_A);
+  collision_filter.AddGeometry(id_B);
+  EncodedData data_A(id_A, true, collision_filter.GetIndex(id_A));
+  EncodedData data_B(id_B, true, collision_filter.GetIndex(id_B));
   data_A.write_to(&sphere_A);
   data_B.write_to(&sphere_B);
   const std::unordered_map<GeometryId, RigidTransformd> X_WGs{
@@ -665,9 +668,6 @@ GTEST_TEST(Callback, RespectCollisionFiltering) {
       {id_B, RigidTransformd::Identity()}};
 
   std::vector<SignedDistancePair<double>> results;
-  CollisionFilter collision_filter;
-  collision_filter.AddGeometry(data_A.id());
-  collision_filter.AddGeometry(data_B.id());
 
   CallbackData<double> data{&collision_filter, &X_WGs, kInf, &results};
 
@@ -700,16 +700,16 @@ GTEST_TEST(Callback, ABOrdering) {
   const GeometryId id_B = GeometryId::get_new_id();
   CollisionObjectd sphere_A(make_shared<Sphered>(0.25));
   CollisionObjectd sphere_B(make_shared<Sphered>(0.25));
-  EncodedData data_A(id_A, true);
-  EncodedData data_B(id_B, true);
+  CollisionFilter collision_filter;
+  collision_filter.AddGeometry(id_A);
+  collision_filter.AddGeometry(id_B);
+  EncodedData data_A(id_A, true, collision_filter.GetIndex(id_A));
+  EncodedData data_B(id_B, true, collision_filter.GetIndex(id_B));
   data_A.write_to(&sphere_A);
   data_B.write_to(&sphere_B);
   const std::unordered_map<GeometryId, RigidTransformd> X_WGs{
       {id_A, RigidTransformd{Vector3d{10, 11, 12}}},
       {id_B, RigidTransformd::Identity()}};
-  CollisionFilter collision_filter;
-  collision_filter.AddGeometry(data_A.id());
-  collision_filter.AddGeometry(data_B.id());
   double threshold = std::numeric_limits<double>::max();
 
   // Pass in the two geometries in order (A, B).
@@ -750,10 +750,10 @@ TYPED_TEST(CallbackMaxDistanceTest, MaxDistanceThreshold) {
 
   const GeometryId id_A = GeometryId::get_new_id();
   const GeometryId id_B = GeometryId::get_new_id();
-  EncodedData data_A(id_A, true);
-  EncodedData data_B(id_B, true);
-  collision_filter.AddGeometry(data_A.id());
-  collision_filter.AddGeometry(data_B.id());
+  collision_filter.AddGeometry(id_A);
+  collision_filter.AddGeometry(id_B);
+  EncodedData data_A(id_A, true, collision_filter.GetIndex(id_A));
+  EncodedData data_B(id_B, true, collision_filter.GetIndex(id_B));
 
   // Two spheres with arbitrary radii. One is at the origin and the other is
   // placed at two distances: one just inside the max distance and one just
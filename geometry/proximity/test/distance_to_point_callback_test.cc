@@ -1,10 +1,15 @@
 #include "drake/geometry/proximity/distance_to_point_callback.h"
 
+#include <random>
+#include <utility>
+#include <vector>
+
 #include <fcl/fcl.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
 #include "drake/geometry/proximity/proximity_utilities.h"
 #include "drake/geometry/utilities.h"
 #include "drake/math/autodiff_gradient.h"
@@ -716,6 +721,141 @@ GTEST_TEST(DistanceToPoint, ScalarShapeSupportAutoDiff) {
   TestScalarShapeSupport<AutoDiffXd>();
 }
 
+// Confirms that the batched ComputeDistancesToPoints() reports, for every
+// point, what DistanceToPoint reports for that point alone (up to round-off).
+// The query points include the shapes' special cases -- the centers, center
+// lines, faces, edges, and corners where the reported gradient is a
+// convention -- and a cloud of arbitrary points inside and outside.
+template <typename T>
+void TestComputeDistancesToPoints() {
+  const double kTolerance = 1e-14;
+  const RigidTransform<T> X_WG =
+      RigidTransformd(RotationMatrix<double>(AngleAxis<double>(
+                          M_PI / 5, Vector3d{1, 2, 3}.normalized())),
+                      Vector3d{0.5, 1.25, -2})
+          .cast<T>();
+
+  // The shapes below are sized so that these points land on their features:
+  // box half sizes (0.5, 1, 1.75), capsule and cylinder radius 1 and half
+  // length 1, sphere radius 1, and the halfspace z ≤ 0.
+  std::vector<Vector3d> p_GQs{
+      {0, 0, 0},     {0.5, 0, 0},     {0, -1, 0},    {0, 0, 1.75},
+      {0.5, 1, 0},   {0.5, -1, 1.75}, {0, 0, 1},     {0, 0, -1},
+      {0, 0, 0.25},  {0, 0, 3},       {1, 0, 0.5},   {0.6, 0.8, 1},
+      {0.6, 0.8, 0}, {2, 0, 1},       {0.25, 0.5, 0}};
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> coordinate(-3, 3);
+  for (int i = 0; i < 200; ++i) {
+    p_GQs.emplace_back(coordinate(generator), coordinate(generator),
+                       coordinate(generator));
+  }
+  const int num_points = static_cast<int>(p_GQs.size());
+  Matrix3X<T> p_WQs(3, num_points);
+  for (int i = 0; i < num_points; ++i) {
+    p_WQs.col(i) = X_WG * p_GQs[i].cast<T>();
+  }
+
+  const GeometryId id = GeometryId::get_new_id();
+  auto run_test = [&](auto geometry_shared_ptr, int expected_result) {
+    fcl::CollisionObjectd object(geometry_shared_ptr);
+    EncodedData(id, true).write_to(&object);
+    SCOPED_TRACE(GetGeometryName(object));
+
+    std::vector<std::pair<int, SignedDistanceToPoint<T>>> distances;
+    ComputeDistancesToPoints(object, X_WG, p_WQs,
+                             std::numeric_limits<double>::infinity(),
+                             &distances);
+    ASSERT_EQ(distances.size(), expected_result * num_points);
+    int num_non_positive = 0;
+    for (int i = 0; i < static_cast<int>(distances.size()); ++i) {
+      const auto& [point_index, distance] = distances[i];
+      ASSERT_EQ(point_index, i);
+      const SignedDistanceToPoint<T> expected =
+          DistanceToPoint<T>(id, X_WG, p_WQs.col(i))(*geometry_shared_ptr);
+      EXPECT_EQ(distance.id_G, id);
+      EXPECT_NEAR(ExtractDoubleOrThrow(distance.distance),
+                  ExtractDoubleOrThrow(expected.distance), kTolerance);
+      EXPECT_TRUE(CompareMatrices(math::DiscardGradient(distance.p_GN),
+                                  math::DiscardGradient(expected.p_GN),
+                                  kTolerance));
+      EXPECT_TRUE(CompareMatrices(math::DiscardGradient(distance.grad_W),
+                                  math::DiscardGradient(expected.grad_W),
+                                  kTolerance));
+      if (distance.distance <= 0) ++num_non_positive;
+    }
+
+    // A threshold of zero only reports the points inside or on the shape.
+    distances.clear();
+    ComputeDistancesToPoints(object, X_WG, p_WQs, 0.0, &distances);
+    EXPECT_EQ(distances.size(), num_non_positive);
+    for (const auto& [point_index, distance] : distances) {
+      EXPECT_LE(distance.distance, 0);
+    }
+  };
+
+  run_test(make_shared<fcl::Boxd>(1.0, 2.0, 3.5), 1);
+  run_test(make_shared<fcl::Capsuled>(1.0, 2.0), 1);
+  run_test(make_shared<fcl::Cylinderd>(1.0, 2.0), ExpectedCylinderResult<T>());
+  run_test(make_shared<fcl::Halfspaced>(Vector3d::UnitZ(), 0), 1);
+  run_test(make_shared<fcl::Sphered>(1.0), 1);
+}
+
+GTEST_TEST(DistanceToPoint, ComputeDistancesToPointsDouble) {
+  TestComputeDistancesToPoints<double>();
+}
+
+// The autodiff version of DistanceToPoint.ComputeDistancesToPointsDouble.
+GTEST_TEST(DistanceToPoint, ComputeDistancesToPointsAutoDiff) {
+  TestComputeDistancesToPoints<AutoDiffXd>();
+}
+
+// Geometries with a signed distance field are evaluated with it: the result
+// approximates the exact distance to the shape the field was built from.
+GTEST_TEST(DistanceToPoint, SignedDistanceField) {
+  const fcl::Boxd box(1.0, 2.0, 3.5);
+  const double resolution = 0.02;
+  const SignedDistanceField field(
+      MakeBoxSurfaceMesh<double>(Box(1.0, 2.0, 3.5), 10.0),
+      {.resolution = resolution, .band_width = 0.1});
+  const RigidTransformd X_WG(
+      RotationMatrix<double>(AngleAxis<double>(M_PI / 5,
+                                               Vector3d{1, 2, 3}.normalized())),
+      Vector3d{0.5, 1.25, -2});
+  const GeometryId id = GeometryId::get_new_id();
+
+  // Points near the faces (inside and outside), away from edges and corners.
+  const std::vector<Vector3d> p_GQs{{0.53, 0.2, -0.4},
+                                    {0.46, -0.1, 0.3},
+                                    {0.1, -1.04, 0.5},
+                                    {-0.2, 0.3, 1.72}};
+  Matrix3X<double> p_WQs(3, p_GQs.size());
+  for (int i = 0; i < static_cast<int>(p_GQs.size()); ++i) {
+    p_WQs.col(i) = X_WG * p_GQs[i];
+    const SignedDistanceToPoint<double> expected =
+        DistanceToPoint<double>(id, X_WG, p_WQs.col(i))(box);
+    const SignedDistanceToPoint<double> distance =
+        ComputeDistanceToField(field, id, X_WG, Vector3d(p_WQs.col(i)));
+    EXPECT_EQ(distance.id_G, id);
+    EXPECT_NEAR(distance.distance, expected.distance, 1e-6);
+    EXPECT_TRUE(CompareMatrices(distance.p_GN, expected.p_GN, 1e-5));
+    EXPECT_TRUE(CompareMatrices(distance.grad_W, expected.grad_W, 1e-5));
+  }
+
+  // The batched evaluation uses the field, whatever the fcl shape.
+  fcl::CollisionObjectd object(make_shared<fcl::Sphered>(0.1));
+  EncodedData(id, true).write_to(&object);
+  std::vector<std::pair<int, SignedDistanceToPoint<double>>> distances;
+  ComputeDistancesToPoints(object, X_WG, p_WQs, 0.0, &distances, &field);
+  ASSERT_EQ(distances.size(), 2);
+  for (const auto& [point_index, distance] : distances) {
+    EXPECT_EQ(distance.distance,
+              ComputeDistanceToField(field, id, X_WG,
+                                     Vector3d(p_WQs.col(point_index)))
+                  .distance);
+    EXPECT_LE(distance.distance, 0);
+  }
+}
+
 }  // namespace
 }  // namespace point_distance
 }  // namespace internal
@@ -26,10 +26,10 @@ GTEST_TEST(Callback, PairsProperlyFormed) {
   const GeometryId id_B = GeometryId::get_new_id();
   CollisionFilter collision_filter;
 
-  EncodedData data_A(id_A, true);
-  EncodedData data_B(id_B, true);
-  collision_filter.AddGeometry(data_A.id());
-  collision_filter.AddGeometry(data_B.id());
+  collision_filter.AddGeometry(id_A);
+  collision_filter.AddGeometry(id_B);
+  EncodedData data_A(id_A, true, collision_filter.GetIndex(id_A));
+  EncodedData data_B(id_B, true, collision_filter.GetIndex(id_B));
 
   CollisionObjectd box_A(make_shared<Boxd>(0.25, 0.3, 0.4));
   data_A.write_to(&box_A);
@@ -55,10 +55,12 @@ GTEST_TEST(Callback, PairsProperlyFormed) {
 GTEST_TEST(Callback, RespectsCollisionFilter) {
   CollisionFilter collision_filter;
 
-  EncodedData data_A(GeometryId::get_new_id(), true);
-  EncodedData data_B(GeometryId::get_new_id(), true);
-  collision_filter.AddGeometry(data_A.id());
-  collision_filter.AddGeometry(data_B.id());
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  collision_filter.AddGeometry(id_A);
+  collision_filter.AddGeometry(id_B);
+  EncodedData data_A(id_A, true, collision_filter.GetIndex(id_A));
+  EncodedData data_B(id_B, true, collision_filter.GetIndex(id_B));
   // Filter the pair (A, B); we'll put the ids in a set and simply return that
   // set for the extract ids function.
   std::unordered_set<GeometryId> ids{data_A.id(), data_B.id()};
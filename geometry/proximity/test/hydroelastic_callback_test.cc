@@ -94,10 +94,10 @@ class TestScene {
 
   void AddGeometry(const HydroelasticType type_A,
                    const HydroelasticType type_B) {
-    EncodedData data_A(id_A_, true);
-    EncodedData data_B(id_B_, true);
-    collision_filter_.AddGeometry(data_A.id());
-    collision_filter_.AddGeometry(data_B.id());
+    collision_filter_.AddGeometry(id_A_);
+    collision_filter_.AddGeometry(id_B_);
+    EncodedData data_A(id_A_, true, collision_filter_.GetIndex(id_A_));
+    EncodedData data_B(id_B_, true, collision_filter_.GetIndex(id_B_));
 
     shape_A_ = MakeShape(id_A_, type_A, shape_A_type_, &data_A);
     shape_B_ = MakeShape(id_B_, type_B, shape_B_type_, &data_B);
@@ -786,6 +786,45 @@ TYPED_TEST(HydroelasticCallbackFallbackTyped, ValidPairProducesResult) {
   EXPECT_EQ(point_pairs.size(), 0u);
 }
 
+// Tests the bookkeeping of the CoherenceCache: entries are keyed by unordered
+// pairs of ids, survive only the round after the one in which they were last
+// accessed, and can be removed by geometry id.
+GTEST_TEST(CoherenceCacheTest, Bookkeeping) {
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  const GeometryId id_C = GeometryId::get_new_id();
+
+  CoherenceCache cache;
+  EXPECT_EQ(cache.size(), 0);
+
+  cache.BeginRound();
+  MeshIntersectionCoherence& coherence_AB = cache.get(id_A, id_B);
+  coherence_AB.num_faces = 17;
+  // The order of the ids doesn't matter.
+  EXPECT_EQ(&cache.get(id_B, id_A), &coherence_AB);
+  EXPECT_EQ(cache.get(id_B, id_A).num_faces, 17);
+  cache.get(id_A, id_C);
+  cache.get(id_B, id_C);
+  EXPECT_EQ(cache.size(), 3);
+
+  // Entries accessed in the previous round survive the start of a new round.
+  cache.BeginRound();
+  EXPECT_EQ(cache.size(), 3);
+  EXPECT_EQ(cache.get(id_A, id_B).num_faces, 17);
+  cache.get(id_A, id_C);
+
+  // Only the pair (B, C) wasn't accessed in the last round.
+  cache.BeginRound();
+  EXPECT_EQ(cache.size(), 2);
+
+  // Removing a geometry removes all of the pairs it belongs to.
+  cache.Remove(id_C);
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.get(id_A, id_B).num_faces, 17);
+  cache.Remove(id_A);
+  EXPECT_EQ(cache.size(), 0);
+}
+
 }  // namespace
 }  // namespace hydroelastic
 }  // namespace internal
@@ -1,13 +1,17 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 
 #include <cmath>
+#include <fstream>
 #include <functional>
 #include <limits>
+#include <string>
 
 #include <fmt/format.h>
 #include <gtest/gtest.h>
 
+#include "drake/common/filesystem.h"
 #include "drake/common/find_resource.h"
+#include "drake/common/temp_directory.h"
 #include "drake/common/test_utilities/expect_no_throw.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/proximity/make_sphere_field.h"
@@ -43,10 +47,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
     SoftMesh copy;
     copy = original;
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable data.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -65,10 +69,10 @@ GTEST_TEST(SoftMeshTest, TestCopyMoveAssignConstruct) {
   {
     SoftMesh copy(original);
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure(), &copy.pressure());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable data.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure(), &copy.pressure());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
 
@@ -138,10 +142,10 @@ GTEST_TEST(SoftGeometryTest, TestCopyMoveAssignConstruct) {
     SoftGeometry dut(SoftHalfSpace{1e+7});
     dut = original;
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &dut.mesh());
-    EXPECT_NE(&original.pressure_field(), &dut.pressure_field());
-    EXPECT_NE(&original.bvh(), &dut.bvh());
+    // Copies share the immutable data.
+    EXPECT_EQ(&original.mesh(), &dut.mesh());
+    EXPECT_EQ(&original.pressure_field(), &dut.pressure_field());
+    EXPECT_EQ(&original.bvh(), &dut.bvh());
 
     EXPECT_TRUE(dut.mesh().Equal(original.mesh()));
     const auto& copy_pressure =
@@ -158,10 +162,10 @@ GTEST_TEST(SoftGeometryTest, TestCopyMoveAssignConstruct) {
   {
     SoftGeometry copy(original);
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.pressure_field(), &copy.pressure_field());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable data.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.pressure_field(), &copy.pressure_field());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     const auto& copy_pressure =
@@ -219,9 +223,9 @@ GTEST_TEST(RigidMeshTest, TestCopyMoveAssignConstruct) {
     RigidMesh copy;
     copy = original;
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable data.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -231,9 +235,9 @@ GTEST_TEST(RigidMeshTest, TestCopyMoveAssignConstruct) {
   {
     RigidMesh copy(original);
 
-    // Test for uniqueness.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable data.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -283,9 +287,9 @@ GTEST_TEST(RigidGeometryTest, TestCopyMoveAssignConstruct) {
     RigidGeometry dut(HalfSpace{});
     dut = original;
 
-    // Test for uniqueness. The contents have different memory addresses.
-    EXPECT_NE(&original.mesh(), &dut.mesh());
-    EXPECT_NE(&original.bvh(), &dut.bvh());
+    // Copies share the immutable data.
+    EXPECT_EQ(&original.mesh(), &dut.mesh());
+    EXPECT_EQ(&original.bvh(), &dut.bvh());
 
     EXPECT_TRUE(dut.mesh().Equal(original.mesh()));
     EXPECT_TRUE(dut.bvh().Equal(original.bvh()));
@@ -295,9 +299,9 @@ GTEST_TEST(RigidGeometryTest, TestCopyMoveAssignConstruct) {
   {
     RigidGeometry copy(original);
 
-    // Test for uniqueness. Their contents are at different memory addresses.
-    EXPECT_NE(&original.mesh(), &copy.mesh());
-    EXPECT_NE(&original.bvh(), &copy.bvh());
+    // Copies share the immutable data.
+    EXPECT_EQ(&original.mesh(), &copy.mesh());
+    EXPECT_EQ(&original.bvh(), &copy.bvh());
 
     EXPECT_TRUE(copy.mesh().Equal(original.mesh()));
     EXPECT_TRUE(copy.bvh().Equal(original.bvh()));
@@ -412,6 +416,229 @@ GTEST_TEST(Hydroelastic, RemoveGeometry) {
   }
 }
 
+// Identical declarations share a single representation, through the global
+// RepresentationCache.
+GTEST_TEST(Hydroelastic, GeometriesShareRepresentations) {
+  RepresentationCache::Global().Clear();
+
+  ProximityProperties rigid_properties;
+  AddRigidHydroelasticProperties(0.25, &rigid_properties);
+  ProximityProperties soft_properties;
+  AddContactMaterial(1e8, {}, {}, &soft_properties);
+  AddSoftHydroelasticProperties(0.25, &soft_properties);
+  ProximityProperties finer_soft_properties;
+  AddContactMaterial(1e8, {}, {}, &finer_soft_properties);
+  AddSoftHydroelasticProperties(0.125, &finer_soft_properties);
+
+  const GeometryId rigid_id = GeometryId::get_new_id();
+  const GeometryId soft_id = GeometryId::get_new_id();
+  Geometries first;
+  first.MaybeAddGeometry(Sphere(0.5), rigid_id, rigid_properties);
+  first.MaybeAddGeometry(Sphere(0.5), soft_id, soft_properties);
+  EXPECT_EQ(RepresentationCache::Global().size(), 2);
+
+  const GeometryId rigid_id2 = GeometryId::get_new_id();
+  const GeometryId soft_id2 = GeometryId::get_new_id();
+  const GeometryId finer_id = GeometryId::get_new_id();
+  const GeometryId larger_id = GeometryId::get_new_id();
+  Geometries second;
+  second.MaybeAddGeometry(Sphere(0.5), rigid_id2, rigid_properties);
+  second.MaybeAddGeometry(Sphere(0.5), soft_id2, soft_properties);
+  second.MaybeAddGeometry(Sphere(0.5), finer_id, finer_soft_properties);
+  second.MaybeAddGeometry(Sphere(0.75), larger_id, soft_properties);
+  EXPECT_EQ(RepresentationCache::Global().size(), 4);
+
+  EXPECT_EQ(&first.rigid_geometry(rigid_id).mesh(),
+            &second.rigid_geometry(rigid_id2).mesh());
+  EXPECT_EQ(&first.soft_geometry(soft_id).mesh(),
+            &second.soft_geometry(soft_id2).mesh());
+  EXPECT_EQ(&first.soft_geometry(soft_id).pressure_field(),
+            &second.soft_geometry(soft_id2).pressure_field());
+  // Any difference in the shape or the properties produces a distinct
+  // representation.
+  EXPECT_NE(&first.soft_geometry(soft_id).mesh(),
+            &second.soft_geometry(finer_id).mesh());
+  EXPECT_NE(&first.soft_geometry(soft_id).mesh(),
+            &second.soft_geometry(larger_id).mesh());
+  EXPECT_GT(second.soft_geometry(finer_id).mesh().num_elements(),
+            second.soft_geometry(soft_id2).mesh().num_elements());
+
+  // Copies of the collection share the representations as well.
+  const Geometries copy(second);
+  EXPECT_EQ(&copy.soft_geometry(finer_id).mesh(),
+            &second.soft_geometry(finer_id).mesh());
+
+  // Malformed properties are still reported (and nothing is cached).
+  ProximityProperties bad_properties;
+  AddSoftHydroelasticProperties(0.25, &bad_properties);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      second.MaybeAddGeometry(Sphere(2), GeometryId::get_new_id(),
+                              bad_properties),
+      ".*missing the .+'elastic_modulus'.+ property");
+  EXPECT_EQ(RepresentationCache::Global().size(), 4);
+
+  RepresentationCache::Global().Clear();
+  EXPECT_EQ(RepresentationCache::Global().size(), 0);
+}
+
+// The hierarchies of the representations are built per the Bvh properties; the
+// strategy distinguishes representations, but the number of threads doesn't.
+GTEST_TEST(Hydroelastic, BvhBuildProperties) {
+  RepresentationCache::Global().Clear();
+
+  ProximityProperties default_properties;
+  AddContactMaterial(1e8, {}, {}, &default_properties);
+  AddSoftHydroelasticProperties(0.25, &default_properties);
+  ProximityProperties sah_properties(default_properties);
+  sah_properties.AddProperty(kHydroGroup, kBvhBuildStrategy,
+                             BvhBuildStrategy::kSurfaceAreaHeuristic);
+  ProximityProperties threaded_properties(default_properties);
+  threaded_properties.AddProperty(kHydroGroup, kBvhBuildThreads, 3);
+
+  const GeometryId default_id = GeometryId::get_new_id();
+  const GeometryId sah_id = GeometryId::get_new_id();
+  const GeometryId threaded_id = GeometryId::get_new_id();
+  Geometries geometries;
+  geometries.MaybeAddGeometry(Sphere(0.5), default_id, default_properties);
+  geometries.MaybeAddGeometry(Sphere(0.5), sah_id, sah_properties);
+  geometries.MaybeAddGeometry(Sphere(0.5), threaded_id, threaded_properties);
+  EXPECT_EQ(RepresentationCache::Global().size(), 2);
+
+  const BvhBuildOptions& default_options =
+      geometries.soft_geometry(default_id).bvh().build_options();
+  EXPECT_EQ(default_options.strategy, BvhBuildStrategy::kMedianSplit);
+  EXPECT_EQ(default_options.num_threads, 1);
+  EXPECT_EQ(geometries.soft_geometry(sah_id).bvh().build_options().strategy,
+            BvhBuildStrategy::kSurfaceAreaHeuristic);
+  EXPECT_EQ(&geometries.soft_geometry(threaded_id).mesh(),
+            &geometries.soft_geometry(default_id).mesh());
+
+  // Without the cache, the number of threads reaches the hierarchy.
+  ProximityProperties rigid_properties;
+  AddRigidHydroelasticProperties(0.25, &rigid_properties);
+  rigid_properties.AddProperty(kHydroGroup, kBvhBuildThreads, 3);
+  const std::optional<RigidGeometry> rigid =
+      MakeRigidRepresentation(Sphere(0.5), rigid_properties);
+  ASSERT_TRUE(rigid.has_value());
+  EXPECT_EQ(rigid->bvh().build_options().num_threads, 3);
+
+  RepresentationCache::Global().Clear();
+}
+
+GTEST_TEST(RepresentationCacheTest, LeastRecentlyUsed) {
+  RepresentationCache cache;
+  EXPECT_EQ(cache.capacity(), RepresentationCache::kDefaultCapacity);
+  EXPECT_EQ(cache.disk_cache_directory(), "");
+
+  int num_made = 0;
+  auto make = [&num_made]() {
+    ++num_made;
+    return std::optional<RigidGeometry>(RigidGeometry(RigidMesh(
+        make_unique<SurfaceMesh<double>>(
+            MakeSphereSurfaceMesh<double>(Sphere(1.0), 1.0)))));
+  };
+
+  cache.set_capacity(2);
+  const auto a = cache.GetOrMakeRigid("a", false, make);
+  ASSERT_TRUE(a.has_value());
+  EXPECT_EQ(&cache.GetOrMakeRigid("a", false, make)->mesh(), &a->mesh());
+  cache.GetOrMakeRigid("b", false, make);
+  EXPECT_EQ(num_made, 2);
+  EXPECT_EQ(cache.size(), 2);
+
+  // Using "a" makes "b" the least recently used, so "c" replaces "b".
+  cache.GetOrMakeRigid("a", false, make);
+  cache.GetOrMakeRigid("c", false, make);
+  EXPECT_EQ(num_made, 3);
+  EXPECT_EQ(&cache.GetOrMakeRigid("a", false, make)->mesh(), &a->mesh());
+  EXPECT_EQ(num_made, 3);
+  cache.GetOrMakeRigid("b", false, make);
+  EXPECT_EQ(num_made, 4);
+
+  // Shrinking the cache drops the least recently used entries.
+  cache.set_capacity(1);
+  EXPECT_EQ(cache.size(), 1);
+  cache.GetOrMakeRigid("b", false, make);
+  EXPECT_EQ(num_made, 4);
+
+  // Unsupported representations (and errors) are not cached.
+  auto make_nothing = []() { return std::optional<RigidGeometry>(); };
+  EXPECT_FALSE(cache.GetOrMakeRigid("d", false, make_nothing).has_value());
+  auto make_error = []() -> std::optional<RigidGeometry> {
+    throw std::logic_error("bad properties");
+  };
+  DRAKE_EXPECT_THROWS_MESSAGE(cache.GetOrMakeRigid("e", false, make_error),
+                              "bad properties");
+  EXPECT_EQ(cache.size(), 1);
+
+  // A zero capacity disables caching.
+  cache.set_capacity(0);
+  EXPECT_EQ(cache.size(), 0);
+  cache.GetOrMakeRigid("b", false, make);
+  cache.GetOrMakeRigid("b", false, make);
+  EXPECT_EQ(num_made, 6);
+}
+
+GTEST_TEST(RepresentationCacheTest, DiskCache) {
+  const std::string directory = temp_directory();
+  const Sphere sphere(0.5);
+  int num_made = 0;
+  auto make_soft = [&num_made, &sphere]() {
+    ++num_made;
+    auto mesh = make_unique<VolumeMesh<double>>(MakeSphereVolumeMesh<double>(
+        sphere, 0.25, TessellationStrategy::kDenseInteriorVertices));
+    auto pressure = make_unique<VolumeMeshFieldLinear<double, double>>(
+        MakeSpherePressureField(sphere, mesh.get(), 1e7));
+    return std::optional<SoftGeometry>(
+        SoftGeometry(SoftMesh(std::move(mesh), std::move(pressure))));
+  };
+  auto make_rigid = [&num_made, &sphere]() {
+    ++num_made;
+    return std::optional<RigidGeometry>(RigidGeometry(RigidMesh(
+        make_unique<SurfaceMesh<double>>(
+            MakeSphereSurfaceMesh<double>(sphere, 0.25)))));
+  };
+
+  RepresentationCache writer;
+  writer.set_disk_cache_directory(directory);
+  const auto soft = writer.GetOrMakeSoft("soft", true, make_soft);
+  const auto rigid = writer.GetOrMakeRigid("rigid", true, make_rigid);
+  // Representations that are not to be persisted are not written.
+  writer.GetOrMakeRigid("transient", false, make_rigid);
+  EXPECT_EQ(num_made, 3);
+
+  // Another cache (e.g., in another process) reads the files rather than
+  // remaking the representations; they are identical to the originals.
+  RepresentationCache reader;
+  reader.set_disk_cache_directory(directory);
+  const auto soft_read = reader.GetOrMakeSoft("soft", true, make_soft);
+  const auto rigid_read = reader.GetOrMakeRigid("rigid", true, make_rigid);
+  EXPECT_EQ(num_made, 3);
+  ASSERT_TRUE(soft_read.has_value());
+  EXPECT_TRUE(soft_read->mesh().Equal(soft->mesh()));
+  EXPECT_TRUE(soft_read->pressure_field().Equal(soft->pressure_field()));
+  EXPECT_TRUE(soft_read->bvh().Equal(soft->bvh()));
+  ASSERT_TRUE(rigid_read.has_value());
+  EXPECT_TRUE(rigid_read->mesh().Equal(rigid->mesh()));
+  EXPECT_TRUE(rigid_read->bvh().Equal(rigid->bvh()));
+  reader.GetOrMakeRigid("transient", true, make_rigid);
+  EXPECT_EQ(num_made, 4);
+
+  // Corrupt files are ignored (and rewritten).
+  for (const auto& entry : filesystem::directory_iterator(directory)) {
+    std::ofstream(entry.path().string(), std::ios::binary) << "garbage";
+  }
+  RepresentationCache recovering;
+  recovering.set_disk_cache_directory(directory);
+  const auto soft_remade = recovering.GetOrMakeSoft("soft", true, make_soft);
+  EXPECT_EQ(num_made, 5);
+  EXPECT_TRUE(soft_remade->mesh().Equal(soft->mesh()));
+  RepresentationCache final_reader;
+  final_reader.set_disk_cache_directory(directory);
+  final_reader.GetOrMakeSoft("soft", true, make_soft);
+  EXPECT_EQ(num_made, 5);
+}
+
 class HydroelasticRigidGeometryTest : public ::testing::Test {
  protected:
   /* Creates a simple set of properties for generating rigid geometry. */
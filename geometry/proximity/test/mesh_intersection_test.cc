@@ -13,6 +13,10 @@
 #include "drake/common/test_utilities/eigen_matrix_compare.h"
 #include "drake/common/test_utilities/expect_throws_message.h"
 #include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/proximity/make_ellipsoid_field.h"
+#include "drake/geometry/proximity/make_ellipsoid_mesh.h"
+#include "drake/geometry/proximity/make_sphere_mesh.h"
+#include "drake/geometry/shape_specification.h"
 #include "drake/math/autodiff.h"
 #include "drake/math/autodiff_gradient.h"
 #include "drake/math/rigid_transform.h"
@@ -42,9 +46,10 @@ class SurfaceVolumeIntersectorTester {
   const std::vector<Vector3<T>>& ClipTriangleByTetrahedron(
       VolumeElementIndex element, const VolumeMesh<double>& volume_M,
       SurfaceFaceIndex face, const SurfaceMesh<double>& surface_N,
-      const math::RigidTransform<T>& X_MN) {
+      const math::RigidTransform<T>& X_MN,
+      TriTetOverlap overlap = TriTetOverlap::kUnknown) {
     return intersect_.ClipTriangleByTetrahedron(element, volume_M, face,
-                                                surface_N, X_MN);
+                                                surface_N, X_MN, overlap);
   }
   bool IsFaceNormalAlongPressureGradient(
       const VolumeMeshFieldLinear<double, double>& volume_field_M,
@@ -715,6 +720,103 @@ GTEST_TEST(MeshIntersectionTest, ClipTriangleByTetrahedronIntoHeptagon) {
   EXPECT_TRUE(CompareConvexPolygon(expect_heptagon_M, polygon_M));
 }
 
+// Tests the conservative classification of triangle-tetrahedron pairs, and
+// confirms that clipping with the classification gives exactly the same
+// polygon as clipping without it.
+GTEST_TEST(MeshIntersectionTest, TriTetBatch) {
+  auto volume_M = TrivialVolumeMesh<double>();
+  auto surface_N = TrivialSurfaceMesh<double>();
+  // A small triangle strictly inside `element0`, i.e., inside the tetrahedron
+  // (Zero(), UnitX(), UnitY(), UnitZ()).
+  unique_ptr<SurfaceMesh<double>> small_surface_N;
+  {
+    const int face_data[3] = {0, 1, 2};
+    std::vector<SurfaceFace> faces{SurfaceFace(face_data)};
+    std::vector<SurfaceVertex<double>> vertices{
+        SurfaceVertex<double>(Vector3d(0.1, 0.1, 0.1)),
+        SurfaceVertex<double>(Vector3d(0.3, 0.1, 0.1)),
+        SurfaceVertex<double>(Vector3d(0.1, 0.3, 0.1))};
+    small_surface_N = std::make_unique<SurfaceMesh<double>>(
+        std::move(faces), std::move(vertices));
+  }
+  const VolumeElementIndex element0(0);
+  const VolumeElementIndex element1(1);
+  const SurfaceFaceIndex face(0);
+
+  struct Case {
+    VolumeElementIndex tet;
+    const SurfaceMesh<double>* surface_N;
+    RigidTransformd X_MN;
+    TriTetOverlap expected;
+  };
+  const std::vector<Case> cases{
+      // Straddles the tetrahedron's boundary.
+      {element0, surface_N.get(), RigidTransformd(Vector3d(0, 0, 0.5)),
+       TriTetOverlap::kUnknown},
+      // Entirely above the face shared by the two tetrahedra.
+      {element1, surface_N.get(), RigidTransformd(Vector3d(0, 0, 0.5)),
+       TriTetOverlap::kDisjoint},
+      // Lies on a face of the tetrahedron; it is not safe to call this either
+      // contained or disjoint.
+      {element0, surface_N.get(), RigidTransformd::Identity(),
+       TriTetOverlap::kUnknown},
+      {element1, surface_N.get(), RigidTransformd::Identity(),
+       TriTetOverlap::kUnknown},
+      // Outside, but with one vertex on a face of the tetrahedron.
+      {element0, surface_N.get(), RigidTransformd(Vector3d::UnitX()),
+       TriTetOverlap::kUnknown},
+      // Far away.
+      {element0, surface_N.get(), RigidTransformd(Vector3d(5, 5, 5)),
+       TriTetOverlap::kDisjoint},
+      {element0, small_surface_N.get(), RigidTransformd::Identity(),
+       TriTetOverlap::kContained},
+      {element1, small_surface_N.get(), RigidTransformd::Identity(),
+       TriTetOverlap::kDisjoint}};
+  ASSERT_EQ(static_cast<int>(cases.size()), TriTetBatch::kCapacity);
+
+  // The transform is per batch; each case gets its own batch, except that we
+  // also fill one batch to capacity to exercise every lane.
+  TriTetBatch full_batch;
+  const RigidTransformd X_MN_small = RigidTransformd::Identity();
+  for (int i = 0; i < TriTetBatch::kCapacity; ++i) {
+    EXPECT_FALSE(full_batch.full());
+    full_batch.Add(cases[i % 2 == 0 ? 6 : 7].tet, *volume_M, face,
+                   *small_surface_N, X_MN_small);
+  }
+  EXPECT_TRUE(full_batch.full());
+  full_batch.Classify();
+  for (int i = 0; i < TriTetBatch::kCapacity; ++i) {
+    EXPECT_EQ(full_batch.tri(i), face);
+    EXPECT_EQ(full_batch.tet(i), i % 2 == 0 ? element0 : element1);
+    EXPECT_EQ(full_batch.overlap(i), i % 2 == 0 ? TriTetOverlap::kContained
+                                                : TriTetOverlap::kDisjoint);
+  }
+  full_batch.Clear();
+  EXPECT_EQ(full_batch.size(), 0);
+
+  for (const Case& c : cases) {
+    TriTetBatch batch;
+    batch.Add(c.tet, *volume_M, face, *c.surface_N, c.X_MN);
+    EXPECT_EQ(batch.size(), 1);
+    batch.Classify();
+    EXPECT_EQ(batch.overlap(0), c.expected);
+
+    const std::vector<Vector3d> expected_polygon =
+        SurfaceVolumeIntersectorTester<double>().ClipTriangleByTetrahedron(
+            c.tet, *volume_M, face, *c.surface_N, c.X_MN);
+    const std::vector<Vector3d> polygon =
+        SurfaceVolumeIntersectorTester<double>().ClipTriangleByTetrahedron(
+            c.tet, *volume_M, face, *c.surface_N, c.X_MN, batch.overlap(0));
+    EXPECT_EQ(polygon, expected_polygon);
+    if (c.expected == TriTetOverlap::kDisjoint) {
+      EXPECT_TRUE(polygon.empty());
+    }
+    if (c.expected == TriTetOverlap::kContained) {
+      EXPECT_EQ(polygon.size(), 3);
+    }
+  }
+}
+
 GTEST_TEST(MeshIntersectionTest, IsFaceNormalAlongPressureGradient) {
   // It is ok to use the trivial mesh and trivial mesh field in this test.
   // The function under test asks for the gradient values and operates on it.
@@ -1034,6 +1136,98 @@ TEST_F(MeshIntersectionFixture, TestComputeContactSurfaceSoftRigid) {
   }
 }
 
+// Tests that the contact surface computed with temporal coherence data is the
+// same as the one computed without it, over a sequence of slowly changing poses
+// (as would be seen over consecutive time steps). The polygons can be reported
+// in a different order, so we compare the number of faces and the total area.
+TEST_F(MeshIntersectionFixture, TestComputeContactSurfaceWithCoherence) {
+  const auto id_S = GeometryId::get_new_id();
+  const auto id_R = GeometryId::get_new_id();
+  const VolumeMesh<double> mesh_S = MakeEllipsoidVolumeMesh<double>(
+      Ellipsoid(0.25, 0.4, 0.15), 0.05,
+      TessellationStrategy::kDenseInteriorVertices);
+  const VolumeMeshFieldLinear<double, double> field_S =
+      MakeEllipsoidPressureField<double>(Ellipsoid(0.25, 0.4, 0.15), &mesh_S,
+                                         1e7);
+  const Bvh<Obb, VolumeMesh<double>> bvh_S(mesh_S);
+  const SurfaceMesh<double> mesh_R =
+      MakeSphereSurfaceMesh<double>(Sphere(0.3), 0.05);
+  const Bvh<Obb, SurfaceMesh<double>> bvh_R(mesh_R);
+  const RigidTransformd X_WS = RigidTransformd::Identity();
+
+  MeshIntersectionCoherence coherence;
+  for (int i = 0; i < 20; ++i) {
+    SCOPED_TRACE(fmt::format("step = {}", i));
+    const RigidTransformd X_WR(
+        AngleAxisd(M_PI / 5 + 0.01 * i, Vector3d(1, 1, 1).normalized()),
+        Vector3d(0.2 + 0.005 * i, 0.1, 0.05));
+    const auto expected = ComputeContactSurfaceFromSoftVolumeRigidSurface(
+        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR,
+        ContactPolygonRepresentation::kCentroidSubdivision);
+    const auto dut = ComputeContactSurfaceFromSoftVolumeRigidSurface(
+        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR,
+        ContactPolygonRepresentation::kCentroidSubdivision, &coherence);
+    ASSERT_NE(expected, nullptr);
+    ASSERT_NE(dut, nullptr);
+    EXPECT_EQ(dut->mesh_W().num_faces(), expected->mesh_W().num_faces());
+    EXPECT_NEAR(dut->mesh_W().total_area(), expected->mesh_W().total_area(),
+                1e-12);
+    // The coherence data has been updated for the next query.
+    EXPECT_FALSE(coherence.front.empty());
+    EXPECT_GT(coherence.root_front_size, 0);
+    EXPECT_EQ(coherence.num_faces, dut->mesh_W().num_faces());
+    EXPECT_EQ(coherence.num_vertices, dut->mesh_W().num_vertices());
+  }
+}
+
+// Tests that reusing a workspace across computations (including computations
+// that find no contact) produces exactly the same contact surfaces as fresh
+// computations do.
+TEST_F(MeshIntersectionFixture, TestComputeContactSurfaceWithWorkspace) {
+  const auto id_S = GeometryId::get_new_id();
+  const auto id_R = GeometryId::get_new_id();
+  const VolumeMesh<double> mesh_S = MakeEllipsoidVolumeMesh<double>(
+      Ellipsoid(0.25, 0.4, 0.15), 0.05,
+      TessellationStrategy::kDenseInteriorVertices);
+  const VolumeMeshFieldLinear<double, double> field_S =
+      MakeEllipsoidPressureField<double>(Ellipsoid(0.25, 0.4, 0.15), &mesh_S,
+                                         1e7);
+  const Bvh<Obb, VolumeMesh<double>> bvh_S(mesh_S);
+  const SurfaceMesh<double> mesh_R =
+      MakeSphereSurfaceMesh<double>(Sphere(0.3), 0.05);
+  const Bvh<Obb, SurfaceMesh<double>> bvh_R(mesh_R);
+  const RigidTransformd X_WS = RigidTransformd::Identity();
+
+  ContactSurfaceWorkspace<double> workspace;
+  for (const double x : {0.2, 0.4, 5.0, 0.1}) {
+    SCOPED_TRACE(fmt::format("x = {}", x));
+    const RigidTransformd X_WR(
+        AngleAxisd(M_PI / 5, Vector3d(1, 1, 1).normalized()),
+        Vector3d(x, 0.1, 0.05));
+    const auto expected = ComputeContactSurfaceFromSoftVolumeRigidSurface(
+        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR,
+        ContactPolygonRepresentation::kCentroidSubdivision);
+    const auto dut = ComputeContactSurfaceFromSoftVolumeRigidSurface(
+        id_S, field_S, bvh_S, X_WS, id_R, mesh_R, bvh_R, X_WR,
+        ContactPolygonRepresentation::kCentroidSubdivision, nullptr,
+        &workspace);
+    if (expected == nullptr) {
+      EXPECT_EQ(dut, nullptr);
+      continue;
+    }
+    ASSERT_NE(dut, nullptr);
+    EXPECT_TRUE(dut->Equal(*expected));
+    for (SurfaceFaceIndex f(0); f < expected->mesh_W().num_faces(); ++f) {
+      EXPECT_EQ(dut->EvaluateGradE_M_W(f), expected->EvaluateGradE_M_W(f));
+    }
+    // The surface's buffers are exactly sized.
+    EXPECT_EQ(dut->mesh_W().faces().capacity(),
+              dut->mesh_W().faces().size());
+    EXPECT_EQ(dut->mesh_W().vertices().capacity(),
+              dut->mesh_W().vertices().size());
+  }
+}
+
 /* This test fixture enables some limited testing of the autodiff-valued contact
  surface. It computes the intersection between a rigid triangle mesh (a single
  large triangle) and simple tetrahedral mesh (single tet).
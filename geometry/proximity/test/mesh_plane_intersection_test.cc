@@ -1574,6 +1574,47 @@ GTEST_TEST(MeshPlaneIntersectionTest, SoftVolumeRigidHalfSpace) {
   }
 }
 
+// Reusing a workspace across computations (including those that find no
+// contact) produces exactly the same contact surfaces as fresh computations.
+GTEST_TEST(MeshPlaneIntersectionTest, SoftVolumeRigidHalfSpaceWithWorkspace) {
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  const VolumeMesh<double> mesh_F = TrivialVolumeMesh(RigidTransformd{});
+  const VolumeMeshFieldLinear<double, double> field_F{
+      "pressure", vector<double>{0.25, 0.5, 0.75, 1, -1}, &mesh_F};
+  const Bvh<Obb, VolumeMesh<double>> bvh_F(mesh_F);
+  const RigidTransformd X_WS{
+      RotationMatrixd{AngleAxisd{M_PI / 3, Vector3d{-1, 1, 1}.normalized()}},
+      Vector3d{1.25, 2.5, -3.75}};
+
+  ContactSurfaceWorkspace<double> workspace;
+  for (const auto representation :
+       {ContactPolygonRepresentation::kCentroidSubdivision,
+        ContactPolygonRepresentation::kSingleTriangle}) {
+    // The plane's normal is Sx; it cuts through both tets at the first and
+    // last offsets and misses the mesh at the second.
+    for (const double offset : {0.5, 1.01, 0.25}) {
+      const RigidTransformd X_WR =
+          X_WS * RigidTransformd{
+                     RotationMatrixd{AngleAxisd{M_PI / 2, Vector3d::UnitY()}},
+                     Vector3d{offset, 0, 0}};
+      const auto expected = ComputeContactSurfaceFromSoftVolumeRigidHalfSpace(
+          id_A, field_F, bvh_F, X_WS, id_B, X_WR, representation);
+      const auto dut = ComputeContactSurfaceFromSoftVolumeRigidHalfSpace(
+          id_A, field_F, bvh_F, X_WS, id_B, X_WR, representation, &workspace);
+      if (expected == nullptr) {
+        EXPECT_EQ(dut, nullptr);
+        continue;
+      }
+      ASSERT_NE(dut, nullptr);
+      EXPECT_TRUE(dut->Equal(*expected));
+      for (SurfaceFaceIndex f(0); f < expected->mesh_W().num_faces(); ++f) {
+        EXPECT_EQ(dut->EvaluateGradE_M_W(f), expected->EvaluateGradE_M_W(f));
+      }
+    }
+  }
+}
+
 /* This test fixture enables some limited testing of the autodiff-valued contact
  surface. It computes the intersection between a plane and simple tetrahedral
  mesh (single tet).
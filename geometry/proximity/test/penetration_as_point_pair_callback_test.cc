@@ -84,9 +84,9 @@ class PenetrationAsPointPairCallbackTest : public ::testing::Test {
  protected:
   void SetUp() override {
     auto encode_data = [this](GeometryId id, CollisionObjectd* shape) {
-      const EncodedData data(id, true);
+      this->collision_filter_.AddGeometry(id);
+      const EncodedData data(id, true, this->collision_filter_.GetIndex(id));
       data.write_to(shape);
-      this->collision_filter_.AddGeometry(data.id());
     };
     encode_data(id_A_, &sphere_A_);
     encode_data(id_B_, &sphere_B_);
@@ -511,9 +511,10 @@ TEST_F(PenetrationAsPointPairCallbackTest, UnsupportedHalfSpaceHalfSpace) {
   CollisionObjectd halfspace2(
       make_shared<fcl::Halfspaced>(Vector3d{1, 0, 0}, 0));
   const GeometryId hs2_id = GeometryId::get_new_id();
-  const EncodedData data(hs2_id, true);
+  this->collision_filter_.AddGeometry(hs2_id);
+  const EncodedData data(hs2_id, true,
+                         this->collision_filter_.GetIndex(hs2_id));
   data.write_to(&halfspace2);
-  this->collision_filter_.AddGeometry(data.id());
   UnsupportedGeometry<double>(this->halfspace_, halfspace2, this->id_halfspace_,
                               hs2_id);
   UnsupportedGeometry<AutoDiffXd>(this->halfspace_, halfspace2,
@@ -25,6 +25,23 @@ GTEST_TEST(EncodedData, ConstructorAndProperties) {
   EncodedData data_B(id_B, false);
   EXPECT_EQ(data_B.id(), id_B);
   EXPECT_FALSE(data_B.is_dynamic());
+  EXPECT_EQ(data_B.filter_index(), 0);
+
+  // The collision filter index is stored next to the id and mobility.
+  const int max_index = (1 << EncodedData::kFilterIndexBits) - 1;
+  for (int index : {1, 17, max_index}) {
+    for (bool is_dynamic : {true, false}) {
+      EncodedData data_C(id_B, is_dynamic, index);
+      EXPECT_EQ(data_C.id(), id_B);
+      EXPECT_EQ(data_C.is_dynamic(), is_dynamic);
+      EXPECT_EQ(data_C.filter_index(), index);
+      data_C.set_dynamic();
+      EXPECT_EQ(data_C.filter_index(), index);
+      data_C.set_anchored();
+      EXPECT_EQ(data_C.filter_index(), index);
+      EXPECT_EQ(data_C.id(), id_B);
+    }
+  }
 }
 
 GTEST_TEST(EncodedData, FactoryConstruction) {
@@ -42,7 +59,7 @@ GTEST_TEST(EncodedData, FactoryConstruction) {
 // This tests writing to and extracting from an fcl object,
 GTEST_TEST(EncodedData, ConstructionFromFclObject) {
   GeometryId id_A = GeometryId::get_new_id();
-  EncodedData data_A(id_A, true);
+  EncodedData data_A(id_A, true, 3);
   CollisionObjectd object(std::shared_ptr<CollisionGeometryd>(nullptr));
 
   data_A.write_to(&object);
@@ -50,6 +67,7 @@ GTEST_TEST(EncodedData, ConstructionFromFclObject) {
     EncodedData data_read(object);
     EXPECT_TRUE(data_read.is_dynamic());
     EXPECT_EQ(data_read.id(), data_A.id());
+    EXPECT_EQ(data_read.filter_index(), 3);
   }
 
   data_A.set_anchored();
@@ -58,6 +76,7 @@ GTEST_TEST(EncodedData, ConstructionFromFclObject) {
     EncodedData data_read(object);
     EXPECT_FALSE(data_read.is_dynamic());
     EXPECT_EQ(data_read.id(), data_A.id());
+    EXPECT_EQ(data_read.filter_index(), 3);
   }
 }
 
@@ -0,0 +1,271 @@
+#include "drake/geometry/proximity/signed_distance_field.h"
+
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/temp_directory.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/geometry/proximity/make_box_mesh.h"
+#include "drake/math/autodiff_gradient.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+
+// The analytical signed distance from Q to a box centered at the origin with
+// the given half widths.
+double BoxDistance(const Vector3d& half_width, const Vector3d& p_BQ) {
+  const Vector3d q = p_BQ.cwiseAbs() - half_width;
+  return q.cwiseMax(0.0).norm() + std::min(q.maxCoeff(), 0.0);
+}
+
+// A non-convex mesh: the L-shaped polygon (0, 0), (2, 0), (2, 1), (1, 1),
+// (1, 2), (0, 2) in the xy-plane extruded over z ∈ [0, 1]. Its faces point
+// outward.
+SurfaceMesh<double> MakeLPrism() {
+  const std::vector<Vector3d> profile{{0, 0, 0}, {2, 0, 0}, {2, 1, 0},
+                                      {1, 1, 0}, {1, 2, 0}, {0, 2, 0}};
+  std::vector<SurfaceVertex<double>> vertices;
+  for (const Vector3d& p : profile) vertices.emplace_back(p);
+  for (const Vector3d& p : profile) {
+    vertices.emplace_back(p + Vector3d::UnitZ());
+  }
+  std::vector<SurfaceFace> faces;
+  auto add_face = [&faces](int v0, int v1, int v2) {
+    faces.emplace_back(SurfaceVertexIndex(v0), SurfaceVertexIndex(v1),
+                       SurfaceVertexIndex(v2));
+  };
+  // The caps: a fan around the reflex vertex 3; counter-clockwise in the
+  // xy-plane for the top and clockwise for the bottom.
+  for (const auto& [a, b] : std::vector<std::pair<int, int>>{
+           {4, 5}, {5, 0}, {0, 1}, {1, 2}}) {
+    add_face(6 + 3, 6 + a, 6 + b);
+    add_face(3, b, a);
+  }
+  // The sides.
+  for (int a = 0; a < 6; ++a) {
+    const int b = (a + 1) % 6;
+    add_face(a, b, 6 + b);
+    add_face(a, 6 + b, 6 + a);
+  }
+  return SurfaceMesh<double>(std::move(faces), std::move(vertices));
+}
+
+class SignedDistanceFieldTest : public ::testing::Test {
+ protected:
+  const Vector3d half_width_{0.1, 0.15, 0.2};
+  const SurfaceMesh<double> box_mesh_{
+      MakeBoxSurfaceMesh<double>(Box(0.2, 0.3, 0.4), 1.0)};
+  const SignedDistanceFieldOptions options_{.resolution = 0.01,
+                                            .band_width = 0.02};
+};
+
+// Within the band, the field matches the analytical distance to within the
+// discretization error and its gradient is the outward normal.
+TEST_F(SignedDistanceFieldTest, BoxWithinBand) {
+  const SignedDistanceField field(box_mesh_, options_);
+  for (const Vector3d& p_BQ :
+       {Vector3d(0.105, 0.01, 0.02), Vector3d(0.093, -0.02, 0.03),
+        Vector3d(0.01, -0.161, -0.05), Vector3d(-0.02, 0.03, 0.187),
+        Vector3d(0.107, 0.155, 0.0), Vector3d(0.111, -0.16, -0.21)}) {
+    double distance{};
+    Vector3d grad;
+    field.Evaluate(p_BQ, &distance, &grad);
+    EXPECT_NEAR(distance, BoxDistance(half_width_, p_BQ),
+                options_.resolution / 2);
+    EXPECT_NEAR(grad.norm(), 1.0, 1e-12);
+  }
+
+  // Away from the edges, the distance is linear and reproduced exactly (up to
+  // the single precision of the samples).
+  const Vector3d p_BQ(0.104, 0.013, -0.027);
+  double distance{};
+  Vector3d grad;
+  field.Evaluate(p_BQ, &distance, &grad);
+  EXPECT_NEAR(distance, 0.004, 1e-6);
+  EXPECT_TRUE(CompareMatrices(grad, Vector3d::UnitX(), 1e-5));
+}
+
+// Outside the domain, the distance is continued as the distance to the domain
+// plus the field at the domain's nearest point.
+TEST_F(SignedDistanceFieldTest, OutsideDomain) {
+  const SignedDistanceField field(box_mesh_, options_);
+  for (const Vector3d& p_BQ : {Vector3d(1.5, 0, 0), Vector3d(0.3, 0.4, -2)}) {
+    double distance{};
+    Vector3d grad;
+    field.Evaluate(p_BQ, &distance, &grad);
+    const double expected = BoxDistance(half_width_, p_BQ);
+    // It's an upper bound which is no worse than the extent of a brick.
+    EXPECT_GE(distance, expected - 1e-6);
+    EXPECT_LE(distance, expected + SignedDistanceField::kBrickVoxels *
+                                       options_.resolution);
+    EXPECT_NEAR(grad.norm(), 1.0, 1e-12);
+  }
+}
+
+// Only the bricks near the surface are finely sampled.
+TEST_F(SignedDistanceFieldTest, Sparsity) {
+  const SurfaceMesh<double> mesh =
+      MakeBoxSurfaceMesh<double>(Box::MakeCube(1.0), 1.0);
+  const SignedDistanceField field(mesh, {.resolution = 0.02,
+                                         .band_width = 0.02});
+  const Vector3<int>& num_bricks = field.num_bricks();
+  // The inflated bounding box is 1.04 m wide; bricks are 0.16 m wide.
+  EXPECT_EQ(num_bricks, Vector3<int>::Constant(7));
+  const int total = num_bricks.prod();
+  EXPECT_GT(field.num_fine_bricks(), 0);
+  EXPECT_LT(field.num_fine_bricks(), total);
+  // The center of the cube is a coarse brick, yet is still reasonable.
+  double distance{};
+  Vector3d grad;
+  field.Evaluate(Vector3d(0, 0, 0), &distance, &grad);
+  EXPECT_NEAR(distance, -0.5, 0.16);
+}
+
+// The sign respects non-convex features: a point in the notch of the L lies
+// outside, although it lies inside the convex hull.
+TEST_F(SignedDistanceFieldTest, NonConvex) {
+  const SignedDistanceField field(MakeLPrism(),
+                                  {.resolution = 0.05, .band_width = 0.1});
+  double distance{};
+  Vector3d grad;
+
+  // Far from the surface, in a coarse brick.
+  field.Evaluate(Vector3d(1.5, 1.5, 0.5), &distance, &grad);
+  EXPECT_NEAR(distance, 0.5, 0.1);
+
+  // Near the reflex edge at (1, 1), outside and inside.
+  field.Evaluate(Vector3d(1.1, 1.05, 0.5), &distance, &grad);
+  EXPECT_NEAR(distance, 0.05, 0.025);
+  EXPECT_TRUE(CompareMatrices(grad, Vector3d(0, 1, 0), 0.05));
+
+  field.Evaluate(Vector3d(1.04, 1.06, 0.5), &distance, &grad);
+  EXPECT_NEAR(distance, 0.04, 0.025);
+
+  field.Evaluate(Vector3d(0.95, 0.9, 0.5), &distance, &grad);
+  EXPECT_NEAR(distance, -std::hypot(0.05, 0.1), 0.025);
+
+  field.Evaluate(Vector3d(0.5, 1.5, 0.8), &distance, &grad);
+  EXPECT_NEAR(distance, -0.2, 0.025);
+}
+
+TEST_F(SignedDistanceFieldTest, AutoDiff) {
+  const SignedDistanceField field(box_mesh_, options_);
+  const Vector3d p_BQ(0.104, 0.013, -0.027);
+  double distance_d{};
+  Vector3d grad_d;
+  field.Evaluate(p_BQ, &distance_d, &grad_d);
+
+  const Vector3<AutoDiffXd> p_BQ_ad = math::initializeAutoDiff(p_BQ);
+  AutoDiffXd distance{};
+  Vector3<AutoDiffXd> grad;
+  field.Evaluate(p_BQ_ad, &distance, &grad);
+  EXPECT_EQ(distance.value(), distance_d);
+  EXPECT_TRUE(CompareMatrices(math::autoDiffToValueMatrix(grad), grad_d));
+  // The derivatives of the distance are its gradient.
+  EXPECT_TRUE(CompareMatrices(distance.derivatives(), grad_d, 1e-5));
+}
+
+TEST_F(SignedDistanceFieldTest, BadOptions) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SignedDistanceField(box_mesh_, {.resolution = 0, .band_width = 0.1}),
+      "SignedDistanceField: the resolution must be positive and finite; "
+      "given 0");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SignedDistanceField(box_mesh_, {.resolution = 0.1, .band_width = -1}),
+      "SignedDistanceField: the band width must be non-negative and finite; "
+      "given -1");
+  // A field too large for the memory limit throws before it's built.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SignedDistanceField(box_mesh_, {.resolution = 1e-5,
+                                      .band_width = 0.1,
+                                      .max_memory_bytes = int64_t{1} << 30}),
+      "SignedDistanceField: the field would occupy .* bytes, more than the "
+      "limit of 1073741824 bytes.*");
+  // So does a field whose finely sampled bricks exceed the limit.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SignedDistanceField(box_mesh_, {.resolution = 0.01,
+                                      .band_width = 0.02,
+                                      .max_memory_bytes = 10000}),
+      "SignedDistanceField: the field would occupy .* bytes, more than the "
+      "limit of 10000 bytes.*");
+}
+
+TEST_F(SignedDistanceFieldTest, Cache) {
+  const std::string path = temp_directory() + "/box.sdf";
+  const SignedDistanceField built(box_mesh_, options_);
+
+  // The first call writes the file; the second reads it.
+  const SignedDistanceField first =
+      SignedDistanceField::LoadOrBuild(box_mesh_, options_, path);
+  EXPECT_TRUE(first.Equal(built));
+  EXPECT_TRUE(std::ifstream(path, std::ios::binary).good());
+  const SignedDistanceField second =
+      SignedDistanceField::LoadOrBuild(box_mesh_, options_, path);
+  EXPECT_TRUE(second.Equal(built));
+
+  // A cached field for different options is ignored (and replaced).
+  const SignedDistanceFieldOptions other{.resolution = 0.02,
+                                         .band_width = 0.02};
+  const SignedDistanceField third =
+      SignedDistanceField::LoadOrBuild(box_mesh_, other, path);
+  EXPECT_NE(third.key(), built.key());
+  EXPECT_TRUE(third.Equal(SignedDistanceField(box_mesh_, other)));
+
+  // A cached field exceeding the memory limit throws.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      SignedDistanceField::LoadOrBuild(
+          box_mesh_,
+          {.resolution = 0.02, .band_width = 0.02, .max_memory_bytes = 100},
+          path),
+      "SignedDistanceField: the field would occupy .*");
+
+  // A truncated file is ignored.
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << "DRKSDF";
+  const SignedDistanceField fourth =
+      SignedDistanceField::LoadOrBuild(box_mesh_, options_, path);
+  EXPECT_TRUE(fourth.Equal(built));
+
+  // A file whose sample count disagrees with its grid is ignored, rather than
+  // allocating whatever the count asks for. The count follows the magic, the
+  // version, the key, p_MD, the resolution, and the brick counts.
+  SignedDistanceField::LoadOrBuild(box_mesh_, options_, path);
+  {
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    file.seekp(8 + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(Vector3d) +
+               sizeof(double) + sizeof(Vector3<int>));
+    const uint64_t huge_count = uint64_t{1} << 60;
+    file.write(reinterpret_cast<const char*>(&huge_count), sizeof(huge_count));
+  }
+  const SignedDistanceField corrupt =
+      SignedDistanceField::LoadOrBuild(box_mesh_, options_, path);
+  EXPECT_TRUE(corrupt.Equal(built));
+
+  // An unwritable path only costs the cache.
+  const SignedDistanceField fifth = SignedDistanceField::LoadOrBuild(
+      box_mesh_, options_, temp_directory() + "/no/such/dir/box.sdf");
+  EXPECT_TRUE(fifth.Equal(built));
+}
+
+GTEST_TEST(MaybeMakeSignedDistanceFieldTest, OnlyForMeshesWithProperties) {
+  ProximityProperties props;
+  EXPECT_EQ(MaybeMakeSignedDistanceField(Box(1, 2, 3), props), nullptr);
+  AddSignedDistanceFieldProperties(0.01, 0.02, std::nullopt, std::nullopt,
+                                   &props);
+  EXPECT_EQ(MaybeMakeSignedDistanceField(Box(1, 2, 3), props), nullptr);
+  EXPECT_EQ(MaybeMakeSignedDistanceField(Sphere(1), props), nullptr);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
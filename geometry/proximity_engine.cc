@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <limits>
+#include <mutex>
+#include <numeric>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -16,8 +18,10 @@
 #include "drake/common/default_scalars.h"
 #include "drake/common/eigen_types.h"
 #include "drake/common/text_logging.h"
+#include "drake/common/thread_pool.h"
 #include "drake/geometry/geometry_ids.h"
 #include "drake/geometry/proximity/collisions_exist_callback.h"
+#include "drake/geometry/proximity/contact_surface_workspace.h"
 #include "drake/geometry/proximity/distance_to_point_callback.h"
 #include "drake/geometry/proximity/distance_to_shape_callback.h"
 #include "drake/geometry/proximity/find_collision_candidates_callback.h"
@@ -25,6 +29,7 @@
 #include "drake/geometry/proximity/hydroelastic_internal.h"
 #include "drake/geometry/proximity/obj_to_surface_mesh.h"
 #include "drake/geometry/proximity/penetration_as_point_pair_callback.h"
+#include "drake/geometry/proximity/signed_distance_field.h"
 #include "drake/geometry/utilities.h"
 
 static_assert(std::is_same_v<tinyobj::real_t, double>,
@@ -319,6 +324,79 @@ void FclDistance(const fcl::DynamicAABBTreeCollisionManager<double>& tree1,
       callback);
 }
 
+// Broadphase callback that records every pair of collision objects whose
+// bounding volumes overlap. No collision filtering is applied here; it is left
+// to whatever consumes the recorded pairs. The callback data must be an
+// instance of std::vector<std::pair<CollisionObjectd*, CollisionObjectd*>>.
+bool CollectCandidatePair(CollisionObjectd* object_A_ptr,
+                          CollisionObjectd* object_B_ptr,
+                          // NOLINTNEXTLINE
+                          void* callback_data) {
+  auto& pairs = *static_cast<
+      std::vector<std::pair<CollisionObjectd*, CollisionObjectd*>>*>(
+      callback_data);
+  pairs.emplace_back(object_A_ptr, object_B_ptr);
+  // Tell the broadphase to keep searching.
+  return false;
+}
+
+// The results of the hydroelastic computation for a single candidate pair;
+// used to merge the results of concurrently-evaluated pairs in a fixed order.
+template <typename T>
+struct HydroelasticPairResults {
+  std::vector<ContactSurface<T>> surfaces;
+  std::vector<PenetrationAsPointPair<T>> point_pairs;
+};
+
+// The query points of a batched signed distance query, grouped into
+// spatially compact clusters. The points of the c-th cluster are the columns
+// indices[offsets[c]], ..., indices[offsets[c + 1] - 1] of the queried matrix.
+struct PointClusters {
+  std::vector<int> indices;
+  std::vector<int> offsets;
+};
+
+// Groups the columns of `p_WQs` into clusters of at most `max_cluster_size`
+// points by recursively splitting the points' bounding box at the median
+// along its longest axis.
+PointClusters ClusterPoints(const Eigen::Matrix3Xd& p_WQs,
+                            int max_cluster_size) {
+  DRAKE_DEMAND(max_cluster_size > 0);
+  const int num_points = static_cast<int>(p_WQs.cols());
+  PointClusters clusters;
+  clusters.indices.resize(num_points);
+  std::iota(clusters.indices.begin(), clusters.indices.end(), 0);
+  clusters.offsets.push_back(0);
+  // The ranges are split depth first, lower half first, so that the clusters
+  // are completed in order.
+  std::vector<std::pair<int, int>> ranges{{0, num_points}};
+  while (!ranges.empty()) {
+    const auto [start, end] = ranges.back();
+    ranges.pop_back();
+    if (end - start <= max_cluster_size) {
+      clusters.offsets.push_back(end);
+      continue;
+    }
+    auto begin = clusters.indices.begin();
+    Vector3d lower = p_WQs.col(begin[start]);
+    Vector3d upper = lower;
+    for (int i = start + 1; i < end; ++i) {
+      lower = lower.cwiseMin(p_WQs.col(begin[i]));
+      upper = upper.cwiseMax(p_WQs.col(begin[i]));
+    }
+    int axis{};
+    (upper - lower).maxCoeff(&axis);
+    const int middle = start + (end - start) / 2;
+    std::nth_element(begin + start, begin + middle, begin + end,
+                     [&p_WQs, axis](int a, int b) {
+                       return p_WQs(axis, a) < p_WQs(axis, b);
+                     });
+    ranges.emplace_back(middle, end);
+    ranges.emplace_back(start, middle);
+  }
+  return clusters;
+}
+
 // Compare function to use with ordering PenetrationAsPointPairs.
 template <typename T>
 bool OrderPointPair(const PenetrationAsPointPair<T>& p1,
@@ -347,6 +425,7 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   Impl(const Impl& other) : ShapeReifier(other) {
     hydroelastic_geometries_ = other.hydroelastic_geometries_;
+    signed_distance_fields_ = other.signed_distance_fields_;
     dynamic_tree_.clear();
     dynamic_objects_.clear();
     anchored_tree_.clear();
@@ -365,6 +444,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     BuildTreeFromReference(other.anchored_tree_, object_map, &anchored_tree_);
 
     collision_filter_ = other.collision_filter_;
+    set_hydroelastic_num_threads(other.hydroelastic_num_threads_);
+    hydroelastic_coherence_enabled_ = other.hydroelastic_coherence_enabled_;
   }
 
   // Only the copy constructor is used to facilitate copying of the parent
@@ -394,7 +475,11 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     BuildTreeFromReference(anchored_tree_, object_map, &engine->anchored_tree_);
 
     engine->hydroelastic_geometries_ = this->hydroelastic_geometries_;
+    engine->signed_distance_fields_ = this->signed_distance_fields_;
     engine->distance_tolerance_ = this->distance_tolerance_;
+    engine->set_hydroelastic_num_threads(this->hydroelastic_num_threads_);
+    engine->hydroelastic_coherence_enabled_ =
+        this->hydroelastic_coherence_enabled_;
 
     return engine;
   }
@@ -417,9 +502,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       const InternalGeometry& geometry,
       const ProximityProperties& new_properties) {
     const GeometryId id = geometry.id();
-    // Note: Currently, the only aspect of a geometry's representation that can
-    // be affected by its proximity properties is its hydroelastic
-    // representation.
+    // Note: Currently, the only aspects of a geometry's representation that
+    // can be affected by its proximity properties are its hydroelastic
+    // representation and its signed distance field.
     if (dynamic_objects_.count(id) == 0 && anchored_objects_.count(id) == 0) {
       throw std::logic_error(
           fmt::format("The proximity engine does not contain a geometry with "
@@ -438,6 +523,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     hydroelastic_geometries_.RemoveGeometry(id);
     hydroelastic_geometries_.MaybeAddGeometry(geometry.shape(), id,
                                               new_properties);
+    coherence_cache_.Remove(id);
+    signed_distance_fields_.erase(id);
+    MaybeAddSignedDistanceField(geometry.shape(), id, new_properties);
   }
 
   void RemoveGeometry(GeometryId id, bool is_dynamic) {
@@ -447,6 +535,8 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       RemoveGeometry(id, &anchored_tree_, &anchored_objects_);
     }
     hydroelastic_geometries_.RemoveGeometry(id);
+    coherence_cache_.Remove(id);
+    signed_distance_fields_.erase(id);
   }
 
   int num_geometries() const {
@@ -465,6 +555,32 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
   double distance_tolerance() const { return distance_tolerance_; }
 
+  void set_hydroelastic_num_threads(int num_threads) {
+    if (num_threads < 1) {
+      throw std::logic_error(fmt::format(
+          "The number of threads for computing contact surfaces must be "
+          "positive; given {}",
+          num_threads));
+    }
+    if (num_threads == hydroelastic_num_threads_) return;
+    hydroelastic_num_threads_ = num_threads;
+    hydroelastic_thread_pool_ =
+        num_threads == 1
+            ? nullptr
+            : make_unique<drake::internal::ThreadPool>(num_threads);
+  }
+
+  int hydroelastic_num_threads() const { return hydroelastic_num_threads_; }
+
+  void set_hydroelastic_coherence_enabled(bool enabled) {
+    hydroelastic_coherence_enabled_ = enabled;
+    if (!enabled) coherence_cache_ = hydroelastic::CoherenceCache();
+  }
+
+  bool hydroelastic_coherence_enabled() const {
+    return hydroelastic_coherence_enabled_;
+  }
+
   // TODO(SeanCurtis-TRI): I could do things here differently a number of ways:
   //  1. I could make this move semantics (or swap semantics).
   //  2. I could simply have a method that returns a mutable reference to such
@@ -483,6 +599,21 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     dynamic_tree_.update();
   }
 
+  void UpdateWorldPoses(const WorldPoseBuffer& X_WGs) {
+    std::vector<fcl::CollisionObjectd*> updated_objects;
+    updated_objects.reserve(X_WGs.size());
+    for (int i = 0; i < X_WGs.size(); ++i) {
+      auto iter = dynamic_objects_.find(X_WGs.id(i));
+      if (iter == dynamic_objects_.end()) continue;
+      fcl::CollisionObjectd* object = iter->second.get();
+      object->setTransform(X_WGs.rotation(i), X_WGs.translation(i));
+      object->computeAABB();
+      updated_objects.push_back(object);
+    }
+    // Only refit the broadphase tree if something moved.
+    if (!updated_objects.empty()) dynamic_tree_.update(updated_objects);
+  }
+
   // Implementation of ShapeReifier interface
   using ShapeReifier::ImplementGeometry;
 
@@ -649,8 +780,9 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
 
     std::vector<SignedDistanceToPoint<T>> distances;
 
-    point_distance::CallbackData<T> data{
-        &query_point, threshold, p_WQ, &X_WGs, &distances};
+    point_distance::CallbackData<T> data{&query_point, threshold, p_WQ,
+                                         &X_WGs, &distances,
+                                         &signed_distance_fields_};
 
     // Perform query of point vs dynamic objects.
     dynamic_tree_.distance(&query_point, &data, point_distance::Callback<T>);
@@ -661,6 +793,102 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return distances;
   }
 
+  SignedDistanceToPointBatch<T> ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      const double threshold) const {
+    SignedDistanceToPointBatch<T> batch;
+    const int num_points = static_cast<int>(p_WQs.cols());
+    if (num_points == 0) return batch;
+
+    // Rather than culling once per point, we cull once per cluster of nearby
+    // points: the cluster's query object is a box spanning the points'
+    // bounding box, and the broadphase reports every geometry whose bounding
+    // box lies within the threshold of it (i.e., overlaps the box inflated by
+    // the threshold). Each candidate is then evaluated against the cluster's
+    // points only. The cluster size trades the broadphase traversals against
+    // the evaluation of points that are far from a candidate.
+    constexpr int kMaxPointsPerCluster = 32;
+    Eigen::Matrix3Xd p_WQs_double(3, num_points);
+    for (int i = 0; i < num_points; ++i) {
+      p_WQs_double.col(i) = convert_to_double(Vector3<T>(p_WQs.col(i)));
+    }
+    const PointClusters clusters =
+        ClusterPoints(p_WQs_double, kMaxPointsPerCluster);
+    const int num_clusters = static_cast<int>(clusters.offsets.size()) - 1;
+
+    std::vector<std::pair<int, SignedDistanceToPoint<T>>> distances;
+    std::vector<const CollisionObjectd*> candidates;
+    Matrix3X<T> p_WQs_cluster;
+    for (int c = 0; c < num_clusters; ++c) {
+      const int start = clusters.offsets[c];
+      const int size = clusters.offsets[c + 1] - start;
+      const int* const indices = clusters.indices.data() + start;
+      p_WQs_cluster.resize(3, size);
+      Vector3d lower = p_WQs_double.col(indices[0]);
+      Vector3d upper = lower;
+      for (int j = 0; j < size; ++j) {
+        p_WQs_cluster.col(j) = p_WQs.col(indices[j]);
+        lower = lower.cwiseMin(p_WQs_double.col(indices[j]));
+        upper = upper.cwiseMax(p_WQs_double.col(indices[j]));
+      }
+      auto fcl_box = make_shared<fcl::Boxd>(upper - lower);
+      CollisionObjectd query_cluster(fcl_box);
+      query_cluster.setTranslation((lower + upper) / 2);
+      query_cluster.computeAABB();
+
+      candidates.clear();
+      point_distance::BatchCallbackData data{&query_cluster, threshold,
+                                             &candidates};
+      dynamic_tree_.distance(&query_cluster, &data,
+                             point_distance::BatchCallback);
+      anchored_tree_.distance(&query_cluster, &data,
+                              point_distance::BatchCallback);
+      std::sort(candidates.begin(), candidates.end(),
+                [](const CollisionObjectd* a, const CollisionObjectd* b) {
+                  return EncodedData(*a).id() < EncodedData(*b).id();
+                });
+
+      for (const CollisionObjectd* candidate : candidates) {
+        const GeometryId id = EncodedData(*candidate).id();
+        const auto field_iter = signed_distance_fields_.find(id);
+        const int first_new = static_cast<int>(distances.size());
+        point_distance::ComputeDistancesToPoints(
+            *candidate, X_WGs.at(id), p_WQs_cluster, threshold, &distances,
+            field_iter == signed_distance_fields_.end()
+                ? nullptr
+                : field_iter->second.get());
+        // Map the cluster's point indices back to the batch's.
+        for (int k = first_new; k < static_cast<int>(distances.size()); ++k) {
+          distances[k].first = indices[distances[k].first];
+        }
+      }
+    }
+
+    // Pack the results by query point; the sort is stable so that each point's
+    // results remain ordered by geometry id.
+    std::vector<int>& offsets = batch.offsets;
+    offsets.assign(num_points + 1, 0);
+    for (const auto& [point_index, distance] : distances) {
+      ++offsets[point_index + 1];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const int num_results = static_cast<int>(distances.size());
+    batch.id_G.resize(num_results);
+    batch.p_GN.resize(3, num_results);
+    batch.distance.resize(num_results);
+    batch.grad_W.resize(3, num_results);
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for (const auto& [point_index, distance] : distances) {
+      const int k = next[point_index]++;
+      batch.id_G[k] = distance.id_G;
+      batch.p_GN.col(k) = distance.p_GN;
+      batch.distance(k) = distance.distance;
+      batch.grad_W.col(k) = distance.grad_W;
+    }
+    return batch;
+  }
+
   std::vector<PenetrationAsPointPair<T>> ComputePointPairPenetration(
       const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs) const {
     std::vector<PenetrationAsPointPair<T>> contacts;
@@ -716,16 +944,162 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     return data.collisions_exist;
   }
 
+  // Collects the candidate pairs for hydroelastic contact: every pair of
+  // dynamic-dynamic and dynamic-anchored objects whose bounding volumes
+  // overlap, in broadphase traversal order. Anchored-anchored pairs are
+  // implicitly filtered.
+  vector<std::pair<CollisionObjectd*, CollisionObjectd*>>
+  CollectCandidatePairs() const {
+    vector<std::pair<CollisionObjectd*, CollisionObjectd*>> pairs;
+    dynamic_tree_.collide(&pairs, CollectCandidatePair);
+    FclCollide(dynamic_tree_, anchored_tree_, &pairs, CollectCandidatePair);
+    return pairs;
+  }
+
+  // Grants a single query exclusive use of the coherence cache for its
+  // duration. If temporal coherence is disabled, or the cache is in use by a
+  // concurrent query, the query proceeds without it (get() is null); that
+  // changes its cost, but not its results.
+  class CoherenceLease {
+   public:
+    explicit CoherenceLease(const Impl& engine) {
+      if (!engine.hydroelastic_coherence_enabled_) return;
+      lock_ = std::unique_lock<std::mutex>(engine.coherence_mutex_,
+                                           std::try_to_lock);
+      if (!lock_.owns_lock()) return;
+      cache_ = &engine.coherence_cache_;
+      cache_->BeginRound();
+    }
+
+    hydroelastic::CoherenceCache* get() const { return cache_; }
+
+   private:
+    std::unique_lock<std::mutex> lock_;
+    hydroelastic::CoherenceCache* cache_{};
+  };
+
+  // Checks out of the engine's pool the scratch memory of the contact surface
+  // computations of a single query, one workspace for each of `num_workers`
+  // workers, and returns it to the pool on destruction. Concurrent queries
+  // thus never share a workspace, while consecutive queries reuse the memory
+  // of their predecessors.
+  class WorkspaceLease {
+   public:
+    WorkspaceLease(const Impl& engine, int num_workers) : engine_(engine) {
+      DRAKE_DEMAND(num_workers > 0);
+      workspaces_.resize(num_workers);
+      int num_pooled = 0;
+      {
+        std::lock_guard<std::mutex> lock(engine_.workspace_mutex_);
+        auto& pool = engine_.workspace_pool_;
+        num_pooled = std::min(num_workers, static_cast<int>(pool.size()));
+        std::move(pool.end() - num_pooled, pool.end(), workspaces_.begin());
+        pool.resize(pool.size() - num_pooled);
+      }
+      for (int i = num_pooled; i < num_workers; ++i) {
+        workspaces_[i] = make_unique<ContactSurfaceWorkspace<T>>();
+      }
+    }
+
+    ~WorkspaceLease() {
+      std::lock_guard<std::mutex> lock(engine_.workspace_mutex_);
+      for (auto& workspace : workspaces_) {
+        engine_.workspace_pool_.push_back(std::move(workspace));
+      }
+    }
+
+    ContactSurfaceWorkspace<T>* get(int worker) const {
+      return workspaces_[worker].get();
+    }
+
+   private:
+    const Impl& engine_;
+    vector<unique_ptr<ContactSurfaceWorkspace<T>>> workspaces_;
+  };
+
+  // Parallel implementation of the hydroelastic queries. The broadphase
+  // candidates are collected first; the per-pair narrowphase (including
+  // collision filtering) is then dispatched across hydroelastic_num_threads_
+  // workers by invoking `callback` on each pair with its own, private result
+  // buffers. The per-pair results are finally appended to the outputs in
+  // candidate order.
+  //
+  // If `point_pairs` is null, `callback` receives hydroelastic::CallbackData;
+  // otherwise it receives hydroelastic::CallbackWithFallbackData.
+  void ComputeHydroelasticInParallel(
+      const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+      ContactPolygonRepresentation representation,
+      fcl::CollisionCallBack<double> callback,
+      vector<ContactSurface<T>>* surfaces,
+      vector<PenetrationAsPointPair<T>>* point_pairs) const {
+    DRAKE_DEMAND(surfaces != nullptr);
+    const bool with_fallback = point_pairs != nullptr;
+    const vector<std::pair<CollisionObjectd*, CollisionObjectd*>> candidates =
+        CollectCandidatePairs();
+    const int num_candidates = static_cast<int>(candidates.size());
+    vector<HydroelasticPairResults<T>> results(num_candidates);
+    const CoherenceLease coherence(*this);
+    hydroelastic::CoherenceCache* const coherence_cache = coherence.get();
+    if (coherence_cache != nullptr) {
+      // The workers may only access existing entries; create them up front.
+      // (Pairs that turn out to be filtered or unsupported get an entry that
+      // is never used.)
+      for (const auto& [object_A, object_B] : candidates) {
+        coherence_cache->get(EncodedData(*object_A).id(),
+                             EncodedData(*object_B).id());
+      }
+    }
+
+    const WorkspaceLease workspaces(*this, hydroelastic_num_threads_);
+
+    // The cost of the pairs varies too much for chunks larger than a single
+    // pair.
+    hydroelastic_thread_pool_->ParallelForWithThreadIndex(
+        0, num_candidates, 1, [&](int thread_index, int i) {
+          HydroelasticPairResults<T>& pair_results = results[i];
+          hydroelastic::CallbackWithFallbackData<T> data{
+              hydroelastic::CallbackData<T>{
+                  &collision_filter_, &X_WGs, &hydroelastic_geometries_,
+                  representation, &pair_results.surfaces, coherence_cache,
+                  workspaces.get(thread_index)},
+              &pair_results.point_pairs};
+          void* callback_data =
+              with_fallback ? static_cast<void*>(&data) : &data.data;
+          callback(candidates[i].first, candidates[i].second, callback_data);
+        });
+
+    for (HydroelasticPairResults<T>& pair_results : results) {
+      for (ContactSurface<T>& surface : pair_results.surfaces) {
+        surfaces->emplace_back(std::move(surface));
+      }
+      if (with_fallback) {
+        for (PenetrationAsPointPair<T>& point_pair : pair_results.point_pairs) {
+          point_pairs->emplace_back(std::move(point_pair));
+        }
+      }
+    }
+  }
+
   // Helper of ComputeContactSurfaces() and ComputePolygonalContactSurfaces().
   vector<ContactSurface<T>> ComputeContactSurfacesImpl(
       const unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
       ContactPolygonRepresentation representation) const {
     vector<ContactSurface<T>> surfaces;
+    if (hydroelastic_num_threads_ > 1) {
+      ComputeHydroelasticInParallel(
+          X_WGs, representation, hydroelastic::Callback<T>, &surfaces,
+          nullptr);
+      std::sort(surfaces.begin(), surfaces.end(), OrderContactSurface<T>);
+      return surfaces;
+    }
+
     // All these quantities, except `representation`, are aliased in the
     // callback data.
-    hydroelastic::CallbackData<T> data{&collision_filter_, &X_WGs,
-                                       &hydroelastic_geometries_,
-                                       representation, &surfaces};
+    const CoherenceLease coherence(*this);
+    const WorkspaceLease workspace(*this, 1);
+    hydroelastic::CallbackData<T> data{
+        &collision_filter_, &X_WGs, &hydroelastic_geometries_, representation,
+        &surfaces, coherence.get(), workspace.get(0)};
 
     // Perform a query of the dynamic objects against themselves.
     dynamic_tree_.collide(&data, hydroelastic::Callback<T>);
@@ -763,20 +1137,29 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
     DRAKE_DEMAND(surfaces != nullptr);
     DRAKE_DEMAND(point_pairs != nullptr);
 
-    // All these quantities, except `representation`, are aliased in the
-    // callback data.
-    hydroelastic::CallbackWithFallbackData<T> data{
-        hydroelastic::CallbackData<T>{&collision_filter_, &X_WGs,
-                                      &hydroelastic_geometries_, representation,
-                                      surfaces},
-        point_pairs};
-
-    // Dynamic vs dynamic and dynamic vs anchored represent all the geometries
-    // that we can support with the point-pair fallback. Do those first.
-    dynamic_tree_.collide(&data, hydroelastic::CallbackWithFallback<T>);
-
-    FclCollide(dynamic_tree_, anchored_tree_, &data,
-               hydroelastic::CallbackWithFallback<T>);
+    if (hydroelastic_num_threads_ > 1) {
+      ComputeHydroelasticInParallel(X_WGs, representation,
+                                    hydroelastic::CallbackWithFallback<T>,
+                                    surfaces, point_pairs);
+    } else {
+      // All these quantities, except `representation`, are aliased in the
+      // callback data.
+      const CoherenceLease coherence(*this);
+      const WorkspaceLease workspace(*this, 1);
+      hydroelastic::CallbackWithFallbackData<T> data{
+          hydroelastic::CallbackData<T>{
+              &collision_filter_, &X_WGs, &hydroelastic_geometries_,
+              representation, surfaces, coherence.get(), workspace.get(0)},
+          point_pairs};
+
+      // Dynamic vs dynamic and dynamic vs anchored represent all the
+      // geometries that we can support with the point-pair fallback. Do those
+      // first.
+      dynamic_tree_.collide(&data, hydroelastic::CallbackWithFallback<T>);
+
+      FclCollide(dynamic_tree_, anchored_tree_, &data,
+                 hydroelastic::CallbackWithFallback<T>);
+    }
 
     std::sort(surfaces->begin(), surfaces->end(), OrderContactSurface<T>);
 
@@ -894,19 +1277,28 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
       const ProximityProperties& props, bool is_dynamic,
       fcl::DynamicAABBTreeCollisionManager<double>* tree,
       unordered_map<GeometryId, unique_ptr<CollisionObjectd>>* objects) {
+    MaybeAddSignedDistanceField(shape, id, props);
     ReifyData data{nullptr, id, props};
     shape.Reify(this, &data);
 
     data.fcl_object->setTransform(X_WG.GetAsIsometry3());
     data.fcl_object->computeAABB();
-    EncodedData encoding(id, is_dynamic);
+    collision_filter_.AddGeometry(id);
+    EncodedData encoding(id, is_dynamic, collision_filter_.GetIndex(id));
     encoding.write_to(data.fcl_object.get());
 
     tree->registerObject(data.fcl_object.get());
     tree->update();
     (*objects)[id] = std::move(data.fcl_object);
+  }
 
-    collision_filter_.AddGeometry(id);
+  // Builds the signed distance field of the geometry, if its properties call
+  // for one.
+  void MaybeAddSignedDistanceField(const Shape& shape, GeometryId id,
+                                   const ProximityProperties& props) {
+    std::unique_ptr<SignedDistanceField> field =
+        MaybeMakeSignedDistanceField(shape, props);
+    if (field != nullptr) signed_distance_fields_[id] = std::move(field);
   }
 
   // Removes the geometry with the given id from the given tree.
@@ -960,9 +1352,38 @@ class ProximityEngine<T>::Impl : public ShapeReifier {
   // @see ProximityEngine::set_distance_tolerance() for more details.
   double distance_tolerance_{1E-6};
 
+  // The maximum number of threads used to compute contact surfaces.
+  // @see ProximityEngine::set_hydroelastic_num_threads() for more details.
+  int hydroelastic_num_threads_{1};
+
+  // The threads that compute contact surfaces in parallel, or nullptr when
+  // hydroelastic_num_threads_ is one. Each engine owns its own pool.
+  unique_ptr<drake::internal::ThreadPool> hydroelastic_thread_pool_;
+
+  // Whether contact surfaces are computed with temporal coherence.
+  // @see ProximityEngine::set_hydroelastic_coherence_enabled().
+  bool hydroelastic_coherence_enabled_{false};
+
+  // The temporal coherence data of the pairs of geometries; it is updated by
+  // the (const) contact surface queries, one at a time (see CoherenceLease).
+  // It is empty unless coherence is enabled and is not copied with the
+  // engine.
+  mutable hydroelastic::CoherenceCache coherence_cache_;
+  mutable std::mutex coherence_mutex_;
+
+  // The pool of scratch memory of the contact surface computations; the
+  // (const) contact surface queries check workspaces out of it for their
+  // duration (see WorkspaceLease). It is not copied with the engine.
+  mutable vector<unique_ptr<ContactSurfaceWorkspace<T>>> workspace_pool_;
+  mutable std::mutex workspace_mutex_;
+
   // All of the hydroelastic representations of supported geometries -- this
   // can get quite large based on mesh resolution.
   hydroelastic::Geometries hydroelastic_geometries_;
+
+  // The precomputed signed distance fields of the mesh geometries whose
+  // properties declare one. The fields are immutable and shared by copies.
+  SignedDistanceFields signed_distance_fields_;
 };
 
 template <typename T>
@@ -1070,12 +1491,37 @@ CollisionFilter& ProximityEngine<T>::collision_filter() {
   return impl_->collision_filter();
 }
 
+template <typename T>
+void ProximityEngine<T>::set_hydroelastic_num_threads(int num_threads) {
+  impl_->set_hydroelastic_num_threads(num_threads);
+}
+
+template <typename T>
+int ProximityEngine<T>::hydroelastic_num_threads() const {
+  return impl_->hydroelastic_num_threads();
+}
+
+template <typename T>
+void ProximityEngine<T>::set_hydroelastic_coherence_enabled(bool enabled) {
+  impl_->set_hydroelastic_coherence_enabled(enabled);
+}
+
+template <typename T>
+bool ProximityEngine<T>::hydroelastic_coherence_enabled() const {
+  return impl_->hydroelastic_coherence_enabled();
+}
+
 template <typename T>
 void ProximityEngine<T>::UpdateWorldPoses(
     const unordered_map<GeometryId, RigidTransform<T>>& X_WGs) {
   impl_->UpdateWorldPoses(X_WGs);
 }
 
+template <typename T>
+void ProximityEngine<T>::UpdateWorldPoses(const WorldPoseBuffer& X_WGs) {
+  impl_->UpdateWorldPoses(X_WGs);
+}
+
 template <typename T>
 std::vector<SignedDistancePair<T>>
 ProximityEngine<T>::ComputeSignedDistancePairwiseClosestPoints(
@@ -1102,6 +1548,14 @@ ProximityEngine<T>::ComputeSignedDistanceToPoint(
   return impl_->ComputeSignedDistanceToPoint(query, X_WGs, threshold);
 }
 
+template <typename T>
+SignedDistanceToPointBatch<T> ProximityEngine<T>::ComputeSignedDistanceToPoints(
+    const Matrix3X<T>& p_WQs,
+    const std::unordered_map<GeometryId, RigidTransform<T>>& X_WGs,
+    const double threshold) const {
+  return impl_->ComputeSignedDistanceToPoints(p_WQs, X_WGs, threshold);
+}
+
 template <typename T>
 bool ProximityEngine<T>::HasCollisions() const {
   return impl_->HasCollisions();
@@ -19,6 +19,7 @@
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/geometry/shape_specification.h"
+#include "drake/geometry/world_pose_buffer.h"
 #include "drake/math/rigid_transform.h"
 
 namespace drake {
@@ -151,6 +152,53 @@ class ProximityEngine {
 
   double distance_tolerance() const;
 
+  /* Sets the maximum number of threads used to compute hydroelastic contact
+   surfaces (i.e., by ComputeContactSurfaces(),
+   ComputePolygonalContactSurfaces(), and their "WithFallback" variants).
+
+   With the default value of one, the candidate pairs reported by the
+   broadphase are processed serially, in the broadphase callback. With a value
+   greater than one, the broadphase first collects all candidate pairs, the
+   per-pair contact surfaces are then computed concurrently, and the results
+   are merged in the same deterministic order as the serial computation. The
+   two modes produce identical results.
+
+   The threads belong to a pool that the engine keeps for as long as the
+   setting is unchanged, so the per-query cost of the parallel mode does not
+   include spawning threads. A copy of the engine gets its own pool.
+
+   Either way, each query computes the contact surfaces with scratch memory
+   (one ContactSurfaceWorkspace per thread) that it checks out of a pool owned
+   by the engine and returns when done, so that the memory is reused from one
+   query to the next. Concurrent queries of a single engine use distinct
+   workspaces.
+   @throws std::exception if `num_threads` is less than one.  */
+  void set_hydroelastic_num_threads(int num_threads);
+
+  int hydroelastic_num_threads() const;
+
+  /* Enables (or disables) the exploitation of temporal coherence in the
+   computation of hydroelastic contact surfaces between soft and rigid meshes.
+
+   When enabled, the engine keeps, for each such pair of geometries, the front
+   of the previous query's bounding volume tree traversal and the size of its
+   contact surface. The next query on that pair (e.g., in the next time step)
+   starts its traversal from that front and sizes its buffers up front. This
+   pays off when the geometries move little between queries, as in
+   quasi-static manipulation. The contact surfaces are the same as they would
+   be without it. The data of a pair is discarded when the pair isn't
+   queried, or when either geometry is removed or its representation changes.
+
+   The data belongs to this engine (and so to the Context that owns it); it
+   is not copied with the engine. Although it is updated by the (const)
+   queries, the engine can still be queried from multiple threads at once:
+   only one query at a time uses the data, while any concurrent query
+   proceeds without it (and produces the same contact surfaces). Disabled by
+   default; disabling it discards the data.  */
+  void set_hydroelastic_coherence_enabled(bool enabled);
+
+  bool hydroelastic_coherence_enabled() const;
+
   //@}
 
   /* Updates the poses for all of the _dynamic_ geometries in the engine.
@@ -166,6 +214,12 @@ class ProximityEngine {
   void UpdateWorldPoses(
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs);
 
+  /* Updates the poses for only the geometries in `X_WGs`; the poses of all
+   other dynamic geometries are assumed to be unchanged since the last update.
+   Geometries in `X_WGs` which aren't dynamic geometries in this engine are
+   ignored. The poses are read in place from the buffer.  */
+  void UpdateWorldPoses(const WorldPoseBuffer& X_WGs);
+
   // ----------------------------------------------------------------------
   /* @name              Signed Distance Queries
   See @ref signed_distance_query "Signed Distance Query" for more details.  */
@@ -198,6 +252,14 @@ class ProximityEngine {
       const Vector3<T>& p_WQ,
       const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
       const double threshold = std::numeric_limits<double>::infinity()) const;
+
+  /* Implementation of GeometryState::ComputeSignedDistanceToPoints().
+   This includes `X_WGs`, the current poses of all geometries in World in the
+   current scalar type, keyed on each geometry's GeometryId.  */
+  SignedDistanceToPointBatch<T> ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const std::unordered_map<GeometryId, math::RigidTransform<T>>& X_WGs,
+      const double threshold = std::numeric_limits<double>::infinity()) const;
   //@}
 
 
@@ -14,6 +14,14 @@ const char* const kHydroGroup = "hydroelastic";
 const char* const kRezHint = "resolution_hint";
 const char* const kComplianceType = "compliance_type";
 const char* const kSlabThickness = "slab_thickness";
+const char* const kBvhBuildStrategy = "bvh_build_strategy";
+const char* const kBvhBuildThreads = "bvh_build_threads";
+
+const char* const kSdfGroup = "signed_distance_field";
+const char* const kSdfResolution = "resolution";
+const char* const kSdfBandWidth = "band_width";
+const char* const kSdfMaxMemory = "max_memory_bytes";
+const char* const kSdfCachePath = "cache_path";
 
 std::ostream& operator<<(std::ostream& out, const HydroelasticType& type) {
   switch (type) {
@@ -126,5 +134,35 @@ void AddSoftHydroelasticPropertiesForHalfSpace(
   AddSoftHydroelasticProperties(properties);
 }
 
+void AddSignedDistanceFieldProperties(
+    double resolution, double band_width,
+    const std::optional<std::string>& cache_path,
+    const std::optional<double>& max_memory_bytes,
+    ProximityProperties* properties) {
+  DRAKE_DEMAND(properties != nullptr);
+  if (!(resolution > 0)) {
+    throw std::logic_error(fmt::format(
+        "The signed distance field resolution must be positive; given {}",
+        resolution));
+  }
+  if (!(band_width >= 0)) {
+    throw std::logic_error(fmt::format(
+        "The signed distance field band width can't be negative; given {}",
+        band_width));
+  }
+  properties->AddProperty(internal::kSdfGroup, internal::kSdfResolution,
+                          resolution);
+  properties->AddProperty(internal::kSdfGroup, internal::kSdfBandWidth,
+                          band_width);
+  if (cache_path.has_value()) {
+    properties->AddProperty(internal::kSdfGroup, internal::kSdfCachePath,
+                            *cache_path);
+  }
+  if (max_memory_bytes.has_value()) {
+    properties->AddProperty(internal::kSdfGroup, internal::kSdfMaxMemory,
+                            *max_memory_bytes);
+  }
+}
+
 }  // namespace geometry
 }  // namespace drake
@@ -9,6 +9,7 @@
 
 #include <optional>
 #include <ostream>
+#include <string>
 
 #include "drake/geometry/geometry_roles.h"
 #include "drake/multibody/plant/coulomb_friction.h"
@@ -66,6 +67,25 @@ extern const char* const kRezHint;          ///< Resolution hint property name.
 extern const char* const kComplianceType;   ///< Compliance type property name.
 extern const char* const kSlabThickness;    ///< Slab thickness property name
                                             ///< (for half spaces).
+extern const char* const kBvhBuildStrategy;  ///< Bvh build strategy property
+                                             ///< name (a BvhBuildStrategy).
+extern const char* const kBvhBuildThreads;   ///< Bvh build thread count
+                                             ///< property name (an int).
+
+//@}
+
+/* @name  Declaring a precomputed signed distance field.
+
+ Mesh and Convex geometries carrying these properties get a precomputed signed
+ distance field (see SignedDistanceField) at registration, with which the
+ signed distance to point queries are answered.  */
+//@{
+
+extern const char* const kSdfGroup;       ///< Signed distance field group name.
+extern const char* const kSdfResolution;  ///< Voxel size property name.
+extern const char* const kSdfBandWidth;   ///< Band width property name.
+extern const char* const kSdfMaxMemory;   ///< Memory limit property name.
+extern const char* const kSdfCachePath;   ///< Cache file property name.
 
 //@}
 
@@ -199,5 +219,33 @@ void AddSoftHydroelasticPropertiesForHalfSpace(double slab_thickness,
 
 //@}
 
+/** Adds properties to the given set of proximity properties that cause a Mesh
+ or Convex geometry to get a precomputed signed distance field at registration.
+ Signed distance to point queries against the geometry are then answered from
+ the field (in constant time, respecting the mesh's non-convex features)
+ instead of being unsupported. The field is sampled at full resolution near the
+ mesh surface and coarsely elsewhere. The mesh must be closed and consistently
+ oriented with outward-pointing faces. The properties are ignored for all other
+ shapes.
+
+ @param resolution        The edge length of the field's voxels (in meters).
+ @param band_width        The field is sampled at full resolution within this
+                          distance of the mesh surface (in meters).
+ @param cache_path        If given, the field is read from this file if it
+                          holds a field for the same mesh and parameters;
+                          otherwise, the computed field is written to it.
+ @param max_memory_bytes  If given, the largest number of bytes the field may
+                          occupy (the default is 256 MiB). Registering a
+                          geometry whose field would be larger throws.
+ @param[in,out] properties    The properties will be added to this property set.
+ @throws std::exception   If `resolution` is not positive, `band_width` is
+                          negative, or `properties` already has properties with
+                          the names that this function would need to add.  */
+void AddSignedDistanceFieldProperties(
+    double resolution, double band_width,
+    const std::optional<std::string>& cache_path,
+    const std::optional<double>& max_memory_bytes,
+    ProximityProperties* properties);
+
 }  // namespace geometry
 }  // namespace drake
@@ -185,6 +185,16 @@ QueryObject<T>::ComputeSignedDistanceToPoint(
   return state.ComputeSignedDistanceToPoint(p_WQ, threshold);
 }
 
+template <typename T>
+SignedDistanceToPointBatch<T> QueryObject<T>::ComputeSignedDistanceToPoints(
+    const Matrix3X<T>& p_WQs, const double threshold) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  return state.ComputeSignedDistanceToPoints(p_WQs, threshold);
+}
+
 template <typename T>
 void QueryObject<T>::RenderColorImage(const ColorRenderCamera& camera,
                                       FrameId parent_frame,
@@ -221,6 +231,16 @@ void QueryObject<T>::RenderLabelImage(const ColorRenderCamera& camera,
   return state.RenderLabelImage(camera, parent_frame, X_PC, label_image_out);
 }
 
+template <typename T>
+void QueryObject<T>::RenderImages(
+    const std::vector<render::ImageRenderRequest>& requests) const {
+  ThrowIfNotCallable();
+
+  FullPoseUpdate();
+  const GeometryState<T>& state = geometry_state();
+  state.RenderImages(requests);
+}
+
 template <typename T>
 const render::RenderEngine* QueryObject<T>::GetRenderEngineByName(
     const std::string& name) const {
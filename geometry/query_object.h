@@ -11,6 +11,7 @@
 #include "drake/geometry/query_results/signed_distance_pair.h"
 #include "drake/geometry/query_results/signed_distance_to_point.h"
 #include "drake/geometry/render/render_camera.h"
+#include "drake/geometry/render/render_engine.h"
 #include "drake/geometry/scene_graph_inspector.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/systems/framework/context.h"
@@ -631,7 +632,12 @@ class QueryObject {
    between geometry approximately 20cm in size and a point.
 
    - ᵃ Unsupported geometry/scalar combinations are simply ignored; no results
-       are reported for that geometry.
+       are reported for that geometry. The exception is a %Mesh or %Convex
+       whose proximity properties declare a signed distance field (see
+       AddSignedDistanceFieldProperties()): it is reported for both scalars,
+       with the field's discretization error (on the order of its resolution
+       near the surface and of its brick size away from it), and respects
+       the mesh's non-convex features.
    - ᵇ This uses an *iterative* algorithm which introduces a relatively large
        and variable error. For example, as the eccentricity of the ellipsoid
        increases, this error may get worse. It also depends on the location of
@@ -681,6 +687,32 @@ class QueryObject {
   ComputeSignedDistanceToPoint(const Vector3<T> &p_WQ,
                                const double threshold
                                = std::numeric_limits<double>::infinity()) const;
+
+  /**
+   A batched variant of ComputeSignedDistanceToPoint() which computes the
+   signed distances and gradients to _many_ query points at once. For each
+   query point Qᵢ it reports exactly what ComputeSignedDistanceToPoint() reports
+   for Qᵢ alone (up to round-off), with the same scalar and shape support and
+   the same conventions for undefined gradients.
+
+   Prefer this query when the number of points is large (e.g., points from a
+   depth sensor). The points are grouped into clusters of nearby points, and
+   the broadphase is traversed once per cluster rather than once per point.
+   For double, the distances from a cluster's points to spheres, boxes,
+   capsules, cylinders, and half spaces are evaluated with vectorized
+   arithmetic.
+
+   @param[in] p_WQs           The positions of the query points Qᵢ in world
+                              frame W, one per column.
+   @param[in] threshold       We ignore any object beyond this distance from a
+                              query point. By default, it is infinity, so we
+                              report distances from every query point to every
+                              object.
+   @retval signed_distances   The packed results for all query points; see
+                              SignedDistanceToPointBatch. */
+  SignedDistanceToPointBatch<T> ComputeSignedDistanceToPoints(
+      const Matrix3X<T>& p_WQs,
+      const double threshold = std::numeric_limits<double>::infinity()) const;
   //@}
 
 
@@ -738,6 +770,26 @@ class QueryObject {
                         FrameId parent_frame, const math::RigidTransformd& X_PC,
                         systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** Renders the images of many cameras at once. Each request is rendered as
+   if by the corresponding Render*Image() methods, but with the camera pose
+   `X_WC` given directly in the world frame (e.g., computed with
+   GetPoseInWorld() for the camera's parent frame). The requests are grouped
+   by renderer (as named by their cameras), and each renderer renders its
+   group in a single call to RenderEngine::RenderImages(); a renderer may
+   render them concurrently (see, e.g., RenderEngineVtkParams).
+
+   This is meant for systems that render many cameras at the same time;
+   RgbdSensor, whose images are computed independently by its output ports,
+   still renders its images one at a time.
+
+   @throws std::exception if a request's color and depth cameras name
+                          different renderers, a named renderer doesn't exist,
+                          or as documented for RenderEngine::RenderImages().
+                          Each renderer validates its requests before
+                          rendering any of them.  */
+  void RenderImages(
+      const std::vector<render::ImageRenderRequest>& requests) const;
+
 
   /** Returns the named render engine, if it exists. The RenderEngine is
    guaranteed to be up to date w.r.t. the poses and data in the context. */
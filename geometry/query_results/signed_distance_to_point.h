@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <vector>
 
 #include "drake/common/drake_copyable.h"
 #include "drake/common/drake_deprecated.h"
@@ -73,5 +74,51 @@ struct SignedDistanceToPoint{
   Vector3<T> grad_W;
 };
 
+/** The data for reporting the signed distances from a _batch_ of query points
+  to the geometries (see QueryObject::ComputeSignedDistanceToPoints()).
+
+  Each result is the signed distance between one query point Qᵢ and one
+  geometry G; it carries the same quantities as SignedDistanceToPoint. The
+  results are packed into parallel arrays (one entry or column per result) and
+  grouped by query point: the results for query point i occupy the index range
+  [offsets[i], offsets[i + 1]). Within that range, results are ordered by
+  increasing geometry id.
+
+  @tparam T The underlying scalar type. Must be a valid Eigen scalar.
+ */
+template <typename T>
+struct SignedDistanceToPointBatch {
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(SignedDistanceToPointBatch)
+
+  /** Constructs the results for an empty batch (of zero query points).  */
+  SignedDistanceToPointBatch() = default;
+
+  /** Returns the number of query points.  */
+  int num_points() const { return static_cast<int>(offsets.size()) - 1; }
+
+  /** Returns the total number of results (over all query points).  */
+  int num_results() const { return static_cast<int>(id_G.size()); }
+
+  /** Returns the result with index `k` (in the range [0, num_results())) as a
+   SignedDistanceToPoint.  */
+  SignedDistanceToPoint<T> result(int k) const {
+    return SignedDistanceToPoint<T>(id_G[k], p_GN.col(k), distance(k),
+                                    grad_W.col(k));
+  }
+
+  /** The num_points() + 1 offsets delimiting each query point's results.  */
+  std::vector<int> offsets{0};
+  /** For each result, the id of the geometry G.  */
+  std::vector<GeometryId> id_G;
+  /** For each result, the position of the nearest point N on G's surface,
+      expressed in G's frame.  */
+  Matrix3X<T> p_GN;
+  /** For each result, the signed distance between the query point and G.  */
+  VectorX<T> distance;
+  /** For each result, the gradient of the distance function with respect to
+      the query point, expressed in world frame W.  */
+  Matrix3X<T> grad_W;
+};
+
 }  // namespace geometry
 }  // namespace drake
@@ -103,6 +103,59 @@ void RenderEngine::DoRenderLabelImage(const ColorRenderCamera&,
                   NiceTypeName::Get(*this)));
 }
 
+void RenderEngine::RenderImages(
+    const std::vector<ImageRenderRequest>& requests) const {
+  for (const ImageRenderRequest& request : requests) {
+    if ((request.color_image_out != nullptr ||
+         request.label_image_out != nullptr) &&
+        !request.color_camera.has_value()) {
+      throw std::logic_error(
+          "RenderImages(): a request for a color or label image must provide "
+          "a color camera");
+    }
+    if (request.depth_image_out != nullptr &&
+        !request.depth_camera.has_value()) {
+      throw std::logic_error(
+          "RenderImages(): a request for a depth image must provide a depth "
+          "camera");
+    }
+    if (request.color_image_out != nullptr) {
+      ThrowIfInvalid(request.color_camera->core().intrinsics(),
+                     request.color_image_out, "color");
+    }
+    if (request.depth_image_out != nullptr) {
+      ThrowIfInvalid(request.depth_camera->core().intrinsics(),
+                     request.depth_image_out, "depth");
+    }
+    if (request.label_image_out != nullptr) {
+      ThrowIfInvalid(request.color_camera->core().intrinsics(),
+                     request.label_image_out, "label");
+    }
+  }
+  DoRenderImages(requests);
+}
+
+void RenderEngine::DoRenderImages(
+    const std::vector<ImageRenderRequest>& requests) const {
+  for (const ImageRenderRequest& request : requests) {
+    RenderRequest(request);
+  }
+}
+
+void RenderEngine::RenderRequest(const ImageRenderRequest& request) const {
+  // The viewpoint is overwritten by every request (see RenderImages()).
+  const_cast<RenderEngine*>(this)->UpdateViewpoint(request.X_WC);
+  if (request.color_image_out != nullptr) {
+    DoRenderColorImage(*request.color_camera, request.color_image_out);
+  }
+  if (request.depth_image_out != nullptr) {
+    DoRenderDepthImage(*request.depth_camera, request.depth_image_out);
+  }
+  if (request.label_image_out != nullptr) {
+    DoRenderLabelImage(*request.color_camera, request.label_image_out);
+  }
+}
+
 void RenderEngine::SetDefaultLightPosition(const Vector3<double>&) {}
 
 }  // namespace render
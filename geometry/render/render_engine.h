@@ -17,6 +17,7 @@
 #include "drake/geometry/render/render_label.h"
 #include "drake/geometry/shape_specification.h"
 #include "drake/geometry/utilities.h"
+#include "drake/geometry/world_pose_buffer.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/systems/sensors/camera_info.h"
 #include "drake/systems/sensors/color_palette.h"
@@ -24,8 +25,39 @@
 
 namespace drake {
 namespace geometry {
+
+template <typename T>
+class GeometryState;
+
 namespace render {
 
+/** A request for the images of a single camera as part of a batch of images
+ rendered by RenderEngine::RenderImages(). A request can ask for any
+ combination of color, depth, and label images; those which are not wanted
+ are left as `nullptr`. Color and label images are rendered with
+ `color_camera` and depth images with `depth_camera`, so the corresponding
+ camera must be provided for each requested image.  */
+struct ImageRenderRequest {
+  /** The pose of the camera's viewpoint in the world frame (see
+   RenderEngine::UpdateViewpoint()).  */
+  math::RigidTransformd X_WC;
+
+  /** The camera for the color and label images.  */
+  std::optional<ColorRenderCamera> color_camera;
+
+  /** The camera for the depth image.  */
+  std::optional<DepthRenderCamera> depth_camera;
+
+  /** The (optional) output color image.  */
+  systems::sensors::ImageRgba8U* color_image_out{};
+
+  /** The (optional) output depth image.  */
+  systems::sensors::ImageDepth32F* depth_image_out{};
+
+  /** The (optional) output label image.  */
+  systems::sensors::ImageLabel16I* label_image_out{};
+};
+
 /** The engine for performing rasterization operations on geometry. This
  includes rgb images and depth images. The coordinate system of
  %RenderEngine's viewpoint `R` is `X-right`, `Y-down` and `Z-forward`
@@ -226,6 +258,23 @@ class RenderEngine : public ShapeReifier {
     DoRenderLabelImage(camera, label_image_out);
   }
 
+  /** Renders all of the images for a batch of cameras. Each request is
+   rendered from its own viewpoint `X_WC`, as if by calling UpdateViewpoint()
+   followed by the requested Render*Image() methods. Afterwards, the engine's
+   viewpoint is unspecified. (Like the Render*Image() methods, this is const so
+   that it can be invoked through QueryObject::RenderImages(), even though it
+   changes the viewpoint.)
+
+   The default implementation renders the requests serially; derived engines
+   may render them concurrently (see, e.g., RenderEngineVtkParams).
+
+   @throws std::exception if any request asks for an image without providing
+                          the corresponding camera, or any of the requested
+                          images is invalid (as for the Render*Image()
+                          methods). The requests are all validated before any
+                          image is rendered.  */
+  void RenderImages(const std::vector<ImageRenderRequest>& requests) const;
+
   //@}
 
   /** Reports the render label value this render engine has been configured to
@@ -236,6 +285,22 @@ class RenderEngine : public ShapeReifier {
   // Allow derived classes to implement Cloning via copy-construction.
   DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(RenderEngine)
 
+  /** Updates the poses of those geometries in `X_WGs` which are marked as
+   "needing update" (see RegisterVisual()); all other geometries are ignored.
+   This allows GeometryState to only push the poses which have actually
+   changed; the buffer is an internal type, so this overload is not part of
+   the public API.
+
+   @param X_WGs  The double-valued poses of the geometries whose poses may have
+                 changed.  */
+  void UpdatePoses(const geometry::internal::WorldPoseBuffer& X_WGs) {
+    for (int i = 0; i < X_WGs.size(); ++i) {
+      const GeometryId id = X_WGs.id(i);
+      if (update_ids_.count(id) == 0) continue;
+      DoUpdateVisualPose(id, X_WGs.pose(i));
+    }
+  }
+
   /** The NVI-function for sub-classes to implement actual geometry
    registration. If the derived class chooses not to register this particular
    shape, it should return false.
@@ -309,6 +374,16 @@ class RenderEngine : public ShapeReifier {
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const;
 
+  /** The NVI-function for rendering a batch of images. When RenderImages()
+   calls this, it has already validated every request. The default
+   implementation renders each request in turn with RenderRequest().  */
+  virtual void DoRenderImages(
+      const std::vector<ImageRenderRequest>& requests) const;
+
+  /** Renders the images of the single given (validated) `request`: updates
+   the viewpoint and dispatches to the DoRender*Image() methods.  */
+  void RenderRequest(const ImageRenderRequest& request) const;
+
   /** Extracts the `(label, id)` RenderLabel property from the given
    `properties` and validates it (or the configured default if no such
    property is defined).
@@ -388,6 +463,11 @@ class RenderEngine : public ShapeReifier {
  private:
   friend class RenderEngineTester;
 
+  // GeometryState pushes its updated poses with the WorldPoseBuffer overload
+  // of UpdatePoses().
+  template <typename>
+  friend class geometry::GeometryState;
+
   // The following two sets store all registered geometry ids. It must be the
   // case that the members of the two maps are disjoint and span all of the
   // registered geometries. This dichotomy facilitates updating only those
@@ -1,5 +1,7 @@
 #include "drake/geometry/render/render_engine_vtk.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <limits>
 #include <optional>
@@ -8,6 +10,7 @@
 
 #include <vtkCamera.h>
 #include <vtkCylinderSource.h>
+#include <vtkMatrix4x4.h>
 #include <vtkOBJReader.h>
 #include <vtkOpenGLPolyDataMapper.h>
 #include <vtkOpenGLTexture.h>
@@ -18,6 +21,8 @@
 #include <vtkTransform.h>
 #include <vtkTransformPolyDataFilter.h>
 
+#include <fmt/format.h>
+
 #include "drake/common/text_logging.h"
 #include "drake/geometry/render/render_engine_vtk_base.h"
 #include "drake/geometry/render/shaders/depth_shaders.h"
@@ -108,14 +113,21 @@ ShaderCallback::ShaderCallback() :
 
 }  // namespace internal
 
-vtkNew<internal::ShaderCallback> RenderEngineVtk::uniform_setting_callback_;
-
 RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
     : RenderEngine(parameters.default_label ? *parameters.default_label
                                             : RenderLabel::kUnspecified),
       pipelines_{{make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>(),
-                  make_unique<RenderingPipeline>()}} {
+                  make_unique<RenderingPipeline>()}},
+      uniform_setting_callback_(
+          vtkSmartPointer<internal::ShaderCallback>::New()),
+      parameters_(parameters) {
+  if (parameters.num_render_threads < 1) {
+    throw std::logic_error(fmt::format(
+        "RenderEngineVtk: the number of render threads must be positive; "
+        "given {}",
+        parameters.num_render_threads));
+  }
   if (parameters.default_diffuse) {
     default_diffuse_ = *parameters.default_diffuse;
   }
@@ -126,6 +138,15 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtkParams& parameters)
   InitializePipelines();
 }
 
+RenderEngineVtk::~RenderEngineVtk() {
+  // Each worker is destroyed on the thread that renders with it.
+  if (render_threads_ != nullptr) {
+    render_threads_->RunOnEachThread([this](int thread_index) {
+      if (thread_index > 0) workers_[thread_index - 1].reset();
+    });
+  }
+}
+
 void RenderEngineVtk::UpdateViewpoint(const RigidTransformd& X_WC) {
   vtkSmartPointer<vtkTransform> vtk_X_WC = ConvertToVtkTransform(X_WC);
 
@@ -135,6 +156,15 @@ void RenderEngineVtk::UpdateViewpoint(const RigidTransformd& X_WC) {
   }
 }
 
+void RenderEngineVtk::ThrowIfDepthOnly(const char* image_type) const {
+  if (parameters_.depth_only) {
+    throw std::logic_error(fmt::format(
+        "RenderEngineVtk: can't render a {} image; the engine was configured "
+        "to render depth images only",
+        image_type));
+  }
+}
+
 void RenderEngineVtk::ImplementGeometry(const Sphere& sphere, void* user_data) {
   vtkNew<vtkTexturedSphereSource> vtk_sphere;
   SetSphereOptions(vtk_sphere.GetPointer(), sphere.radius());
@@ -192,6 +222,11 @@ bool RenderEngineVtk::DoRegisterVisual(
   // Note: the user_data interface on reification requires a non-const pointer.
   RegistrationData data{properties, X_WG, id};
   shape.Reify(this, &data);
+  if (parameters_.num_render_threads > 1) {
+    registrations_[id] =
+        Registration{copyable_unique_ptr<Shape>(shape.Clone()), properties};
+    if (render_threads_ != nullptr) changed_geometries_.push_back(id);
+  }
   return true;
 }
 
@@ -216,6 +251,9 @@ bool RenderEngineVtk::DoRemoveGeometry(GeometryId id) {
       pipelines_[i]->renderer->RemoveActor(pipe_actors[i]);
     }
     actors_.erase(iter);
+    if (registrations_.erase(id) > 0 && render_threads_ != nullptr) {
+      changed_geometries_.push_back(id);
+    }
     return true;
   }
 
@@ -229,6 +267,7 @@ std::unique_ptr<RenderEngine> RenderEngineVtk::DoClone() const {
 void RenderEngineVtk::DoRenderColorImage(
     const ColorRenderCamera& camera,
     ImageRgba8U* color_image_out) const {
+  ThrowIfDepthOnly("color");
   UpdateWindow(camera.core(), camera.show_window(),
                pipelines_[ImageType::kColor].get(), "Color Image");
   PerformVtkUpdate(*pipelines_[ImageType::kColor]);
@@ -244,35 +283,36 @@ void RenderEngineVtk::DoRenderDepthImage(
   UpdateWindow(camera, pipelines_[ImageType::kDepth].get());
   PerformVtkUpdate(*pipelines_[ImageType::kDepth]);
 
+  // The encoded depth is decoded straight from VTK's image data into the
+  // output image in a single pass (rather than being exported to an
+  // intermediate image first). The depth pipeline reads back only rgb, three
+  // bytes per pixel. VTK's image data starts at the *lower* left corner, so
+  // its rows are visited in reverse order.
   const CameraInfo& intrinsics = camera.core().intrinsics();
-  ImageRgba8U image(intrinsics.width(), intrinsics.height());
-  // TODO(SeanCurtis-TRI): We're doing multiple passes on the pixel data. This
-  // does one pass by copying the filter to the given image. We then do a second
-  // pass where we re-encode the values. It would be much better to process the
-  // pixels in a single pass.  The solution is to simply call
-  // exporter->GetPointerToData() and process the pixels as they are read.
-  // See the implementation in vtkImageExport::Export() for details.
-  pipelines_[ImageType::kDepth]->exporter->Export(image.at(0, 0));
+  const int width = intrinsics.width();
+  const int height = intrinsics.height();
+  const uint8_t* const encoded = static_cast<const uint8_t*>(
+      pipelines_[ImageType::kDepth]->exporter->GetPointerToData());
+  DRAKE_DEMAND(encoded != nullptr);
 
   const double min_depth = camera.depth_range().min_depth();
   const double max_depth = camera.depth_range().max_depth();
-  for (int v = 0; v < intrinsics.height(); ++v) {
-    for (int u = 0; u < intrinsics.width(); ++u) {
-      if (image.at(u, v)[0] == 255u && image.at(u, v)[1] == 255u &&
-          image.at(u, v)[2] == 255u) {
-        depth_image_out->at(u, v)[0] =
-            ImageTraits<PixelType::kDepth32F>::kTooFar;
+  for (int v = 0; v < height; ++v) {
+    const uint8_t* rgb = encoded + 3 * width * (height - 1 - v);
+    float* depth = depth_image_out->at(0, v);
+    for (int u = 0; u < width; ++u, rgb += 3) {
+      if (rgb[0] == 255u && rgb[1] == 255u && rgb[2] == 255u) {
+        depth[u] = ImageTraits<PixelType::kDepth32F>::kTooFar;
       } else {
         // Decoding three channel color values to a float value. For the detail,
         // see depth_shaders.h.
-        float shader_value = image.at(u, v)[0] + image.at(u, v)[1] / 255. +
-                             image.at(u, v)[2] / (255. * 255.);
+        float shader_value = rgb[0] + rgb[1] / 255. + rgb[2] / (255. * 255.);
 
         // Dividing by 255 so that the range gets to be [0, 1].
         shader_value /= 255.f;
         // TODO(kunimatsu-tri) Calculate this in a vertex shader.
-        depth_image_out->at(u, v)[0] = CheckRangeAndConvertToMeters(
-            shader_value, min_depth, max_depth);
+        depth[u] = CheckRangeAndConvertToMeters(shader_value, min_depth,
+                                                max_depth);
       }
     }
   }
@@ -281,25 +321,29 @@ void RenderEngineVtk::DoRenderDepthImage(
 void RenderEngineVtk::DoRenderLabelImage(
     const ColorRenderCamera& camera,
     ImageLabel16I* label_image_out) const {
+  ThrowIfDepthOnly("label");
   UpdateWindow(camera.core(), camera.show_window(),
                pipelines_[ImageType::kLabel].get(), "Label Image");
   PerformVtkUpdate(*pipelines_[ImageType::kLabel]);
 
-  // TODO(SeanCurtis-TRI): This copies the image and *that's* a tragedy. It
-  // would be much better to process the pixels directly. The solution is to
-  // simply call exporter->GetPointerToData() and process the pixels myself.
-  // See the implementation in vtkImageExport::Export() for details.
+  // As with depth images, the labels are decoded straight from VTK's (lower
+  // left origin) rgba image data into the output image.
   const CameraInfo& intrinsics = camera.core().intrinsics();
-  ImageRgba8U image(intrinsics.width(), intrinsics.height());
-  pipelines_[ImageType::kLabel]->exporter->Export(image.at(0, 0));
+  const int width = intrinsics.width();
+  const int height = intrinsics.height();
+  const uint8_t* const encoded = static_cast<const uint8_t*>(
+      pipelines_[ImageType::kLabel]->exporter->GetPointerToData());
+  DRAKE_DEMAND(encoded != nullptr);
 
   ColorI color;
-  for (int v = 0; v < intrinsics.height(); ++v) {
-    for (int u = 0; u < intrinsics.width(); ++u) {
-      color.r = image.at(u, v)[0];
-      color.g = image.at(u, v)[1];
-      color.b = image.at(u, v)[2];
-      label_image_out->at(u, v)[0] = RenderEngine::LabelFromColor(color);
+  for (int v = 0; v < height; ++v) {
+    const uint8_t* rgba = encoded + 4 * width * (height - 1 - v);
+    int16_t* label = label_image_out->at(0, v);
+    for (int u = 0; u < width; ++u, rgba += 4) {
+      color.r = rgba[0];
+      color.g = rgba[1];
+      color.b = rgba[2];
+      label[u] = RenderEngine::LabelFromColor(color);
     }
   }
 }
@@ -309,8 +353,11 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
       pipelines_{{make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>(),
                   make_unique<RenderingPipeline>()}},
+      uniform_setting_callback_(other.uniform_setting_callback_),
+      parameters_(other.parameters_),
       default_diffuse_{other.default_diffuse_},
-      default_clear_color_{other.default_clear_color_} {
+      default_clear_color_{other.default_clear_color_},
+      registrations_(other.registrations_) {
   InitializePipelines();
 
   // Utility function for creating a cloned actor which *shares* the same
@@ -322,6 +369,8 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
     std::array<vtkSmartPointer<vtkActor>, kNumPipelines>& clone_actors =
         *clone_actors_ptr;
     for (int i = 0; i < kNumPipelines; ++i) {
+      // A depth-only engine only populates the depth pipeline.
+      if (parameters_.depth_only && i != ImageType::kDepth) continue;
       // NOTE: source *should* be const; but none of the getters on the source
       // are const-compatible.
       DRAKE_DEMAND(source_actors[i]);
@@ -375,6 +424,78 @@ RenderEngineVtk::RenderEngineVtk(const RenderEngineVtk& other)
   }
 }
 
+void RenderEngineVtk::DoRenderImages(
+    const std::vector<ImageRenderRequest>& requests) const {
+  if (parameters_.num_render_threads == 1 || requests.size() <= 1) {
+    RenderEngine::DoRenderImages(requests);
+    return;
+  }
+  PrepareWorkers();
+  render_threads_->ParallelForWithThreadIndex(
+      0, static_cast<int>(requests.size()), 1,
+      [this, &requests](int thread_index, int i) {
+        const RenderEngineVtk& engine =
+            thread_index == 0 ? *this : *workers_[thread_index - 1];
+        engine.RenderRequest(requests[i]);
+      });
+}
+
+void RenderEngineVtk::PrepareWorkers() const {
+  if (render_threads_ == nullptr) {
+    render_threads_ = make_unique<drake::internal::ThreadPool>(
+        parameters_.num_render_threads);
+    workers_.resize(parameters_.num_render_threads - 1);
+  }
+
+  // Only the calling thread touches this engine's VTK objects; the workers
+  // read a copy of the geometry poses and the light position.
+  std::vector<std::pair<GeometryId, std::array<double, 16>>> poses;
+  poses.reserve(actors_.size());
+  for (const auto& [id, actors] : actors_) {
+    vtkLinearTransform* vtk_X_WG =
+        actors[ImageType::kDepth]->GetUserTransform();
+    std::array<double, 16> X_WG;
+    vtkMatrix4x4::DeepCopy(X_WG.data(), vtk_X_WG->GetMatrix());
+    poses.emplace_back(id, X_WG);
+  }
+  std::array<double, 3> p_WL;
+  light_->GetPosition(p_WL.data());
+
+  render_threads_->RunOnEachThread([&](int thread_index) {
+    if (thread_index == 0) return;
+    std::unique_ptr<RenderEngineVtk>& worker = workers_[thread_index - 1];
+    if (worker == nullptr) {
+      RenderEngineVtkParams worker_parameters = parameters_;
+      worker_parameters.num_render_threads = 1;
+      worker = make_unique<RenderEngineVtk>(worker_parameters);
+      for (const auto& [id, registration] : registrations_) {
+        worker->RegisterVisual(id, *registration.shape,
+                               registration.properties,
+                               RigidTransformd::Identity());
+      }
+    } else {
+      for (GeometryId id : changed_geometries_) {
+        worker->RemoveGeometry(id);
+        auto iter = registrations_.find(id);
+        if (iter != registrations_.end()) {
+          worker->RegisterVisual(id, *iter->second.shape,
+                                 iter->second.properties,
+                                 RigidTransformd::Identity());
+        }
+      }
+    }
+    for (const auto& [id, X_WG] : poses) {
+      auto vtk_X_WG = vtkSmartPointer<vtkTransform>::New();
+      vtk_X_WG->SetMatrix(X_WG.data());
+      for (const auto& worker_actor : worker->actors_.at(id)) {
+        worker_actor->SetUserTransform(vtk_X_WG);
+      }
+    }
+    worker->light_->SetPosition(p_WL.data());
+  });
+  changed_geometries_.clear();
+}
+
 void RenderEngineVtk::InitializePipelines() {
   const vtkSmartPointer<vtkTransform> vtk_identity =
       ConvertToVtkTransform(RigidTransformd::Identity());
@@ -423,7 +544,8 @@ void RenderEngineVtk::InitializePipelines() {
     pipeline->exporter->SetInputData(pipeline->filter->GetOutput());
     pipeline->exporter->ImageLowerLeftOff();
 
-    pipeline->renderer->AddLight(light_);
+    // The depth shader doesn't use lighting.
+    if (!parameters_.depth_only) pipeline->renderer->AddLight(light_);
   }
 
   // Pipeline-specific tweaks.
@@ -431,6 +553,8 @@ void RenderEngineVtk::InitializePipelines() {
   // Depth image background color is white -- the representation of the maximum
   // distance (e.g., infinity).
   pipelines_[ImageType::kDepth]->renderer->SetBackground(1., 1., 1.);
+  // The encoded depth only occupies the rgb channels; don't read back alpha.
+  pipelines_[ImageType::kDepth]->filter->SetInputBufferTypeToRGB();
 
   const ColorD empty_color =
       RenderEngine::GetColorDFromLabel(RenderLabel::kEmpty);
@@ -495,8 +619,19 @@ void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
     pipelines_[image_type]->renderer->AddActor(actors[image_type].Get());
   };
 
-  // Label actor.
+  // The label is validated even if no label actor is configured.
   const RenderLabel label = GetRenderLabelOrThrow(data.properties);
+
+  // Depth actor; always gets wired in with no additional work.
+  connect_actor(ImageType::kDepth);
+
+  if (parameters_.depth_only) {
+    // The color and label actors remain disconnected.
+    actors_.insert({data.id, std::move(actors)});
+    return;
+  }
+
+  // Label actor.
   if (label != RenderLabel::kDoNotRender) {
     // NOTE: We only configure the label actor if it doesn't have to "do not
     // render" label applied. We *have* created an actor and connected it to
@@ -562,9 +697,6 @@ void RenderEngineVtk::ImplementGeometry(vtkPolyDataAlgorithm* source,
 
   connect_actor(ImageType::kColor);
 
-  // Depth actor; always gets wired in with no additional work.
-  connect_actor(ImageType::kDepth);
-
   // Take ownership of the actors.
   actors_.insert({data.id, std::move(actors)});
 }
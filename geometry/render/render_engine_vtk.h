@@ -19,7 +19,9 @@
 #include <vtkSmartPointer.h>
 #include <vtkWindowToImageFilter.h>
 
+#include "drake/common/copyable_unique_ptr.h"
 #include "drake/common/drake_copyable.h"
+#include "drake/common/thread_pool.h"
 #include "drake/geometry/render/render_engine.h"
 #include "drake/geometry/render/render_engine_vtk_factory.h"
 #include "drake/geometry/render/render_label.h"
@@ -104,6 +106,8 @@ class RenderEngineVtk : public RenderEngine,
   RenderEngineVtk(
       const RenderEngineVtkParams& parameters = RenderEngineVtkParams());
 
+  ~RenderEngineVtk() override;
+
   /** @see RenderEngine::UpdateViewpoint().  */
   void UpdateViewpoint(const math::RigidTransformd& X_WR) override;
 
@@ -175,6 +179,20 @@ class RenderEngineVtk : public RenderEngine,
       const ColorRenderCamera& camera,
       systems::sensors::ImageLabel16I* label_image_out) const override;
 
+  // @see RenderEngine::DoRenderImages(). With multiple render threads, the
+  // requests are distributed across this engine and its workers.
+  void DoRenderImages(
+      const std::vector<ImageRenderRequest>& requests) const override;
+
+  // Throws if this engine only renders depth images; `image_type` names the
+  // requested image type for the error message.
+  void ThrowIfDepthOnly(const char* image_type) const;
+
+  // Creates the render threads and worker engines (if they don't already
+  // exist) and brings each worker up to date with this engine's geometry,
+  // poses, and lighting, on the worker's own thread.
+  void PrepareWorkers() const;
+
   // Initializes the VTK pipelines.
   void InitializePipelines();
 
@@ -225,15 +243,19 @@ class RenderEngineVtk : public RenderEngine,
   // (If there is deformable geometry, it will have to be handled differently.)
   // Having "shared geometry" means having shared vtkPolyDataAlgorithm and
   // vtkOpenGLPolyDataMapper instances. The shader callback gets registered to
-  // the *mapper* instances, so they all, implicitly, share the same callback.
-  // Making this member static facilitates that but it does preclude the
-  // possibility of simultaneous renderings with different uniform parameters.
-  // Currently, this doesn't happen because drake isn't particularly thread safe
-  // (or executed in such a context). However, this renderer will need some
-  // formal thread safe mechanism so that it doesn't rely on that in the future.
-  // TODO(SeanCurtis-TRI): This is not threadsafe; investigate mechanisms to
-  // prevent undesirable behaviors if used in multi-threaded application.
-  static vtkNew<internal::ShaderCallback> uniform_setting_callback_;
+  // the *mapper* instances, so an engine and all of its clones share the same
+  // callback. That precludes simultaneous renderings with different uniform
+  // parameters by an engine and its clones. The worker engines used for
+  // concurrent rendering (see workers_) have their own mappers and, therefore,
+  // their own callback.
+  // TODO(SeanCurtis-TRI): This is not threadsafe across clones; investigate
+  // mechanisms to prevent undesirable behaviors if used in multi-threaded
+  // application.
+  vtkSmartPointer<internal::ShaderCallback> uniform_setting_callback_;
+
+  // The parameters this engine was constructed with; used to construct worker
+  // engines.
+  RenderEngineVtkParams parameters_;
 
   // Obnoxious bright orange.
   Eigen::Vector4d default_diffuse_{0.9, 0.45, 0.1, 1.0};
@@ -245,6 +267,31 @@ class RenderEngineVtk : public RenderEngine,
   // depth, and label) keyed by the geometry's GeometryId.
   std::unordered_map<GeometryId, std::array<vtkSmartPointer<vtkActor>, 3>>
       actors_;
+
+  // What's needed to register a geometry with a worker engine.
+  struct Registration {
+    copyable_unique_ptr<Shape> shape;
+    PerceptionProperties properties;
+  };
+
+  // The registration data of every geometry, keyed by the geometry's id. It is
+  // only recorded if the engine has more than one render thread (and so may
+  // have workers).
+  std::unordered_map<GeometryId, Registration> registrations_;
+
+  // The geometries registered with or removed from this engine since the
+  // workers were last brought up to date; recorded once the workers exist.
+  mutable std::vector<GeometryId> changed_geometries_;
+
+  // The threads that render a batch in DoRenderImages(): the calling thread
+  // (thread 0) renders with this engine, and thread t > 0 with workers_[t - 1],
+  // an independent engine sharing no VTK objects with this one. Each worker is
+  // only ever created, updated, used, and destroyed on its own thread, so that
+  // its OpenGL context is never made current on another thread. They are
+  // created on demand by the (const) DoRenderImages() and are not copied when
+  // cloning.
+  mutable std::unique_ptr<drake::internal::ThreadPool> render_threads_;
+  mutable std::vector<std::unique_ptr<RenderEngineVtk>> workers_;
 };
 
 }  // namespace render
@@ -23,6 +23,25 @@ struct RenderEngineVtkParams  {
    channel in the range [0, 1]). The default value (in byte values) would be
    [204, 229, 255].  */
   Eigen::Vector3d default_clear_color{204 / 255., 229 / 255., 255 / 255.};
+
+  /** The maximum number of threads RenderEngine::RenderImages() (and so
+   QueryObject::RenderImages()) uses to render a batch of cameras
+   concurrently. With more than one thread, the engine
+   maintains additional, independent VTK pipelines (one set per extra thread,
+   each with its own copy of the registered geometry) so that the cameras can
+   be rendered in parallel. Each extra set of pipelines belongs to a persistent
+   thread of the engine, and its OpenGL context is only ever used on that
+   thread; the calling thread renders with the engine's own pipelines. This is
+   only beneficial with an OpenGL implementation that supports concurrent
+   contexts on multiple threads.  */
+  int num_render_threads{1};
+
+  /** If true, the engine is configured to render depth images only. Geometry
+   is registered with the depth pipeline alone: no textures are loaded, no
+   color or label pipelines are populated, and no lighting is applied. This
+   reduces the registration and per-frame overhead for depth sensors.
+   Attempting to render a color or label image with such an engine throws.  */
+  bool depth_only{false};
 };
 
 /** Constructs a RenderEngine implementation which uses a VTK-based OpenGL
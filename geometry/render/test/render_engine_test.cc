@@ -343,6 +343,78 @@ GTEST_TEST(RenderEngine, ValidateIntrinsicsAndImage) {
   });
 }
 
+// The batch render API validates every request before dispatching any of them
+// and, by default, renders the requests serially, in order, through the
+// DoRender*Image() API.
+GTEST_TEST(RenderEngine, RenderImages) {
+  DummyRenderEngine engine;
+  const int w = 2;
+  const int h = 2;
+  const CameraInfo intrinsics{w, h, M_PI};
+  const ColorRenderCamera color_camera{
+      {"color", intrinsics, {0.1, 10}, RigidTransformd{}}, false};
+  const DepthRenderCamera depth_camera{
+      {"depth", intrinsics, {0.1, 10}, RigidTransformd{}}, {1.0, 5.0}};
+  ImageRgba8U color{w, h};
+  ImageDepth32F depth{w, h};
+  ImageLabel16I label{w, h};
+
+  {
+    // Missing cameras are reported; nothing gets rendered.
+    ImageRenderRequest no_color_camera;
+    no_color_camera.label_image_out = &label;
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        engine.RenderImages({no_color_camera}), std::logic_error,
+        "RenderImages.+: a request for a color or label image must "
+        "provide a color camera");
+    ImageRenderRequest no_depth_camera;
+    no_depth_camera.color_camera = color_camera;
+    no_depth_camera.depth_image_out = &depth;
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        engine.RenderImages({no_depth_camera}), std::logic_error,
+        "RenderImages.+: a request for a depth image must provide a depth "
+        "camera");
+
+    // A bad image in a later request prevents the earlier from rendering.
+    ImageRenderRequest good;
+    good.color_camera = color_camera;
+    good.color_image_out = &color;
+    ImageDepth32F bad_depth{w + 1, h};
+    ImageRenderRequest bad;
+    bad.depth_camera = depth_camera;
+    bad.depth_image_out = &bad_depth;
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        engine.RenderImages({good, bad}), std::logic_error,
+        "The depth image to write has a size different from .*");
+    EXPECT_EQ(engine.num_color_renders(), 0);
+    EXPECT_EQ(engine.num_depth_renders(), 0);
+  }
+
+  {
+    // Each request renders only the images it asks for, from its own pose.
+    const RigidTransformd X_WC1(Vector3d(1, 2, 3));
+    const RigidTransformd X_WC2(Vector3d(-1, -2, -3));
+    ImageRenderRequest all;
+    all.X_WC = X_WC1;
+    all.color_camera = color_camera;
+    all.depth_camera = depth_camera;
+    all.color_image_out = &color;
+    all.depth_image_out = &depth;
+    all.label_image_out = &label;
+    ImageRenderRequest depth_only;
+    depth_only.X_WC = X_WC2;
+    depth_only.depth_camera = depth_camera;
+    depth_only.depth_image_out = &depth;
+    engine.RenderImages({all, depth_only});
+    EXPECT_EQ(engine.num_color_renders(), 1);
+    EXPECT_EQ(engine.num_depth_renders(), 2);
+    EXPECT_EQ(engine.num_label_renders(), 1);
+    EXPECT_EQ(engine.last_color_camera().core().renderer_name(), "color");
+    EXPECT_TRUE(CompareMatrices(engine.last_updated_X_WC().GetAsMatrix34(),
+                                X_WC2.GetAsMatrix34()));
+  }
+}
+
 // An absolute barebones RenderEngine implementation; however it is cloneable
 // with both a copy constructor *and* a valid DoClone() implementation.
 class CloneableEngine : public MinimumEngine {
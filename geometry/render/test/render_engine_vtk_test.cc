@@ -1194,6 +1194,125 @@ TEST_F(RenderEngineVtkTest, DifferentCameras) {
   }
 }
 
+// Confirms that the batch render API produces the same images whether the
+// requests are rendered serially or distributed across multiple threads, over
+// several batches, and that the threads see geometry added, moved, and removed
+// between batches.
+TEST_F(RenderEngineVtkTest, RenderImagesMultipleThreads) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      RenderEngineVtk(RenderEngineVtkParams{{}, {}, {}, 0}), std::logic_error,
+      "RenderEngineVtk: the number of render threads must be positive; "
+      "given 0");
+
+  for (const int num_threads : {1, 3}) {
+    const Vector3d bg_rgb{
+        kBgColor.r / 255., kBgColor.g / 255., kBgColor.b / 255.};
+    RenderEngineVtk renderer(
+        RenderEngineVtkParams{{}, {}, bg_rgb, num_threads});
+    InitializeRenderer(X_WC_, true /* add terrain */, &renderer);
+    PopulateSphereTest(&renderer);
+
+    // Cameras of differing sizes, all with the same pose.
+    const auto& ref_core = depth_camera_.core();
+    const int ref_w = ref_core.intrinsics().width();
+    const int ref_h = ref_core.intrinsics().height();
+    const double ref_fov_y = ref_core.intrinsics().fov_y();
+    std::vector<DepthRenderCamera> cameras;
+    for (int scale : {1, 2, 4, 8}) {
+      cameras.push_back(DepthRenderCamera{
+          {ref_core.renderer_name(),
+           {ref_w / scale, ref_h / scale, ref_fov_y},
+           ref_core.clipping(),
+           ref_core.sensor_pose_in_camera_body()},
+          depth_camera_.depth_range()});
+    }
+
+    auto render_and_verify = [&](const char* name) {
+      std::vector<ImageRgba8U> colors;
+      std::vector<ImageDepth32F> depths;
+      std::vector<ImageLabel16I> labels;
+      for (const auto& camera : cameras) {
+        const int w = camera.core().intrinsics().width();
+        const int h = camera.core().intrinsics().height();
+        colors.emplace_back(w, h);
+        depths.emplace_back(w, h);
+        labels.emplace_back(w, h);
+      }
+      std::vector<ImageRenderRequest> requests;
+      for (int i = 0; i < static_cast<int>(cameras.size()); ++i) {
+        ImageRenderRequest request;
+        request.X_WC = X_WC_;
+        request.color_camera = ColorRenderCamera(cameras[i].core(), false);
+        request.depth_camera = cameras[i];
+        request.color_image_out = &colors[i];
+        request.depth_image_out = &depths[i];
+        request.label_image_out = &labels[i];
+        requests.push_back(request);
+      }
+      renderer.RenderImages(requests);
+      for (int i = 0; i < static_cast<int>(cameras.size()); ++i) {
+        VerifyCenterShapeTest(renderer, name, cameras[i], colors[i], depths[i],
+                              labels[i]);
+      }
+    };
+
+    // The render threads and their engines persist from one batch to the
+    // next.
+    for (int batch = 0; batch < 3; ++batch) {
+      render_and_verify("Batch render");
+    }
+
+    // Moving the sphere and adding geometry are reflected in the next batch.
+    // The added sphere is hidden below the terrain.
+    const double sphere_z = 0.25;
+    expected_object_depth_ += 0.5 - sphere_z;
+    renderer.UpdatePoses(unordered_map<GeometryId, RigidTransformd>{
+        {geometry_id_, RigidTransformd{Vector3d{0, 0, sphere_z}}}});
+    const GeometryId hidden_id = GeometryId::get_new_id();
+    renderer.RegisterVisual(hidden_id, Sphere(0.5), simple_material(),
+                            RigidTransformd{Vector3d{0, 0, -1}},
+                            false /* needs update */);
+    render_and_verify("Batch render after change");
+    EXPECT_TRUE(renderer.RemoveGeometry(hidden_id));
+    render_and_verify("Batch render after removal");
+    ResetExpectations();
+  }
+}
+
+// A depth-only engine produces the same depth images as a full engine (also
+// after cloning), but refuses to render color and label images.
+TEST_F(RenderEngineVtkTest, DepthOnly) {
+  RenderEngineVtkParams params;
+  params.depth_only = true;
+  RenderEngineVtk renderer(params);
+  InitializeRenderer(X_WC_, true /* add terrain */, &renderer);
+  PopulateSphereTest(&renderer, true /* use_texture */);
+
+  const ColorRenderCamera color_camera(depth_camera_.core(), kShowWindow);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      renderer.RenderColorImage(color_camera, &color_), std::logic_error,
+      "RenderEngineVtk: can't render a color image; the engine was configured "
+      "to render depth images only");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      renderer.RenderLabelImage(color_camera, &label_), std::logic_error,
+      "RenderEngineVtk: can't render a label image; the engine was configured "
+      "to render depth images only");
+
+  const ScreenCoord inlier = GetInlier(depth_camera_.core().intrinsics());
+  auto verify_depth = [&](const RenderEngine& engine, const char* name) {
+    ImageDepth32F depth(kWidth, kHeight);
+    engine.RenderDepthImage(depth_camera_, &depth);
+    EXPECT_TRUE(IsExpectedDepth(depth, inlier, expected_object_depth_,
+                                kDepthTolerance)) << name;
+    for (const auto& outlier : GetOutliers(depth_camera_.core().intrinsics())) {
+      EXPECT_TRUE(IsExpectedDepth(depth, outlier, expected_outlier_depth_,
+                                  kDepthTolerance)) << name;
+    }
+  };
+  verify_depth(renderer, "Depth only");
+  verify_depth(*renderer.Clone(), "Depth only clone");
+}
+
 // Tests the ability to configure the RenderEngineVtk's default render label.
 TEST_F(RenderEngineVtkTest, DefaultProperties_RenderLabel) {
   // A variation of PopulateSphereTest(), but uses an empty set of properties.
@@ -335,6 +335,30 @@ CollisionFilterManager SceneGraph<T>::collision_filter_manager(
   return mutable_geometry_state(context).collision_filter_manager();
 }
 
+template <typename T>
+void SceneGraph<T>::set_hydroelastic_contact_params(
+    const HydroelasticContactParams& params) {
+  model_.set_hydroelastic_contact_params(params);
+}
+
+template <typename T>
+void SceneGraph<T>::set_hydroelastic_contact_params(
+    Context<T>* context, const HydroelasticContactParams& params) const {
+  mutable_geometry_state(context).set_hydroelastic_contact_params(params);
+}
+
+template <typename T>
+HydroelasticContactParams SceneGraph<T>::get_hydroelastic_contact_params()
+    const {
+  return model_.get_hydroelastic_contact_params();
+}
+
+template <typename T>
+HydroelasticContactParams SceneGraph<T>::get_hydroelastic_contact_params(
+    const Context<T>& context) const {
+  return geometry_state(context).get_hydroelastic_contact_params();
+}
+
 template <typename T>
 void SceneGraph<T>::ExcludeCollisionsWithin(const GeometrySet& geometry_set) {
   collision_filter_manager().Apply(
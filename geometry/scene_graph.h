@@ -9,6 +9,7 @@
 #include "drake/geometry/collision_filter_manager.h"
 #include "drake/geometry/geometry_set.h"
 #include "drake/geometry/geometry_state.h"
+#include "drake/geometry/hydroelastic_contact_params.h"
 #include "drake/geometry/query_object.h"
 #include "drake/geometry/query_results/penetration_as_point_pair.h"
 #include "drake/geometry/scene_graph_inspector.h"
@@ -838,6 +839,37 @@ class SceneGraph final : public systems::LeafSystem<T> {
       systems::Context<T>* context) const;
   //@}
 
+  /** @name       Configuring hydroelastic contact
+
+   The computation of hydroelastic contact surfaces (see
+   QueryObject::ComputeContactSurfaces() and its variants) can be configured
+   with HydroelasticContactParams. Like the geometry data, the parameters are
+   stored both in the %SceneGraph model and in each Context (which gets a copy
+   of the model's parameters when it is allocated); these methods configure
+   either one.  */
+  //@{
+
+  /** Sets the hydroelastic contact parameters of this %SceneGraph instance's
+   *model*.
+   @throws std::exception if `params.num_threads` is less than one.  */
+  void set_hydroelastic_contact_params(const HydroelasticContactParams& params);
+
+  /** systems::Context-modifying variant of set_hydroelastic_contact_params().
+   Rather than modifying %SceneGraph's model, it modifies the copy of the model
+   stored in the provided context.  */
+  void set_hydroelastic_contact_params(
+      systems::Context<T>* context,
+      const HydroelasticContactParams& params) const;
+
+  /** Returns the hydroelastic contact parameters of this %SceneGraph
+   instance's *model*.  */
+  HydroelasticContactParams get_hydroelastic_contact_params() const;
+
+  /** Returns the hydroelastic contact parameters stored in `context`.  */
+  HydroelasticContactParams get_hydroelastic_contact_params(
+      const systems::Context<T>& context) const;
+  //@}
+
   // TODO(2021-11-01) Remove this entire group when completing deprecation of
   //  the methods below.
   /** @name         Collision filtering (Deprecated)
@@ -127,7 +127,12 @@ class DrakeVisualizerTest : public ::testing::Test {
   void ConfigureDiagram(double period = kPublishPeriod,
                         Role role = Role::kIllustration,
                         const Rgba& default_color = Rgba{0.1, 0.2, 0.3, 0.4}) {
-    DrakeVisualizerParams params{period, role, default_color};
+    ConfigureDiagram(DrakeVisualizerParams{period, role, default_color});
+  }
+
+  /* Configures the diagram (and raw pointers) with a DrakeVisualizer configured
+   by the given parameters.  */
+  void ConfigureDiagram(DrakeVisualizerParams params) {
     DiagramBuilder<T> builder;
     scene_graph_ = builder.template AddSystem<SceneGraph<T>>();
     visualizer_ =
@@ -374,6 +379,90 @@ TYPED_TEST(DrakeVisualizerTest, EmptyScene) {
   EXPECT_EQ(results.draw_message.timestamp, 0);
 }
 
+/* Confirms that, with publish_changed_poses_only, a draw message only includes
+ the frames whose poses have changed, except for the periodic full draw
+ messages.  */
+TYPED_TEST(DrakeVisualizerTest, ChangedPosesOnly) {
+  using T = TypeParam;
+  DrakeVisualizerParams params;
+  params.publish_period = 0.1;
+  params.role = Role::kProximity;
+  params.publish_changed_poses_only = true;
+  params.pose_change_tolerance = 1e-3;
+  params.full_draw_period = 0.35;
+  this->ConfigureDiagram(params);
+
+  vector<FrameId> frame_ids;
+  for (const char* name : {"static", "moving"}) {
+    const FrameId f_id = this->scene_graph_->RegisterFrame(
+        this->source_id_, GeometryFrame(name, 0));
+    const GeometryId g_id = this->scene_graph_->RegisterGeometry(
+        this->source_id_, f_id,
+        make_unique<GeometryInstance>(RigidTransformd{}, make_unique<Sphere>(1),
+                                      name));
+    this->scene_graph_->AssignRole(this->source_id_, g_id,
+                                   ProximityProperties());
+    frame_ids.push_back(f_id);
+  }
+  auto set_moving_pose = [this, &frame_ids](double x) {
+    this->pose_source_->SetPoses(
+        {{frame_ids[0], math::RigidTransform<T>{}},
+         {frame_ids[1], math::RigidTransform<T>{Vector3<T>(x, 0, 0)}}});
+  };
+  set_moving_pose(0.0);
+
+  Simulator<T> simulator(*(this->diagram_));
+  // The poses are not part of the context; don't let the cache hide changes.
+  simulator.get_mutable_context().DisableCaching();
+
+  // The first draw message (along with the load message) is full.
+  simulator.AdvanceTo(0.0);
+  MessageResults results = this->ProcessMessages();
+  ASSERT_EQ(results.num_load, 1);
+  ASSERT_EQ(results.num_draw, 1);
+  EXPECT_EQ(results.draw_message.num_links, 2);
+
+  // Only the moving frame is sent.
+  set_moving_pose(1.0);
+  simulator.AdvanceTo(0.1);
+  results = this->ProcessMessages();
+  ASSERT_EQ(results.num_draw, 1);
+  ASSERT_EQ(results.draw_message.num_links, 1);
+  EXPECT_EQ(results.draw_message.link_name[0],
+            fmt::format("{}::moving", this->kSourceName));
+  EXPECT_EQ(results.draw_message.position[0][0], 1.0);
+
+  // Changes within the tolerance are not sent.
+  set_moving_pose(1.0 + 1e-4);
+  simulator.AdvanceTo(0.2);
+  results = this->ProcessMessages();
+  ASSERT_EQ(results.num_draw, 1);
+  EXPECT_EQ(results.draw_message.num_links, 0);
+  EXPECT_EQ(results.draw_message.timestamp, 200);
+
+  // The change is measured relative to the pose that was last sent.
+  set_moving_pose(1.0 + 2e-3);
+  simulator.AdvanceTo(0.3);
+  results = this->ProcessMessages();
+  ASSERT_EQ(results.num_draw, 1);
+  EXPECT_EQ(results.draw_message.num_links, 1);
+
+  // After the full draw period, all frames are sent again.
+  simulator.AdvanceTo(0.4);
+  results = this->ProcessMessages();
+  ASSERT_EQ(results.num_draw, 1);
+  EXPECT_EQ(results.draw_message.num_links, 2);
+
+  // Invalid parameters.
+  params.pose_change_tolerance = -1;
+  DRAKE_EXPECT_THROWS_MESSAGE(DrakeVisualizer<T>(&(this->lcm_), params),
+                              ".*non-negative pose change tolerance.*");
+  params.pose_change_tolerance = 0;
+  params.full_draw_period = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(DrakeVisualizer<T>(&(this->lcm_), params),
+                              ".*positive full draw period.*");
+}
+
 /* DrakeVisualizer can accept an lcm interface from the user or instantiate its
  own. This tests that logic. However, it does *not* do any work on the owned
  lcm interface because we don't want this unit test to spew network traffic.  */
@@ -3218,6 +3218,41 @@ TEST_F(GeometryStateTest, AddRendererAfterGeometry) {
   }
 }
 
+// A renderer added after the poses have been updated registers each geometry
+// at its current world pose; the frames that don't move afterwards never send
+// it another one.
+TEST_F(GeometryStateTest, AddRendererAfterPoseUpdate) {
+  SetUpSingleSourceTree(Assign::kPerception);
+  // Every frame is offset from its default pose, so that no geometry is at its
+  // pose in its frame.
+  const Vector3d offset{1, 2, 3};
+  FramePoseVector<double> poses;
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    RigidTransformd X_PF = X_PFs_[f];
+    X_PF.set_translation(X_PF.translation() + offset);
+    poses.set_value(frames_[f], X_PF);
+  }
+  gs_tester_.SetFramePoses(source_id_, poses);
+  gs_tester_.FinalizePoseUpdate();
+
+  auto new_renderer = make_unique<DummyRenderEngine>();
+  DummyRenderEngine* other_renderer = new_renderer.get();
+  geometry_state_.AddRenderer("other", move(new_renderer));
+
+  // The frames stay where they are.
+  gs_tester_.SetFramePoses(source_id_, poses);
+  gs_tester_.FinalizePoseUpdate();
+  EXPECT_EQ(other_renderer->updated_ids().size(), 0u);
+
+  for (const GeometryId& id : geometries_) {
+    const RigidTransformd& X_WG = gs_tester_.get_geometry_world_poses().at(id);
+    ASSERT_FALSE(X_WG.IsExactlyEqualTo(
+        RigidTransformd(gs_tester_.GetGeometry(id)->X_FG())));
+    EXPECT_TRUE(CompareMatrices(other_renderer->world_pose(id).GetAsMatrix34(),
+                                X_WG.GetAsMatrix34()));
+  }
+}
+
 // Successful invocations of AddRenderer are implicit in SetupSingleSource().
 // This merely tests the error conditions.
 TEST_F(GeometryStateTest, AddRendererError) {
@@ -3239,6 +3274,70 @@ TEST_F(GeometryStateTest, AddRendererError) {
   EXPECT_NE(dynamic_cast<const DummyRenderEngine*>(engine), nullptr);
 }
 
+// Confirms that a batch of render requests is dispatched to the renderers its
+// cameras name, each renderer rendering its own requests.
+TEST_F(GeometryStateTest, RenderImages) {
+  auto new_renderer = make_unique<DummyRenderEngine>();
+  const DummyRenderEngine& other_renderer = *new_renderer;
+  const string other_name = "other";
+  geometry_state_.AddRenderer(other_name, move(new_renderer));
+
+  const systems::sensors::CameraInfo intrinsics{2, 2, M_PI};
+  auto color_camera = [&intrinsics](const string& renderer_name) {
+    return render::ColorRenderCamera{
+        {renderer_name, intrinsics, {0.1, 10}, RigidTransformd{}}, false};
+  };
+  auto depth_camera = [&intrinsics](const string& renderer_name) {
+    return render::DepthRenderCamera{
+        {renderer_name, intrinsics, {0.1, 10}, RigidTransformd{}}, {1.0, 5.0}};
+  };
+  systems::sensors::ImageRgba8U color{2, 2};
+  systems::sensors::ImageDepth32F depth{2, 2};
+
+  render::ImageRenderRequest dummy_color;
+  dummy_color.color_camera = color_camera(kDummyRenderName);
+  dummy_color.color_image_out = &color;
+  render::ImageRenderRequest other_depth;
+  other_depth.X_WC = RigidTransformd(Vector3d(1, 2, 3));
+  other_depth.depth_camera = depth_camera(other_name);
+  other_depth.depth_image_out = &depth;
+  render::ImageRenderRequest dummy_depth;
+  dummy_depth.depth_camera = depth_camera(kDummyRenderName);
+  dummy_depth.depth_image_out = &depth;
+  geometry_state_.RenderImages({dummy_color, other_depth, dummy_depth});
+  EXPECT_EQ(render_engine_->num_color_renders(), 1);
+  EXPECT_EQ(render_engine_->num_depth_renders(), 1);
+  EXPECT_EQ(other_renderer.num_color_renders(), 0);
+  EXPECT_EQ(other_renderer.num_depth_renders(), 1);
+  EXPECT_TRUE(
+      CompareMatrices(other_renderer.last_updated_X_WC().GetAsMatrix34(),
+                      other_depth.X_WC.GetAsMatrix34()));
+
+  // A request whose cameras name different renderers.
+  render::ImageRenderRequest mixed = dummy_color;
+  mixed.depth_camera = depth_camera(other_name);
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.RenderImages({mixed}), std::logic_error,
+      "RenderImages.+: a request's color and depth cameras must use the same "
+      "renderer; given 'dummy_renderer' and 'other'");
+
+  // A missing renderer is reported before any image is rendered.
+  render::ImageRenderRequest missing;
+  missing.color_camera = color_camera("missing");
+  missing.color_image_out = &color;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.RenderImages({dummy_color, missing}), std::logic_error,
+      "No renderer exists with name: 'missing'");
+  EXPECT_EQ(render_engine_->num_color_renders(), 1);
+
+  // A request for an image without any camera.
+  render::ImageRenderRequest no_camera;
+  no_camera.depth_image_out = &depth;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      geometry_state_.RenderImages({no_camera}), std::logic_error,
+      "RenderImages.+: a request for an image must provide a camera");
+}
+
 // Tests that when assigning a geometry the perception role, that the process
 // respects the ("renderer", "accepting") property with the following semantics:
 //  1. Missing property --> all renderers accept the geometry.
@@ -3489,6 +3588,77 @@ TEST_F(GeometryStateTest, RendererPoseUpdate) {
   expect_poses(render_engine_->updated_ids(), expected_ids);
 }
 
+// Confirms that a pose update only recomputes (and pushes to the engines) the
+// poses of geometries whose frames have moved, and that the skipped poses are
+// nevertheless correct.
+TEST_F(GeometryStateTest, IncrementalPoseUpdate) {
+  SetUpSingleSourceTree(Assign::kPerception | Assign::kProximity);
+  EXPECT_EQ(geometry_state_.num_geometries_with_updated_poses(), 0);
+
+  FramePoseVector<double> poses;
+  for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+    poses.set_value(frames_[f], X_PFs_[f]);
+  }
+  auto update_poses = [this, &poses]() {
+    render_engine_->init_test_data();
+    gs_tester_.SetFramePoses(source_id_, poses);
+    gs_tester_.FinalizePoseUpdate();
+    // The render engine sees exactly the updated geometries.
+    EXPECT_EQ(render_engine_->updated_ids().size(),
+              geometry_state_.num_geometries_with_updated_poses());
+    return geometry_state_.num_geometries_with_updated_poses();
+  };
+  auto expect_world_poses = [this]() {
+    for (int f = 0; f < static_cast<int>(frames_.size()); ++f) {
+      EXPECT_TRUE(CompareMatrices(
+          geometry_state_.get_pose_in_world(frames_[f]).GetAsMatrix34(),
+          X_WFs_[f].GetAsMatrix34(), 1e-14));
+      for (int g = 0; g < kGeometryCount; ++g) {
+        const GeometryId g_id = geometries_[f * kGeometryCount + g];
+        const RigidTransformd X_WG =
+            X_WFs_[f] * geometry_state_.GetPoseInFrame(g_id);
+        EXPECT_TRUE(CompareMatrices(
+            geometry_state_.get_pose_in_world(g_id).GetAsMatrix34(),
+            X_WG.GetAsMatrix34(), 1e-14));
+        EXPECT_TRUE(CompareMatrices(
+            render_engine_->world_pose(g_id).GetAsMatrix34(),
+            X_WG.GetAsMatrix34(), 1e-14));
+      }
+    }
+  };
+
+  // The first update poses everything.
+  EXPECT_EQ(update_poses(), single_tree_dynamic_geometry_count());
+  expect_world_poses();
+
+  // Nothing moved.
+  EXPECT_EQ(update_poses(), 0);
+  expect_world_poses();
+
+  // Moving the leaf f2 only updates its geometries.
+  X_PFs_[2].set_translation(X_PFs_[2].translation() + Vector3d(1, 0, 0));
+  X_WFs_[2] = X_WFs_[1] * X_PFs_[2];
+  poses.set_value(frames_[2], X_PFs_[2]);
+  EXPECT_EQ(update_poses(), kGeometryCount);
+  expect_world_poses();
+
+  // Moving f1 updates its geometries and those of its child frame f2 (although
+  // f2's pose relative to f1 is unchanged).
+  X_PFs_[1].set_translation(X_PFs_[1].translation() + Vector3d(0, 1, 0));
+  X_WFs_[1] = X_PFs_[1];
+  X_WFs_[2] = X_WFs_[1] * X_PFs_[2];
+  poses.set_value(frames_[1], X_PFs_[1]);
+  EXPECT_EQ(update_poses(), 2 * kGeometryCount);
+  expect_world_poses();
+
+  // Registering a new frame forces a full update, as it has yet to be posed.
+  const FrameId new_frame =
+      geometry_state_.RegisterFrame(source_id_, GeometryFrame("new"));
+  poses.set_value(new_frame, RigidTransformd::Identity());
+  EXPECT_EQ(update_poses(), single_tree_dynamic_geometry_count());
+  expect_world_poses();
+}
+
 // This tests the equivalence of versions among copies of GeometryState
 // instances; two copies are equivalent and equivalence is transitive. So, for
 // state s: copy(s) == s and copy(copy(s)) == s.
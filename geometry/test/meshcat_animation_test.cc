@@ -0,0 +1,164 @@
+#include "drake/geometry/meshcat_animation.h"
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/expect_throws_message.h"
+
+namespace drake {
+namespace geometry {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransformd;
+using math::RotationMatrixd;
+
+GTEST_TEST(MeshcatAnimationTest, Options) {
+  MeshcatAnimation animation(20.0);
+  EXPECT_EQ(animation.frames_per_second(), 20.0);
+  EXPECT_EQ(animation.frame(0.0), 0);
+  EXPECT_EQ(animation.frame(1.0), 20);
+  EXPECT_EQ(animation.frame(1.02), 20);
+  EXPECT_EQ(animation.frame(1.03), 21);
+
+  EXPECT_TRUE(animation.autoplay());
+  animation.set_autoplay(false);
+  EXPECT_FALSE(animation.autoplay());
+  EXPECT_EQ(animation.loop_mode(), MeshcatAnimation::kLoopRepeat);
+  animation.set_loop_mode(MeshcatAnimation::kLoopPingPong);
+  EXPECT_EQ(animation.loop_mode(), MeshcatAnimation::kLoopPingPong);
+  EXPECT_EQ(animation.repetitions(), 1);
+  animation.set_repetitions(4);
+  EXPECT_EQ(animation.repetitions(), 4);
+  EXPECT_FALSE(animation.clamp_when_finished());
+  animation.set_clamp_when_finished(true);
+  EXPECT_TRUE(animation.clamp_when_finished());
+
+  DRAKE_EXPECT_THROWS_MESSAGE(MeshcatAnimation(0.0), ".*frames_per_second.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(animation.set_repetitions(0), ".*repetitions.*");
+}
+
+GTEST_TEST(MeshcatAnimationTest, SetTransform) {
+  MeshcatAnimation animation;
+  const RigidTransformd X_ParentPath(RotationMatrixd::MakeZRotation(M_PI / 2),
+                                     Vector3d(1, 2, 3));
+  animation.SetTransform(0, "foo", X_ParentPath);
+  EXPECT_EQ(animation.num_keyframes(), 2);
+
+  const auto& tracks = animation.tracks().at("foo");
+  ASSERT_EQ(tracks.size(), 2);
+  const MeshcatAnimation::Track& position = tracks.at("position");
+  EXPECT_EQ(position.js_type, "vector3");
+  EXPECT_EQ(position.size, 3);
+  EXPECT_EQ(position.frames, std::vector<int>({0}));
+  EXPECT_EQ(position.values, std::vector<double>({1, 2, 3}));
+  const MeshcatAnimation::Track& quaternion = tracks.at("quaternion");
+  EXPECT_EQ(quaternion.js_type, "quaternion");
+  EXPECT_EQ(quaternion.size, 4);
+  EXPECT_EQ(quaternion.frames, std::vector<int>({0}));
+  // Three.js orders the values as x, y, z, w.
+  const double kTol = 1e-15;
+  ASSERT_EQ(quaternion.values.size(), 4);
+  EXPECT_NEAR(quaternion.values[0], 0.0, kTol);
+  EXPECT_NEAR(quaternion.values[1], 0.0, kTol);
+  EXPECT_NEAR(quaternion.values[2], std::sqrt(0.5), kTol);
+  EXPECT_NEAR(quaternion.values[3], std::sqrt(0.5), kTol);
+}
+
+GTEST_TEST(MeshcatAnimationTest, SetProperty) {
+  MeshcatAnimation animation;
+  animation.SetProperty(0, "foo", "visible", true);
+  animation.SetProperty(1, "foo", "visible", false);
+  animation.SetProperty(0, "foo", "opacity", 0.5);
+  animation.SetProperty(0, "foo", "color", {0.1, 0.2, 0.3});
+  EXPECT_EQ(animation.num_keyframes(), 4);
+
+  const auto& tracks = animation.tracks().at("foo");
+  EXPECT_EQ(tracks.at("visible").js_type, "boolean");
+  EXPECT_EQ(tracks.at("visible").values, std::vector<double>({1, 0}));
+  EXPECT_EQ(tracks.at("opacity").js_type, "number");
+  EXPECT_EQ(tracks.at("opacity").values, std::vector<double>({0.5}));
+  EXPECT_EQ(tracks.at("color").js_type, "vector");
+  EXPECT_EQ(tracks.at("color").size, 3);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      animation.SetProperty(2, "foo", "visible", 1.0),
+      ".*visible of foo was previously set to a value of type boolean.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      animation.SetProperty(2, "foo", "color", {0.1, 0.2}),
+      ".*color of foo was previously set to a value of type vector.*");
+}
+
+// Keyframes that repeat the values of their neighbors are not stored.
+GTEST_TEST(MeshcatAnimationTest, Decimation) {
+  MeshcatAnimation animation;
+  for (int frame = 0; frame < 10; ++frame) {
+    animation.SetProperty(frame, "foo", "opacity", 0.5);
+  }
+  for (int frame = 10; frame < 12; ++frame) {
+    animation.SetProperty(frame, "foo", "opacity", 0.1 * frame);
+  }
+  for (int frame = 12; frame < 20; ++frame) {
+    animation.SetProperty(frame, "foo", "opacity", 1.0);
+  }
+  const MeshcatAnimation::Track& track =
+      animation.tracks().at("foo").at("opacity");
+  // Each run of identical values is reduced to its first and last keyframes,
+  // so that the interpolated values are unchanged.
+  EXPECT_EQ(track.frames, std::vector<int>({0, 9, 10, 11, 12, 19}));
+  EXPECT_EQ(track.values,
+            std::vector<double>({0.5, 0.5, 1.0, 0.1 * 11, 1.0, 1.0}));
+  EXPECT_EQ(animation.num_keyframes(), 6);
+
+  // Keyframes set out of order are inserted (or overwrite existing keyframes).
+  animation.SetProperty(5, "foo", "opacity", 0.2);
+  animation.SetProperty(9, "foo", "opacity", 0.3);
+  EXPECT_EQ(track.frames, std::vector<int>({0, 5, 9, 10, 11, 12, 19}));
+  EXPECT_EQ(track.values,
+            std::vector<double>({0.5, 0.2, 0.3, 1.0, 0.1 * 11, 1.0, 1.0}));
+  EXPECT_EQ(animation.num_keyframes(), 7);
+}
+
+GTEST_TEST(MeshcatAnimationTest, MaxKeyframes) {
+  MeshcatAnimation animation;
+  EXPECT_EQ(animation.max_keyframes(), MeshcatAnimation::kDefaultMaxKeyframes);
+  animation.set_max_keyframes(5);
+  animation.SetTransform(0, "foo", RigidTransformd(Vector3d(1, 0, 0)));
+  animation.SetProperty(0, "foo", "visible", true);
+  animation.SetProperty(1, "foo", "visible", true);
+  EXPECT_EQ(animation.num_keyframes(), 4);
+  // Decimated keyframes don't count against the maximum.
+  animation.SetProperty(2, "foo", "visible", true);
+  EXPECT_EQ(animation.num_keyframes(), 4);
+  // A transform needs two keyframes, and only one is available.
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      animation.SetTransform(1, "foo", RigidTransformd(Vector3d(2, 0, 0))),
+      ".*keyframe for foo at frame 1.*holds 4 keyframes.*maximum is 5.");
+  animation.SetProperty(3, "foo", "visible", false);
+  EXPECT_EQ(animation.num_keyframes(), 5);
+  DRAKE_EXPECT_THROWS_MESSAGE(animation.SetProperty(4, "foo", "visible", true),
+                              ".*maximum is 5.");
+  // Overwritten keyframes don't count against the maximum either.
+  animation.SetProperty(3, "foo", "visible", true);
+  EXPECT_EQ(animation.num_keyframes(), 5);
+
+  // A full animation still accepts a transform whose keyframes are all
+  // decimated or overwritten.
+  MeshcatAnimation full;
+  full.set_max_keyframes(4);
+  const RigidTransformd X(Vector3d(1, 2, 3));
+  full.SetTransform(0, "bar", X);
+  full.SetTransform(1, "bar", X);
+  EXPECT_EQ(full.num_keyframes(), 4);
+  full.SetTransform(2, "bar", X);
+  full.SetTransform(0, "bar", RigidTransformd(Vector3d(3, 2, 1)));
+  EXPECT_EQ(full.num_keyframes(), 4);
+  EXPECT_EQ(full.tracks().at("bar").at("position").frames,
+            std::vector<int>({0, 2}));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(animation.set_max_keyframes(4),
+                              ".*max_keyframes >= num_keyframes_.*");
+}
+
+}  // namespace
+}  // namespace geometry
+}  // namespace drake
@@ -1,6 +1,8 @@
 #include "drake/geometry/meshcat.h"
 
 #include <cstdlib>
+#include <map>
+#include <sstream>
 
 #include <fmt/format.h>
 #include <gmock/gmock.h>
@@ -127,6 +129,60 @@ GTEST_TEST(MeshcatTest, SetTransform) {
   EXPECT_TRUE(CompareMatrices(matrix, X_ParentPath.GetAsMatrix4()));
 }
 
+// SetTransforms() sets the same transforms as SetTransform() would, except for
+// those paths whose transforms haven't changed by more than the tolerance.
+GTEST_TEST(MeshcatTest, SetTransforms) {
+  Meshcat meshcat;
+  auto get_matrix = [&meshcat](std::string_view path) {
+    std::string transform = meshcat.GetPackedTransform(path);
+    msgpack::object_handle oh =
+        msgpack::unpack(transform.data(), transform.size());
+    auto data = oh.get().as<internal::SetTransformData>();
+    EXPECT_EQ(data.type, "set_transform");
+    return Eigen::Matrix4d(Eigen::Map<Eigen::Matrix4d>(data.matrix));
+  };
+
+  const RigidTransformd X_PA{math::RollPitchYawd(.5, .26, -3),
+                             Vector3d{.9, -2., .12}};
+  const RigidTransformd X_PB{Vector3d{1, 2, 3}};
+  meshcat.SetTransforms({"a", "/drake/b"}, {X_PA, X_PB});
+  EXPECT_TRUE(CompareMatrices(get_matrix("a"), X_PA.GetAsMatrix4()));
+  EXPECT_TRUE(CompareMatrices(get_matrix("b"), X_PB.GetAsMatrix4()));
+
+  // A change within the tolerance is skipped; beyond it, it is sent.
+  const RigidTransformd X_PA_small{X_PA.rotation(),
+                                   X_PA.translation() + Vector3d(0.01, 0, 0)};
+  const RigidTransformd X_PB_large{Vector3d{1.5, 2, 3}};
+  meshcat.SetTransforms({"a", "b"}, {X_PA_small, X_PB_large}, 0.1);
+  EXPECT_TRUE(CompareMatrices(get_matrix("a"), X_PA.GetAsMatrix4()));
+  EXPECT_TRUE(CompareMatrices(get_matrix("b"), X_PB_large.GetAsMatrix4()));
+
+  // The tolerance is measured against the last transform sent, so small
+  // changes accumulate.
+  const RigidTransformd X_PA_accumulated{
+      X_PA.rotation(), X_PA.translation() + Vector3d(0.2, 0, 0)};
+  meshcat.SetTransforms({"a"}, {X_PA_accumulated}, 0.1);
+  EXPECT_TRUE(
+      CompareMatrices(get_matrix("a"), X_PA_accumulated.GetAsMatrix4()));
+
+  // SetTransform() and Delete() are respected: a path set again afterwards is
+  // always sent, even if its transform matches the one last sent by
+  // SetTransforms().
+  meshcat.SetTransform("a", X_PA);
+  meshcat.SetTransforms({"a"}, {X_PA_accumulated}, 0.0);
+  EXPECT_TRUE(
+      CompareMatrices(get_matrix("a"), X_PA_accumulated.GetAsMatrix4()));
+  meshcat.Delete("a");
+  EXPECT_FALSE(meshcat.HasPath("a"));
+  meshcat.SetTransforms({"a"}, {X_PA_accumulated}, 0.0);
+  EXPECT_TRUE(meshcat.HasPath("a"));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(meshcat.SetTransforms({"a", "b"}, {X_PA}),
+                              ".*paths.size.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(meshcat.SetTransforms({"a"}, {X_PA}, -1),
+                              ".*tolerance.*");
+}
+
 GTEST_TEST(MeshcatTest, Delete) {
   Meshcat meshcat;
   // Ok to delete an empty tree.
@@ -414,6 +470,82 @@ GTEST_TEST(MeshcatTest, ResetRenderMode) {
   EXPECT_FALSE(meshcat.GetPackedProperty("/Grid", "visible").empty());
   EXPECT_FALSE(meshcat.GetPackedProperty("/Axes", "visible").empty());
 }
+
+GTEST_TEST(MeshcatTest, SetAnimationData) {
+  MeshcatAnimation animation(20.0);
+  animation.SetTransform(0, "box", RigidTransformd(Vector3d(1, 2, 3)));
+  animation.SetProperty(0, "box", "visible", true);
+  animation.SetProperty(5, "box", "visible", false);
+  animation.set_repetitions(2);
+
+  internal::SetAnimationData data;
+  data.fps = animation.frames_per_second();
+  data.animations.emplace_back("/drake/box", &animation.tracks().at("box"));
+  data.options.repetitions = animation.repetitions();
+  std::stringstream message_stream;
+  msgpack::pack(message_stream, data);
+  const std::string message = message_stream.str();
+  msgpack::object_handle oh = msgpack::unpack(message.data(), message.size());
+  using MsgPackMap = std::map<std::string, msgpack::object>;
+  const auto map = oh.get().as<MsgPackMap>();
+  EXPECT_EQ(map.at("type").as<std::string>(), "set_animation");
+  EXPECT_EQ(map.at("options").as<MsgPackMap>().at("repetitions").as<int>(), 2);
+
+  const auto animations = map.at("animations").as<std::vector<MsgPackMap>>();
+  ASSERT_EQ(animations.size(), 1);
+  EXPECT_EQ(animations[0].at("path").as<std::string>(), "/drake/box");
+  const auto clip = animations[0].at("clip").as<MsgPackMap>();
+  EXPECT_EQ(clip.at("fps").as<double>(), 20.0);
+  // The tracks are ordered by property name.
+  const auto tracks = clip.at("tracks").as<std::vector<MsgPackMap>>();
+  ASSERT_EQ(tracks.size(), 3);
+  EXPECT_EQ(tracks[0].at("name").as<std::string>(), ".position");
+  EXPECT_EQ(tracks[0].at("type").as<std::string>(), "vector3");
+  const auto position_keys = tracks[0].at("keys").as<std::vector<MsgPackMap>>();
+  ASSERT_EQ(position_keys.size(), 1);
+  EXPECT_EQ(position_keys[0].at("time").as<int>(), 0);
+  EXPECT_EQ(position_keys[0].at("value").as<std::vector<double>>(),
+            std::vector<double>({1, 2, 3}));
+  EXPECT_EQ(tracks[1].at("name").as<std::string>(), ".quaternion");
+  EXPECT_EQ(tracks[1].at("type").as<std::string>(), "quaternion");
+  EXPECT_EQ(tracks[2].at("name").as<std::string>(), ".visible");
+  EXPECT_EQ(tracks[2].at("type").as<std::string>(), "boolean");
+  const auto visible_keys = tracks[2].at("keys").as<std::vector<MsgPackMap>>();
+  ASSERT_EQ(visible_keys.size(), 2);
+  EXPECT_EQ(visible_keys[1].at("time").as<int>(), 5);
+  EXPECT_EQ(visible_keys[1].at("value").as<bool>(), false);
+}
+
+// Counts the occurrences of `pattern` in `text`.
+int CountOccurrences(const std::string& text, const std::string& pattern) {
+  int count = 0;
+  for (size_t pos = text.find(pattern); pos != std::string::npos;
+       pos = text.find(pattern, pos + pattern.size())) {
+    ++count;
+  }
+  return count;
+}
+
+GTEST_TEST(MeshcatTest, StaticHtml) {
+  Meshcat meshcat;
+  const std::string empty_html = meshcat.StaticHtml();
+  // The javascript is inlined, and the page doesn't connect to a server.
+  EXPECT_THAT(empty_html, ::testing::Not(HasSubstr("src=\"meshcat.js\"")));
+  EXPECT_THAT(empty_html, HasSubstr("const connect_to_server = false;"));
+  const std::string command = "handle_embedded_command(\"";
+  const int num_empty_commands = CountOccurrences(empty_html, command);
+
+  // Each object, transform, and animation is embedded as one command.
+  meshcat.SetObject("box", Box(0.25, 0.25, 0.5), Rgba(0.3, 0.3, 0.3));
+  meshcat.SetTransform("box", RigidTransformd(Vector3d(1, 0, 0)));
+  MeshcatAnimation animation;
+  animation.SetTransform(0, "box", RigidTransformd());
+  animation.SetTransform(32, "box", RigidTransformd(Vector3d(0, 0, 1)));
+  meshcat.SetAnimation(animation);
+  EXPECT_EQ(CountOccurrences(meshcat.StaticHtml(), command),
+            num_empty_commands + 3);
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
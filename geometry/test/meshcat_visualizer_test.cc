@@ -1,5 +1,6 @@
 #include "drake/geometry/meshcat_visualizer.h"
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "drake/common/find_resource.h"
@@ -184,6 +185,55 @@ TEST_F(MeshcatVisualizerWithIiwaTest, Delete) {
   EXPECT_FALSE(meshcat_->HasPath("/drake/visualizer"));
 }
 
+TEST_F(MeshcatVisualizerWithIiwaTest, Recording) {
+  MeshcatVisualizerParams params;
+  params.publish_period = 0.01;
+  SetUpDiagram(params);
+  EXPECT_EQ(visualizer_->get_recording().frames_per_second(), 100.0);
+
+  // Recording without setting the transforms in Meshcat.
+  systems::Simulator<double> simulator(*diagram_);
+  simulator.AdvanceTo(0.0);
+  const std::string packed_X_W7 =
+      meshcat_->GetPackedTransform("visualizer/iiwa14/iiwa_link_7");
+  visualizer_->StartRecording(false);
+  simulator.AdvanceTo(0.1);
+  EXPECT_EQ(meshcat_->GetPackedTransform("visualizer/iiwa14/iiwa_link_7"),
+            packed_X_W7);
+
+  const auto& tracks = visualizer_->get_recording().tracks();
+  // The moving link has a keyframe for each publish.
+  const MeshcatAnimation::Track& link_7 =
+      tracks.at("visualizer/iiwa14/iiwa_link_7").at("position");
+  EXPECT_GE(link_7.frames.size(), 9);
+  // The base is welded to the world; its identical frames are decimated.
+  const MeshcatAnimation::Track& link_0 =
+      tracks.at("visualizer/iiwa14/iiwa_link_0").at("position");
+  EXPECT_EQ(link_0.frames.size(), 2);
+  EXPECT_EQ(link_0.frames.back(), link_7.frames.back());
+
+  // After the recording stops, the transforms are set in Meshcat again and are
+  // no longer recorded.
+  visualizer_->StopRecording();
+  const int num_keyframes = visualizer_->get_recording().num_keyframes();
+  simulator.AdvanceTo(0.2);
+  EXPECT_NE(meshcat_->GetPackedTransform("visualizer/iiwa14/iiwa_link_7"),
+            packed_X_W7);
+  EXPECT_EQ(visualizer_->get_recording().num_keyframes(), num_keyframes);
+
+  // The recording is bounded.
+  visualizer_->StartRecording().set_max_keyframes(num_keyframes + 20);
+  simulator.AdvanceTo(0.3);
+  EXPECT_LE(visualizer_->get_recording().num_keyframes(), num_keyframes + 20);
+  EXPECT_LT(link_7.frames.back(), 30);
+
+  visualizer_->PublishRecording();
+  EXPECT_THAT(meshcat_->StaticHtml(), ::testing::HasSubstr("embedded-json"));
+
+  visualizer_->DeleteRecording();
+  EXPECT_EQ(visualizer_->get_recording().num_keyframes(), 0);
+}
+
 TEST_F(MeshcatVisualizerWithIiwaTest, ScalarConversion) {
   SetUpDiagram();
 
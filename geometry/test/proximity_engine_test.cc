@@ -1,7 +1,9 @@
 #include "drake/geometry/proximity_engine.h"
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -996,6 +998,121 @@ GTEST_TEST(SignedDistanceToPointBroadphaseTest, MultipleThreshold) {
   EXPECT_EQ(2, results.size());
 }
 
+// Confirms that the batched ComputeSignedDistanceToPoints() reports, for every
+// query point, what ComputeSignedDistanceToPoint() reports for that point
+// alone: the same geometries (ordered by id) with the same values. The scene
+// mixes dynamic and anchored geometries; the ellipsoid is the one shape not
+// evaluated by a batched kernel. The points span several clusters, and the
+// finite thresholds exercise their broadphase culling.
+GTEST_TEST(SignedDistanceToPointsTest, MatchesSinglePointQuery) {
+  const double kTolerance = 1e-14;
+  ProximityEngine<double> engine;
+  unordered_map<GeometryId, RigidTransformd> X_WGs;
+  auto add_geometry = [&engine, &X_WGs](const Shape& shape,
+                                        const RigidTransformd& X_WG,
+                                        bool anchored) {
+    const GeometryId id = GeometryId::get_new_id();
+    X_WGs[id] = X_WG;
+    if (anchored) {
+      engine.AddAnchoredGeometry(shape, X_WG, id);
+    } else {
+      engine.AddDynamicGeometry(shape, X_WG, id);
+    }
+  };
+  const RotationMatrixd R_WG(
+      AngleAxisd(M_PI / 5, Vector3d{1, 2, 3}.normalized()));
+  add_geometry(Box(0.2, 0.3, 0.4), RigidTransformd(R_WG, Vector3d::Zero()),
+               false);
+  add_geometry(Capsule(0.1, 0.3), RigidTransformd(R_WG, Vector3d{1, 0, 0}),
+               false);
+  add_geometry(Ellipsoid(0.1, 0.2, 0.3),
+               RigidTransformd(R_WG, Vector3d{0, -1, 0}), false);
+  add_geometry(Cylinder(0.15, 0.3), RigidTransformd(R_WG, Vector3d{0, 1, 0}),
+               true);
+  add_geometry(Sphere(0.2), RigidTransformd(Vector3d{-1, 0, 0}), true);
+  add_geometry(HalfSpace(), RigidTransformd(Vector3d{0, 0, -1}), true);
+  engine.UpdateWorldPoses(X_WGs);
+
+  const Eigen::Matrix3Xd p_WQs = 1.5 * Eigen::Matrix3Xd::Random(3, 100);
+  for (const double threshold : {kInf, 0.3, 0.0}) {
+    SCOPED_TRACE(fmt::format("threshold = {}", threshold));
+    const SignedDistanceToPointBatch<double> batch =
+        engine.ComputeSignedDistanceToPoints(p_WQs, X_WGs, threshold);
+    ASSERT_EQ(batch.num_points(), p_WQs.cols());
+    ASSERT_EQ(batch.offsets.front(), 0);
+    ASSERT_EQ(batch.offsets.back(), batch.num_results());
+    for (int i = 0; i < p_WQs.cols(); ++i) {
+      std::vector<SignedDistanceToPoint<double>> expected =
+          engine.ComputeSignedDistanceToPoint(p_WQs.col(i), X_WGs, threshold);
+      std::sort(expected.begin(), expected.end(),
+                [](const auto& a, const auto& b) { return a.id_G < b.id_G; });
+      ASSERT_EQ(batch.offsets[i + 1] - batch.offsets[i], expected.size());
+      for (int j = 0; j < static_cast<int>(expected.size()); ++j) {
+        const SignedDistanceToPoint<double> result =
+            batch.result(batch.offsets[i] + j);
+        EXPECT_EQ(result.id_G, expected[j].id_G);
+        EXPECT_NEAR(result.distance, expected[j].distance, kTolerance);
+        EXPECT_TRUE(
+            CompareMatrices(result.p_GN, expected[j].p_GN, kTolerance));
+        EXPECT_TRUE(
+            CompareMatrices(result.grad_W, expected[j].grad_W, kTolerance));
+      }
+    }
+  }
+
+  // An empty batch produces no results.
+  const SignedDistanceToPointBatch<double> empty =
+      engine.ComputeSignedDistanceToPoints(Eigen::Matrix3Xd(3, 0), X_WGs);
+  EXPECT_EQ(empty.num_points(), 0);
+  EXPECT_EQ(empty.num_results(), 0);
+}
+
+// Meshes only report signed distance to points when their proximity properties
+// declare a signed distance field. The field respects the mesh's non-convexity:
+// the query point lies in the notch of the U (inside its convex hull) and is
+// reported as outside, 5 cm above the notch's floor.
+GTEST_TEST(SignedDistanceToPointsTest, MeshWithSignedDistanceField) {
+  const Mesh mesh{
+      drake::FindResourceOrThrow("drake/geometry/test/extruded_u.obj"), 1.0};
+  const RigidTransformd X_WG(Vector3d{0.5, -0.25, 1});
+  const Vector3d p_GQ(0, 0, -0.45);
+  const Vector3d p_WQ = X_WG * p_GQ;
+
+  ProximityEngine<double> engine;
+  const GeometryId plain_id = GeometryId::get_new_id();
+  engine.AddAnchoredGeometry(mesh, X_WG, plain_id);
+  unordered_map<GeometryId, RigidTransformd> X_WGs{{plain_id, X_WG}};
+  EXPECT_EQ(engine.ComputeSignedDistanceToPoint(p_WQ, X_WGs).size(), 0);
+
+  ProximityProperties props;
+  AddSignedDistanceFieldProperties(0.05, 0.1, std::nullopt, std::nullopt,
+                                   &props);
+  const GeometryId sdf_id = GeometryId::get_new_id();
+  engine.AddDynamicGeometry(mesh, X_WG, sdf_id, props);
+  X_WGs[sdf_id] = X_WG;
+
+  const ProximityEngine<double> copy(engine);
+  for (const ProximityEngine<double>* e : {&std::as_const(engine), &copy}) {
+    const std::vector<SignedDistanceToPoint<double>> results =
+        e->ComputeSignedDistanceToPoint(p_WQ, X_WGs);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0].id_G, sdf_id);
+    EXPECT_NEAR(results[0].distance, 0.05, 1e-5);
+    EXPECT_TRUE(CompareMatrices(results[0].grad_W, Vector3d::UnitZ(), 1e-5));
+    EXPECT_TRUE(CompareMatrices(results[0].p_GN, Vector3d(0, 0, -0.5), 1e-5));
+
+    const SignedDistanceToPointBatch<double> batch =
+        e->ComputeSignedDistanceToPoints(Eigen::Matrix3Xd(p_WQ), X_WGs);
+    ASSERT_EQ(batch.num_results(), 1);
+    EXPECT_EQ(batch.id_G[0], sdf_id);
+    EXPECT_EQ(batch.distance(0), results[0].distance);
+  }
+
+  // Removing the geometry discards its field.
+  engine.RemoveGeometry(sdf_id, true);
+  EXPECT_EQ(engine.ComputeSignedDistanceToPoint(p_WQ, X_WGs).size(), 0);
+}
+
 // Test the narrow-phase part of ComputeSignedDistanceToPoint.
 
 // Parameter for the value-parameterized test fixture SignedDistanceToPointTest.
@@ -1890,6 +2007,43 @@ GTEST_TEST(ProximityEngineTests, FindCollisionCandidatesResultOrdering) {
   }
 }
 
+// The broadphase callbacks look up the collision filter by the index stored
+// with each fcl object. Confirms that the filter still applies to the right
+// pairs after a geometry is removed and another takes over its index, in the
+// engine and in a copy of it.
+GTEST_TEST(ProximityEngineTests, FilterIndexSurvivesRemoval) {
+  ProximityEngine<double> engine;
+  const Sphere sphere{0.5};
+  const GeometryId id_A = GeometryId::get_new_id();
+  const GeometryId id_B = GeometryId::get_new_id();
+  const GeometryId id_C = GeometryId::get_new_id();
+  const GeometryId id_D = GeometryId::get_new_id();
+  // All of the spheres overlap at the origin.
+  engine.AddDynamicGeometry(sphere, {}, id_A);
+  engine.AddDynamicGeometry(sphere, {}, id_B);
+  engine.AddAnchoredGeometry(sphere, {}, id_C);
+
+  auto extract_ids = [id_A, id_C](const GeometrySet&) {
+    return std::unordered_set<GeometryId>{id_A, id_C};
+  };
+  engine.collision_filter().Apply(
+      CollisionFilterDeclaration().ExcludeWithin(GeometrySet{id_A, id_C}),
+      extract_ids, false /* is_invariant */);
+
+  engine.RemoveGeometry(id_B, true);
+  engine.AddDynamicGeometry(sphere, {}, id_D);
+  const ProximityEngine<double> copy(engine);
+
+  const std::vector<SortedPair<GeometryId>> expected{{id_A, id_D},
+                                                     {id_C, id_D}};
+  for (const ProximityEngine<double>* e : {&std::as_const(engine), &copy}) {
+    std::vector<SortedPair<GeometryId>> candidates =
+        e->FindCollisionCandidates();
+    std::sort(candidates.begin(), candidates.end());
+    EXPECT_EQ(candidates, expected);
+  }
+}
+
 // Confirms that the ComputeContactSurfaces() computation returns the
 // same results twice in a row. This test is explicitly required because it is
 // known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -1960,6 +2114,126 @@ TEST_F(ProximityEngineHydro, ComputePolygonalContactSurfacesResultOrdering) {
   }
 }
 
+// Confirms that computing the contact surfaces with multiple threads produces
+// exactly the same results (in the same order) as the serial computation.
+TEST_F(ProximityEngineHydro, ComputeContactSurfacesInParallel) {
+  engine_.UpdateWorldPoses(poses_);
+  ASSERT_EQ(engine_.hydroelastic_num_threads(), 1);
+  const auto serial = engine_.ComputeContactSurfaces(poses_);
+  const auto serial_polygonal = engine_.ComputePolygonalContactSurfaces(poses_);
+
+  for (int num_threads : {2, 3, 8}) {
+    engine_.set_hydroelastic_num_threads(num_threads);
+    EXPECT_EQ(engine_.hydroelastic_num_threads(), num_threads);
+    for (const bool polygonal : {false, true}) {
+      const auto& expected = polygonal ? serial_polygonal : serial;
+      const auto parallel =
+          polygonal ? engine_.ComputePolygonalContactSurfaces(poses_)
+                    : engine_.ComputeContactSurfaces(poses_);
+      ASSERT_EQ(parallel.size(), expected.size());
+      for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(parallel[i].id_M(), expected[i].id_M());
+        EXPECT_EQ(parallel[i].id_N(), expected[i].id_N());
+        EXPECT_EQ(parallel[i].mesh_W().num_elements(),
+                  expected[i].mesh_W().num_elements());
+        EXPECT_EQ(parallel[i].mesh_W().total_area(),
+                  expected[i].mesh_W().total_area());
+      }
+    }
+  }
+
+  // The setting survives copying.
+  const ProximityEngine<double> copy(engine_);
+  EXPECT_EQ(copy.hydroelastic_num_threads(), 8);
+  EXPECT_EQ(engine_.ToAutoDiffXd()->hydroelastic_num_threads(), 8);
+
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      engine_.set_hydroelastic_num_threads(0), std::logic_error,
+      "The number of threads for computing contact surfaces must be "
+      "positive; given 0");
+}
+
+// Confirms that a single engine can be queried for contact surfaces from
+// multiple threads at once: each query uses its own scratch memory (and at most
+// one of them the coherence data), so all of them produce the same surfaces.
+TEST_F(ProximityEngineHydro, ConcurrentContactSurfaceQueries) {
+  engine_.UpdateWorldPoses(poses_);
+  const auto expected = engine_.ComputeContactSurfaces(poses_);
+  engine_.set_hydroelastic_coherence_enabled(true);
+
+  for (int num_threads : {1, 2}) {
+    engine_.set_hydroelastic_num_threads(num_threads);
+    constexpr int kNumQueryThreads = 4;
+    std::vector<std::vector<ContactSurface<double>>> results(kNumQueryThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumQueryThreads; ++t) {
+      threads.emplace_back([this, &results, t]() {
+        for (int k = 0; k < 10; ++k) {
+          results[t] = engine_.ComputeContactSurfaces(poses_);
+        }
+      });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    for (const auto& dut : results) {
+      ASSERT_EQ(dut.size(), expected.size());
+      for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_TRUE(dut[i].Equal(expected[i]));
+      }
+    }
+  }
+}
+
+// Confirms that computing the contact surfaces with temporal coherence enabled
+// produces exactly the same contact surfaces as without it, in both the serial
+// and parallel paths, regardless of the order of the queries: the poses move
+// away and come back, and the two representations are queried in alternating
+// order, so each query starts from the front of a different earlier query.
+TEST_F(ProximityEngineHydro, ComputeContactSurfacesWithCoherence) {
+  ASSERT_FALSE(engine_.hydroelastic_coherence_enabled());
+  ProximityEngine<double> coherent(engine_);
+  coherent.set_hydroelastic_coherence_enabled(true);
+  EXPECT_TRUE(coherent.hydroelastic_coherence_enabled());
+
+  const std::vector<int> steps{0, 1, 2, 4, 3, 1, 0, 5, 2};
+  for (int num_threads : {1, 3}) {
+    coherent.set_hydroelastic_num_threads(num_threads);
+    for (size_t k = 0; k < steps.size(); ++k) {
+      unordered_map<GeometryId, RigidTransformd> poses;
+      for (const auto& [id, X_WG] : poses_) {
+        poses[id] = RigidTransformd(
+            X_WG.rotation(),
+            X_WG.translation() + 1e-3 * steps[k] * Vector3d(1, -1, 0.5));
+      }
+      engine_.UpdateWorldPoses(poses);
+      coherent.UpdateWorldPoses(poses);
+      const bool polygonal_first = k % 2 == 1;
+      for (const bool polygonal : {polygonal_first, !polygonal_first}) {
+        const auto expected =
+            polygonal ? engine_.ComputePolygonalContactSurfaces(poses)
+                      : engine_.ComputeContactSurfaces(poses);
+        const auto dut = polygonal
+                             ? coherent.ComputePolygonalContactSurfaces(poses)
+                             : coherent.ComputeContactSurfaces(poses);
+        ASSERT_EQ(dut.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+          EXPECT_EQ(dut[i].id_M(), expected[i].id_M());
+          EXPECT_EQ(dut[i].id_N(), expected[i].id_N());
+          EXPECT_TRUE(dut[i].Equal(expected[i]));
+        }
+      }
+    }
+  }
+
+  // The setting survives copying.
+  const ProximityEngine<double> copy(coherent);
+  EXPECT_TRUE(copy.hydroelastic_coherence_enabled());
+  EXPECT_TRUE(coherent.ToAutoDiffXd()->hydroelastic_coherence_enabled());
+
+  coherent.set_hydroelastic_coherence_enabled(false);
+  EXPECT_FALSE(coherent.hydroelastic_coherence_enabled());
+}
+
 // Confirms that the ComputeContactSurfacesWithFallback() computation returns
 // the same results twice in a row. This test is explicitly required because it
 // is known that updating the pose in the FCL tree can lead to erratic ordering.
@@ -2053,6 +2327,33 @@ TEST_F(ProximityEngineHydroWithFallback,
   }
 }
 
+// Confirms that the parallel evaluation of the hydroelastic-with-fallback
+// query produces the same results as the serial evaluation.
+TEST_F(ProximityEngineHydroWithFallback,
+       ComputeContactSurfacesWithFallbackInParallel) {
+  engine_.UpdateWorldPoses(poses_);
+  vector<ContactSurface<double>> surfaces1;
+  vector<PenetrationAsPointPair<double>> points1;
+  engine_.ComputeContactSurfacesWithFallback(poses_, &surfaces1, &points1);
+
+  engine_.set_hydroelastic_num_threads(4);
+  vector<ContactSurface<double>> surfaces2;
+  vector<PenetrationAsPointPair<double>> points2;
+  engine_.ComputeContactSurfacesWithFallback(poses_, &surfaces2, &points2);
+  ASSERT_EQ(surfaces2.size(), N_ / 2);
+  ASSERT_EQ(points2.size(), N_ / 2);
+
+  for (size_t i = 0; i < N_ / 2; ++i) {
+    EXPECT_EQ(surfaces1[i].id_M(), surfaces2[i].id_M());
+    EXPECT_EQ(surfaces1[i].id_N(), surfaces2[i].id_N());
+    EXPECT_EQ(surfaces1[i].mesh_W().num_elements(),
+              surfaces2[i].mesh_W().num_elements());
+    EXPECT_EQ(points1[i].id_A, points2[i].id_A);
+    EXPECT_EQ(points1[i].id_B, points2[i].id_B);
+    EXPECT_EQ(points1[i].depth, points2[i].depth);
+  }
+}
+
 // These tests validate collisions/distance between spheres. This does *not*
 // test against other geometry types because we assume FCL works. This merely
 // confirms that the ProximityEngine functions provide the correct mapping.
@@ -175,6 +175,43 @@ GTEST_TEST(ProximityPropertiesTest, AddHalfSpaceSoftProperties) {
   }
 }
 
+GTEST_TEST(ProximityPropertiesTest, AddSignedDistanceFieldProperties) {
+  using internal::kSdfBandWidth;
+  using internal::kSdfCachePath;
+  using internal::kSdfGroup;
+  using internal::kSdfMaxMemory;
+  using internal::kSdfResolution;
+
+  {
+    ProximityProperties props;
+    AddSignedDistanceFieldProperties(0.01, 0.05, std::nullopt, std::nullopt,
+                                     &props);
+    EXPECT_EQ(props.GetProperty<double>(kSdfGroup, kSdfResolution), 0.01);
+    EXPECT_EQ(props.GetProperty<double>(kSdfGroup, kSdfBandWidth), 0.05);
+    EXPECT_FALSE(props.HasProperty(kSdfGroup, kSdfCachePath));
+    EXPECT_FALSE(props.HasProperty(kSdfGroup, kSdfMaxMemory));
+  }
+
+  {
+    ProximityProperties props;
+    AddSignedDistanceFieldProperties(0.01, 0, "/tmp/field.sdf", 1e6, &props);
+    EXPECT_EQ(props.GetProperty<double>(kSdfGroup, kSdfBandWidth), 0);
+    EXPECT_EQ(props.GetProperty<std::string>(kSdfGroup, kSdfCachePath),
+              "/tmp/field.sdf");
+    EXPECT_EQ(props.GetProperty<double>(kSdfGroup, kSdfMaxMemory), 1e6);
+  }
+
+  ProximityProperties props;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AddSignedDistanceFieldProperties(0, 0.05, std::nullopt, std::nullopt,
+                                       &props),
+      "The signed distance field resolution must be positive; given 0");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      AddSignedDistanceFieldProperties(0.01, -0.5, std::nullopt, std::nullopt,
+                                       &props),
+      "The signed distance field band width can't be negative; given -0.5");
+}
+
 }  // namespace
 }  // namespace geometry
 }  // namespace drake
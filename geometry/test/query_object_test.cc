@@ -182,6 +182,8 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
       GeometryId::get_new_id(), GeometryId::get_new_id()));
   EXPECT_DEFAULT_ERROR(
       default_object.ComputeSignedDistanceToPoint(Vector3<double>::Zero()));
+  EXPECT_DEFAULT_ERROR(default_object.ComputeSignedDistanceToPoints(
+      Matrix3X<double>::Zero(3, 1)));
 
   EXPECT_DEFAULT_ERROR(default_object.FindCollisionCandidates());
   EXPECT_DEFAULT_ERROR(default_object.HasCollisions());
@@ -202,6 +204,7 @@ TEST_F(QueryObjectTest, DefaultQueryThrows) {
   ImageLabel16I label;
   EXPECT_DEFAULT_ERROR(default_object.RenderLabelImage(
       color_camera, FrameId::get_new_id(), X_WC, &label));
+  EXPECT_DEFAULT_ERROR(default_object.RenderImages({}));
 
   EXPECT_DEFAULT_ERROR(default_object.GetRenderEngineByName("dummy"));
 
@@ -744,6 +744,42 @@ GTEST_TEST(SceneGraphContextModifier, RegisterGeometry) {
       "Referenced geometry \\d+ has not been registered.");
 }
 
+// Tests that the hydroelastic contact parameters are stored in the model and
+// copied into (and independently configurable in) the context.
+GTEST_TEST(SceneGraphContextModifier, HydroelasticContactParams) {
+  SceneGraph<double> scene_graph;
+  EXPECT_EQ(scene_graph.get_hydroelastic_contact_params().num_threads, 1);
+  EXPECT_FALSE(
+      scene_graph.get_hydroelastic_contact_params().exploit_temporal_coherence);
+
+  HydroelasticContactParams params;
+  params.num_threads = 3;
+  params.exploit_temporal_coherence = true;
+  scene_graph.set_hydroelastic_contact_params(params);
+  EXPECT_EQ(scene_graph.get_hydroelastic_contact_params().num_threads, 3);
+  auto context = scene_graph.CreateDefaultContext();
+  EXPECT_EQ(scene_graph.get_hydroelastic_contact_params(*context).num_threads,
+            3);
+  EXPECT_TRUE(scene_graph.get_hydroelastic_contact_params(*context)
+                  .exploit_temporal_coherence);
+
+  params.num_threads = 2;
+  params.exploit_temporal_coherence = false;
+  scene_graph.set_hydroelastic_contact_params(context.get(), params);
+  EXPECT_EQ(scene_graph.get_hydroelastic_contact_params(*context).num_threads,
+            2);
+  EXPECT_FALSE(scene_graph.get_hydroelastic_contact_params(*context)
+                   .exploit_temporal_coherence);
+  EXPECT_EQ(scene_graph.get_hydroelastic_contact_params().num_threads, 3);
+  EXPECT_TRUE(
+      scene_graph.get_hydroelastic_contact_params().exploit_temporal_coherence);
+
+  params.num_threads = 0;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      scene_graph.set_hydroelastic_contact_params(params),
+      ".*number of threads.*must be positive.*");
+}
+
 // TODO(2021-11-01) Remove this test entirely when resolving deprecation.
 GTEST_TEST(SceneGraphContextModifier, CollisionFiltersDeprecated) {
   // Initializes the scene graph and context.
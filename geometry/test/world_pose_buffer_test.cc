@@ -0,0 +1,71 @@
+#include "drake/geometry/world_pose_buffer.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/autodiff.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/math/roll_pitch_yaw.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+namespace {
+
+using Eigen::Vector3d;
+using math::RigidTransform;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+
+GTEST_TEST(WorldPoseBufferTest, AppendAndRead) {
+  WorldPoseBuffer buffer;
+  EXPECT_TRUE(buffer.empty());
+
+  std::vector<GeometryId> ids;
+  std::vector<RigidTransformd> poses;
+  for (int i = 0; i < 5; ++i) {
+    ids.push_back(GeometryId::get_new_id());
+    poses.emplace_back(RollPitchYawd(0.1 * i, -0.2 * i, 0.3 * i),
+                       Vector3d(i, 2 * i, -3 * i));
+    buffer.Append(ids.back(), poses.back());
+  }
+  // AutoDiff-valued poses are stored by value.
+  const GeometryId ad_id = GeometryId::get_new_id();
+  const RigidTransform<AutoDiffXd> X_WG_ad(
+      RigidTransformd(RollPitchYawd(1, 2, 3), Vector3d(4, 5, 6))
+          .cast<AutoDiffXd>());
+  buffer.Append(ad_id, X_WG_ad);
+  ids.push_back(ad_id);
+  poses.push_back(math::RigidTransformd(RollPitchYawd(1, 2, 3),
+                                        Vector3d(4, 5, 6)));
+
+  ASSERT_EQ(buffer.size(), 6);
+  for (int i = 0; i < buffer.size(); ++i) {
+    EXPECT_EQ(buffer.id(i), ids[i]);
+    EXPECT_TRUE(CompareMatrices(buffer.rotation(i),
+                                poses[i].rotation().matrix()));
+    EXPECT_TRUE(CompareMatrices(buffer.translation(i), poses[i].translation()));
+    EXPECT_TRUE(CompareMatrices(buffer.pose(i).GetAsMatrix34(),
+                                poses[i].GetAsMatrix34()));
+  }
+
+  // The value arrays are aligned to cache lines.
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(buffer.rotation(0).data()) % 64,
+            0);
+  EXPECT_EQ(
+      reinterpret_cast<std::uintptr_t>(buffer.translation(0).data()) % 64, 0);
+
+  // Copies are independent.
+  const WorldPoseBuffer copy(buffer);
+  buffer.clear();
+  EXPECT_TRUE(buffer.empty());
+  ASSERT_EQ(copy.size(), 6);
+  EXPECT_EQ(copy.id(5), ad_id);
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include "drake/common/drake_assert.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/geometry/geometry_ids.h"
+#include "drake/geometry/utilities.h"
+#include "drake/math/rigid_transform.h"
+
+namespace drake {
+namespace geometry {
+namespace internal {
+
+/* The double-valued world poses X_WG of a set of geometries, stored as a
+ structure of arrays: an array of geometry ids, an array of rotation matrices
+ (nine contiguous values per pose, column major) and an array of translations
+ (three contiguous values per pose). The value arrays are 64-byte aligned.
+
+ GeometryState fills one of these with the geometries whose poses changed in a
+ pose update, converting each pose to double once. The proximity and render
+ engines then read the poses in place (see rotation() and translation()),
+ rather than each looking up and converting the T-valued poses themselves.  */
+class WorldPoseBuffer {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(WorldPoseBuffer)
+
+  WorldPoseBuffer() = default;
+
+  /* Appends the pose of the geometry with the given `id`; the pose is
+   converted to double.  */
+  template <typename T>
+  void Append(GeometryId id, const math::RigidTransform<T>& X_WG) {
+    const math::RigidTransformd& X_WG_d = convert_to_double(X_WG);
+    const int i = size();
+    ids_.push_back(id);
+    rotations_.resize(9 * (i + 1));
+    translations_.resize(3 * (i + 1));
+    Eigen::Map<Eigen::Matrix3d> R_WG(&rotations_[9 * i]);
+    Eigen::Map<Eigen::Vector3d> p_WG(&translations_[3 * i]);
+    R_WG = X_WG_d.rotation().matrix();
+    p_WG = X_WG_d.translation();
+  }
+
+  /* Removes all poses, retaining the allocated memory.  */
+  void clear() {
+    ids_.clear();
+    rotations_.clear();
+    translations_.clear();
+  }
+
+  int size() const { return static_cast<int>(ids_.size()); }
+
+  bool empty() const { return ids_.empty(); }
+
+  /* The id of the geometry whose pose is the ith.  */
+  GeometryId id(int i) const {
+    DRAKE_ASSERT(0 <= i && i < size());
+    return ids_[i];
+  }
+
+  /* The rotation matrix R_WG of the ith pose.  */
+  Eigen::Map<const Eigen::Matrix3d> rotation(int i) const {
+    DRAKE_ASSERT(0 <= i && i < size());
+    return Eigen::Map<const Eigen::Matrix3d>(&rotations_[9 * i]);
+  }
+
+  /* The translation p_WoGo_W of the ith pose.  */
+  Eigen::Map<const Eigen::Vector3d> translation(int i) const {
+    DRAKE_ASSERT(0 <= i && i < size());
+    return Eigen::Map<const Eigen::Vector3d>(&translations_[3 * i]);
+  }
+
+  /* The ith pose as a RigidTransform (for consumers which require one).  */
+  math::RigidTransformd pose(int i) const {
+    return math::RigidTransformd(math::RotationMatrixd(rotation(i)),
+                                 translation(i));
+  }
+
+ private:
+  /* A minimal allocator for 64-byte (cache line) aligned storage.  */
+  template <typename U>
+  struct AlignedAllocator {
+    using value_type = U;
+    static constexpr std::align_val_t kAlignment{64};
+
+    AlignedAllocator() = default;
+    template <typename V>
+    AlignedAllocator(const AlignedAllocator<V>&) {}
+
+    U* allocate(std::size_t n) {
+      return static_cast<U*>(::operator new(n * sizeof(U), kAlignment));
+    }
+    void deallocate(U* p, std::size_t) { ::operator delete(p, kAlignment); }
+
+    template <typename V>
+    bool operator==(const AlignedAllocator<V>&) const { return true; }
+    template <typename V>
+    bool operator!=(const AlignedAllocator<V>&) const { return false; }
+  };
+
+  std::vector<GeometryId> ids_;
+  std::vector<double, AlignedAllocator<double>> rotations_;
+  std::vector<double, AlignedAllocator<double>> translations_;
+};
+
+}  // namespace internal
+}  // namespace geometry
+}  // namespace drake
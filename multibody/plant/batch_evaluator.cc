@@ -0,0 +1,160 @@
+#include "drake/multibody/plant/batch_evaluator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/multibody/tree/multibody_tree_system.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+BatchEvaluator<T>::BatchEvaluator(const MultibodyPlant<T>* plant,
+                                  const systems::Context<T>& context,
+                                  int num_threads)
+    : plant_(plant) {
+  DRAKE_THROW_UNLESS(plant != nullptr);
+  DRAKE_THROW_UNLESS(plant->is_finalized());
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  if (!context.is_root_context()) {
+    throw std::logic_error(fmt::format(
+        "BatchEvaluator: the given context (of the system '{}') is not a root "
+        "context; pass the root context that contains it instead (e.g., the "
+        "Diagram's context rather than plant.GetMyContextFromRoot()).",
+        context.GetSystemPathname()));
+  }
+  for (int t = 0; t < num_threads; ++t) {
+    root_contexts_.push_back(context.Clone());
+    contexts_.push_back(
+        &plant->GetMyMutableContextFromRoot(root_contexts_.back().get()));
+    auto scratch = std::make_unique<Scratch>(*plant);
+    scratch->A_WB.resize(plant->num_bodies());
+    scratch->F_BMo_W.resize(plant->num_bodies());
+    scratch->vdot.resize(plant->num_velocities());
+    scratches_.push_back(std::move(scratch));
+  }
+  plant->ValidateContext(*contexts_.front());
+  thread_pool_ = std::make_unique<drake::internal::ThreadPool>(num_threads);
+}
+
+template <typename T>
+BatchEvaluator<T>::~BatchEvaluator() = default;
+
+template <typename T>
+void BatchEvaluator<T>::CalcBodyPosesInWorld(
+    const Eigen::Ref<const MatrixX<T>>& q,
+    std::vector<math::RigidTransform<T>>* X_WB) const {
+  DRAKE_THROW_UNLESS(X_WB != nullptr);
+  const int num_instances = ValidateBatch(q);
+  const int num_bodies = plant_->num_bodies();
+  X_WB->resize(num_instances * num_bodies);
+  thread_pool_->ParallelForWithThreadIndex(
+      0, num_instances, grain_size(num_instances),
+      [&](int thread_index, int k) {
+        systems::Context<T>& context = *contexts_[thread_index];
+        plant_->SetPositions(&context, q.col(k));
+        for (BodyIndex b(0); b < num_bodies; ++b) {
+          (*X_WB)[k * num_bodies + b] =
+              plant_->EvalBodyPoseInWorld(context, plant_->get_body(b));
+        }
+      });
+}
+
+template <typename T>
+void BatchEvaluator<T>::CalcJacobianSpatialVelocity(
+    const Eigen::Ref<const MatrixX<T>>& q, JacobianWrtVariable with_respect_to,
+    const Frame<T>& frame_B, const Eigen::Ref<const Vector3<T>>& p_BoBp_B,
+    const Frame<T>& frame_A, const Frame<T>& frame_E,
+    MatrixX<T>* Js_V_ABp_E) const {
+  DRAKE_THROW_UNLESS(Js_V_ABp_E != nullptr);
+  const int num_instances = ValidateBatch(q);
+  const int n = with_respect_to == JacobianWrtVariable::kQDot
+                    ? plant_->num_positions()
+                    : plant_->num_velocities();
+  Js_V_ABp_E->resize(6, num_instances * n);
+  thread_pool_->ParallelForWithThreadIndex(
+      0, num_instances, grain_size(num_instances),
+      [&](int thread_index, int k) {
+        systems::Context<T>& context = *contexts_[thread_index];
+        plant_->SetPositions(&context, q.col(k));
+        auto J_k = Js_V_ABp_E->middleCols(k * n, n);
+        plant_->CalcJacobianSpatialVelocity(context, with_respect_to, frame_B,
+                                            p_BoBp_B, frame_A, frame_E, &J_k);
+      });
+}
+
+template <typename T>
+void BatchEvaluator<T>::CalcMassMatrices(const Eigen::Ref<const MatrixX<T>>& q,
+                                         MatrixX<T>* M) const {
+  DRAKE_THROW_UNLESS(M != nullptr);
+  const int num_instances = ValidateBatch(q);
+  const int nv = plant_->num_velocities();
+  M->resize(nv, num_instances * nv);
+  thread_pool_->ParallelForWithThreadIndex(
+      0, num_instances, grain_size(num_instances),
+      [&](int thread_index, int k) {
+        systems::Context<T>& context = *contexts_[thread_index];
+        plant_->SetPositions(&context, q.col(k));
+        auto M_k = M->middleCols(k * nv, nv);
+        plant_->CalcMassMatrix(context, &M_k);
+      });
+}
+
+template <typename T>
+void BatchEvaluator<T>::CalcInverseDynamics(
+    const Eigen::Ref<const MatrixX<T>>& q,
+    const Eigen::Ref<const MatrixX<T>>& v,
+    const Eigen::Ref<const MatrixX<T>>& vdot, MatrixX<T>* tau) const {
+  DRAKE_THROW_UNLESS(tau != nullptr);
+  const int num_instances = ValidateBatch(q, &v, &vdot);
+  tau->resize(plant_->num_velocities(), num_instances);
+  const internal::MultibodyTree<T>& tree = internal::GetInternalTree(*plant_);
+  thread_pool_->ParallelForWithThreadIndex(
+      0, num_instances, grain_size(num_instances),
+      [&](int thread_index, int k) {
+        systems::Context<T>& context = *contexts_[thread_index];
+        Scratch& scratch = *scratches_[thread_index];
+        plant_->SetPositions(&context, q.col(k));
+        plant_->SetVelocities(&context, v.col(k));
+        plant_->CalcForceElementsContribution(context, &scratch.forces);
+        scratch.vdot = vdot.col(k);
+        Eigen::Ref<VectorX<T>> tau_k = tau->col(k);
+        tree.CalcInverseDynamics(
+            context, scratch.vdot, scratch.forces.body_forces(),
+            scratch.forces.generalized_forces(), &scratch.A_WB,
+            &scratch.F_BMo_W, &tau_k);
+      });
+}
+
+template <typename T>
+int BatchEvaluator<T>::grain_size(int num_instances) const {
+  // About four chunks per thread balances the load without claiming chunks
+  // too often.
+  return std::max(1, num_instances / (4 * num_threads()));
+}
+
+template <typename T>
+int BatchEvaluator<T>::ValidateBatch(
+    const Eigen::Ref<const MatrixX<T>>& q,
+    const Eigen::Ref<const MatrixX<T>>* v,
+    const Eigen::Ref<const MatrixX<T>>* vdot) const {
+  DRAKE_THROW_UNLESS(q.rows() == plant_->num_positions());
+  const int num_instances = static_cast<int>(q.cols());
+  for (const auto* velocities : {v, vdot}) {
+    if (velocities != nullptr) {
+      DRAKE_THROW_UNLESS(velocities->rows() == plant_->num_velocities());
+      DRAKE_THROW_UNLESS(velocities->cols() == num_instances);
+    }
+  }
+  return num_instances;
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::BatchEvaluator)
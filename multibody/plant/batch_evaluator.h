@@ -0,0 +1,163 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/common/thread_pool.h"
+#include "drake/math/rigid_transform.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+
+/** Evaluates kinematic and dynamic quantities of a MultibodyPlant at a batch of
+K configurations (and velocities) at once, e.g., for the samples of a
+sampling-based planner, the seeds of an inverse kinematics solver, or the
+states of a set of learning rollouts.
+
+The batch is given as a matrix with one column per instance: `q` is
+`num_positions() x K` and `v` is `num_velocities() x K`. The results are
+returned packed in the same instance-major order (see each method for the exact
+layout), so that the results for a batch are written into a single allocation.
+
+Evaluating a batch through a loop over K contexts spends much of its time
+allocating and initializing those contexts and the results for each. This
+class instead owns one scratch context per worker thread (cloned once, at
+construction, from a user-supplied root context, so that the plant's parameters
+and any state not given per instance are those of that context), writes each
+instance's state into it, and writes the results directly into the packed
+outputs; the intermediate quantities of each computation also live in per-thread
+scratch memory that is allocated once, at construction. The instances are
+independent, so the batch is split across up to `num_threads` threads, which
+are created once, at construction, and reused by every batch; the results do not
+depend on the number of threads.
+
+This class is not thread-safe: the scratch contexts are shared by all of its
+methods, so a single %BatchEvaluator must not be used by more than one thread
+at a time.
+
+@tparam_nonsymbolic_scalar */
+template <typename T>
+class BatchEvaluator {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(BatchEvaluator)
+
+  /** Creates an evaluator for the given `plant`.
+   @param plant The plant to evaluate. It is aliased, and must outlive this
+     evaluator.
+   @param context A root context that either is a context for `plant` or
+     contains one, e.g., the context of a Diagram built with
+     AddMultibodyPlantSceneGraph(). The parameters (and any state or input not
+     given per instance) of its context for `plant` are used for every
+     instance. It is copied (in full, once per thread).
+   @param num_threads The maximum number of threads used to evaluate a batch
+     (including the calling thread).
+   @throws std::exception if `plant` is nullptr or not finalized, if `context`
+     is not a root context (e.g., it is `plant.GetMyContextFromRoot(root)`;
+     pass `root` instead), if `context` neither is nor contains a context for
+     `plant`, or if `num_threads < 1`. */
+  BatchEvaluator(const MultibodyPlant<T>* plant,
+                 const systems::Context<T>& context, int num_threads = 1);
+
+  ~BatchEvaluator();
+
+  /** Returns the plant being evaluated. */
+  const MultibodyPlant<T>& plant() const { return *plant_; }
+
+  /** Returns the maximum number of threads used to evaluate a batch. */
+  int num_threads() const { return thread_pool_->num_threads(); }
+
+  /** Computes the pose `X_WB` of every body B in the world frame W, for each
+   configuration in `q`.
+   @param q The `num_positions() x K` batch of configurations.
+   @param[out] X_WB On output, holds `K * num_bodies()` poses; the pose of the
+     body with index `b` for instance `k` is `(*X_WB)[k * num_bodies() + b]`.
+   @throws std::exception if `q` has the wrong number of rows or `X_WB` is
+     nullptr. */
+  void CalcBodyPosesInWorld(const Eigen::Ref<const MatrixX<T>>& q,
+                            std::vector<math::RigidTransform<T>>* X_WB) const;
+
+  /** Computes the spatial velocity Jacobian `J𝑠_V_ABp_E` of a point Bp fixed
+   to frame B, for each configuration in `q`. See
+   MultibodyPlant::CalcJacobianSpatialVelocity() for the meaning of the
+   arguments.
+   @param q The `num_positions() x K` batch of configurations.
+   @param[out] Js_V_ABp_E On output, the `6 x (K * n)` matrix whose columns
+     `[k * n, (k + 1) * n)` hold the Jacobian for instance `k`, where `n` is
+     num_positions() or num_velocities(), per `with_respect_to`.
+   @throws std::exception if `q` has the wrong number of rows or `Js_V_ABp_E`
+     is nullptr. */
+  void CalcJacobianSpatialVelocity(const Eigen::Ref<const MatrixX<T>>& q,
+                                   JacobianWrtVariable with_respect_to,
+                                   const Frame<T>& frame_B,
+                                   const Eigen::Ref<const Vector3<T>>& p_BoBp_B,
+                                   const Frame<T>& frame_A,
+                                   const Frame<T>& frame_E,
+                                   MatrixX<T>* Js_V_ABp_E) const;
+
+  /** Computes the mass matrix `M(q)` for each configuration in `q`.
+   @param q The `num_positions() x K` batch of configurations.
+   @param[out] M On output, the `nv x (K * nv)` matrix whose columns
+     `[k * nv, (k + 1) * nv)` hold the mass matrix for instance `k`, where `nv`
+     is num_velocities().
+   @throws std::exception if `q` has the wrong number of rows or `M` is
+     nullptr. */
+  void CalcMassMatrices(const Eigen::Ref<const MatrixX<T>>& q,
+                        MatrixX<T>* M) const;
+
+  /** For each instance `k`, computes the generalized forces
+   `tau = M(q)v̇ + C(q, v)v - tau_app` that achieve the generalized
+   accelerations `vdot.col(k)` at the state `(q.col(k), v.col(k))`, where
+   `tau_app` are the forces applied by the plant's force elements (e.g.,
+   gravity), as computed by MultibodyPlant::CalcForceElementsContribution().
+   @param q The `num_positions() x K` batch of configurations.
+   @param v The `num_velocities() x K` batch of generalized velocities.
+   @param vdot The `num_velocities() x K` batch of generalized accelerations.
+   @param[out] tau On output, the `num_velocities() x K` generalized forces.
+   @throws std::exception if the inputs have the wrong sizes or `tau` is
+     nullptr. */
+  void CalcInverseDynamics(const Eigen::Ref<const MatrixX<T>>& q,
+                           const Eigen::Ref<const MatrixX<T>>& v,
+                           const Eigen::Ref<const MatrixX<T>>& vdot,
+                           MatrixX<T>* tau) const;
+
+ private:
+  // Throws unless `q` is a batch of configurations (and, when provided, `v`
+  // and `vdot` are batches of velocities of the same size). Returns the
+  // number of instances K.
+  int ValidateBatch(const Eigen::Ref<const MatrixX<T>>& q,
+                    const Eigen::Ref<const MatrixX<T>>* v = nullptr,
+                    const Eigen::Ref<const MatrixX<T>>* vdot = nullptr) const;
+
+  // Returns the number of consecutive instances each thread claims at once.
+  int grain_size(int num_instances) const;
+
+  // The per-thread scratch memory of CalcInverseDynamics(), sized at
+  // construction.
+  struct Scratch {
+    explicit Scratch(const MultibodyPlant<T>& plant) : forces(plant) {}
+    MultibodyForces<T> forces;
+    std::vector<SpatialAcceleration<T>> A_WB;
+    std::vector<SpatialForce<T>> F_BMo_W;
+    VectorX<T> vdot;
+  };
+
+  const MultibodyPlant<T>* const plant_;
+  // One scratch copy of the root context (and the other scratch memory) per
+  // worker thread, and the plant's context within each copy.
+  std::vector<std::unique_ptr<systems::Context<T>>> root_contexts_;
+  std::vector<systems::Context<T>*> contexts_;
+  std::vector<std::unique_ptr<Scratch>> scratches_;
+  // The threads that evaluate a batch; the calling thread is thread 0.
+  std::unique_ptr<drake::internal::ThreadPool> thread_pool_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_NONSYMBOLIC_SCALARS(
+    class ::drake::multibody::BatchEvaluator)
@@ -0,0 +1,336 @@
+#include "drake/multibody/plant/dynamics_derivatives.h"
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/nice_type_name.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/prismatic_mobilizer.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/revolute_mobilizer.h"
+#include "drake/multibody/tree/weld_mobilizer.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+// Spatial vectors below are about the world origin Wo and expressed in W,
+// with the rotational component first, as everywhere in Drake.
+
+// Returns the cross product m1 × m2 of two motion vectors.
+Vector6<double> CrossMotion(const Vector6<double>& m1,
+                            const Vector6<double>& m2) {
+  Vector6<double> result;
+  result << m1.head<3>().cross(m2.head<3>()),
+      m1.head<3>().cross(m2.tail<3>()) + m1.tail<3>().cross(m2.head<3>());
+  return result;
+}
+
+// Returns the cross product m ×* f of a motion vector and a force vector.
+Vector6<double> CrossForce(const Vector6<double>& m, const Vector6<double>& f) {
+  Vector6<double> result;
+  result << m.head<3>().cross(f.head<3>()) + m.tail<3>().cross(f.tail<3>()),
+      m.head<3>().cross(f.tail<3>());
+  return result;
+}
+
+// Throws unless `plant` is a finalized plant, which it returns.
+const MultibodyPlant<double>& ValidatePlant(
+    const MultibodyPlant<double>* plant) {
+  DRAKE_THROW_UNLESS(plant != nullptr);
+  DRAKE_THROW_UNLESS(plant->is_finalized());
+  return *plant;
+}
+
+}  // namespace
+
+DynamicsDerivatives::DynamicsDerivatives(const MultibodyPlant<double>* plant)
+    : plant_(plant), factorization_(ValidatePlant(plant)) {
+  if (plant->num_force_elements() != 1) {
+    throw std::logic_error(fmt::format(
+        "DynamicsDerivatives: the only supported force element is gravity, "
+        "but the plant has {} force elements.",
+        plant->num_force_elements()));
+  }
+  if (plant->num_collision_geometries() > 0) {
+    throw std::logic_error(fmt::format(
+        "DynamicsDerivatives: contact is not supported, but the plant has {} "
+        "collision geometries.",
+        plant->num_collision_geometries()));
+  }
+
+  const internal::MultibodyTree<double>& tree =
+      internal::GetInternalTree(*plant);
+  const internal::MultibodyTreeTopology& topology = tree.get_topology();
+  for (internal::BodyNodeIndex node_index(1);
+       node_index < topology.get_num_body_nodes(); ++node_index) {
+    const internal::BodyNodeTopology& node_topology =
+        topology.get_body_node(node_index);
+    const internal::Mobilizer<double>& mobilizer =
+        tree.get_mobilizer(node_topology.mobilizer);
+    Node node;
+    node.parent = node_topology.parent_body_node - 1;
+    node.frame_F = &mobilizer.inboard_frame();
+    node.frame_M = &mobilizer.outboard_frame();
+    node.body = &plant->get_body(node_topology.body);
+    if (const auto* revolute =
+            dynamic_cast<const internal::RevoluteMobilizer<double>*>(
+                &mobilizer)) {
+      node.type = JointType::kRevolute;
+      node.axis_F = revolute->revolute_axis();
+    } else if (const auto* prismatic =
+                   dynamic_cast<const internal::PrismaticMobilizer<double>*>(
+                       &mobilizer)) {
+      node.type = JointType::kPrismatic;
+      node.axis_F = prismatic->translation_axis();
+    } else if (dynamic_cast<const internal::WeldMobilizer<double>*>(
+                   &mobilizer) != nullptr) {
+      node.type = JointType::kWeld;
+    } else {
+      throw std::logic_error(fmt::format(
+          "DynamicsDerivatives: only revolute, prismatic, and weld joints are "
+          "supported, but body '{}' is connected to its parent by a {}.",
+          node.body->name(), NiceTypeName::Get(mobilizer)));
+    }
+    if (node.type != JointType::kWeld) {
+      node.q_index = node_topology.mobilizer_positions_start;
+      node.v_index = node_topology.mobilizer_velocities_start_in_v;
+    }
+    nodes_.push_back(node);
+  }
+
+  damping_ = VectorX<double>::Zero(plant->num_velocities());
+  for (JointIndex joint_index(0); joint_index < plant->num_joints();
+       ++joint_index) {
+    const Joint<double>& joint = plant->get_joint(joint_index);
+    if (const auto* revolute =
+            dynamic_cast<const RevoluteJoint<double>*>(&joint)) {
+      damping_(joint.velocity_start()) = revolute->damping();
+    } else if (const auto* prismatic =
+                   dynamic_cast<const PrismaticJoint<double>*>(&joint)) {
+      damping_(joint.velocity_start()) = prismatic->damping();
+    }
+  }
+  B_ = plant->MakeActuationMatrix();
+
+  const int num_nodes = static_cast<int>(nodes_.size());
+  S_.resize(num_nodes);
+  V_.resize(num_nodes);
+  A_.resize(num_nodes);
+  h_.resize(num_nodes);
+  F_.resize(num_nodes);
+  I_.resize(num_nodes);
+  dF_dq_.resize(num_nodes);
+  dF_dv_.resize(num_nodes);
+  in_subtree_.resize(num_nodes);
+}
+
+DynamicsDerivatives::~DynamicsDerivatives() = default;
+
+void DynamicsDerivatives::CalcKinematics(
+    const systems::Context<double>& context,
+    const VectorX<double>* vdot) const {
+  const Eigen::VectorBlock<const VectorX<double>> v =
+      plant_->GetVelocities(context);
+  // With the gravity offset, A is the acceleration of each body relative to a
+  // frame falling freely with gravity, so that F includes the weights.
+  A_world_ << Vector3<double>::Zero(),
+      -plant_->gravity_field().gravity_vector();
+  const int num_nodes = static_cast<int>(nodes_.size());
+  for (int i = 0; i < num_nodes; ++i) {
+    const Node& node = nodes_[i];
+    if (node.type == JointType::kWeld) {
+      S_[i].setZero();
+    } else {
+      const Vector3<double> axis_W =
+          node.frame_F->CalcRotationMatrixInWorld(context) * node.axis_F;
+      if (node.type == JointType::kRevolute) {
+        // The joint rotates about the axis through Mo.
+        const Vector3<double> p_WoMo_W =
+            node.frame_M->CalcPoseInWorld(context).translation();
+        S_[i] << axis_W, p_WoMo_W.cross(axis_W);
+      } else {
+        S_[i] << Vector3<double>::Zero(), axis_W;
+      }
+    }
+    const double vi = node.v_index >= 0 ? v(node.v_index) : 0.0;
+    V_[i] = S_[i] * vi;
+    if (node.parent >= 0) V_[i] += V_[node.parent];
+    if (vdot == nullptr) continue;
+
+    const math::RigidTransform<double>& X_WB =
+        node.body->EvalPoseInWorld(context);
+    I_[i] = node.body->CalcSpatialInertiaInBodyFrame(context)
+                .ReExpress(X_WB.rotation())
+                .Shift(-X_WB.translation())
+                .CopyToFullMatrix6();
+    const double vdot_i = node.v_index >= 0 ? (*vdot)(node.v_index) : 0.0;
+    // A = A_P + S⋅v̇ + Ṡ⋅v, with Ṡ = V × S for S fixed in the body.
+    A_[i] = (node.parent >= 0 ? A_[node.parent] : A_world_) + S_[i] * vdot_i +
+            CrossMotion(V_[i], S_[i]) * vi;
+    h_[i] = I_[i] * V_[i];
+    F_[i] = I_[i] * A_[i] + CrossForce(V_[i], h_[i]);
+  }
+  if (vdot == nullptr) return;
+  for (int i = num_nodes - 1; i >= 0; --i) {
+    if (nodes_[i].parent >= 0) F_[nodes_[i].parent] += F_[i];
+  }
+}
+
+void DynamicsDerivatives::CalcInverseDynamicsDerivatives(
+    const systems::Context<double>& context,
+    const Eigen::Ref<const VectorX<double>>& known_vdot,
+    MatrixX<double>* dtau_dq, MatrixX<double>* dtau_dv) const {
+  plant_->ValidateContext(context);
+  const int nq = plant_->num_positions();
+  const int nv = plant_->num_velocities();
+  DRAKE_THROW_UNLESS(known_vdot.size() == nv);
+  DRAKE_THROW_UNLESS(dtau_dq != nullptr);
+  DRAKE_THROW_UNLESS(dtau_dv != nullptr);
+  vdot_ = known_vdot;
+  CalcKinematics(context, &vdot_);
+  dtau_dq->setZero(nv, nq);
+  dtau_dv->setZero(nv, nv);
+
+  // A change δ of the coordinate of joint j moves the subtree of its body J
+  // rigidly by the twist Sⱼ⋅δ, which changes the subtree's vectors by their
+  // cross product with Sⱼ. This is the world-frame differentiation of the
+  // recursive Newton-Euler algorithm of [Carpentier 2018], with the partials
+  // of each body's force computed directly from those of its velocity and
+  // acceleration.
+  const int num_nodes = static_cast<int>(nodes_.size());
+  for (int J = 0; J < num_nodes; ++J) {
+    const Node& joint_node = nodes_[J];
+    if (joint_node.type == JointType::kWeld) continue;
+    const Vector6<double>& Sj = S_[J];
+    const int parent = joint_node.parent;
+    const Vector6<double> V_P =
+        parent >= 0 ? V_[parent] : Vector6<double>::Zero();
+    const Vector6<double>& A_P = parent >= 0 ? A_[parent] : A_world_;
+    const Vector6<double> Sj_cross_V_P = CrossMotion(Sj, V_P);
+    const Vector6<double> V_P_cross_Sj = -Sj_cross_V_P;
+
+    // Partials of the force of each body in the subtree.
+    for (int i = J; i < num_nodes; ++i) {
+      in_subtree_[i] =
+          i == J || (nodes_[i].parent >= J && in_subtree_[nodes_[i].parent]);
+      if (!in_subtree_[i]) continue;
+      const Matrix6<double>& I = I_[i];
+      const Vector6<double>& V = V_[i];
+      // The subtree's velocities relative to J's parent, which are the ones
+      // carried along by the motion of joint j.
+      const Vector6<double> V_rel = V - V_P;
+
+      // With respect to q: dV = Sj × V_rel, dA = Sj × (A - A_P) -
+      // (Sj × V_P) × V_rel, and dI⋅x = Sj ×* (I⋅x) - I⋅(Sj × x).
+      const Vector6<double> dV_dq = CrossMotion(Sj, V_rel);
+      const Vector6<double> dA_dq =
+          CrossMotion(Sj, A_[i] - A_P) - CrossMotion(Sj_cross_V_P, V_rel);
+      const Vector6<double> dI_A =
+          CrossForce(Sj, I * A_[i]) - I * CrossMotion(Sj, A_[i]);
+      const Vector6<double> dI_V =
+          CrossForce(Sj, h_[i]) - I * CrossMotion(Sj, V);
+      dF_dq_[i] = dI_A + I * dA_dq + CrossForce(dV_dq, h_[i]) +
+                  CrossForce(V, dI_V + I * dV_dq);
+
+      // With respect to v: dV = Sj and dA = Sj × V_rel + V_P × Sj.
+      const Vector6<double> dA_dv = dV_dq + V_P_cross_Sj;
+      dF_dv_[i] =
+          I * dA_dv + CrossForce(Sj, h_[i]) + CrossForce(V, I * Sj);
+    }
+    for (int i = num_nodes - 1; i > J; --i) {
+      if (!in_subtree_[i]) continue;
+      dF_dq_[nodes_[i].parent] += dF_dq_[i];
+      dF_dv_[nodes_[i].parent] += dF_dv_[i];
+    }
+
+    // tau_k = S_kᵀ⋅F_k. Within the subtree S_k moves with joint j as well;
+    // the ancestors of J only see the change of F_J.
+    const int j_q = joint_node.q_index;
+    const int j_v = joint_node.v_index;
+    for (int k = J; k < num_nodes; ++k) {
+      if (!in_subtree_[k] || nodes_[k].type == JointType::kWeld) continue;
+      const int k_v = nodes_[k].v_index;
+      (*dtau_dq)(k_v, j_q) =
+          CrossMotion(Sj, S_[k]).dot(F_[k]) + S_[k].dot(dF_dq_[k]);
+      (*dtau_dv)(k_v, j_v) = S_[k].dot(dF_dv_[k]);
+    }
+    for (int k = parent; k >= 0; k = nodes_[k].parent) {
+      if (nodes_[k].type == JointType::kWeld) continue;
+      const int k_v = nodes_[k].v_index;
+      (*dtau_dq)(k_v, j_q) = S_[k].dot(dF_dq_[J]);
+      (*dtau_dv)(k_v, j_v) = S_[k].dot(dF_dv_[J]);
+    }
+  }
+
+  // tau_app includes the joint damping forces -d⋅v.
+  dtau_dv->diagonal() += damping_;
+}
+
+void DynamicsDerivatives::CalcForwardDynamicsDerivatives(
+    const systems::Context<double>& context, MatrixX<double>* dvdot_dq,
+    MatrixX<double>* dvdot_dv, MatrixX<double>* dvdot_du) const {
+  plant_->ValidateContext(context);
+  DRAKE_THROW_UNLESS(!plant_->is_discrete());
+  DRAKE_THROW_UNLESS(dvdot_dq != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_dv != nullptr);
+  DRAKE_THROW_UNLESS(dvdot_du != nullptr);
+  if (plant_->get_applied_spatial_force_input_port().HasValue(context)) {
+    throw std::logic_error(
+        "DynamicsDerivatives: the applied spatial force input port must not "
+        "be connected.");
+  }
+
+  // Differentiate ID(q, v, v̇(q, v, u)) = B⋅u + tau_ext.
+  const VectorX<double> vdot = plant_->EvalTimeDerivatives(context)
+                                   .get_generalized_velocity()
+                                   .CopyToVector();
+  CalcInverseDynamicsDerivatives(context, vdot, dvdot_dq, dvdot_dv);
+  plant_->CalcMassMatrixFactorization(context, &factorization_);
+  factorization_.SolveInPlace(dvdot_dq);
+  *dvdot_dq *= -1.0;
+  factorization_.SolveInPlace(dvdot_dv);
+  *dvdot_dv *= -1.0;
+  *dvdot_du = B_;
+  factorization_.SolveInPlace(dvdot_du);
+}
+
+void DynamicsDerivatives::CalcSpatialVelocityDerivatives(
+    const systems::Context<double>& context, const Frame<double>& frame_B,
+    MatrixX<double>* dV_WBo_W_dq, MatrixX<double>* dV_WBo_W_dv) const {
+  plant_->ValidateContext(context);
+  DRAKE_THROW_UNLESS(dV_WBo_W_dq != nullptr);
+  DRAKE_THROW_UNLESS(dV_WBo_W_dv != nullptr);
+  dV_WBo_W_dq->setZero(6, plant_->num_positions());
+  dV_WBo_W_dv->setZero(6, plant_->num_velocities());
+  const int i = frame_B.body().node_index() - 1;
+  if (i < 0) return;  // Frame B is fixed to the world.
+  CalcKinematics(context, nullptr);
+
+  // V_WBo_W = [w; v_Wo + w × p], with V_i = [w; v_Wo] about Wo.
+  const Vector3<double> p_WoBo_W =
+      frame_B.CalcPoseInWorld(context).translation();
+  const Vector3<double> w_WB_W = V_[i].head<3>();
+  for (int J = i; J >= 0; J = nodes_[J].parent) {
+    const Node& joint_node = nodes_[J];
+    if (joint_node.type == JointType::kWeld) continue;
+    const Vector6<double>& Sj = S_[J];
+    const Vector6<double> V_P = joint_node.parent >= 0
+                                    ? V_[joint_node.parent]
+                                    : Vector6<double>::Zero();
+    const Vector6<double> dV_dq = CrossMotion(Sj, V_[i] - V_P);
+    // The velocity of Bo due to joint j is also the partial of its position.
+    const Vector3<double> dp_dq =
+        Sj.tail<3>() + Sj.head<3>().cross(p_WoBo_W);
+    dV_WBo_W_dq->col(joint_node.q_index)
+        << dV_dq.head<3>(),
+        dV_dq.tail<3>() + dV_dq.head<3>().cross(p_WoBo_W) +
+            w_WB_W.cross(dp_dq);
+    dV_WBo_W_dv->col(joint_node.v_index) << Sj.head<3>(), dp_dq;
+  }
+}
+
+}  // namespace multibody
+}  // namespace drake
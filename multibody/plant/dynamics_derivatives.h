@@ -0,0 +1,160 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+
+/** Computes the partial derivatives of the inverse dynamics, the forward
+dynamics, and the spatial velocity of frames of a MultibodyPlant<double> with
+respect to its state (and its actuation input), with recursive analytical
+algorithms over the multibody tree instead of scalar conversion to AutoDiffXd.
+
+The inverse dynamics are the generalized forces
+`tau = ID(q, v, v̇) = M(q)v̇ + C(q, v)v - tau_app(q, v)` that achieve the
+generalized accelerations `v̇`, where `tau_app` are the forces applied by the
+plant's force elements and joint damping (see
+MultibodyPlant::CalcForceElementsContribution()). Their derivatives are
+computed as in [Carpentier 2018]: differentiating the recursive Newton-Euler
+algorithm in the world frame, where a change of a joint's coordinate moves its
+whole subtree rigidly, costs `O(n⋅N)` operations for `n` generalized
+velocities and `N` bodies. The forward dynamics `v̇ = FD(q, v, u)` solve
+`ID(q, v, v̇) = B⋅u + tau_ext`, so that
+@verbatim
+  ∂v̇/∂q = -M⁻¹⋅∂ID/∂q,  ∂v̇/∂v = -M⁻¹⋅∂ID/∂v,  ∂v̇/∂u = M⁻¹⋅B,
+@endverbatim
+where `B` is the actuation matrix (see MultibodyPlant::MakeActuationMatrix())
+and `tau_ext` are the applied generalized forces. The solves with `M` use the
+sparse MassMatrixFactorization.
+
+Supported models are those in which every body is connected to its parent by
+a revolute, prismatic, or weld joint (so that `q̇ = v`), whose only force
+element is gravity, and that have no collision geometries. For these models
+the results equal (to roundoff) the gradients obtained by scalar conversion to
+AutoDiffXd, at a fraction of the cost.
+
+This class is not thread-safe: its scratch storage is shared by all of its
+methods, so a single %DynamicsDerivatives must not be used by more than one
+thread at a time.
+
+- [Carpentier 2018] Carpentier, J. and Mansard, N., 2018. Analytical
+  derivatives of rigid body dynamics algorithms. Robotics: Science and
+  Systems. */
+class DynamicsDerivatives {
+ public:
+  DRAKE_NO_COPY_NO_MOVE_NO_ASSIGN(DynamicsDerivatives)
+
+  /** Creates an evaluator of the derivatives of `plant`.
+   @param plant The plant to differentiate. It is aliased, and must outlive
+     this object.
+   @throws std::exception if `plant` is nullptr or not finalized, if one of
+     its bodies is not connected to its parent by a revolute, prismatic, or
+     weld joint, if it has force elements other than gravity, or if it has
+     collision geometries. */
+  explicit DynamicsDerivatives(const MultibodyPlant<double>* plant);
+
+  ~DynamicsDerivatives();
+
+  /** Returns the plant being differentiated. */
+  const MultibodyPlant<double>& plant() const { return *plant_; }
+
+  /** Computes the partial derivatives of the inverse dynamics
+   `tau = ID(q, v, v̇)` (see the class documentation) with respect to `q` and
+   `v`, at the state stored in `context` and the generalized accelerations
+   `known_vdot`. The derivative with respect to `v̇` is the mass matrix (see
+   MultibodyPlant::CalcMassMatrix()).
+   @param[out] dtau_dq On output, the `nv x nq` matrix `∂tau/∂q`.
+   @param[out] dtau_dv On output, the `nv x nv` matrix `∂tau/∂v`.
+   @throws std::exception if `known_vdot` is not of size `nv` or if an output
+     is nullptr. */
+  void CalcInverseDynamicsDerivatives(
+      const systems::Context<double>& context,
+      const Eigen::Ref<const VectorX<double>>& known_vdot,
+      MatrixX<double>* dtau_dq, MatrixX<double>* dtau_dv) const;
+
+  /** Computes the partial derivatives of the forward dynamics
+   `v̇ = FD(q, v, u)` (see the class documentation) with respect to `q`, `v`,
+   and the actuation input `u`, at the state and inputs stored in `context`.
+   The applied generalized forces input, if connected, is held fixed.
+   @param[out] dvdot_dq On output, the `nv x nq` matrix `∂v̇/∂q`.
+   @param[out] dvdot_dv On output, the `nv x nv` matrix `∂v̇/∂v`.
+   @param[out] dvdot_du On output, the `nv x nu` matrix `∂v̇/∂u`, with `nu`
+     the number of actuated dofs.
+   @throws std::exception if the plant is discrete, if its applied spatial
+     force input is connected, or if an output is nullptr. */
+  void CalcForwardDynamicsDerivatives(const systems::Context<double>& context,
+                                      MatrixX<double>* dvdot_dq,
+                                      MatrixX<double>* dvdot_dv,
+                                      MatrixX<double>* dvdot_du) const;
+
+  /** Computes the partial derivatives of the spatial velocity `V_WBo_W` of
+   frame B (measured at its origin Bo, expressed in the world frame W) with
+   respect to `q` and `v`. The derivative with respect to `v` is the
+   Jacobian `Jv_V_WBo_W` (see MultibodyPlant::CalcJacobianSpatialVelocity()).
+   @param[out] dV_WBo_W_dq On output, the `6 x nq` matrix `∂V_WBo_W/∂q`.
+   @param[out] dV_WBo_W_dv On output, the `6 x nv` matrix `∂V_WBo_W/∂v`.
+   @throws std::exception if an output is nullptr. */
+  void CalcSpatialVelocityDerivatives(const systems::Context<double>& context,
+                                      const Frame<double>& frame_B,
+                                      MatrixX<double>* dV_WBo_W_dq,
+                                      MatrixX<double>* dV_WBo_W_dv) const;
+
+ private:
+  enum class JointType { kRevolute, kPrismatic, kWeld };
+
+  // A body node of the plant's tree, other than the world's. Nodes are stored
+  // in BodyNodeIndex order (minus one), so that the parent of a node precedes
+  // it.
+  struct Node {
+    // The index of the parent node in nodes_, or -1 for the world.
+    int parent{};
+    JointType type{};
+    // The unit axis of a revolute or prismatic joint, in its frame F.
+    Vector3<double> axis_F{Vector3<double>::Zero()};
+    const Frame<double>* frame_F{};
+    const Frame<double>* frame_M{};
+    const Body<double>* body{};
+    // The index of the joint's coordinate in q and in v (or -1 for a weld).
+    int q_index{-1};
+    int v_index{-1};
+  };
+
+  // Computes, for each node, the joint's motion subspace S and the spatial
+  // velocity V of the body, about the world origin and expressed in W. When
+  // `vdot` is given, also computes the spatial inertia I, the momentum
+  // h = I⋅V, the spatial acceleration A (offset by gravity), and the force
+  // F = I⋅A + V ×* h accumulated over the node's subtree.
+  void CalcKinematics(const systems::Context<double>& context,
+                      const VectorX<double>* vdot) const;
+
+  const MultibodyPlant<double>* const plant_;
+  std::vector<Node> nodes_;
+  // The joint damping coefficient of each generalized velocity.
+  VectorX<double> damping_;
+  // The actuation matrix B.
+  MatrixX<double> B_;
+
+  // Scratch storage, with one entry per node.
+  mutable std::vector<Vector6<double>> S_;
+  mutable std::vector<Vector6<double>> V_;
+  mutable std::vector<Vector6<double>> A_;
+  mutable std::vector<Vector6<double>> h_;
+  mutable std::vector<Vector6<double>> F_;
+  mutable std::vector<Matrix6<double>> I_;
+  mutable std::vector<Vector6<double>> dF_dq_;
+  mutable std::vector<Vector6<double>> dF_dv_;
+  mutable std::vector<bool> in_subtree_;
+  // The acceleration of the world, offset by gravity like A_.
+  mutable Vector6<double> A_world_;
+  mutable VectorX<double> vdot_;
+  mutable MassMatrixFactorization<double> factorization_;
+};
+
+}  // namespace multibody
+}  // namespace drake
@@ -30,6 +30,7 @@
 #include "drake/multibody/plant/tamsi_solver.h"
 #include "drake/multibody/topology/multibody_graph.h"
 #include "drake/multibody/tree/force_element.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/rigid_body.h"
@@ -2886,6 +2887,28 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     DRAKE_DEMAND(v != nullptr);
     internal_tree().MapQDotToVelocity(context, qdot, v);
   }
+
+  /// Sets the maximum number of threads (including the calling thread) used
+  /// to process the bodies at each depth of the kinematic tree in the
+  /// recursions that compute position and velocity kinematics, spatial
+  /// accelerations, composite body inertias, and forward dynamics. Bodies at
+  /// the same depth are independent of each other, so the results are
+  /// identical for any number of threads. Only wide trees benefit: depths with
+  /// fewer than 32 bodies are always processed serially, so most robots are
+  /// unaffected, while a scene with hundreds of free bodies (e.g., bin picking
+  /// or granular media) sees its wide depths split across threads. The
+  /// threads are created here, not on every evaluation, and the setting is
+  /// preserved by scalar conversion. The default is one thread.
+  /// @throws std::exception if `num_threads < 1`.
+  void set_tree_recursion_num_threads(int num_threads) {
+    this->mutable_tree().set_tree_recursion_num_threads(num_threads);
+  }
+
+  /// Returns the maximum number of threads used by the tree recursions. See
+  /// set_tree_recursion_num_threads().
+  int tree_recursion_num_threads() const {
+    return internal_tree().tree_recursion_num_threads();
+  }
   /// @} <!-- Kinematic and dynamic computations -->
 
   /// @anchor mbp_system_matrix_computations
@@ -2962,6 +2985,31 @@ class MultibodyPlant : public internal::MultibodyTreeSystem<T> {
     internal_tree().CalcMassMatrix(context, M);
   }
 
+  /// Computes the sparse factorization `M(q) = Lᵀ⋅D⋅L` of the mass matrix of
+  /// the model, as a function of the generalized positions q stored in
+  /// `context`. The mass matrix is computed with CalcMassMatrix() and then
+  /// factored exploiting its branch-induced sparsity (see
+  /// MassMatrixFactorization), so that, e.g., the generalized accelerations
+  /// `v̇ = M⁻¹⋅tau` can be computed with MassMatrixFactorization::Solve() much
+  /// faster than with a dense factorization of `M(q)`. No memory is allocated.
+  ///
+  /// @param[in] context
+  ///   The context containing the state of the model.
+  /// @param[out] factorization
+  ///   A factorization object created for `this` model, i.e., with
+  ///   MassMatrixFactorization<T>(plant).
+  /// @throws std::exception if `factorization` is nullptr or was not created
+  ///   for this model.
+  /// @throws std::exception if the mass matrix is not positive definite (e.g.,
+  ///   for a model with massless bodies at the end of a kinematic chain); only
+  ///   checked for numeric scalar types.
+  void CalcMassMatrixFactorization(
+      const systems::Context<T>& context,
+      MassMatrixFactorization<T>* factorization) const {
+    this->ValidateContext(context);
+    internal_tree().CalcMassMatrixFactorization(context, factorization);
+  }
+
   /// Computes the bias term `C(q, v)v` containing Coriolis, centripetal, and
   /// gyroscopic effects in the multibody equations of motion: <pre>
   ///   M(q) v̇ + C(q, v) v = tau_app + ∑ (Jv_V_WBᵀ(q) ⋅ Fapp_Bo_W)
@@ -0,0 +1,220 @@
+#include "drake/multibody/plant/batch_evaluator.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/find_resource.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/parsing/parser.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/systems/framework/diagram_builder.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+class BatchEvaluatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // An acrobot, plus a free body so that q and v differ in size.
+    Parser(&plant_).AddModelFromFile(
+        FindResourceOrThrow("drake/multibody/benchmarks/acrobot/acrobot.sdf"));
+    free_body_ = &plant_.AddRigidBody(
+        "free_body",
+        SpatialInertia<double>::MakeFromCentralInertia(
+            2.0, Vector3d(0.1, 0, 0),
+            UnitInertia<double>::SolidBox(0.1, 0.2, 0.3) * 2.0));
+    plant_.Finalize();
+    context_ = plant_.CreateDefaultContext();
+
+    // A batch of valid (i.e., with unit quaternions) states.
+    const int nq = plant_.num_positions();
+    const int nv = plant_.num_velocities();
+    q_.resize(nq, kNumInstances);
+    v_.resize(nv, kNumInstances);
+    vdot_.resize(nv, kNumInstances);
+    auto scratch = plant_.CreateDefaultContext();
+    for (int k = 0; k < kNumInstances; ++k) {
+      plant_.SetFreeBodyPose(
+          scratch.get(), *free_body_,
+          RigidTransformd(RollPitchYawd(0.1 * k, -0.2 * k, 0.3),
+                          Vector3d(k, 0.5, -0.25 * k)));
+      plant_.GetMutableJointByName<RevoluteJoint>("ShoulderJoint")
+          .set_angle(scratch.get(), 0.4 * k - 1.0);
+      plant_.GetMutableJointByName<RevoluteJoint>("ElbowJoint")
+          .set_angle(scratch.get(), 0.5 - 0.3 * k);
+      q_.col(k) = plant_.GetPositions(*scratch);
+      v_.col(k) = VectorXd::LinSpaced(nv, -1.0, 0.5 * k);
+      vdot_.col(k) = VectorXd::LinSpaced(nv, 0.25 * k, 2.0);
+    }
+  }
+
+  // Returns the plant's context for instance k.
+  std::unique_ptr<Context<double>> MakeContext(int k) const {
+    auto context = context_->Clone();
+    plant_.SetPositions(context.get(), q_.col(k));
+    plant_.SetVelocities(context.get(), v_.col(k));
+    return context;
+  }
+
+  static constexpr int kNumInstances = 5;
+  MultibodyPlant<double> plant_{0.0};
+  const RigidBody<double>* free_body_{};
+  std::unique_ptr<Context<double>> context_;
+  MatrixXd q_;
+  MatrixXd v_;
+  MatrixXd vdot_;
+};
+
+// Each quantity matches the corresponding MultibodyPlant computation, for any
+// number of threads.
+TEST_F(BatchEvaluatorTest, MatchesPlant) {
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  const int num_bodies = plant_.num_bodies();
+  const Frame<double>& frame_B = plant_.GetFrameByName("Link2");
+  const Frame<double>& frame_A = free_body_->body_frame();
+  const Frame<double>& frame_W = plant_.world_frame();
+  const Vector3d p_BoBp_B(0.1, -0.2, 0.3);
+
+  for (int num_threads : {1, 3}) {
+    SCOPED_TRACE(num_threads);
+    const BatchEvaluator<double> dut(&plant_, *context_, num_threads);
+    EXPECT_EQ(&dut.plant(), &plant_);
+    EXPECT_EQ(dut.num_threads(), num_threads);
+
+    std::vector<RigidTransformd> X_WB;
+    dut.CalcBodyPosesInWorld(q_, &X_WB);
+    ASSERT_EQ(static_cast<int>(X_WB.size()), kNumInstances * num_bodies);
+
+    MatrixXd Jq, Jv;
+    dut.CalcJacobianSpatialVelocity(q_, JacobianWrtVariable::kQDot, frame_B,
+                                    p_BoBp_B, frame_A, frame_W, &Jq);
+    dut.CalcJacobianSpatialVelocity(q_, JacobianWrtVariable::kV, frame_B,
+                                    p_BoBp_B, frame_A, frame_W, &Jv);
+    ASSERT_EQ(Jq.rows(), 6);
+    ASSERT_EQ(Jq.cols(), kNumInstances * nq);
+    ASSERT_EQ(Jv.cols(), kNumInstances * nv);
+
+    MatrixXd M;
+    dut.CalcMassMatrices(q_, &M);
+    ASSERT_EQ(M.rows(), nv);
+    ASSERT_EQ(M.cols(), kNumInstances * nv);
+
+    MatrixXd tau;
+    dut.CalcInverseDynamics(q_, v_, vdot_, &tau);
+    ASSERT_EQ(tau.rows(), nv);
+    ASSERT_EQ(tau.cols(), kNumInstances);
+
+    for (int k = 0; k < kNumInstances; ++k) {
+      auto context = MakeContext(k);
+      for (BodyIndex b(0); b < num_bodies; ++b) {
+        const RigidTransformd& expected_X_WB =
+            plant_.EvalBodyPoseInWorld(*context, plant_.get_body(b));
+        EXPECT_TRUE(X_WB[k * num_bodies + b].IsExactlyEqualTo(expected_X_WB));
+      }
+
+      MatrixXd expected_Jq(6, nq), expected_Jv(6, nv);
+      plant_.CalcJacobianSpatialVelocity(*context, JacobianWrtVariable::kQDot,
+                                         frame_B, p_BoBp_B, frame_A, frame_W,
+                                         &expected_Jq);
+      plant_.CalcJacobianSpatialVelocity(*context, JacobianWrtVariable::kV,
+                                         frame_B, p_BoBp_B, frame_A, frame_W,
+                                         &expected_Jv);
+      EXPECT_TRUE(CompareMatrices(Jq.middleCols(k * nq, nq), expected_Jq));
+      EXPECT_TRUE(CompareMatrices(Jv.middleCols(k * nv, nv), expected_Jv));
+
+      MatrixXd expected_M(nv, nv);
+      plant_.CalcMassMatrix(*context, &expected_M);
+      EXPECT_TRUE(CompareMatrices(M.middleCols(k * nv, nv), expected_M));
+
+      MultibodyForces<double> forces(plant_);
+      plant_.CalcForceElementsContribution(*context, &forces);
+      const VectorXd expected_tau =
+          plant_.CalcInverseDynamics(*context, vdot_.col(k), forces);
+      EXPECT_TRUE(CompareMatrices(tau.col(k), expected_tau));
+    }
+  }
+}
+
+// Inverse dynamics includes gravity: holding the acrobot still at a
+// horizontal configuration requires nonzero shoulder torque.
+TEST_F(BatchEvaluatorTest, InverseDynamicsIncludesGravity) {
+  const BatchEvaluator<double> dut(&plant_, *context_);
+  const MatrixXd zero_v = MatrixXd::Zero(plant_.num_velocities(), 1);
+  auto context = plant_.CreateDefaultContext();
+  plant_.GetMutableJointByName<RevoluteJoint>("ShoulderJoint")
+      .set_angle(context.get(), M_PI / 2);
+  MatrixXd tau;
+  dut.CalcInverseDynamics(plant_.GetPositions(*context), zero_v, zero_v, &tau);
+  const int shoulder = plant_.GetJointByName("ShoulderJoint").velocity_start();
+  EXPECT_GT(std::abs(tau(shoulder, 0)), 1.0);
+}
+
+// The plant may be part of a Diagram, in which case the evaluator is given the
+// Diagram's (root) context; the plant's subcontext is rejected.
+GTEST_TEST(BatchEvaluatorDiagramTest, RootContext) {
+  systems::DiagramBuilder<double> builder;
+  auto [plant, scene_graph] = AddMultibodyPlantSceneGraph(&builder, 0.0);
+  Parser(&plant).AddModelFromFile(
+      FindResourceOrThrow("drake/multibody/benchmarks/acrobot/acrobot.sdf"));
+  plant.Finalize();
+  auto diagram = builder.Build();
+  auto diagram_context = diagram->CreateDefaultContext();
+  const Context<double>& plant_context =
+      plant.GetMyContextFromRoot(*diagram_context);
+
+  const BatchEvaluator<double> dut(&plant, *diagram_context, 2);
+  const MatrixXd q = MatrixXd::Random(plant.num_positions(), 3);
+  MatrixXd M;
+  dut.CalcMassMatrices(q, &M);
+  for (int k = 0; k < 3; ++k) {
+    MatrixXd expected_M(plant.num_velocities(), plant.num_velocities());
+    plant.SetPositions(
+        &plant.GetMyMutableContextFromRoot(diagram_context.get()), q.col(k));
+    plant.CalcMassMatrix(plant_context, &expected_M);
+    EXPECT_TRUE(CompareMatrices(
+        M.middleCols(k * plant.num_velocities(), plant.num_velocities()),
+        expected_M, 1e-14));
+  }
+
+  DRAKE_EXPECT_THROWS_MESSAGE(BatchEvaluator<double>(&plant, plant_context),
+                              ".*not a root context.*");
+}
+
+TEST_F(BatchEvaluatorTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      BatchEvaluator<double>(nullptr, *context_), ".*plant != nullptr.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      BatchEvaluator<double>(&plant_, *context_, 0), ".*num_threads >= 1.*");
+  MultibodyPlant<double> other_plant(0.0);
+  other_plant.Finalize();
+  EXPECT_THROW(BatchEvaluator<double>(&plant_,
+                                      *other_plant.CreateDefaultContext()),
+               std::exception);
+
+  const BatchEvaluator<double> dut(&plant_, *context_);
+  MatrixXd M;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.CalcMassMatrices(MatrixXd::Zero(1, 2), &M), ".*num_positions.*");
+  MatrixXd tau;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      dut.CalcInverseDynamics(q_, v_, vdot_.leftCols(2), &tau),
+      ".*cols.*num_instances.*");
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -0,0 +1,250 @@
+#include "drake/multibody/plant/dynamics_derivatives.h"
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/autodiff_gradient.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/benchmarks/acrobot/make_acrobot_plant.h"
+#include "drake/multibody/tree/fixed_offset_frame.h"
+#include "drake/multibody/tree/linear_spring_damper.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/weld_joint.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+constexpr double kTolerance = 1e-11;
+
+// The gradients computed with AutoDiffXd are the reference for the analytical
+// derivatives.
+class DynamicsDerivativesTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // Two trees. The first has a prismatic base with two revolute arms, one of
+    // which ends in a hand welded to it and a revolute finger; the second is a
+    // single pendulum. The axes are not aligned with the frames.
+    const SpatialInertia<double> M_BBo_B(
+        1.5, Vector3d(0.1, -0.2, 0.05),
+        UnitInertia<double>::SolidBox(0.2, 0.3, 0.4));
+    const RigidBody<double>& base = plant_.AddRigidBody("base", M_BBo_B);
+    const RigidBody<double>& left = plant_.AddRigidBody("left", M_BBo_B);
+    const RigidBody<double>& right = plant_.AddRigidBody("right", M_BBo_B);
+    const RigidBody<double>& hand = plant_.AddRigidBody("hand", M_BBo_B);
+    const RigidBody<double>& finger = plant_.AddRigidBody("finger", M_BBo_B);
+    const RigidBody<double>& pendulum =
+        plant_.AddRigidBody("pendulum", M_BBo_B);
+    const RigidTransformd X_PF(RollPitchYawd(0.3, -0.4, 0.5),
+                               Vector3d(0.1, 0.2, 0.3));
+    const auto& base_joint = plant_.AddJoint<PrismaticJoint>(
+        "base", plant_.world_body(), X_PF, base, std::nullopt,
+        Vector3d(1, 0, 0.2).normalized(), -10, 10, 0.5 /* damping */);
+    const auto& left_joint = plant_.AddJoint<RevoluteJoint>(
+        "left", base, X_PF, left, X_PF.inverse(),
+        Vector3d(1, 2, 3).normalized(), 0.1 /* damping */);
+    plant_.AddJoint<RevoluteJoint>("right", base, std::nullopt, right,
+                                   X_PF, Vector3d::UnitZ());
+    plant_.AddJoint<WeldJoint>("hand", right, X_PF, hand, std::nullopt,
+                               RigidTransformd(Vector3d(0, 0, -0.5)));
+    const auto& finger_joint = plant_.AddJoint<RevoluteJoint>(
+        "finger", hand, X_PF, finger, std::nullopt,
+        Vector3d(0, 1, 1).normalized(), 0.2 /* damping */);
+    plant_.AddJoint<RevoluteJoint>("pendulum", plant_.world_body(),
+                                   std::nullopt, pendulum, X_PF,
+                                   Vector3d::UnitY());
+    plant_.AddJointActuator("base", base_joint);
+    plant_.AddJointActuator("left", left_joint);
+    plant_.AddJointActuator("finger", finger_joint);
+    frame_ = &plant_.AddFrame(std::make_unique<FixedOffsetFrame<double>>(
+        "fingertip", finger, RigidTransformd(Vector3d(0.3, -0.2, 0.5))));
+    plant_.Finalize();
+
+    const int nq = plant_.num_positions();
+    const int nv = plant_.num_velocities();
+    context_ = plant_.CreateDefaultContext();
+    plant_.SetPositions(context_.get(), VectorXd::LinSpaced(nq, -1.2, 0.9));
+    plant_.SetVelocities(context_.get(), VectorXd::LinSpaced(nv, 1.5, -2.0));
+    u_ = VectorXd::LinSpaced(plant_.num_actuated_dofs(), -3.0, 4.0);
+    plant_.get_actuation_input_port().FixValue(context_.get(), u_);
+
+    plant_ad_ = systems::System<double>::ToAutoDiffXd(plant_);
+    context_ad_ = plant_ad_->CreateDefaultContext();
+    // The derivatives are taken with respect to [q; v; u].
+    VectorXd x(nq + nv + u_.size());
+    x << plant_.GetPositionsAndVelocities(*context_), u_;
+    const VectorX<AutoDiffXd> x_ad = math::initializeAutoDiff(x);
+    plant_ad_->SetPositionsAndVelocities(context_ad_.get(),
+                                         x_ad.head(nq + nv));
+    plant_ad_->get_actuation_input_port().FixValue(
+        context_ad_.get(), VectorX<AutoDiffXd>(x_ad.tail(u_.size())));
+  }
+
+  MultibodyPlant<double> plant_{0.0};
+  const Frame<double>* frame_{};
+  std::unique_ptr<Context<double>> context_;
+  VectorXd u_;
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_ad_;
+  std::unique_ptr<Context<AutoDiffXd>> context_ad_;
+};
+
+TEST_F(DynamicsDerivativesTest, InverseDynamics) {
+  const DynamicsDerivatives derivatives(&plant_);
+  EXPECT_EQ(&derivatives.plant(), &plant_);
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  const VectorXd vdot = VectorXd::LinSpaced(nv, 2.0, -0.5);
+  MatrixXd dtau_dq;
+  MatrixXd dtau_dv;
+  derivatives.CalcInverseDynamicsDerivatives(*context_, vdot, &dtau_dq,
+                                             &dtau_dv);
+
+  MultibodyForces<AutoDiffXd> forces(*plant_ad_);
+  plant_ad_->CalcForceElementsContribution(*context_ad_, &forces);
+  const VectorX<AutoDiffXd> tau = plant_ad_->CalcInverseDynamics(
+      *context_ad_, vdot.cast<AutoDiffXd>(), forces);
+  const MatrixXd dtau = math::autoDiffToGradientMatrix(tau);
+  EXPECT_TRUE(CompareMatrices(dtau_dq, dtau.leftCols(nq), kTolerance));
+  EXPECT_TRUE(CompareMatrices(dtau_dv, dtau.middleCols(nq, nv), kTolerance));
+}
+
+TEST_F(DynamicsDerivativesTest, ForwardDynamics) {
+  const DynamicsDerivatives derivatives(&plant_);
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  MatrixXd dvdot_dq;
+  MatrixXd dvdot_dv;
+  MatrixXd dvdot_du;
+  derivatives.CalcForwardDynamicsDerivatives(*context_, &dvdot_dq, &dvdot_dv,
+                                             &dvdot_du);
+
+  const VectorX<AutoDiffXd> vdot = plant_ad_->EvalTimeDerivatives(*context_ad_)
+                                       .get_generalized_velocity()
+                                       .CopyToVector();
+  const MatrixXd dvdot = math::autoDiffToGradientMatrix(vdot);
+  EXPECT_TRUE(CompareMatrices(dvdot_dq, dvdot.leftCols(nq), kTolerance));
+  EXPECT_TRUE(CompareMatrices(dvdot_dv, dvdot.middleCols(nq, nv), kTolerance));
+  EXPECT_TRUE(CompareMatrices(dvdot_du, dvdot.rightCols(u_.size()),
+                              kTolerance));
+}
+
+TEST_F(DynamicsDerivativesTest, SpatialVelocity) {
+  const DynamicsDerivatives derivatives(&plant_);
+  const int nq = plant_.num_positions();
+  const int nv = plant_.num_velocities();
+  MatrixXd dV_dq;
+  MatrixXd dV_dv;
+  derivatives.CalcSpatialVelocityDerivatives(*context_, *frame_, &dV_dq,
+                                             &dV_dv);
+
+  const Frame<AutoDiffXd>& frame_ad =
+      plant_ad_->get_frame(frame_->index());
+  const MatrixXd dV = math::autoDiffToGradientMatrix(
+      frame_ad.CalcSpatialVelocityInWorld(*context_ad_).get_coeffs());
+  EXPECT_TRUE(CompareMatrices(dV_dq, dV.leftCols(nq), kTolerance));
+  EXPECT_TRUE(CompareMatrices(dV_dv, dV.middleCols(nq, nv), kTolerance));
+
+  // The spatial velocity of a frame fixed to the world is zero.
+  derivatives.CalcSpatialVelocityDerivatives(*context_, plant_.world_frame(),
+                                             &dV_dq, &dV_dv);
+  EXPECT_TRUE(CompareMatrices(dV_dq, MatrixXd::Zero(6, nq)));
+  EXPECT_TRUE(CompareMatrices(dV_dv, MatrixXd::Zero(6, nv)));
+}
+
+// The acrobot of examples/acrobot/benchmark_autodiff.cc, whose forward dynamics
+// are differentiated there with AutoDiffXd.
+GTEST_TEST(DynamicsDerivativesAcrobotTest, ForwardDynamics) {
+  const std::unique_ptr<MultibodyPlant<double>> plant =
+      benchmarks::acrobot::MakeAcrobotPlant(
+          benchmarks::acrobot::AcrobotParameters(), true);
+  auto context = plant->CreateDefaultContext();
+  const Eigen::Vector4d x(0.3, -1.1, 2.0, -0.5);
+  const Vector1d u(0.7);
+  plant->SetPositionsAndVelocities(context.get(), x);
+  plant->get_actuation_input_port().FixValue(context.get(), u);
+  const DynamicsDerivatives derivatives(plant.get());
+  MatrixXd dvdot_dq, dvdot_dv, dvdot_du;
+  derivatives.CalcForwardDynamicsDerivatives(*context, &dvdot_dq, &dvdot_dv,
+                                             &dvdot_du);
+
+  const std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_ad =
+      systems::System<double>::ToAutoDiffXd(*plant);
+  auto context_ad = plant_ad->CreateDefaultContext();
+  VectorXd xu(5);
+  xu << x, u;
+  const VectorX<AutoDiffXd> xu_ad = math::initializeAutoDiff(xu);
+  plant_ad->SetPositionsAndVelocities(context_ad.get(), xu_ad.head(4));
+  plant_ad->get_actuation_input_port().FixValue(
+      context_ad.get(), VectorX<AutoDiffXd>(xu_ad.tail(1)));
+  const MatrixXd dvdot = math::autoDiffToGradientMatrix(
+      plant_ad->EvalTimeDerivatives(*context_ad)
+          .get_generalized_velocity()
+          .CopyToVector());
+  EXPECT_TRUE(CompareMatrices(dvdot_dq, dvdot.leftCols(2), kTolerance));
+  EXPECT_TRUE(CompareMatrices(dvdot_dv, dvdot.middleCols(2, 2), kTolerance));
+  EXPECT_TRUE(CompareMatrices(dvdot_du, dvdot.rightCols(1), kTolerance));
+}
+
+GTEST_TEST(DynamicsDerivativesErrorsTest, UnsupportedModels) {
+  const SpatialInertia<double> M_BBo_B(
+      1.0, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.1));
+  DRAKE_EXPECT_THROWS_MESSAGE(DynamicsDerivatives{nullptr},
+                              ".*plant != nullptr.*");
+  {
+    MultibodyPlant<double> plant(0.0);
+    plant.AddRigidBody("free", M_BBo_B);
+    DRAKE_EXPECT_THROWS_MESSAGE(DynamicsDerivatives{&plant},
+                                ".*is_finalized.*");
+    plant.Finalize();
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        DynamicsDerivatives{&plant},
+        ".*only revolute, prismatic, and weld joints are supported, but body "
+        "'free' is connected to its parent by a .*QuaternionFloatingMobilizer"
+        ".*");
+  }
+  {
+    MultibodyPlant<double> plant(0.0);
+    const RigidBody<double>& body = plant.AddRigidBody("body", M_BBo_B);
+    plant.AddJoint<PrismaticJoint>("slider", plant.world_body(), std::nullopt,
+                                   body, std::nullopt, Vector3d::UnitZ());
+    plant.AddForceElement<LinearSpringDamper>(
+        plant.world_body(), Vector3d::Zero(), body, Vector3d::Zero(), 1.0,
+        10.0, 1.0);
+    plant.Finalize();
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        DynamicsDerivatives{&plant},
+        ".*the only supported force element is gravity, but the plant has 2 "
+        "force elements.*");
+  }
+  {
+    MultibodyPlant<double> plant(0.01);
+    const RigidBody<double>& body = plant.AddRigidBody("body", M_BBo_B);
+    plant.AddJoint<RevoluteJoint>("pin", plant.world_body(), std::nullopt,
+                                  body, std::nullopt, Vector3d::UnitY());
+    plant.Finalize();
+    const DynamicsDerivatives derivatives(&plant);
+    auto context = plant.CreateDefaultContext();
+    MatrixXd dvdot_dq, dvdot_dv, dvdot_du;
+    DRAKE_EXPECT_THROWS_MESSAGE(
+        derivatives.CalcForwardDynamicsDerivatives(*context, &dvdot_dq,
+                                                   &dvdot_dv, &dvdot_du),
+        ".*is_discrete.*");
+  }
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
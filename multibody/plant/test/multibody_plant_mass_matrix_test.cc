@@ -79,6 +79,21 @@ class MultibodyPlantMassMatrixTests : public ::testing::Test {
                               Mcba.norm() / plant_.num_velocities();
     EXPECT_TRUE(
         CompareMatrices(Mcba, Mid, kTolerance, MatrixCompareType::relative));
+
+    // The sparse factorization reproduces the mass matrix, and solves with it.
+    MassMatrixFactorization<double> factorization(plant_);
+    plant_.CalcMassMatrixFactorization(context, &factorization);
+    const MatrixX<double> L = factorization.matrixL();
+    const MatrixX<double> LtDL =
+        L.transpose() * factorization.vectorD().asDiagonal() * L;
+    EXPECT_TRUE(CompareMatrices(LtDL, Mcba, kTolerance,
+                                MatrixCompareType::relative));
+    const VectorX<double> tau = VectorX<double>::LinSpaced(
+        plant_.num_velocities(), -1.0, 1.0);
+    const VectorX<double> vdot = factorization.Solve(tau);
+    // A backward stable solve has a residual of order ε⋅‖M‖⋅‖v̇‖.
+    EXPECT_TRUE(CompareMatrices(
+        Mcba * vdot, tau, kTolerance * plant_.num_velocities() * vdot.norm()));
   }
 
  protected:
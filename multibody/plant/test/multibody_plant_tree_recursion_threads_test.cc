@@ -0,0 +1,154 @@
+#include <memory>
+#include <vector>
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/math/autodiff.h"
+#include "drake/math/roll_pitch_yaw.h"
+#include "drake/multibody/plant/multibody_plant.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/systems/framework/context.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+
+// The number of free bodies and of double pendulums in the model. Both are
+// larger than the minimum width of a level processed in parallel, so that the
+// first two levels of the tree are split across threads.
+constexpr int kNumFreeBodies = 70;
+constexpr int kNumPendulums = 40;
+
+// Everything computed by the recursions that may be processed in parallel.
+struct Results {
+  std::vector<RigidTransformd> X_WB;
+  std::vector<SpatialVelocity<double>> V_WB;
+  std::vector<SpatialAcceleration<double>> A_WB;
+  MatrixXd M;
+  VectorXd xdot;
+};
+
+class TreeRecursionThreadsTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const SpatialInertia<double> M_BBo_B(
+        1.5, Vector3d(0.1, -0.05, 0.2),
+        UnitInertia<double>::SolidBox(0.1, 0.2, 0.3));
+    std::vector<const RigidBody<double>*> free_bodies;
+    for (int i = 0; i < kNumFreeBodies; ++i) {
+      free_bodies.push_back(
+          &plant_.AddRigidBody(fmt::format("free_body_{}", i), M_BBo_B));
+    }
+    std::vector<const RevoluteJoint<double>*> pins;
+    for (int i = 0; i < kNumPendulums; ++i) {
+      const RigidBody<double>& upper =
+          plant_.AddRigidBody(fmt::format("upper_{}", i), M_BBo_B);
+      const RigidBody<double>& lower =
+          plant_.AddRigidBody(fmt::format("lower_{}", i), M_BBo_B);
+      pins.push_back(&plant_.AddJoint<RevoluteJoint>(
+          fmt::format("shoulder_{}", i), plant_.world_body(),
+          RigidTransformd(Vector3d(i, 0, 0)), upper, RigidTransformd(),
+          Vector3d::UnitY()));
+      pins.push_back(&plant_.AddJoint<RevoluteJoint>(
+          fmt::format("elbow_{}", i), upper,
+          RigidTransformd(Vector3d(0, 0, -1)), lower, RigidTransformd(),
+          Vector3d::UnitX()));
+    }
+    plant_.Finalize();
+
+    context_ = plant_.CreateDefaultContext();
+    for (int i = 0; i < kNumFreeBodies; ++i) {
+      plant_.SetFreeBodyPose(
+          context_.get(), *free_bodies[i],
+          RigidTransformd(RollPitchYawd(0.1 * i, -0.2 * i, 0.3),
+                          Vector3d(i, 0.5, -0.25 * i)));
+    }
+    for (int i = 0; i < static_cast<int>(pins.size()); ++i) {
+      pins[i]->set_angle(context_.get(), 0.3 * i - 1.0);
+    }
+    plant_.SetVelocities(
+        context_.get(),
+        VectorXd::LinSpaced(plant_.num_velocities(), -2.0, 3.0));
+  }
+
+  // Evaluates the results on a fresh copy of the context, so that nothing is
+  // reused from the cache of a previous evaluation.
+  Results CalcResults() const {
+    std::unique_ptr<Context<double>> context = context_->Clone();
+    Results results;
+    const int num_bodies = plant_.num_bodies();
+    for (BodyIndex b(0); b < num_bodies; ++b) {
+      const Body<double>& body = plant_.get_body(b);
+      results.X_WB.push_back(plant_.EvalBodyPoseInWorld(*context, body));
+      results.V_WB.push_back(
+          plant_.EvalBodySpatialVelocityInWorld(*context, body));
+      results.A_WB.push_back(
+          plant_.EvalBodySpatialAccelerationInWorld(*context, body));
+    }
+    results.M.resize(plant_.num_velocities(), plant_.num_velocities());
+    plant_.CalcMassMatrix(*context, &results.M);
+    results.xdot = plant_.EvalTimeDerivatives(*context).CopyToVector();
+    return results;
+  }
+
+  MultibodyPlant<double> plant_{0.0};
+  std::unique_ptr<Context<double>> context_;
+};
+
+TEST_F(TreeRecursionThreadsTest, SameResultsForAnyNumberOfThreads) {
+  EXPECT_EQ(plant_.tree_recursion_num_threads(), 1);
+  const Results serial = CalcResults();
+  for (int num_threads : {2, 4, 7}) {
+    plant_.set_tree_recursion_num_threads(num_threads);
+    EXPECT_EQ(plant_.tree_recursion_num_threads(), num_threads);
+    const Results parallel = CalcResults();
+    for (int b = 0; b < plant_.num_bodies(); ++b) {
+      EXPECT_TRUE(CompareMatrices(parallel.X_WB[b].GetAsMatrix34(),
+                                  serial.X_WB[b].GetAsMatrix34()));
+      EXPECT_TRUE(CompareMatrices(parallel.V_WB[b].get_coeffs(),
+                                  serial.V_WB[b].get_coeffs()));
+      EXPECT_TRUE(CompareMatrices(parallel.A_WB[b].get_coeffs(),
+                                  serial.A_WB[b].get_coeffs()));
+    }
+    EXPECT_TRUE(CompareMatrices(parallel.M, serial.M));
+    EXPECT_TRUE(CompareMatrices(parallel.xdot, serial.xdot));
+  }
+  plant_.set_tree_recursion_num_threads(1);
+  EXPECT_EQ(plant_.tree_recursion_num_threads(), 1);
+  EXPECT_TRUE(CompareMatrices(CalcResults().xdot, serial.xdot));
+
+  DRAKE_EXPECT_THROWS_MESSAGE(plant_.set_tree_recursion_num_threads(0),
+                              ".*num_threads >= 1.*");
+}
+
+TEST_F(TreeRecursionThreadsTest, ScalarConversion) {
+  plant_.set_tree_recursion_num_threads(3);
+  std::unique_ptr<MultibodyPlant<AutoDiffXd>> plant_ad =
+      systems::System<double>::ToAutoDiffXd(plant_);
+  EXPECT_EQ(plant_ad->tree_recursion_num_threads(), 3);
+
+  // The converted plant computes the same dynamics.
+  auto context_ad = plant_ad->CreateDefaultContext();
+  context_ad->SetTimeStateAndParametersFrom(*context_);
+  const VectorX<AutoDiffXd> xdot_ad =
+      plant_ad->EvalTimeDerivatives(*context_ad).CopyToVector();
+  EXPECT_TRUE(CompareMatrices(math::DiscardGradient(xdot_ad),
+                              plant_.EvalTimeDerivatives(*context_)
+                                  .CopyToVector(),
+                              1e-12));
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -167,6 +167,49 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
     return *mobilizer_;
   }
 
+  // The mobilizers whose across-mobilizer operators (X_FM, H_FM, and the
+  // projection H_FMᵀ) this node evaluates with fixed-size kernels of its own,
+  // instead of through the virtual Mobilizer interface. Revolute, prismatic,
+  // and weld mobilizers make up the bulk of most robots, and their operators
+  // are fully described by a constant axis or pose, and have Hdot_FM = 0.
+  enum class MobilizerKernel {
+    // Any other mobilizer, evaluated through the Mobilizer interface.
+    kGeneric,
+    // H_FM = [axis_F; 0], X_FM = (AngleAxis(q, axis_F), 0).
+    kRevolute,
+    // H_FM = [0; axis_F], X_FM = (I, q * axis_F).
+    kPrismatic,
+    // Zero velocities, constant X_FM.
+    kWeld,
+  };
+
+  // Returns the kernel used for this node's mobilizer.
+  MobilizerKernel mobilizer_kernel() const { return mobilizer_kernel_; }
+
+  // Used by MultibodyTree at Finalize() to evaluate this node's mobilizer with
+  // the revolute kernel, for a revolute mobilizer with unit axis `axis_F`.
+  void SetRevoluteKernel(const Vector3<double>& axis_F) {
+    DRAKE_DEMAND(get_num_mobilizer_velocities() == 1);
+    mobilizer_kernel_ = MobilizerKernel::kRevolute;
+    kernel_axis_F_ = axis_F.template cast<T>();
+  }
+
+  // Used by MultibodyTree at Finalize() to evaluate this node's mobilizer with
+  // the prismatic kernel, for a prismatic mobilizer with unit axis `axis_F`.
+  void SetPrismaticKernel(const Vector3<double>& axis_F) {
+    DRAKE_DEMAND(get_num_mobilizer_velocities() == 1);
+    mobilizer_kernel_ = MobilizerKernel::kPrismatic;
+    kernel_axis_F_ = axis_F.template cast<T>();
+  }
+
+  // Used by MultibodyTree at Finalize() to evaluate this node's mobilizer with
+  // the weld kernel, for a weld mobilizer with the constant pose `X_FM`.
+  void SetWeldKernel(const math::RigidTransform<double>& X_FM) {
+    DRAKE_DEMAND(get_num_mobilizer_velocities() == 0);
+    mobilizer_kernel_ = MobilizerKernel::kWeld;
+    kernel_X_FM_ = X_FM.template cast<T>();
+  }
+
   // @name Methods to retrieve BodyNode sizes
   //@{
 
@@ -335,7 +378,7 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
 
     // Update V_FM using the operator V_FM = H_FM * vm:
     SpatialVelocity<T>& V_FM = get_mutable_V_FM(vc);
-    V_FM = get_mobilizer().CalcAcrossMobilizerSpatialVelocity(context, vm);
+    V_FM = CalcAcrossMobilizerSpatialVelocity(context, vm);
 
     // Compute V_PB_W = R_WF * V_FM.Shift(p_MoBo_F), Eq. (4).
     // Side note to developers: in operator form for rigid bodies this would be
@@ -511,7 +554,7 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
 
     // Operator A_FM = H_FM * vmdot + Hdot_FM * vm
     SpatialAcceleration<T> A_FM =
-        get_mobilizer().CalcAcrossMobilizerSpatialAcceleration(context, vmdot);
+        CalcAcrossMobilizerSpatialAcceleration(context, vmdot);
 
     // =========================================================================
     // Compose acceleration A_WP of P in W with acceleration A_PB of B in P,
@@ -777,7 +820,7 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
     // components of the spatial force performing work. Therefore we need to
     // project F_BMo along the directions of motion.
     // Project as: tau = H_FMᵀ(q) * F_BMo_F, Eq. (4).
-    get_mobilizer().ProjectSpatialForce(context, F_BMo_F, tau);
+    ProjectSpatialForce(context, F_BMo_F, tau);
 
     // Include the contribution of applied generalized forces.
     if (tau_applied.size() != 0) tau -= tau_applied;
@@ -830,6 +873,17 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
     const Vector3<T>& p_MB_M = X_MB.translation();
     const Vector3<T> p_MB_F = R_FM * p_MB_M;
 
+    // The single column of H_FM of the revolute and prismatic kernels is known.
+    if (mobilizer_kernel_ == MobilizerKernel::kRevolute ||
+        mobilizer_kernel_ == MobilizerKernel::kPrismatic) {
+      const SpatialVelocity<T> H_FM =
+          mobilizer_kernel_ == MobilizerKernel::kRevolute
+              ? SpatialVelocity<T>(kernel_axis_F_, Vector3<T>::Zero())
+              : SpatialVelocity<T>(Vector3<T>::Zero(), kernel_axis_F_);
+      H_PB_W->col(0) = (R_WF * H_FM.Shift(p_MB_F)).get_coeffs();
+      return;
+    }
+
     // Compute the imob-th column in J_PB_W:
     VectorUpTo6<T> v = VectorUpTo6<T>::Zero(get_num_mobilizer_velocities());
     // We compute H_FM(q) one column at a time by calling the multiplication by
@@ -1379,8 +1433,7 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
     const VectorUpTo6<T> vmdot_zero =
         VectorUpTo6<T>::Zero(get_num_mobilizer_velocities());
     const SpatialAcceleration<T> Ab_FM =
-        get_mobilizer().CalcAcrossMobilizerSpatialAcceleration(context,
-                                                               vmdot_zero);
+        CalcAcrossMobilizerSpatialAcceleration(context, vmdot_zero);
 
     // Due to the fact that frames P and F are on the same rigid body, we have
     // that V_PF = 0. Therefore, DtP(V_PB) = DtF(V_PB). Since M and B are also
@@ -1442,6 +1495,14 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
 
   // =========================================================================
   // Helpers to access the state.
+  // Returns an Eigen expression of the vector of generalized positions.
+  Eigen::VectorBlock<const VectorX<T>> get_mobilizer_positions(
+      const systems::Context<T>& context) const {
+    return this->get_parent_tree().get_state_segment(context,
+        topology_.mobilizer_positions_start,
+        topology_.num_mobilizer_positions);
+  }
+
   // Returns an Eigen expression of the vector of generalized velocities.
   Eigen::VectorBlock<const VectorX<T>> get_mobilizer_velocities(
       const systems::Context<T>& context) const {
@@ -1853,9 +1914,84 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
       PositionKinematicsCache<T>* pc) const {
     DRAKE_ASSERT(pc != nullptr);
     math::RigidTransform<T>& X_FM = get_mutable_X_FM(pc);
+    switch (mobilizer_kernel_) {
+      case MobilizerKernel::kRevolute: {
+        const T& theta = get_mobilizer_positions(context)[0];
+        X_FM = math::RigidTransform<T>(
+            Eigen::AngleAxis<T>(theta, kernel_axis_F_), Vector3<T>::Zero());
+        return;
+      }
+      case MobilizerKernel::kPrismatic: {
+        const T& x = get_mobilizer_positions(context)[0];
+        X_FM = math::RigidTransform<T>(x * kernel_axis_F_);
+        return;
+      }
+      case MobilizerKernel::kWeld:
+        X_FM = kernel_X_FM_;
+        return;
+      case MobilizerKernel::kGeneric:
+        break;
+    }
     X_FM = get_mobilizer().CalcAcrossMobilizerTransform(context);
   }
 
+  // Computes V_FM = H_FM * vm, with this node's mobilizer kernel.
+  SpatialVelocity<T> CalcAcrossMobilizerSpatialVelocity(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const VectorX<T>>& vm) const {
+    switch (mobilizer_kernel_) {
+      case MobilizerKernel::kRevolute:
+        return SpatialVelocity<T>(vm[0] * kernel_axis_F_, Vector3<T>::Zero());
+      case MobilizerKernel::kPrismatic:
+        return SpatialVelocity<T>(Vector3<T>::Zero(), vm[0] * kernel_axis_F_);
+      case MobilizerKernel::kWeld:
+        return SpatialVelocity<T>::Zero();
+      case MobilizerKernel::kGeneric:
+        break;
+    }
+    return get_mobilizer().CalcAcrossMobilizerSpatialVelocity(context, vm);
+  }
+
+  // Computes A_FM = H_FM * vmdot + Hdot_FM * vm, with this node's mobilizer
+  // kernel. Hdot_FM = 0 for all but the generic kernel.
+  SpatialAcceleration<T> CalcAcrossMobilizerSpatialAcceleration(
+      const systems::Context<T>& context,
+      const Eigen::Ref<const VectorX<T>>& vmdot) const {
+    switch (mobilizer_kernel_) {
+      case MobilizerKernel::kRevolute:
+        return SpatialAcceleration<T>(vmdot[0] * kernel_axis_F_,
+                                      Vector3<T>::Zero());
+      case MobilizerKernel::kPrismatic:
+        return SpatialAcceleration<T>(Vector3<T>::Zero(),
+                                      vmdot[0] * kernel_axis_F_);
+      case MobilizerKernel::kWeld:
+        return SpatialAcceleration<T>::Zero();
+      case MobilizerKernel::kGeneric:
+        break;
+    }
+    return get_mobilizer().CalcAcrossMobilizerSpatialAcceleration(context,
+                                                                  vmdot);
+  }
+
+  // Computes tau = H_FMᵀ * F_Mo_F, with this node's mobilizer kernel.
+  void ProjectSpatialForce(const systems::Context<T>& context,
+                           const SpatialForce<T>& F_Mo_F,
+                           Eigen::Ref<VectorX<T>> tau) const {
+    switch (mobilizer_kernel_) {
+      case MobilizerKernel::kRevolute:
+        tau[0] = kernel_axis_F_.dot(F_Mo_F.rotational());
+        return;
+      case MobilizerKernel::kPrismatic:
+        tau[0] = kernel_axis_F_.dot(F_Mo_F.translational());
+        return;
+      case MobilizerKernel::kWeld:
+        return;
+      case MobilizerKernel::kGeneric:
+        break;
+    }
+    get_mobilizer().ProjectSpatialForce(context, F_Mo_F, tau);
+  }
+
   // This method computes the total force Ftot_BBo on body B that must be
   // applied for it to incur in a spatial acceleration A_WB. Mathematically:
   //   Ftot_BBo = M_B_W * A_WB + b_Bo
@@ -1916,6 +2052,13 @@ class BodyNode : public MultibodyElement<BodyNode, T, BodyNodeIndex> {
   // Pointers for fast access.
   const Body<T>* body_;
   const Mobilizer<T>* mobilizer_{nullptr};
+
+  // The kernel for this node's mobilizer and its constant data: the unit
+  // axis of the revolute and prismatic kernels and the pose of the weld
+  // kernel. See MobilizerKernel.
+  MobilizerKernel mobilizer_kernel_{MobilizerKernel::kGeneric};
+  Vector3<T> kernel_axis_F_{Vector3<T>::Zero()};
+  math::RigidTransform<T> kernel_X_FM_;
 };
 
 }  // namespace internal
@@ -0,0 +1,120 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "drake/common/drake_throw.h"
+#include "drake/common/extract_double.h"
+#include "drake/multibody/tree/multibody_tree.h"
+
+namespace drake {
+namespace multibody {
+
+template <typename T>
+MassMatrixFactorization<T>::MassMatrixFactorization(
+    const internal::MultibodyTreeSystem<T>& plant)
+    : MassMatrixFactorization(internal::GetInternalTree(plant)) {}
+
+template <typename T>
+MassMatrixFactorization<T>::MassMatrixFactorization(
+    const internal::MultibodyTree<T>& model)
+    : MassMatrixFactorization(model.velocity_parents()) {
+  DRAKE_DEMAND(model.topology_is_valid());
+}
+
+template <typename T>
+MassMatrixFactorization<T>::MassMatrixFactorization(std::vector<int> parents)
+    : parents_(std::move(parents)) {
+  for (int i = 0; i < size(); ++i) {
+    DRAKE_THROW_UNLESS(-1 <= parents_[i] && parents_[i] < i);
+  }
+  LD_.resize(size(), size());
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::Factor(
+    const Eigen::Ref<const MatrixX<T>>& M) {
+  DRAKE_THROW_UNLESS(M.rows() == size() && M.cols() == size());
+  LD_.template triangularView<Eigen::Lower>() = M;
+  FactorInPlace();
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::FactorInPlace() {
+  // The tip-to-base LTDL factorization of [Featherstone 2005], Table 2. Each
+  // row k is scaled by its pivot and subtracted from the rows of its
+  // ancestors; the entries of M off the ancestor paths are zero and stay
+  // zero, so they are never visited.
+  for (int k = size() - 1; k >= 0; --k) {
+    const T& d = LD_(k, k);
+    if constexpr (scalar_predicate<T>::is_bool) {
+      if (!(d > 0)) {
+        throw std::runtime_error(fmt::format(
+            "MassMatrixFactorization: the matrix is not positive definite; "
+            "the pivot for index {} is {}.",
+            k, ExtractDoubleOrThrow(d)));
+      }
+    }
+    for (int i = parents_[k]; i >= 0; i = parents_[i]) {
+      const T a = LD_(k, i) / d;
+      for (int j = i; j >= 0; j = parents_[j]) {
+        LD_(i, j) -= a * LD_(k, j);
+      }
+      LD_(k, i) = a;
+    }
+  }
+}
+
+template <typename T>
+MatrixX<T> MassMatrixFactorization<T>::matrixL() const {
+  MatrixX<T> L = MatrixX<T>::Identity(size(), size());
+  for (int k = 0; k < size(); ++k) {
+    for (int i = parents_[k]; i >= 0; i = parents_[i]) {
+      L(k, i) = LD_(k, i);
+    }
+  }
+  return L;
+}
+
+template <typename T>
+VectorX<T> MassMatrixFactorization<T>::Solve(
+    const Eigen::Ref<const VectorX<T>>& b) const {
+  DRAKE_THROW_UNLESS(b.size() == size());
+  MatrixX<T> x = b;
+  SolveInPlace(&x);
+  return x;
+}
+
+template <typename T>
+void MassMatrixFactorization<T>::SolveInPlace(EigenPtr<MatrixX<T>> B) const {
+  DRAKE_THROW_UNLESS(B != nullptr);
+  DRAKE_THROW_UNLESS(B->rows() == size());
+  const int n = size();
+  for (int c = 0; c < B->cols(); ++c) {
+    auto x = B->col(c);
+    // Solve Lᵀ⋅y = b, from the tips to the base.
+    for (int i = n - 1; i >= 0; --i) {
+      for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+        x(j) -= LD_(i, j) * x(i);
+      }
+    }
+    // Solve D⋅z = y.
+    for (int i = 0; i < n; ++i) {
+      x(i) /= LD_(i, i);
+    }
+    // Solve L⋅x = z, from the base to the tips.
+    for (int i = 0; i < n; ++i) {
+      for (int j = parents_[i]; j >= 0; j = parents_[j]) {
+        x(i) -= LD_(i, j) * x(j);
+      }
+    }
+  }
+}
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DEFINE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::MassMatrixFactorization)
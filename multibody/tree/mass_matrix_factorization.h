@@ -0,0 +1,112 @@
+#pragma once
+
+#include <vector>
+
+#include "drake/common/default_scalars.h"
+#include "drake/common/drake_copyable.h"
+#include "drake/common/eigen_types.h"
+
+namespace drake {
+namespace multibody {
+
+namespace internal {
+template <typename T> class MultibodyTree;
+template <typename T> class MultibodyTreeSystem;
+}  // namespace internal
+
+/// A sparse factorization `M = Lᵀ⋅D⋅L` of the mass matrix `M` of a multibody
+/// model, where `L` is unit lower triangular and `D` is diagonal, that exploits
+/// the branch-induced sparsity of `M`.
+///
+/// For a tree-structured model, the entry `M(i, j)` (with `i > j`) can only be
+/// nonzero when the generalized velocity `j` is an ancestor of `i`, i.e., when
+/// it belongs to the mobilizer of a body between the body of `i` and the world
+/// (or to an earlier velocity of the same mobilizer). We describe the tree by
+/// the array `parents`, where `parents[i] < i` is the nearest ancestor of `i`,
+/// or -1 if there is none. Since `L` has the same sparsity as the lower
+/// triangle of `M` (there is no fill-in), both the factorization and each
+/// solve only visit the ancestors of each velocity. This costs `O(n⋅d²)` and
+/// `O(n⋅d)` operations, respectively, with `n` the number of velocities and
+/// `d` the depth of the tree, instead of the `O(n³)` and `O(n²)` of a dense
+/// factorization, as described in [Featherstone 2005].
+///
+/// Typical use with a MultibodyPlant:
+/// @code
+/// MassMatrixFactorization<double> factorization(plant);
+/// plant.CalcMassMatrixFactorization(context, &factorization);
+/// const VectorX<double> vdot = factorization.Solve(tau);
+/// @endcode
+///
+/// - [Featherstone 2005] Featherstone, R., 2005. Efficient factorization of
+///   the joint-space inertia matrix for branched kinematic trees. The
+///   International Journal of Robotics Research, 24(6), pp. 487-500.
+///
+/// @tparam_default_scalar
+template <typename T>
+class MassMatrixFactorization {
+ public:
+  DRAKE_DEFAULT_COPY_AND_MOVE_AND_ASSIGN(MassMatrixFactorization)
+
+  /// Constructs storage for the factorization of the mass matrix of `plant`.
+  /// The factorization is computed by
+  /// MultibodyPlant::CalcMassMatrixFactorization().
+  /// `plant` must have been already finalized with
+  /// MultibodyPlant::Finalize() or this constructor will abort.
+  explicit MassMatrixFactorization(
+      const internal::MultibodyTreeSystem<T>& plant);
+
+  /// (Advanced) Tree overload.
+  explicit MassMatrixFactorization(const internal::MultibodyTree<T>& model);
+
+  /// (Advanced) Constructs storage for the factorization of matrices of size
+  /// `parents.size()` with the sparsity given by `parents` (see the class
+  /// documentation). Use Factor() to compute the factorization.
+  /// @throws std::exception unless `-1 <= parents[i] < i` for every `i`.
+  explicit MassMatrixFactorization(std::vector<int> parents);
+
+  /// Returns the size of the factored matrix.
+  int size() const { return static_cast<int>(parents_.size()); }
+
+  /// Returns the nearest ancestor of each velocity (or -1); see the class
+  /// documentation.
+  const std::vector<int>& parents() const { return parents_; }
+
+  /// Computes the factorization of the symmetric positive definite matrix
+  /// `M`. Only the lower triangle of `M` is read, and only its entries along
+  /// the paths from each velocity to the root of its tree.
+  /// @throws std::exception if `M` is not of size size() x size().
+  /// @throws std::exception if `M` is not positive definite (only checked for
+  ///   numeric scalar types).
+  void Factor(const Eigen::Ref<const MatrixX<T>>& M);
+
+  /// Returns the unit lower triangular factor `L`, as a dense matrix.
+  MatrixX<T> matrixL() const;
+
+  /// Returns the diagonal of `D`.
+  VectorX<T> vectorD() const { return LD_.diagonal(); }
+
+  /// Returns the solution `x` of `M⋅x = b`.
+  /// @throws std::exception if `b` is not of size size().
+  VectorX<T> Solve(const Eigen::Ref<const VectorX<T>>& b) const;
+
+  /// Overwrites each column `b` of `B` with the solution `x` of `M⋅x = b`.
+  /// Solving in place does not allocate.
+  /// @throws std::exception if `B` is nullptr or does not have size() rows.
+  void SolveInPlace(EigenPtr<MatrixX<T>> B) const;
+
+ private:
+  friend class internal::MultibodyTree<T>;
+
+  // Factors LD_ in place: on input, LD_ holds M; on output, its diagonal
+  // holds D and its strict lower triangle holds L (along the ancestor paths).
+  void FactorInPlace();
+
+  std::vector<int> parents_;
+  MatrixX<T> LD_;
+};
+
+}  // namespace multibody
+}  // namespace drake
+
+DRAKE_DECLARE_CLASS_TEMPLATE_INSTANTIATIONS_ON_DEFAULT_SCALARS(
+    class ::drake::multibody::MassMatrixFactorization)
@@ -16,10 +16,13 @@
 #include "drake/math/rotation_matrix.h"
 #include "drake/multibody/tree/body_node_welded.h"
 #include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/prismatic_mobilizer.h"
 #include "drake/multibody/tree/quaternion_floating_mobilizer.h"
+#include "drake/multibody/tree/revolute_mobilizer.h"
 #include "drake/multibody/tree/rigid_body.h"
 #include "drake/multibody/tree/spatial_inertia.h"
 #include "drake/multibody/tree/uniform_gravity_field_element.h"
+#include "drake/multibody/tree/weld_mobilizer.h"
 
 namespace drake {
 namespace multibody {
@@ -600,6 +603,26 @@ void MultibodyTree<T>::FinalizeInternals() {
     body_node_levels_[node_topology.level].push_back(body_node_index);
   }
 
+  // Since BodyNode objects are in Breadth First Traversal order, and their
+  // velocities are numbered in the same order, a node's parent (and its
+  // velocities) always precede the node.
+  velocity_parents_.assign(topology_.num_velocities(), -1);
+  std::vector<int> last_velocity_of_node(topology_.get_num_body_nodes(), -1);
+  for (BodyNodeIndex body_node_index(1);
+       body_node_index < topology_.get_num_body_nodes(); ++body_node_index) {
+    const BodyNodeTopology& node_topology =
+        topology_.get_body_node(body_node_index);
+    int parent = last_velocity_of_node[node_topology.parent_body_node];
+    const int start = node_topology.mobilizer_velocities_start_in_v;
+    for (int i = start; i < start + node_topology.num_mobilizer_velocities;
+         ++i) {
+      DRAKE_DEMAND(parent < i);
+      velocity_parents_[i] = parent;
+      parent = i;
+    }
+    last_velocity_of_node[body_node_index] = parent;
+  }
+
   // Creates BodyNode's:
   // This recursion order ensures that a BodyNode's parent is created before the
   // node itself, since BodyNode objects are in Breadth First Traversal order.
@@ -677,6 +700,22 @@ void MultibodyTree<T>::CreateBodyNode(BodyNodeIndex body_node_index) {
   body_node->set_parent_tree(this, body_node_index);
   body_node->SetTopology(topology_);
 
+  // The most common mobilizers are evaluated by the node's own kernels,
+  // bypassing the virtual Mobilizer interface in the recursions.
+  if (body_index != world_index()) {
+    const Mobilizer<T>& mobilizer = body_node->get_mobilizer();
+    if (const auto* revolute =
+            dynamic_cast<const RevoluteMobilizer<T>*>(&mobilizer)) {
+      body_node->SetRevoluteKernel(revolute->revolute_axis());
+    } else if (const auto* prismatic =
+                   dynamic_cast<const PrismaticMobilizer<T>*>(&mobilizer)) {
+      body_node->SetPrismaticKernel(prismatic->translation_axis());
+    } else if (const auto* weld =
+                   dynamic_cast<const WeldMobilizer<T>*>(&mobilizer)) {
+      body_node->SetWeldKernel(weld->get_X_FM());
+    }
+  }
+
   body_nodes_.push_back(std::move(body_node));
 }
 
@@ -845,6 +884,38 @@ void MultibodyTree<T>::SetFreeBodyRandomRotationDistributionOrThrow(
   mobilizer.set_random_quaternion_distribution(rotation);
 }
 
+template <typename T>
+void MultibodyTree<T>::set_tree_recursion_num_threads(int num_threads) {
+  DRAKE_THROW_UNLESS(num_threads >= 1);
+  if (num_threads == tree_recursion_num_threads()) return;
+  level_thread_pool_ =
+      num_threads == 1
+          ? nullptr
+          : std::make_unique<drake::internal::ThreadPool>(num_threads);
+}
+
+template <typename T>
+template <typename Calc>
+void MultibodyTree<T>::CalcForEachNodeInLevel(int level,
+                                              const Calc& calc) const {
+  const std::vector<BodyNodeIndex>& level_nodes = body_node_levels_[level];
+  const int num_nodes = static_cast<int>(level_nodes.size());
+  if (level_thread_pool_ != nullptr && num_nodes >= kMinParallelLevelWidth) {
+    // About four chunks per thread balances the load without claiming chunks
+    // too often.
+    const int grain_size =
+        std::max(1, num_nodes / (4 * level_thread_pool_->num_threads()));
+    level_thread_pool_->ParallelFor(
+        0, num_nodes, grain_size, [this, &level_nodes, &calc](int i) {
+          calc(*body_nodes_[level_nodes[i]]);
+        });
+    return;
+  }
+  for (BodyNodeIndex body_node_index : level_nodes) {
+    calc(*body_nodes_[body_node_index]);
+  }
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcAllBodyPosesInWorld(
     const systems::Context<T>& context,
@@ -892,15 +963,12 @@ void MultibodyTree<T>::CalcPositionKinematicsCache(
   // recursion to update world positions and parent to child body transforms.
   // This skips the world, level = 0.
   for (int level = 1; level < tree_height(); ++level) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[level]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
+    CalcForEachNodeInLevel(level, [&](const BodyNode<T>& node) {
       DRAKE_ASSERT(node.get_topology().level == level);
-      DRAKE_ASSERT(node.index() == body_node_index);
 
       // Update per-node kinematics.
       node.CalcPositionKinematicsCache_BaseToTip(context, pc);
-    }
+    });
   }
 }
 
@@ -927,11 +995,8 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
   // Performs a base-to-tip recursion computing body velocities.
   // This skips the world, depth = 0.
   for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
+    CalcForEachNodeInLevel(depth, [&](const BodyNode<T>& node) {
       DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
 
       // Hinge matrix for this node. H_PB_W ∈ ℝ⁶ˣⁿᵐ with nm ∈ [0; 6] the
       // number of mobilities for this node. Therefore, the return is a
@@ -944,7 +1009,7 @@ void MultibodyTree<T>::CalcVelocityKinematicsCache(
 
       // Update per-node kinematics.
       node.CalcVelocityKinematicsCache_BaseToTip(context, pc, H_PB_W, vc);
-    }
+    });
   }
 }
 
@@ -1000,9 +1065,9 @@ void MultibodyTree<T>::CalcCompositeBodyInertiasInWorld(
 
   // Perform tip-to-base recursion for each composite body, skipping the world.
   for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex composite_node_index : body_node_levels_[depth]) {
-      // Node corresponding to the composite body C.
-      const BodyNode<T>& composite_node = *body_nodes_[composite_node_index];
+    // Node corresponding to the composite body C.
+    CalcForEachNodeInLevel(depth, [&](const BodyNode<T>& composite_node) {
+      const BodyNodeIndex composite_node_index = composite_node.index();
 
       // This node's spatial inertia.
       const SpatialInertia<T>& M_C_W = M_B_W_all[composite_node_index];
@@ -1013,7 +1078,7 @@ void MultibodyTree<T>::CalcCompositeBodyInertiasInWorld(
       SpatialInertia<T>& Mc_C_W = (*Mc_B_W_all)[composite_node_index];
       composite_node.CalcCompositeBodyInertia_TipToBase(M_C_W, pc, *Mc_B_W_all,
                                                         &Mc_C_W);
-    }
+    });
   }
 }
 
@@ -1136,16 +1201,13 @@ void MultibodyTree<T>::CalcSpatialAccelerationsFromVdot(
   // Performs a base-to-tip recursion computing body accelerations.
   // This skips the world, depth = 0.
   for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
-
+    CalcForEachNodeInLevel(depth, [&](const BodyNode<T>& node) {
       DRAKE_ASSERT(node.get_topology().level == depth);
-      DRAKE_ASSERT(node.index() == body_node_index);
 
       // Update per-node kinematics.
       node.CalcSpatialAcceleration_BaseToTip(
           context, pc, vc, known_vdot, A_WB_array);
-    }
+    });
   }
 }
 
@@ -1438,6 +1500,40 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
       // This node's 6x6 composite body inertia.
       const SpatialInertia<T>& Mc_C_W = Mc_B_W_cache[composite_node_index];
 
+      // Fast path for single-dof mobilizers (e.g., revolute and prismatic),
+      // which are the most common: the same recursion as below, with the 6 x 1
+      // hinge matrices and forces as fixed-size vectors.
+      if (cnv == 1) {
+        const int composite_start = composite_node.velocity_start();
+        const Vector6<T>& H_CpC_W = H_PB_W_cache[composite_start];
+        SpatialForce<T> Fm_CBo_W =
+            Mc_C_W * SpatialAcceleration<T>(H_CpC_W);  // Fm_CCo_W.
+        (*M)(composite_start, composite_start) +=
+            H_CpC_W.dot(Fm_CBo_W.get_coeffs());
+        const BodyNode<T>* child_node = &composite_node;
+        const BodyNode<T>* body_node = child_node->parent_body_node();
+        while (body_node) {
+          Fm_CBo_W.ShiftInPlace(-pc.get_p_PoBo_W(child_node->index()));
+          const int bnv = body_node->get_num_mobilizer_velocities();
+          const int body_start = body_node->velocity_start();
+          if (bnv == 1) {
+            const T HtFm =
+                H_PB_W_cache[body_start].dot(Fm_CBo_W.get_coeffs());
+            (*M)(body_start, composite_start) += HtFm;
+            (*M)(composite_start, body_start) += HtFm;
+          } else if (bnv > 1) {
+            const VectorUpTo6<T> HtFm =
+                body_node->GetJacobianFromArray(H_PB_W_cache).transpose() *
+                Fm_CBo_W.get_coeffs();
+            M->block(body_start, composite_start, bnv, 1) += HtFm;
+            M->block(composite_start, body_start, 1, bnv) += HtFm.transpose();
+          }
+          child_node = body_node;
+          body_node = child_node->parent_body_node();
+        }
+        continue;
+      }
+
       // Across-mobilizer 6 x cnv hinge matrix, from C's parent Cp to C.
       Eigen::Map<const MatrixUpTo6<T>> H_CpC_W =
           composite_node.GetJacobianFromArray(H_PB_W_cache);
@@ -1516,6 +1612,23 @@ void MultibodyTree<T>::CalcMassMatrix(const systems::Context<T>& context,
   }
 }
 
+template <typename T>
+void MultibodyTree<T>::CalcMassMatrixFactorization(
+    const systems::Context<T>& context,
+    MassMatrixFactorization<T>* factorization) const {
+  DRAKE_THROW_UNLESS(factorization != nullptr);
+  if (factorization->parents() != velocity_parents()) {
+    throw std::logic_error(fmt::format(
+        "CalcMassMatrixFactorization(): the factorization (of size {}) was "
+        "not created for this model (with {} generalized velocities).",
+        factorization->size(), num_velocities()));
+  }
+  // The mass matrix is computed directly into the factorization's storage,
+  // which is then factored in place, so that no memory is allocated.
+  CalcMassMatrix(context, &factorization->LD_);
+  factorization->FactorInPlace();
+}
+
 template <typename T>
 void MultibodyTree<T>::CalcBiasTerm(
     const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const {
@@ -2816,8 +2929,8 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
 
   // Perform tip-to-base recursion, skipping the world.
   for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
+    CalcForEachNodeInLevel(depth, [&](const BodyNode<T>& node) {
+      const BodyNodeIndex body_node_index = node.index();
 
       // Get hinge matrix and spatial inertia for this node.
       Eigen::Map<const MatrixUpTo6<T>> H_PB_W =
@@ -2827,7 +2940,7 @@ void MultibodyTree<T>::CalcArticulatedBodyInertiaCache(
 
       node.CalcArticulatedBodyInertiaCache_TipToBase(
           context, pc, H_PB_W, M_B_W, reflected_inertia, abic);
-    }
+    });
   }
 }
 
@@ -2867,8 +2980,8 @@ void MultibodyTree<T>::CalcArticulatedBodyForceCache(
 
   // Perform tip-to-base recursion, skipping the world.
   for (int depth = tree_height() - 1; depth > 0; --depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
+    CalcForEachNodeInLevel(depth, [&](const BodyNode<T>& node) {
+      const BodyNodeIndex body_node_index = node.index();
 
       // Get generalized force and body force for this node.
       Eigen::Ref<const VectorX<T>> tau_applied =
@@ -2885,7 +2998,7 @@ void MultibodyTree<T>::CalcArticulatedBodyForceCache(
       node.CalcArticulatedBodyForceCache_TipToBase(
           context, pc, &vc, Fb_B_W, abic, Zb_Bo_W, Fapplied_Bo_W, tau_applied,
           H_PB_W, aba_force_cache);
-    }
+    });
   }
 }
 
@@ -2905,8 +3018,8 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
 
   // Perform base-to-tip recursion, skipping the world.
   for (int depth = 1; depth < tree_height(); ++depth) {
-    for (BodyNodeIndex body_node_index : body_node_levels_[depth]) {
-      const BodyNode<T>& node = *body_nodes_[body_node_index];
+    CalcForEachNodeInLevel(depth, [&](const BodyNode<T>& node) {
+      const BodyNodeIndex body_node_index = node.index();
 
       const SpatialAcceleration<T>& Ab_WB = Ab_WB_cache[body_node_index];
 
@@ -2916,7 +3029,7 @@ void MultibodyTree<T>::CalcArticulatedBodyAccelerations(
 
       node.CalcArticulatedBodyAccelerations_BaseToTip(
           context, pc, abic, aba_force_cache, H_PB_W, Ab_WB, ac);
-    }
+    });
   }
 }
 
@@ -18,10 +18,12 @@
 #include "drake/common/drake_deprecated.h"
 #include "drake/common/pointer_cast.h"
 #include "drake/common/random.h"
+#include "drake/common/thread_pool.h"
 #include "drake/math/rigid_transform.h"
 #include "drake/multibody/tree/acceleration_kinematics_cache.h"
 #include "drake/multibody/tree/articulated_body_force_cache.h"
 #include "drake/multibody/tree/articulated_body_inertia_cache.h"
+#include "drake/multibody/tree/mass_matrix_factorization.h"
 #include "drake/multibody/tree/multibody_forces.h"
 #include "drake/multibody/tree/multibody_tree_system.h"
 #include "drake/multibody/tree/multibody_tree_topology.h"
@@ -622,6 +624,43 @@ class MultibodyTree {
     return topology_.tree_height();
   }
 
+  // The minimum number of body nodes a level of the tree must have for
+  // set_tree_recursion_num_threads() to process it in parallel. Narrower
+  // levels (i.e., all levels of most robots) are processed serially, since
+  // their per-node work is too small to repay the cost of waking the workers.
+  static constexpr int kMinParallelLevelWidth = 32;
+
+  // Sets the maximum number of threads (including the calling thread) used to
+  // process the body nodes within each level of the tree, in the base-to-tip
+  // and tip-to-base recursions for position and velocity kinematics,
+  // composite body inertias, and articulated body (forward) dynamics. The
+  // nodes within a level are independent of each other, so this gives the
+  // same results as the serial recursions, for any number of threads. Only
+  // levels with at least kMinParallelLevelWidth nodes (e.g., a scene with many
+  // free bodies) are processed in parallel. The default of one thread
+  // processes every level serially.
+  // @throws std::exception if `num_threads < 1`.
+  void set_tree_recursion_num_threads(int num_threads);
+
+  // Returns, for each generalized velocity i, the nearest velocity that is an
+  // ancestor of i in the tree (i.e., the previous velocity of the same
+  // mobilizer, or else the last velocity of the nearest inboard mobilizer
+  // with velocities), or -1 if there is none. Ancestors always precede their
+  // descendants in v, so velocity_parents()[i] < i. This describes the
+  // sparsity of the mass matrix; see MassMatrixFactorization.
+  // @throws std::exception if the tree is not finalized.
+  const std::vector<int>& velocity_parents() const {
+    DRAKE_MBT_THROW_IF_NOT_FINALIZED();
+    return velocity_parents_;
+  }
+
+  // Returns the maximum number of threads used to process each level of the
+  // tree. See set_tree_recursion_num_threads().
+  int tree_recursion_num_threads() const {
+    return level_thread_pool_ == nullptr ? 1
+                                         : level_thread_pool_->num_threads();
+  }
+
   // Returns a constant reference to the *world* body.
   const RigidBody<T>& world_body() const {
     // world_body_ is set in the constructor. So this assert is here only to
@@ -1604,6 +1643,11 @@ class MultibodyTree {
   void CalcMassMatrix(const systems::Context<T>& context,
                       EigenPtr<MatrixX<T>> M) const;
 
+  // See MultibodyPlant method.
+  void CalcMassMatrixFactorization(
+      const systems::Context<T>& context,
+      MassMatrixFactorization<T>* factorization) const;
+
   // See MultibodyPlant method.
   void CalcBiasTerm(
       const systems::Context<T>& context, EigenPtr<VectorX<T>> Cv) const;
@@ -2165,6 +2209,8 @@ class MultibodyTree {
     tree_clone->instance_index_to_name_ = this->instance_index_to_name_;
     tree_clone->joint_to_mobilizer_ = this->joint_to_mobilizer_;
     tree_clone->discrete_state_index_ = this->discrete_state_index_;
+    tree_clone->set_tree_recursion_num_threads(
+        this->tree_recursion_num_threads());
 
     // All other internals templated on T are created with the following call to
     // FinalizeInternals().
@@ -2379,6 +2425,14 @@ class MultibodyTree {
   // Friend class to facilitate testing.
   friend class MultibodyTreeTester;
 
+  // Calls `calc(node)` for each BodyNode in the given level of the tree, in
+  // parallel when the level is wide enough (see
+  // set_tree_recursion_num_threads()). `calc` must only write to the
+  // quantities of the node it is given. It is a template so that the (default)
+  // serial loop calls `calc` directly; it is only used in multibody_tree.cc.
+  template <typename Calc>
+  void CalcForEachNodeInLevel(int level, const Calc& calc) const;
+
   // Helpers for getting the full qv discrete state once we know we are using
   // discrete state.
   Eigen::VectorBlock<const VectorX<T>> get_discrete_state_vector(
@@ -2902,6 +2956,15 @@ class MultibodyTree {
   // in that level.
   std::vector<std::vector<BodyNodeIndex>> body_node_levels_;
 
+  // The nearest ancestor of each generalized velocity, or -1. See
+  // velocity_parents().
+  std::vector<int> velocity_parents_;
+
+  // The workers that process the nodes of wide levels in parallel, or nullptr
+  // when the levels are processed serially. See
+  // set_tree_recursion_num_threads().
+  std::unique_ptr<drake::internal::ThreadPool> level_thread_pool_;
+
   // Joint to Mobilizer map, of size num_joints(). For a joint with index
   // joint_index, mobilizer_index = joint_to_mobilizer_[joint_index] maps to the
   // mobilizer model of the joint, or an invalid index if the joint is modeled
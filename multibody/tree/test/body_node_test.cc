@@ -0,0 +1,125 @@
+#include "drake/multibody/tree/body_node.h"
+
+#include <limits>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/multibody_tree_system.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/universal_joint.h"
+#include "drake/multibody/tree/weld_joint.h"
+
+namespace drake {
+namespace multibody {
+namespace internal {
+
+// Friend tester class for accessing MultibodyTree protected/private internals.
+class MultibodyTreeTester {
+ public:
+  MultibodyTreeTester() = delete;
+  static const BodyNode<double>& get_body_node(
+      const MultibodyTree<double>& model, const Body<double>& body) {
+    return *model.body_nodes_[body.node_index()];
+  }
+};
+
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+using math::RigidTransformd;
+using math::RollPitchYawd;
+using systems::Context;
+using MobilizerKernel = BodyNode<double>::MobilizerKernel;
+
+// Verifies that the revolute, prismatic, and weld mobilizers are evaluated
+// with the body node's own kernels, and that these agree with the (virtual)
+// Mobilizer interface they replace.
+GTEST_TEST(BodyNodeTest, MobilizerKernels) {
+  auto model = std::make_unique<MultibodyTree<double>>();
+  const SpatialInertia<double> M_BBo_B(
+      1.5, Vector3d(0.1, -0.2, 0.05),
+      UnitInertia<double>::SolidBox(0.2, 0.3, 0.4));
+  // A chain whose single-dof mobilizers are outboard of a multi-dof one, with
+  // axes that are not aligned with the frames, and a free body.
+  const RigidBody<double>& u_body = model->AddBody<RigidBody>("u", M_BBo_B);
+  const RigidBody<double>& r_body = model->AddBody<RigidBody>("r", M_BBo_B);
+  const RigidBody<double>& p_body = model->AddBody<RigidBody>("p", M_BBo_B);
+  const RigidBody<double>& w_body = model->AddBody<RigidBody>("w", M_BBo_B);
+  const RigidBody<double>& free_body =
+      model->AddBody<RigidBody>("free", M_BBo_B);
+  const RigidTransformd X_PF(RollPitchYawd(0.3, -0.4, 0.5),
+                             Vector3d(0.1, 0.2, 0.3));
+  const UniversalJoint<double>& u_joint = model->AddJoint<UniversalJoint>(
+      "u", model->world_body(), X_PF, u_body, std::nullopt, 0.0);
+  const RevoluteJoint<double>& r_joint = model->AddJoint<RevoluteJoint>(
+      "r", u_body, X_PF, r_body, X_PF.inverse(),
+      Vector3d(1, 2, 3).normalized());
+  const PrismaticJoint<double>& p_joint = model->AddJoint<PrismaticJoint>(
+      "p", r_body, X_PF, p_body, std::nullopt,
+      Vector3d(-1, 0.5, 2).normalized());
+  model->AddJoint<WeldJoint>("w", p_body, X_PF, w_body, std::nullopt,
+                             RigidTransformd(Vector3d(0, 0, -1)));
+  MultibodyTreeSystem<double> system(std::move(model));
+  const MultibodyTree<double>& tree = GetInternalTree(system);
+
+  auto node_of = [&tree](const Body<double>& body) -> const BodyNode<double>& {
+    return MultibodyTreeTester::get_body_node(tree, body);
+  };
+  EXPECT_EQ(node_of(u_body).mobilizer_kernel(), MobilizerKernel::kGeneric);
+  EXPECT_EQ(node_of(r_body).mobilizer_kernel(), MobilizerKernel::kRevolute);
+  EXPECT_EQ(node_of(p_body).mobilizer_kernel(), MobilizerKernel::kPrismatic);
+  EXPECT_EQ(node_of(w_body).mobilizer_kernel(), MobilizerKernel::kWeld);
+  EXPECT_EQ(node_of(free_body).mobilizer_kernel(),
+            MobilizerKernel::kGeneric);
+
+  std::unique_ptr<Context<double>> context = system.CreateDefaultContext();
+  u_joint.set_angles(context.get(), Eigen::Vector2d(0.3, -0.7));
+  r_joint.set_angle(context.get(), 1.1);
+  p_joint.set_translation(context.get(), 0.25);
+  const VectorXd v = VectorXd::LinSpaced(tree.num_velocities(), -1.0, 2.0);
+  tree.GetMutableVelocities(context.get()) = v;
+
+  const PositionKinematicsCache<double>& pc =
+      tree.EvalPositionKinematics(*context);
+  const VelocityKinematicsCache<double>& vc =
+      tree.EvalVelocityKinematics(*context);
+  const double kTolerance = 16 * std::numeric_limits<double>::epsilon();
+  for (const RigidBody<double>* body : {&r_body, &p_body, &w_body}) {
+    const BodyNode<double>& node = node_of(*body);
+    const Mobilizer<double>& mobilizer = node.get_mobilizer();
+    EXPECT_TRUE(CompareMatrices(
+        pc.get_X_FM(node.index()).GetAsMatrix34(),
+        mobilizer.CalcAcrossMobilizerTransform(*context).GetAsMatrix34(),
+        kTolerance));
+    const VectorXd vm = v.segment(node.velocity_start(),
+                                  node.get_num_mobilizer_velocities());
+    EXPECT_TRUE(CompareMatrices(
+        vc.get_V_FM(node.index()).get_coeffs(),
+        mobilizer.CalcAcrossMobilizerSpatialVelocity(*context, vm)
+            .get_coeffs(),
+        kTolerance));
+  }
+
+  // The mass matrix from the composite body algorithm (with its fixed-size
+  // path for single-dof mobilizers) agrees with the one from inverse dynamics
+  // (which projects the forces with the kernels).
+  const int nv = tree.num_velocities();
+  MatrixXd M(nv, nv);
+  tree.CalcMassMatrix(*context, &M);
+  MatrixXd M_id(nv, nv);
+  tree.CalcMassMatrixViaInverseDynamics(*context, &M_id);
+  EXPECT_TRUE(CompareMatrices(M, M_id, 1e-14, MatrixCompareType::relative));
+}
+
+}  // namespace
+}  // namespace internal
+}  // namespace multibody
+}  // namespace drake
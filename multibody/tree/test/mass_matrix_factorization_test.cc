@@ -0,0 +1,168 @@
+#include "drake/multibody/tree/mass_matrix_factorization.h"
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "drake/common/eigen_types.h"
+#include "drake/common/test_utilities/eigen_matrix_compare.h"
+#include "drake/common/test_utilities/expect_throws_message.h"
+#include "drake/multibody/tree/multibody_tree-inl.h"
+#include "drake/multibody/tree/prismatic_joint.h"
+#include "drake/multibody/tree/revolute_joint.h"
+#include "drake/multibody/tree/rigid_body.h"
+#include "drake/multibody/tree/weld_joint.h"
+
+namespace drake {
+namespace multibody {
+namespace {
+
+using Eigen::MatrixXd;
+using Eigen::Vector3d;
+using Eigen::VectorXd;
+
+constexpr double kEpsilon = std::numeric_limits<double>::epsilon();
+
+// A forest with two trees. The first branches at index 1 (into the chains
+// {2} and {3, 4}) and at index 0 (into {1, ...} and {7}); the second is the
+// chain {5, 6}.
+const std::vector<int> kParents{-1, 0, 1, 1, 3, -1, 5, 0};
+
+// Returns true iff `j` is `i` or one of its ancestors.
+bool IsAncestorOrSelf(const std::vector<int>& parents, int j, int i) {
+  for (; i >= 0; i = parents[i]) {
+    if (i == j) return true;
+  }
+  return false;
+}
+
+// Makes a unit lower triangular L with nonzero entries only along the ancestor
+// paths given by `parents`.
+MatrixXd MakeL(const std::vector<int>& parents) {
+  const int n = static_cast<int>(parents.size());
+  MatrixXd L = MatrixXd::Identity(n, n);
+  for (int k = 0; k < n; ++k) {
+    for (int i = parents[k]; i >= 0; i = parents[i]) {
+      L(k, i) = 0.1 * (k + 1) - 0.3 * i;
+    }
+  }
+  return L;
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, FactorAndSolve) {
+  const int n = static_cast<int>(kParents.size());
+  const MatrixXd L = MakeL(kParents);
+  const VectorXd D = VectorXd::LinSpaced(n, 0.5, 4.0);
+  const MatrixXd M = L.transpose() * D.asDiagonal() * L;
+
+  // M has branch-induced sparsity: M(i, j) is zero unless one of i, j is an
+  // ancestor of the other.
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      if (!IsAncestorOrSelf(kParents, j, i) &&
+          !IsAncestorOrSelf(kParents, i, j)) {
+        EXPECT_EQ(M(i, j), 0.0);
+      }
+    }
+  }
+
+  MassMatrixFactorization<double> factorization(kParents);
+  EXPECT_EQ(factorization.size(), n);
+  EXPECT_EQ(factorization.parents(), kParents);
+  factorization.Factor(M);
+  const double kTolerance = 16 * kEpsilon;
+  EXPECT_TRUE(CompareMatrices(factorization.matrixL(), L, kTolerance));
+  EXPECT_TRUE(CompareMatrices(factorization.vectorD(), D, kTolerance));
+
+  const VectorXd b = VectorXd::LinSpaced(n, -1.0, 2.0);
+  const VectorXd x_expected = M.ldlt().solve(b);
+  EXPECT_TRUE(CompareMatrices(factorization.Solve(b), x_expected,
+                              kTolerance * x_expected.norm()));
+
+  MatrixXd B(n, 2);
+  B.col(0) = b;
+  B.col(1) = 2.0 * b;
+  factorization.SolveInPlace(&B);
+  EXPECT_TRUE(CompareMatrices(B.col(0), x_expected,
+                              kTolerance * x_expected.norm()));
+  EXPECT_TRUE(CompareMatrices(B.col(1), 2.0 * x_expected,
+                              2.0 * kTolerance * x_expected.norm()));
+
+  // Only the lower triangle of M is read.
+  MatrixXd M_lower = M.triangularView<Eigen::Lower>();
+  factorization.Factor(M_lower);
+  EXPECT_TRUE(CompareMatrices(factorization.matrixL(), L, kTolerance));
+}
+
+GTEST_TEST(MassMatrixFactorizationTest, Errors) {
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MassMatrixFactorization<double>(std::vector<int>{-1, 1}),
+      ".*parents_\\[i\\] < i.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      MassMatrixFactorization<double>(std::vector<int>{-2}),
+      ".*-1 <= parents_\\[i\\].*");
+
+  MassMatrixFactorization<double> factorization(std::vector<int>{-1, 0});
+  DRAKE_EXPECT_THROWS_MESSAGE(factorization.Factor(MatrixXd::Identity(3, 3)),
+                              ".*M.rows\\(\\) == size\\(\\).*");
+  // The second pivot is 1 - 2² / 1 < 0.
+  MatrixXd M(2, 2);
+  M << 1, 2,
+       2, 1;
+  DRAKE_EXPECT_THROWS_MESSAGE(
+      factorization.Factor(M),
+      ".*not positive definite; the pivot for index 0 is -3.*");
+  DRAKE_EXPECT_THROWS_MESSAGE(factorization.Solve(VectorXd::Zero(3)),
+                              ".*b.size\\(\\) == size\\(\\).*");
+}
+
+// Verifies the sparsity of the mass matrix of a branched model.
+GTEST_TEST(MassMatrixFactorizationTest, VelocityParents) {
+  internal::MultibodyTree<double> model;
+  const SpatialInertia<double> M_BBo_B(
+      1.0, Vector3d::Zero(), UnitInertia<double>::SolidSphere(0.1));
+  const RigidBody<double>& base = model.AddBody<RigidBody>("base", M_BBo_B);
+  const RigidBody<double>& left = model.AddBody<RigidBody>("left", M_BBo_B);
+  const RigidBody<double>& right = model.AddBody<RigidBody>("right", M_BBo_B);
+  const RigidBody<double>& hand = model.AddBody<RigidBody>("hand", M_BBo_B);
+  const RigidBody<double>& finger =
+      model.AddBody<RigidBody>("finger", M_BBo_B);
+  const RigidBody<double>& free = model.AddBody<RigidBody>("free", M_BBo_B);
+  const Joint<double>& base_joint = model.AddJoint<PrismaticJoint>(
+      "base", model.world_body(), std::nullopt, base, std::nullopt,
+      Vector3d::UnitX());
+  const Joint<double>& left_joint = model.AddJoint<RevoluteJoint>(
+      "left", base, std::nullopt, left, std::nullopt, Vector3d::UnitZ());
+  const Joint<double>& right_joint = model.AddJoint<RevoluteJoint>(
+      "right", base, std::nullopt, right, std::nullopt, Vector3d::UnitZ());
+  // A weld contributes no velocities, so the finger's parent is the velocity
+  // of the right arm.
+  model.AddJoint<WeldJoint>("hand", right, std::nullopt, hand, std::nullopt,
+                            math::RigidTransformd());
+  const Joint<double>& finger_joint = model.AddJoint<RevoluteJoint>(
+      "finger", hand, std::nullopt, finger, std::nullopt, Vector3d::UnitY());
+  model.Finalize();
+  ASSERT_EQ(model.num_velocities(), 10);
+
+  std::vector<int> expected(10);
+  expected[base_joint.velocity_start()] = -1;
+  expected[left_joint.velocity_start()] = base_joint.velocity_start();
+  expected[right_joint.velocity_start()] = base_joint.velocity_start();
+  expected[finger_joint.velocity_start()] = right_joint.velocity_start();
+  // The six velocities of the free body form a chain.
+  const int free_start =
+      free.floating_velocities_start() - model.num_positions();
+  expected[free_start] = -1;
+  for (int i = 1; i < 6; ++i) {
+    expected[free_start + i] = free_start + i - 1;
+  }
+  EXPECT_EQ(model.velocity_parents(), expected);
+
+  const MassMatrixFactorization<double> factorization(model);
+  EXPECT_EQ(factorization.parents(), expected);
+}
+
+}  // namespace
+}  // namespace multibody
+}  // namespace drake
@@ -141,8 +141,10 @@ void RgbdSensor::CalcDepthImage32F(const Context<double>& context,
 
 void RgbdSensor::CalcDepthImage16U(const Context<double>& context,
                                    ImageDepth16U* depth_image) const {
-  ImageDepth32F depth32(depth_image->width(), depth_image->height());
-  CalcDepthImage32F(context, &depth32);
+  // The 16U image is derived from the (cached) 32F image. This neither renders
+  // the depth image a second time nor allocates a temporary image.
+  const ImageDepth32F& depth32 =
+      depth_image_32F_port_->Eval<ImageDepth32F>(context);
   ConvertDepth32FTo16U(depth32, depth_image);
 }
 